@@ -5,14 +5,13 @@
 #include "Engine/World.h"
 #include "RTS_Survival/Behaviours/BehaviourComp.h"
 #include "RTS_Survival/RTSComponents/RTSComponent.h"
+#include "RTS_Survival/Subsystems/AuraSubsystem/RTSAuraSubsystem.h"
 #include "RTS_Survival/Subsystems/RadiusSubsystem/RTSRadiusPoolSubsystem/RTSRadiusPoolSubsystem.h"
-#include "RTS_Survival/Utils/AOE/FRTS_AOE.h"
 #include "RTS_Survival/Utils/HFunctionLibary.h"
 
 UPulseAuraBehaviour::UPulseAuraBehaviour()
 {
 	BehaviourLifeTime = EBehaviourLifeTime::Timed;
-	bM_UsesTick = true;
 }
 
 void UPulseAuraBehaviour::OnAdded(AActor* BehaviourOwner)
@@ -34,10 +33,11 @@ void UPulseAuraBehaviour::OnAdded(AActor* BehaviourOwner)
 	if (UWorld* World = BehaviourOwner->GetWorld())
 	{
 		M_RadiusSubsystem = World->GetSubsystem<URTSRadiusPoolSubsystem>();
+		M_AuraSubsystem = World->GetSubsystem<URTSAuraSubsystem>();
 	}
 
 	ShowAuraRadius();
-	ExecutePulse();
+	RegisterPulseSource();
 }
 
 void UPulseAuraBehaviour::OnRemoved(AActor* BehaviourOwner)
@@ -45,79 +45,89 @@ void UPulseAuraBehaviour::OnRemoved(AActor* BehaviourOwner)
 	Super::OnRemoved(BehaviourOwner);
 
 	HideAuraRadius();
+	UnregisterPulseSource();
 	M_OwningRTSComponent = nullptr;
 	M_RadiusSubsystem = nullptr;
+	M_AuraSubsystem = nullptr;
 	M_OwningActor = nullptr;
-	M_TimeSinceLastPulseSeconds = 0.f;
 	M_OwningPlayer = 0;
 }
 
-void UPulseAuraBehaviour::OnTick(const float DeltaTime)
-{
-	Super::OnTick(DeltaTime);
-
-	if (not GetIsValidOwningActor())
-	{
-		return;
-	}
-
-	RefreshPulseTimer(DeltaTime);
-}
-
 bool UPulseAuraBehaviour::GetShouldApplyToOverlappedActor(const AActor* OverlappedActor) const
 {
 	return IsValid(OverlappedActor);
 }
 
-void UPulseAuraBehaviour::RefreshPulseTimer(const float DeltaTime)
+void UPulseAuraBehaviour::RegisterPulseSource()
 {
-	const float SafePulseIntervalSeconds = FMath::Max(
-		1.f,
-		static_cast<float>(M_PulseAuraSettings.PulseIntervalSeconds));
+	if (not GetIsValidOwningActor() || not GetIsValidAuraSubsystem())
+	{
+		return;
+	}
 
-	M_TimeSinceLastPulseSeconds += DeltaTime;
-	if (M_TimeSinceLastPulseSeconds < SafePulseIntervalSeconds)
+	if (M_PulseAuraSettings.BehavioursToApply.IsEmpty())
 	{
 		return;
 	}
 
-	M_TimeSinceLastPulseSeconds = 0.f;
-	ExecutePulse();
+	FRTSAuraSourceSettings SourceSettings;
+	SourceSettings.SourceActor = M_OwningActor;
+	SourceSettings.EpicenterOffset = M_PulseAuraSettings.RadiusOffset;
+	SourceSettings.Radius = M_PulseAuraSettings.Radius;
+	SourceSettings.IntervalSeconds = FMath::Max(1.f, static_cast<float>(M_PulseAuraSettings.PulseIntervalSeconds));
+	// The first pulse is resolved in the next pass.
+	SourceSettings.FirstResolveDelaySeconds = 0.f;
+	SourceSettings.OverlapLogic = GetResolvedOverlapRule();
+
+	const TWeakObjectPtr<UPulseAuraBehaviour> WeakThis(this);
+	M_AuraSourceId = M_AuraSubsystem->RegisterAuraSource(
+		SourceSettings,
+		[WeakThis](const TArray<AActor*>& UnitsInRadius)
+		{
+			if (not WeakThis.IsValid())
+			{
+				return;
+			}
+
+			WeakThis->OnPulseResolved(UnitsInRadius);
+		});
 }
 
-void UPulseAuraBehaviour::ExecutePulse()
+void UPulseAuraBehaviour::UnregisterPulseSource()
 {
-	if (not GetIsValidOwningActor())
+	if (M_AuraSourceId == INDEX_NONE)
 	{
 		return;
 	}
 
-	if (M_PulseAuraSettings.BehavioursToApply.IsEmpty())
+	if (M_AuraSubsystem.IsValid())
 	{
-		return;
+		M_AuraSubsystem->UnregisterAuraSource(M_AuraSourceId);
 	}
+	M_AuraSourceId = INDEX_NONE;
+}
 
-	const FVector PulseOrigin = M_OwningActor->GetActorLocation() + M_PulseAuraSettings.RadiusOffset;
-	const TWeakObjectPtr<UPulseAuraBehaviour> WeakThis(this);
-	FRTS_AOE::ApplyToActorsAsync(
-		M_OwningActor.Get(),
-		PulseOrigin,
-		M_PulseAuraSettings.Radius,
-		GetResolvedOverlapRule(),
-		[WeakThis](AActor& FoundActor)
+void UPulseAuraBehaviour::OnPulseResolved(const TArray<AActor*>& UnitsInRadius)
+{
+	for (AActor* FoundActor : UnitsInRadius)
+	{
+		if (not GetShouldApplyToOverlappedActor(FoundActor))
 		{
-			if (not WeakThis.IsValid())
-			{
-				return;
-			}
+			continue;
+		}
 
-			if (not WeakThis->GetShouldApplyToOverlappedActor(&FoundActor))
-			{
-				return;
-			}
+		ApplyBehavioursToTargetActor(*FoundActor);
+	}
 
-			WeakThis->ApplyBehavioursToTargetActor(FoundActor);
-		});
+	// The owner may have changed player; the next pulse queries the matching team.
+	if (M_OwningRTSComponent.IsValid())
+	{
+		M_OwningPlayer = M_OwningRTSComponent->GetOwningPlayer();
+	}
+	if (M_AuraSourceId != INDEX_NONE && M_AuraSubsystem.IsValid())
+	{
+		M_AuraSubsystem->SetAuraSourceOverlapLogic(M_AuraSourceId, GetResolvedOverlapRule());
+	}
 }
 
 void UPulseAuraBehaviour::ApplyBehavioursToTargetActor(AActor& TargetActor) const
@@ -224,6 +234,21 @@ bool UPulseAuraBehaviour::GetIsValidOwningRTSComponent() const
 	return false;
 }
 
+bool UPulseAuraBehaviour::GetIsValidAuraSubsystem() const
+{
+	if (M_AuraSubsystem.IsValid())
+	{
+		return true;
+	}
+
+	RTSFunctionLibrary::ReportErrorVariableNotInitialised_Object(
+		this,
+		"M_AuraSubsystem",
+		"GetIsValidAuraSubsystem",
+		this);
+	return false;
+}
+
 bool UPulseAuraBehaviour::GetIsValidRadiusSubsystem() const
 {
 	if (M_RadiusSubsystem.IsValid())
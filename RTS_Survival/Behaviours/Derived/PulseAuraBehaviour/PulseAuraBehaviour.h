@@ -9,6 +9,7 @@
 #include "PulseAuraBehaviour.generated.h"
 
 class UBehaviourComp;
+class URTSAuraSubsystem;
 class URTSComponent;
 class URTSRadiusPoolSubsystem;
 
@@ -29,7 +30,7 @@ struct RTS_SURVIVAL_API FPulseAuraBehaviourSettings
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Pulse Aura")
 	FVector RadiusOffset = FVector::ZeroVector;
 
-	// Interval in seconds between each async pulse overlap check.
+	// Interval in seconds between pulses; pulses are resolved by the aura subsystem.
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Pulse Aura", meta=(ClampMin="1"))
 	int32 PulseIntervalSeconds = 1;
 
@@ -37,13 +38,14 @@ struct RTS_SURVIVAL_API FPulseAuraBehaviourSettings
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Pulse Aura")
 	TArray<TSubclassOf<UBehaviour>> BehavioursToApply;
 
-	// Defines which overlap group we query in the async overlap library.
+	// Defines which team the aura subsystem queries for each pulse.
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Pulse Aura")
 	ETriggerOverlapLogic OverlapRule = ETriggerOverlapLogic::OverlapPlayer;
 };
 
 /**
  * @brief Timed aura behaviour that periodically pulses and applies child behaviours to units inside a radius.
+ * The pulses are registered as a source with the aura subsystem, which resolves them together with all other auras.
  * The aura displays its active radius through the pooled radius subsystem while it is active.
  */
 UCLASS(Blueprintable)
@@ -56,7 +58,6 @@ public:
 
 	virtual void OnAdded(AActor* BehaviourOwner) override;
 	virtual void OnRemoved(AActor* BehaviourOwner) override;
-	virtual void OnTick(float DeltaTime) override;
 
 protected:
 	// Allows derived pulse aura behaviours to provide custom filtering rules per overlapped unit.
@@ -66,8 +67,9 @@ protected:
 	FPulseAuraBehaviourSettings M_PulseAuraSettings;
 
 private:
-	void RefreshPulseTimer(float DeltaTime);
-	void ExecutePulse();
+	void RegisterPulseSource();
+	void UnregisterPulseSource();
+	void OnPulseResolved(const TArray<AActor*>& UnitsInRadius);
 	void ApplyBehavioursToTargetActor(AActor& TargetActor) const;
 	ETriggerOverlapLogic GetResolvedOverlapRule() const;
 	void ShowAuraRadius();
@@ -75,6 +77,7 @@ private:
 	bool GetIsValidOwningActor() const;
 	bool GetIsValidOwningRTSComponent() const;
 	bool GetIsValidRadiusSubsystem() const;
+	bool GetIsValidAuraSubsystem() const;
 
 	UPROPERTY()
 	TWeakObjectPtr<AActor> M_OwningActor;
@@ -85,7 +88,11 @@ private:
 	UPROPERTY()
 	TWeakObjectPtr<URTSRadiusPoolSubsystem> M_RadiusSubsystem;
 
-	float M_TimeSinceLastPulseSeconds = 0.f;
+	UPROPERTY()
+	TWeakObjectPtr<URTSAuraSubsystem> M_AuraSubsystem;
+
+	// Id of the pulse source in the aura subsystem, INDEX_NONE while not registered.
+	int32 M_AuraSourceId = INDEX_NONE;
 	int32 M_AuraRadiusId = INDEX_NONE;
 	uint8 M_OwningPlayer = 0;
 };
@@ -42,14 +42,16 @@ namespace DeveloperSettings
 	{
 		// How often the UGameUnitManager writes data of potential actor targets for weapon systems
 		// to the AsyncGetTargetThread.
-		inline constexpr float GameThreadUpdateAsyncWithActorTargetsInterval = 1.f;
+		// Snapshots are filled in place and handed over through a triple buffer so no maps are copied per update.
+		inline constexpr float GameThreadUpdateAsyncWithActorTargetsInterval = 0.25f;
 
 		// How often the UGameUnitManager writes detailed actor data to the AsyncGetTargetThread.
 		inline constexpr float GameThreadUpdateAsyncWithAllDetailedActorDataInterval = 8.67f;
 
-		// How Long the AsyncGetTargetThread waits before handling new incoming target requests from the game thread.
-		// Increasing this will cause a longer delay on the thread and hence a longer wait for target request to be processed.
-		inline constexpr float AsyncGetTargetThreadUpdateInterval = 0.1f;
+		// The AsyncGetTargetThread sleeps until a request or snapshot arrives. After waking it waits this long so
+		// requests issued in the same frame are handled, and returned to the game thread, as one batch.
+		// Set to 0 to handle every wakeup immediately.
+		inline constexpr float AsyncGetTargetThreadCoalescingWindow = 0.004f;
 
 		// How often the UGameResourceManager writes Resource DropOff Data to the AsyncGetResourceThread.
 		// Decreasing this will keep the async thread more up to date with the game state but
@@ -60,10 +62,13 @@ namespace DeveloperSettings
 		// increases the load on the game thread.
 		inline constexpr float GameThreadUpdateAsyncWithResourcesInterval = 1.25;
 
-		// How long the AsyncGetResourceThread waits before handling new incoming TargetResource and TargetDropOff
-		// requests from the game thread. Increasing this will cause a longer delay on the thread and hence a longer wait for
-		// target request to be processed.
-		inline constexpr float AsyncGetResourceThreadUpdateInterval = 0.25f;
+		// The AsyncGetResourceThread sleeps until a TargetResource or TargetDropOff request or new data arrives.
+		// After waking it waits this long so requests of the same frame are handled as one batch.
+		// Set to 0 to handle every wakeup immediately.
+		inline constexpr float AsyncGetResourceThreadCoalescingWindow = 0.01f;
+
+		// Upper bound on how long an idle async query thread sleeps without being woken; only a safety net.
+		inline constexpr uint32 AsyncQueryThreadMaxIdleWaitMs = 1000;
 	}
 
 	namespace TargetAcquisition
@@ -1648,6 +1653,8 @@ namespace DeveloperSettings
 		{
 			// Projectile pool size for smallarms.
 			inline constexpr int32 SmallArmsProjectilePoolSize = 256;
+			// The small arms pool grows past its initial size up to this many projectiles in flight.
+			inline constexpr int32 SmallArmsProjectilePoolMaxSize = 4096;
 			inline constexpr int32 SmallArmsProjectileSpeed = 7500;
 			// Projectile pool size for tank projectiles.
 			inline constexpr int32 TankProjectilePoolSize = 64;
@@ -1761,6 +1768,14 @@ namespace DeveloperSettings
 		inline static float HoverMouseMoveThreshold = 2.f;
 		// How many pixels (Screen space) the mouse needs to move for dragging logic to be triggered.
 		inline static constexpr float MouseDragThreshold = 2.f;
+		// The cursor is only traced again once the mouse moved this many pixels, the camera this many cm or degrees,
+		// or the hovered actor this many cm since the last trace.
+		inline constexpr float HoverRetraceMouseThreshold = 0.5f;
+		inline constexpr float HoverRetraceCameraMoveThreshold = 1.f;
+		inline constexpr float HoverRetraceCameraRotationThreshold = 0.01f;
+		inline constexpr float HoverRetraceActorMoveThreshold = 2.f;
+		// Max age in seconds of the cached cursor trace, so units moving under a resting cursor are picked up.
+		inline constexpr double HoverMaxCacheAge = 0.1;
 
 
 		namespace TechTree
@@ -1807,6 +1822,17 @@ namespace DeveloperSettings
 		// If a ticking component has 0.f as tick time then this is the tick time used out of Fov far.
 		inline constexpr float ImportantTickCompOutOfFOVFarTickRate = 1.f;
 
+		// How often the optimization subsystem classifies every registered unit against the camera, in seconds.
+		inline constexpr float OptimizerClassificationInterval = 0.25f;
+		// Max FOV bucket transitions applied per frame; the remaining transitions are applied in the next frames.
+		inline constexpr int32 MaxOptimizerTransitionsPerFrame = 16;
+		// Game-thread time a settings change may spend per frame applying itself to registered components, in
+		// seconds; the remaining components are updated in the next frames.
+		inline constexpr double SettingsDispatchBudgetPerFrame = 0.0005;
+		// How often the aura subsystem resolves the aura sources that are due, in seconds. Pulses of sources that
+		// fall in the same step share one unit index; aura intervals are effectively rounded up to this step.
+		inline constexpr float AuraResolveInterval = 0.25f;
+
 		namespace Tank
 		{
 			// For tanks we use the same tick interval in full fov as in close out of fov to ensure smooth rotate towards.
@@ -1869,6 +1895,8 @@ namespace DeveloperSettings
 		// Debug enemy controller
 		constexpr bool GEnemyController_Compile_DebugSymbols = false;
 		constexpr bool GEnemyController_StrategicAI_Compile_DebugSymbols = false;
+		// Logs the strategic AI threat grid every time it is rebuilt from a new detailed snapshot.
+		constexpr bool GEnemyController_StrategicAIThreatGrid_Compile_DebugSymbols = false;
 		constexpr bool GEnemyController_NavDetector_DebugSymbols = false;
 		constexpr bool GEnemyController_DirectControl_Compile_DebugSymbols = false;
 		constexpr bool ExplosionsManager_Compile_DebugSymbols = false;
@@ -1885,6 +1913,8 @@ namespace DeveloperSettings
 		constexpr bool GTargetAimOffsets_Compile_DebugSymbols = false;
 		constexpr bool GTargetAcquisition_Compile_DebugSymbols = false;
 		constexpr bool GAOELibrary_Compile_DebugSymbols = false;
+		// Prints the sources evaluated and queries performed per second by the aura subsystem.
+		constexpr bool GAuraSubsystem_Compile_DebugSymbols = false;
 		// Damage taken on actors
 		constexpr bool GDamage_System_Compile_DebugSymbols = false;
 		// ICommands.
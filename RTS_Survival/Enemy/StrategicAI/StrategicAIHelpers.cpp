@@ -2,6 +2,7 @@
 
 #include "RTS_Survival/Game/GameState/GameUnitManager/AsyncUnitDetailedState/AsyncUnitDetailedState.h"
 #include "RTS_Survival/Enemy/StrategicAI/Requests/StrategicAIRequests.h"
+#include "RTS_Survival/Enemy/StrategicAI/ThreatGrid/StrategicAIThreatGrid.h"
 #include "RTS_Survival/Buildings/BuildingExpansion/BuildingExpansionEnums.h"
 #include "RTS_Survival/Player/Abilities.h"
 #include "RTS_Survival/Units/Enums/Enum_UnitType.h"
@@ -1211,74 +1212,95 @@ FResultEnemyBaseClusters FStrategicAIHelpers::BuildEnemyBaseClustersResult(
 
 namespace StrategicAIHelperUtilities
 {
-	float GetUnitThreatWeight(
-		const FAsyncDetailedUnitState& UnitState,
+	float GetThreatClassWeight(
+		const EStrategicAIThreatClass ThreatClass,
 		const FFindLocationsUnderPlayerAttack& Request)
 	{
-		if (UnitState.UnitType == EAllUnitType::UNType_Squad)
+		switch (ThreatClass)
 		{
+		case EStrategicAIThreatClass::Squad:
 			return Request.SquadThreatScore;
-		}
-
-		if (UnitState.UnitType != EAllUnitType::UNType_Tank)
-		{
-			return 0.f;
-		}
-
-		const ETankSubtype TankSubtype = static_cast<ETankSubtype>(UnitState.UnitSubtypeRaw);
-		if (Global_GetIsArmoredCar(TankSubtype))
-		{
+		case EStrategicAIThreatClass::ArmoredCar:
 			return Request.ArmoredCarThreatScore;
-		}
-		if (Global_GetIsLightTank(TankSubtype))
-		{
+		case EStrategicAIThreatClass::LightTank:
 			return Request.LightTankThreatScore;
-		}
-		if (Global_GetIsMediumTank(TankSubtype))
-		{
+		case EStrategicAIThreatClass::MediumTank:
 			return Request.MediumTankThreatScore;
-		}
-		if (Global_GetIsHeavyTank(TankSubtype))
-		{
+		case EStrategicAIThreatClass::HeavyTank:
 			return Request.HeavyTankThreatScore;
+		default:
+			return 0.f;
 		}
+	}
 
-		return 0.f;
+	float GetUnitThreatWeight(
+		const FAsyncDetailedUnitState& UnitState,
+		const FFindLocationsUnderPlayerAttack& Request)
+	{
+		return GetThreatClassWeight(FStrategicAIThreatGrid::GetThreatClass(UnitState), Request);
 	}
 
 	float GetPlayerBulkWeight(
 		const FAsyncDetailedUnitState& UnitState,
 		const FFindPlayerUnitBulkLocations& Request)
 	{
-		if (UnitState.UnitType == EAllUnitType::UNType_Squad)
+		switch (FStrategicAIThreatGrid::GetThreatClass(UnitState))
 		{
+		case EStrategicAIThreatClass::Squad:
 			return Request.SquadBulkScore;
-		}
-
-		if (UnitState.UnitType != EAllUnitType::UNType_Tank)
-		{
-			return 0.f;
-		}
-
-		const ETankSubtype TankSubtype = static_cast<ETankSubtype>(UnitState.UnitSubtypeRaw);
-		if (Global_GetIsArmoredCar(TankSubtype))
-		{
+		case EStrategicAIThreatClass::ArmoredCar:
 			return Request.ArmoredCarBulkScore;
-		}
-		if (Global_GetIsLightTank(TankSubtype))
-		{
+		case EStrategicAIThreatClass::LightTank:
 			return Request.LightTankBulkScore;
+		case EStrategicAIThreatClass::MediumTank:
+			return Request.MediumTankBulkScore;
+		case EStrategicAIThreatClass::HeavyTank:
+			return Request.HeavyTankBulkScore;
+		default:
+			return 0.f;
 		}
-		if (Global_GetIsMediumTank(TankSubtype))
+	}
+
+	/**
+	 * @brief Upper bound of the final threat score at a location, from the class counts of the overlapping cells.
+	 * Every unit contributes at most its class weight and at most one effective attacker.
+	 * @return False if the location cannot reach the request thresholds and needs no refinement.
+	 */
+	bool GetCanLocationReachThreatThresholds(
+		const FFindLocationsUnderPlayerAttack& Request,
+		const FStrategicAIThreatGrid& ThreatGrid,
+		const FVector& EvaluatedLocation,
+		const float MaxInfluenceRadius,
+		const float MinimumThreatScore,
+		const float MinimumEffectiveAttackerCount,
+		const float GroupAmplifierPerExtraAttacker)
+	{
+		int32 ClassCounts[FStrategicAIThreatGrid::NumThreatClasses];
+		ThreatGrid.GetClassCountsInRadius(EvaluatedLocation, MaxInfluenceRadius, ClassCounts);
+
+		float MaxRawThreatScore = 0.f;
+		float MaxAttackerCount = 0.f;
+		for (int32 ClassIndex = 0; ClassIndex < FStrategicAIThreatGrid::NumThreatClasses; ++ClassIndex)
 		{
-			return Request.MediumTankBulkScore;
+			const float ClassWeight = GetThreatClassWeight(static_cast<EStrategicAIThreatClass>(ClassIndex), Request);
+			if (ClassWeight <= 0.f || ClassCounts[ClassIndex] == 0)
+			{
+				continue;
+			}
+			MaxRawThreatScore += ClassWeight * ClassCounts[ClassIndex];
+			MaxAttackerCount += ClassCounts[ClassIndex];
 		}
-		if (Global_GetIsHeavyTank(TankSubtype))
+		if (MaxRawThreatScore <= 0.f)
 		{
-			return Request.HeavyTankBulkScore;
+			return false;
 		}
 
-		return 0.f;
+		// Small tolerance so float rounding of the exact sums can never reject a location the full scan accepts.
+		constexpr float BoundTolerance = 1.001f;
+		const float MaxGroupAmplifier = 1.f + GroupAmplifierPerExtraAttacker * FMath::Max(0.f, MaxAttackerCount - 1.f);
+		const float MaxFinalThreatScore = MaxRawThreatScore * MaxGroupAmplifier * BoundTolerance;
+		return MaxFinalThreatScore >= MinimumThreatScore
+			&& MaxAttackerCount * BoundTolerance >= MinimumEffectiveAttackerCount;
 	}
 
 	struct FPlayerBulkCandidate
@@ -1295,11 +1317,14 @@ namespace StrategicAIHelperUtilities
 
 	TArray<FPlayerBulkCandidate> GatherPlayerBulkCandidates(
 		const FFindPlayerUnitBulkLocations& Request,
-		const TArray<FAsyncDetailedUnitState>& DetailedUnitStates)
+		const TArray<FAsyncDetailedUnitState>& DetailedUnitStates,
+		TArray<int32>& OutCandidateIndexByUnitIndex)
 	{
 		TArray<FPlayerBulkCandidate> Candidates;
-		for (const FAsyncDetailedUnitState& UnitState : DetailedUnitStates)
+		OutCandidateIndexByUnitIndex.Init(INDEX_NONE, DetailedUnitStates.Num());
+		for (int32 UnitIndex = 0; UnitIndex < DetailedUnitStates.Num(); ++UnitIndex)
 		{
+			const FAsyncDetailedUnitState& UnitState = DetailedUnitStates[UnitIndex];
 			if (UnitState.OwningPlayer != StrategicAIHelperConstants::PlayerOwningId)
 			{
 				continue;
@@ -1315,31 +1340,51 @@ namespace StrategicAIHelperUtilities
 			Candidate.UnitState = &UnitState;
 			Candidate.LocationXY = FVector2D(UnitState.UnitLocation.X, UnitState.UnitLocation.Y);
 			Candidate.Weight = UnitWeight;
-			Candidates.Add(Candidate);
+			OutCandidateIndexByUnitIndex[UnitIndex] = Candidates.Add(Candidate);
 		}
 
 		return Candidates;
 	}
 
+	/** Shared state of the flood fill over the bulk candidates of one request. */
+	struct FPlayerBulkClusterContext
+	{
+		const TArray<FPlayerBulkCandidate>& Candidates;
+		const TArray<int32>& CandidateIndexByUnitIndex;
+		const FStrategicAIThreatGrid& ThreatGrid;
+		float ClusterRadiusXY = 0.f;
+		float ClusterRadiusSq = 0.f;
+		TArray<int32> CandidateLabels;
+		// Reused between neighbour searches.
+		TArray<int32> NearbyUnitIndices;
+	};
+
 	void AddUnassignedNeighborCandidates(
-		const TArray<FPlayerBulkCandidate>& Candidates,
+		FPlayerBulkClusterContext& Context,
 		const int32 SourceCandidateIndex,
-		const float ClusterRadiusSq,
-		TArray<int32>& CandidateLabels,
 		TArray<int32>& Frontier,
 		const int32 ClusterLabel)
 	{
-		for (int32 CandidateIndex = 0; CandidateIndex < Candidates.Num(); ++CandidateIndex)
+		const TArray<FPlayerBulkCandidate>& Candidates = Context.Candidates;
+		TArray<int32>& CandidateLabels = Context.CandidateLabels;
+		const FVector2D& SourceLocation = Candidates[SourceCandidateIndex].LocationXY;
+		Context.ThreatGrid.GatherUnitIndicesInRadius(
+			FVector(SourceLocation.X, SourceLocation.Y, 0.f),
+			Context.ClusterRadiusXY,
+			Context.NearbyUnitIndices);
+
+		// Candidates are gathered in snapshot order, so ascending unit indices visit the neighbours in the
+		// same order as a scan over every candidate and the clusters stay identical.
+		for (const int32 UnitIndex : Context.NearbyUnitIndices)
 		{
-			if (CandidateLabels[CandidateIndex] != INDEX_NONE)
+			const int32 CandidateIndex = Context.CandidateIndexByUnitIndex[UnitIndex];
+			if (CandidateIndex == INDEX_NONE || CandidateLabels[CandidateIndex] != INDEX_NONE)
 			{
 				continue;
 			}
 
-			const float DistanceSq = FVector2D::DistSquared(
-				Candidates[SourceCandidateIndex].LocationXY,
-				Candidates[CandidateIndex].LocationXY);
-			if (DistanceSq > ClusterRadiusSq)
+			const float DistanceSq = FVector2D::DistSquared(SourceLocation, Candidates[CandidateIndex].LocationXY);
+			if (DistanceSq > Context.ClusterRadiusSq)
 			{
 				continue;
 			}
@@ -1350,15 +1395,13 @@ namespace StrategicAIHelperUtilities
 	}
 
 	FPlayerBulkClusterBuilder BuildPlayerBulkCluster(
-		const TArray<FPlayerBulkCandidate>& Candidates,
+		FPlayerBulkClusterContext& Context,
 		const int32 SeedCandidateIndex,
-		const float ClusterRadiusSq,
-		TArray<int32>& CandidateLabels,
 		const int32 ClusterLabel)
 	{
 		FPlayerBulkClusterBuilder Cluster;
 		TArray<int32> Frontier;
-		CandidateLabels[SeedCandidateIndex] = ClusterLabel;
+		Context.CandidateLabels[SeedCandidateIndex] = ClusterLabel;
 		Frontier.Add(SeedCandidateIndex);
 
 		while (not Frontier.IsEmpty())
@@ -1366,13 +1409,7 @@ namespace StrategicAIHelperUtilities
 			const int32 CurrentCandidateIndex = Frontier.Last();
 			Frontier.RemoveAt(Frontier.Num() - 1, 1, false);
 			Cluster.CandidateIndices.Add(CurrentCandidateIndex);
-			AddUnassignedNeighborCandidates(
-				Candidates,
-				CurrentCandidateIndex,
-				ClusterRadiusSq,
-				CandidateLabels,
-				Frontier,
-				ClusterLabel);
+			AddUnassignedNeighborCandidates(Context, CurrentCandidateIndex, Frontier, ClusterLabel);
 		}
 
 		return Cluster;
@@ -1380,6 +1417,8 @@ namespace StrategicAIHelperUtilities
 
 	TArray<FPlayerBulkClusterBuilder> BuildPlayerBulkClusters(
 		const TArray<FPlayerBulkCandidate>& Candidates,
+		const TArray<int32>& CandidateIndexByUnitIndex,
+		const FStrategicAIThreatGrid& ThreatGrid,
 		const float ClusterRadiusXY)
 	{
 		TArray<FPlayerBulkClusterBuilder> Clusters;
@@ -1388,23 +1427,19 @@ namespace StrategicAIHelperUtilities
 			return Clusters;
 		}
 
-		const float ClusterRadiusSq = FMath::Square(FMath::Max(0.f, ClusterRadiusXY));
-		TArray<int32> CandidateLabels;
-		CandidateLabels.Init(INDEX_NONE, Candidates.Num());
+		FPlayerBulkClusterContext Context{Candidates, CandidateIndexByUnitIndex, ThreatGrid};
+		Context.ClusterRadiusXY = FMath::Max(0.f, ClusterRadiusXY);
+		Context.ClusterRadiusSq = FMath::Square(Context.ClusterRadiusXY);
+		Context.CandidateLabels.Init(INDEX_NONE, Candidates.Num());
 		for (int32 CandidateIndex = 0; CandidateIndex < Candidates.Num(); ++CandidateIndex)
 		{
-			if (CandidateLabels[CandidateIndex] != INDEX_NONE)
+			if (Context.CandidateLabels[CandidateIndex] != INDEX_NONE)
 			{
 				continue;
 			}
 
 			const int32 ClusterLabel = Clusters.Num();
-			Clusters.Add(BuildPlayerBulkCluster(
-				Candidates,
-				CandidateIndex,
-				ClusterRadiusSq,
-				CandidateLabels,
-				ClusterLabel));
+			Clusters.Add(BuildPlayerBulkCluster(Context, CandidateIndex, ClusterLabel));
 		}
 
 		return Clusters;
@@ -1908,7 +1943,8 @@ namespace StrategicAIHelperUtilities
 
 FResultLocationsUnderPlayerAttack FStrategicAIHelpers::BuildLocationsUnderPlayerAttackResult(
 	const FFindLocationsUnderPlayerAttack& Request,
-	const TArray<FAsyncDetailedUnitState>& DetailedUnitStates)
+	const TArray<FAsyncDetailedUnitState>& DetailedUnitStates,
+	const FStrategicAIThreatGrid& ThreatGrid)
 {
 	FResultLocationsUnderPlayerAttack Result;
 	Result.RequestID = Request.RequestID;
@@ -1930,21 +1966,27 @@ FResultLocationsUnderPlayerAttack FStrategicAIHelpers::BuildLocationsUnderPlayer
 	const float GroupAmplifierPerExtraAttacker = FMath::Max(0.f, Request.GroupAmplifierPerExtraEffectiveAttacker);
 	const float InverseMaxInfluenceRadius = 1.f / MaxInfluenceRadius;
 
+	TArray<int32> NearbyUnitIndices;
 	for (const FVector& EvaluatedLocation : Request.LocationsToEvaluate)
 	{
+		if (not StrategicAIHelperUtilities::GetCanLocationReachThreatThresholds(
+			Request, ThreatGrid, EvaluatedLocation, MaxInfluenceRadius, MinimumThreatScore,
+			MinimumEffectiveAttackerCount, GroupAmplifierPerExtraAttacker))
+		{
+			continue;
+		}
+
 		float RawThreatScore = 0.f;
 		float WeightedAttackerCount = 0.f;
 		float WeightedDistanceSum = 0.f;
 		FVector WeightedLocationSum = FVector::ZeroVector;
 		TArray<TWeakObjectPtr<AActor>> ContributingAttackerActors;
 
-		for (const FAsyncDetailedUnitState& UnitState : DetailedUnitStates)
+		// Only player units with a threat class are indexed; ascending indices keep the sums in snapshot order.
+		ThreatGrid.GatherUnitIndicesInRadius(EvaluatedLocation, MaxInfluenceRadius, NearbyUnitIndices);
+		for (const int32 UnitIndex : NearbyUnitIndices)
 		{
-			if (UnitState.OwningPlayer != StrategicAIHelperConstants::PlayerOwningId)
-			{
-				continue;
-			}
-
+			const FAsyncDetailedUnitState& UnitState = DetailedUnitStates[UnitIndex];
 			const float UnitThreatWeight = StrategicAIHelperUtilities::GetUnitThreatWeight(UnitState, Request);
 			if (UnitThreatWeight <= 0.f)
 			{
@@ -2001,15 +2043,18 @@ FResultLocationsUnderPlayerAttack FStrategicAIHelpers::BuildLocationsUnderPlayer
 
 FResultPlayerUnitBulkLocations FStrategicAIHelpers::BuildPlayerUnitBulkLocationsResult(
 	const FFindPlayerUnitBulkLocations& Request,
-	const TArray<FAsyncDetailedUnitState>& DetailedUnitStates)
+	const TArray<FAsyncDetailedUnitState>& DetailedUnitStates,
+	const FStrategicAIThreatGrid& ThreatGrid)
 {
 	FResultPlayerUnitBulkLocations Result;
 	Result.RequestID = Request.RequestID;
 
+	TArray<int32> CandidateIndexByUnitIndex;
 	const TArray<StrategicAIHelperUtilities::FPlayerBulkCandidate> Candidates =
-		StrategicAIHelperUtilities::GatherPlayerBulkCandidates(Request, DetailedUnitStates);
+		StrategicAIHelperUtilities::GatherPlayerBulkCandidates(Request, DetailedUnitStates, CandidateIndexByUnitIndex);
 	const TArray<StrategicAIHelperUtilities::FPlayerBulkClusterBuilder> Clusters =
-		StrategicAIHelperUtilities::BuildPlayerBulkClusters(Candidates, Request.ClusterRadiusXY);
+		StrategicAIHelperUtilities::BuildPlayerBulkClusters(
+			Candidates, CandidateIndexByUnitIndex, ThreatGrid, Request.ClusterRadiusXY);
 
 	for (const StrategicAIHelperUtilities::FPlayerBulkClusterBuilder& Cluster : Clusters)
 	{
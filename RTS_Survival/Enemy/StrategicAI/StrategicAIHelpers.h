@@ -21,6 +21,7 @@ struct FFindMineLocations;
 struct FResultMineLocations;
 struct FEnemyBasePointCoreBuildings;
 struct FEnemyBasePointSatelliteBuildings;
+class FStrategicAIThreatGrid;
 
 namespace FStrategicAIHelpers
 {
@@ -107,19 +108,29 @@ namespace FStrategicAIHelpers
 		const FFindEnemyBaseClusters& Request,
 		const TArray<FAsyncDetailedUnitState>& DetailedUnitStates);
 
+	/**
+	 * @brief Scores each evaluated location by the weighted player threat within the influence radius.
+	 * @param Request Locations to evaluate with the per-subtype threat scores and acceptance thresholds.
+	 * @param DetailedUnitStates Unit snapshot data the threat grid was built from.
+	 * @param ThreatGrid Grid over the same snapshot; rejects locations without enough threat in range.
+	 * @return Result payload containing the locations considered under attack.
+	 */
 	FResultLocationsUnderPlayerAttack BuildLocationsUnderPlayerAttackResult(
 		const FFindLocationsUnderPlayerAttack& Request,
-		const TArray<FAsyncDetailedUnitState>& DetailedUnitStates);
+		const TArray<FAsyncDetailedUnitState>& DetailedUnitStates,
+		const FStrategicAIThreatGrid& ThreatGrid);
 
 	/**
 	 * @brief Finds player mobile-combat concentrations so strategy can pick macro pressure points.
 	 * @param Request Clustering parameters and unit weights used to accept meaningful bulks.
 	 * @param DetailedUnitStates Unit snapshot data to cluster.
+	 * @param ThreatGrid Grid over the same snapshot, used to find the neighbours of each clustered unit.
 	 * @return Result payload containing accepted squad/tank bulk locations.
 	 */
 	FResultPlayerUnitBulkLocations BuildPlayerUnitBulkLocationsResult(
 		const FFindPlayerUnitBulkLocations& Request,
-		const TArray<FAsyncDetailedUnitState>& DetailedUnitStates);
+		const TArray<FAsyncDetailedUnitState>& DetailedUnitStates,
+		const FStrategicAIThreatGrid& ThreatGrid);
 	/**
 	 * @brief Builds cleaned construction locations while keeping new field builds outside known enemy bases.
 	 * @param Request Defense anchors, player bulk locations, and arc cleanup settings.
@@ -0,0 +1,247 @@
+#include "StrategicAIThreatGrid.h"
+
+#include "RTS_Survival/Game/GameState/GameUnitManager/AsyncUnitDetailedState/AsyncUnitDetailedState.h"
+#include "RTS_Survival/Units/Enums/Enum_UnitType.h"
+
+namespace StrategicAIThreatGridConstants
+{
+	constexpr int32 PlayerOwningId = 1;
+	// Close to the typical influence and cluster radii so a query touches a 3x3 block of cells.
+	constexpr double PreferredCellSize = 2000.0;
+	// Caps the offset tables; very spread out armies get larger cells instead.
+	constexpr int32 MaxCellsPerAxis = 128;
+}
+
+FStrategicAIThreatGrid::FStrategicAIThreatGrid()
+	: M_Origin(FVector2D::ZeroVector)
+	  , M_CellSize(StrategicAIThreatGridConstants::PreferredCellSize)
+	  , M_CellsX(0)
+	  , M_CellsY(0)
+{
+}
+
+EStrategicAIThreatClass FStrategicAIThreatGrid::GetThreatClass(const FAsyncDetailedUnitState& UnitState)
+{
+	if (UnitState.UnitType == EAllUnitType::UNType_Squad)
+	{
+		return EStrategicAIThreatClass::Squad;
+	}
+
+	if (UnitState.UnitType != EAllUnitType::UNType_Tank)
+	{
+		return EStrategicAIThreatClass::None;
+	}
+
+	const ETankSubtype TankSubtype = static_cast<ETankSubtype>(UnitState.UnitSubtypeRaw);
+	if (Global_GetIsArmoredCar(TankSubtype))
+	{
+		return EStrategicAIThreatClass::ArmoredCar;
+	}
+	if (Global_GetIsLightTank(TankSubtype))
+	{
+		return EStrategicAIThreatClass::LightTank;
+	}
+	if (Global_GetIsMediumTank(TankSubtype))
+	{
+		return EStrategicAIThreatClass::MediumTank;
+	}
+	if (Global_GetIsHeavyTank(TankSubtype))
+	{
+		return EStrategicAIThreatClass::HeavyTank;
+	}
+
+	return EStrategicAIThreatClass::None;
+}
+
+void FStrategicAIThreatGrid::Rebuild(const TArray<FAsyncDetailedUnitState>& DetailedUnitStates)
+{
+	M_CellStarts.Reset();
+	M_UnitIndices.Reset();
+	M_CellClassCounts.Reset();
+	M_UnitCellIndices.Reset();
+
+	FBox2D Bounds(ForceInit);
+	int32 NumIndexedUnits = 0;
+	for (const FAsyncDetailedUnitState& UnitState : DetailedUnitStates)
+	{
+		if (UnitState.OwningPlayer != StrategicAIThreatGridConstants::PlayerOwningId
+			|| GetThreatClass(UnitState) == EStrategicAIThreatClass::None)
+		{
+			continue;
+		}
+		Bounds += FVector2D(UnitState.UnitLocation);
+		++NumIndexedUnits;
+	}
+	if (NumIndexedUnits == 0)
+	{
+		M_CellsX = 0;
+		M_CellsY = 0;
+		return;
+	}
+
+	const FVector2D Extent = Bounds.Max - Bounds.Min;
+	const double LargestAxis = FMath::Max(Extent.X, Extent.Y);
+	M_CellSize = FMath::Max(
+		StrategicAIThreatGridConstants::PreferredCellSize,
+		LargestAxis / StrategicAIThreatGridConstants::MaxCellsPerAxis);
+	M_Origin = Bounds.Min;
+	M_CellsX = FMath::Clamp(FMath::FloorToInt32(Extent.X / M_CellSize) + 1, 1,
+	                        StrategicAIThreatGridConstants::MaxCellsPerAxis);
+	M_CellsY = FMath::Clamp(FMath::FloorToInt32(Extent.Y / M_CellSize) + 1, 1,
+	                        StrategicAIThreatGridConstants::MaxCellsPerAxis);
+	const int32 NumCells = M_CellsX * M_CellsY;
+
+	// Counting sort: count units per cell, prefix-sum into offsets, then scatter in snapshot order so every
+	// cell lists its units by ascending snapshot index.
+	M_CellStarts.SetNumZeroed(NumCells + 1);
+	M_CellClassCounts.SetNumZeroed(NumCells * NumThreatClasses);
+	M_UnitCellIndices.Init(INDEX_NONE, DetailedUnitStates.Num());
+	for (int32 UnitIndex = 0; UnitIndex < DetailedUnitStates.Num(); ++UnitIndex)
+	{
+		const FAsyncDetailedUnitState& UnitState = DetailedUnitStates[UnitIndex];
+		if (UnitState.OwningPlayer != StrategicAIThreatGridConstants::PlayerOwningId)
+		{
+			continue;
+		}
+		const EStrategicAIThreatClass ThreatClass = GetThreatClass(UnitState);
+		if (ThreatClass == EStrategicAIThreatClass::None)
+		{
+			continue;
+		}
+
+		const int32 CellIndex = GetCellIndex(UnitState.UnitLocation);
+		M_UnitCellIndices[UnitIndex] = CellIndex;
+		++M_CellStarts[CellIndex + 1];
+		++M_CellClassCounts[CellIndex * NumThreatClasses + static_cast<int32>(ThreatClass)];
+	}
+	for (int32 CellIndex = 1; CellIndex <= NumCells; ++CellIndex)
+	{
+		M_CellStarts[CellIndex] += M_CellStarts[CellIndex - 1];
+	}
+
+	M_UnitIndices.SetNumUninitialized(NumIndexedUnits);
+	M_WriteCursors = M_CellStarts;
+	for (int32 UnitIndex = 0; UnitIndex < M_UnitCellIndices.Num(); ++UnitIndex)
+	{
+		const int32 CellIndex = M_UnitCellIndices[UnitIndex];
+		if (CellIndex == INDEX_NONE)
+		{
+			continue;
+		}
+		M_UnitIndices[M_WriteCursors[CellIndex]++] = UnitIndex;
+	}
+}
+
+void FStrategicAIThreatGrid::GetClassCountsInRadius(
+	const FVector& Center,
+	const float Radius,
+	int32 (&OutClassCounts)[NumThreatClasses]) const
+{
+	for (int32& ClassCount : OutClassCounts)
+	{
+		ClassCount = 0;
+	}
+
+	FIntPoint MinCell;
+	FIntPoint MaxCell;
+	if (not GetCellRange(Center, Radius, MinCell, MaxCell))
+	{
+		return;
+	}
+
+	for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; ++CellY)
+	{
+		for (int32 CellX = MinCell.X; CellX <= MaxCell.X; ++CellX)
+		{
+			const int32 CountsStart = (CellY * M_CellsX + CellX) * NumThreatClasses;
+			for (int32 ClassIndex = 0; ClassIndex < NumThreatClasses; ++ClassIndex)
+			{
+				OutClassCounts[ClassIndex] += M_CellClassCounts[CountsStart + ClassIndex];
+			}
+		}
+	}
+}
+
+void FStrategicAIThreatGrid::GatherUnitIndicesInRadius(
+	const FVector& Center,
+	const float Radius,
+	TArray<int32>& OutUnitIndices) const
+{
+	OutUnitIndices.Reset();
+
+	FIntPoint MinCell;
+	FIntPoint MaxCell;
+	if (not GetCellRange(Center, Radius, MinCell, MaxCell))
+	{
+		return;
+	}
+
+	for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; ++CellY)
+	{
+		// Cells of one row are contiguous, so copy the row as a single span.
+		const int32 RowStart = CellY * M_CellsX;
+		const int32 SpanStart = M_CellStarts[RowStart + MinCell.X];
+		const int32 SpanEnd = M_CellStarts[RowStart + MaxCell.X + 1];
+		OutUnitIndices.Append(M_UnitIndices.GetData() + SpanStart, SpanEnd - SpanStart);
+	}
+
+	// Callers accumulate in snapshot order to match a full scan of the snapshot exactly.
+	OutUnitIndices.Sort();
+}
+
+FString FStrategicAIThreatGrid::BuildDebugString() const
+{
+	FString DebugString = FString::Printf(
+		TEXT("Strategic AI threat grid: %d units, %dx%d cells of %.0f at (%.0f, %.0f)"),
+		Num(), M_CellsX, M_CellsY, M_CellSize, M_Origin.X, M_Origin.Y);
+	for (int32 CellIndex = 0; CellIndex < M_CellsX * M_CellsY; ++CellIndex)
+	{
+		if (M_CellStarts[CellIndex] == M_CellStarts[CellIndex + 1])
+		{
+			continue;
+		}
+
+		const int32* ClassCounts = &M_CellClassCounts[CellIndex * NumThreatClasses];
+		DebugString += FString::Printf(
+			TEXT("\n  cell (%d, %d): squads %d, armored cars %d, light %d, medium %d, heavy %d"),
+			CellIndex % M_CellsX, CellIndex / M_CellsX,
+			ClassCounts[static_cast<int32>(EStrategicAIThreatClass::Squad)],
+			ClassCounts[static_cast<int32>(EStrategicAIThreatClass::ArmoredCar)],
+			ClassCounts[static_cast<int32>(EStrategicAIThreatClass::LightTank)],
+			ClassCounts[static_cast<int32>(EStrategicAIThreatClass::MediumTank)],
+			ClassCounts[static_cast<int32>(EStrategicAIThreatClass::HeavyTank)]);
+	}
+	return DebugString;
+}
+
+int32 FStrategicAIThreatGrid::GetCellIndex(const FVector& Location) const
+{
+	const int32 CellX = FMath::Clamp(FMath::FloorToInt32((Location.X - M_Origin.X) / M_CellSize), 0, M_CellsX - 1);
+	const int32 CellY = FMath::Clamp(FMath::FloorToInt32((Location.Y - M_Origin.Y) / M_CellSize), 0, M_CellsY - 1);
+	return CellY * M_CellsX + CellX;
+}
+
+bool FStrategicAIThreatGrid::GetCellRange(
+	const FVector& Center,
+	const float Radius,
+	FIntPoint& OutMinCell,
+	FIntPoint& OutMaxCell) const
+{
+	if (M_UnitIndices.IsEmpty() || Radius < 0.f)
+	{
+		return false;
+	}
+
+	const int32 MinX = FMath::FloorToInt32((Center.X - Radius - M_Origin.X) / M_CellSize);
+	const int32 MinY = FMath::FloorToInt32((Center.Y - Radius - M_Origin.Y) / M_CellSize);
+	const int32 MaxX = FMath::FloorToInt32((Center.X + Radius - M_Origin.X) / M_CellSize);
+	const int32 MaxY = FMath::FloorToInt32((Center.Y + Radius - M_Origin.Y) / M_CellSize);
+	if (MaxX < 0 || MaxY < 0 || MinX >= M_CellsX || MinY >= M_CellsY)
+	{
+		return false;
+	}
+
+	OutMinCell = FIntPoint(FMath::Max(0, MinX), FMath::Max(0, MinY));
+	OutMaxCell = FIntPoint(FMath::Min(M_CellsX - 1, MaxX), FMath::Min(M_CellsY - 1, MaxY));
+	return true;
+}
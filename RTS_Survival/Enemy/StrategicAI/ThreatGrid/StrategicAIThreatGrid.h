@@ -0,0 +1,85 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FAsyncDetailedUnitState;
+
+/** Player unit classes the strategic AI requests weigh with their own per-subtype scores. */
+enum class EStrategicAIThreatClass : uint8
+{
+	Squad,
+	ArmoredCar,
+	LightTank,
+	MediumTank,
+	HeavyTank,
+	// Not weighted by any request and not indexed in the grid.
+	None
+};
+
+/**
+ * @brief Flat uniform grid over the player units of one detailed snapshot, with per-cell counts per threat class.
+ * Rebuilt once per snapshot on the async target thread. Requests apply their own class weights to the cell counts
+ * to reject locations without enough threat in range, and only refine against the units of overlapping cells.
+ * @note Rebuilt by a single thread; the const queries are safe to run from parallel strategic AI work items.
+ */
+class FStrategicAIThreatGrid
+{
+public:
+	static constexpr int32 NumThreatClasses = static_cast<int32>(EStrategicAIThreatClass::None);
+
+	FStrategicAIThreatGrid();
+
+	/** @return The threat class of the unit; squads and the four tank families, None for everything else. */
+	static EStrategicAIThreatClass GetThreatClass(const FAsyncDetailedUnitState& UnitState);
+
+	/**
+	 * @brief Rebuilds the grid from the player units of a snapshot, previous contents are discarded.
+	 * @param DetailedUnitStates Latest detailed snapshot; the grid stores indices into this array.
+	 */
+	void Rebuild(const TArray<FAsyncDetailedUnitState>& DetailedUnitStates);
+
+	/**
+	 * @brief Sums the class counts of every cell the XY circle overlaps.
+	 * The sums are an upper bound of the indexed units within the radius.
+	 * @param Center Center of the query circle, Z is ignored.
+	 * @param Radius Radius of the query circle.
+	 * @param OutClassCounts Overwritten with the unit count per threat class.
+	 */
+	void GetClassCountsInRadius(const FVector& Center, const float Radius,
+	                            int32 (&OutClassCounts)[NumThreatClasses]) const;
+
+	/**
+	 * @brief Collects the snapshot indices of the indexed units in every cell the XY circle overlaps.
+	 * Callers still have to test the exact distance of each unit.
+	 * @param Center Center of the query circle, Z is ignored.
+	 * @param Radius Radius of the query circle.
+	 * @param OutUnitIndices Reset and filled with ascending snapshot indices.
+	 */
+	void GatherUnitIndicesInRadius(const FVector& Center, const float Radius, TArray<int32>& OutUnitIndices) const;
+
+	int32 Num() const { return M_UnitIndices.Num(); }
+
+	/** @return Multi-line dump of the grid bounds and every non-empty cell with its class counts. */
+	FString BuildDebugString() const;
+
+private:
+	FVector2D M_Origin;
+	double M_CellSize;
+	int32 M_CellsX;
+	int32 M_CellsY;
+
+	// Units sorted by cell; the units of cell C are M_UnitIndices[M_CellStarts[C] .. M_CellStarts[C + 1]).
+	TArray<int32> M_CellStarts;
+	TArray<int32> M_UnitIndices;
+	// NumThreatClasses counts per cell, laid out cell by cell.
+	TArray<int32> M_CellClassCounts;
+
+	// Reused between rebuilds to avoid allocating per snapshot.
+	TArray<int32> M_WriteCursors;
+	TArray<int32> M_UnitCellIndices;
+
+	int32 GetCellIndex(const FVector& Location) const;
+
+	/** @return False if the circle does not overlap the grid at all. */
+	bool GetCellRange(const FVector& Center, const float Radius, FIntPoint& OutMinCell, FIntPoint& OutMaxCell) const;
+};
@@ -9,10 +9,17 @@
 #include "Engine/World.h"
 #include "Engine/AssetManager.h"
 #include "Engine/DamageEvents.h"
+#include "Engine/StaticMesh.h"
 #include "RTS_Survival/DeveloperSettings.h"
 #include "RTS_Survival/Environment/InstanceHelpers/FRTSInstanceHelpers.h"
 #include "RTS_Survival/Utils/HFunctionLibary.h"
 
+namespace InstancedDestrucablesEnvActorConstants
+{
+	// Slack on top of the instance bounds for hit locations reported just outside the mesh.
+	constexpr float HitDistanceTolerance = 50.f;
+}
+
 AInstancedDestrucablesEnvActor::AInstancedDestrucablesEnvActor(const FObjectInitializer& ObjectInitializer)
 	: ADestructableEnvActor(ObjectInitializer),
 	  CollapseFX(nullptr),
@@ -72,16 +79,40 @@ void AInstancedDestrucablesEnvActor::PostInitializeComponents()
 	{
 		const int32 NumInstances = InstancedMeshComponent->GetInstanceCount();
 		M_Health.SetNum(NumInstances);
+		TArray<FVector> InstanceLocations;
+		InstanceLocations.Reserve(NumInstances);
+		double MaxInstanceScale = 0.0;
 		for (int32 i = 0; i < NumInstances; ++i)
 		{
 			M_Health[i] = HealthPerInstance;
 			FTransform InstanceTransform;
 			InstancedMeshComponent->GetInstanceTransform(i, InstanceTransform, true);
-			M_InstanceLocations.Add(InstanceTransform.GetLocation());
+			InstanceLocations.Add(InstanceTransform.GetLocation());
+			MaxInstanceScale = FMath::Max(MaxInstanceScale, InstanceTransform.GetMaximumAxisScale());
 		}
+		// Instances never move while intact, so the index is built once.
+		M_InstanceIndex.Build(InstanceLocations);
+		InitMaxHitDistance(MaxInstanceScale);
 	}
 }
 
+void AInstancedDestrucablesEnvActor::InitMaxHitDistance(const double MaxInstanceScale)
+{
+	const UStaticMesh* const InstanceMesh = InstancedMeshComponent->GetStaticMesh();
+	if (not IsValid(InstanceMesh))
+	{
+		RTSFunctionLibrary::ReportError("Instanced destructable has no static mesh to bound its hits: " + GetName()
+			+ "\n Hits on it are applied to the closest instance at any distance.");
+		M_MaxHitDistance = TNumericLimits<float>::Max();
+		return;
+	}
+
+	// Farthest a point of the mesh can lie from its instance location, for the largest instance.
+	const FBoxSphereBounds MeshBounds = InstanceMesh->GetBounds();
+	M_MaxHitDistance = (MeshBounds.Origin.Size() + MeshBounds.SphereRadius) * MaxInstanceScale
+		+ InstancedDestrucablesEnvActorConstants::HitDistanceTolerance;
+}
+
 void AInstancedDestrucablesEnvActor::SetupHierarchicalInstanceBox(UInstancedStaticMeshComponent* InstStaticMesh,
                                                                   const FVector2D BoxBounds, const float DistanceBetweenInstances)
 {
@@ -111,39 +142,22 @@ float AInstancedDestrucablesEnvActor::TakeDamage(float DamageAmount, FDamageEven
 		return 1.f;
 	}
 
-	const FHitResult& Hit = PointDamageEvent->HitInfo;
-
-	// Prepare call back for the closest instance.
-	TWeakObjectPtr<AInstancedDestrucablesEnvActor> WeakThis(this);
-	auto OnFoundClosest = [WeakThis, DamageAmount](const int Index)-> void
+	M_PendingHits.Add(FPendingInstanceHit{PointDamageEvent->HitInfo.Location, DamageAmount});
+	if (bM_IsApplyPendingHitsScheduled)
 	{
-		if (WeakThis.IsValid())
-		{
-			WeakThis->OnFoundClosestInstance(Index, DamageAmount);
-		}
-	};
+		return DamageAmount;
+	}
 
-	auto Locations = M_InstanceLocations;
-	const FVector HitLocation = Hit.Location;
-	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [WeakThis, OnFoundClosest, Locations, HitLocation]()-> void
+	UWorld* World = GetWorld();
+	if (not IsValid(World))
 	{
-		// find the index of the closest location to HitLocation in the provided Locations.
-		int32 ClosestIndex = 0;
-		float ClosestDistance = FVector::DistSquared(HitLocation, Locations[0]);
-		for (int32 i = 1; i < Locations.Num(); ++i)
-		{
-			const float Distance = FVector::DistSquared(HitLocation, Locations[i]);
-			if (Distance < ClosestDistance)
-			{
-				ClosestIndex = i;
-				ClosestDistance = Distance;
-			}
-		}
-		AsyncTask(ENamedThreads::GameThread, [OnFoundClosest, ClosestIndex]()
-		{
-			OnFoundClosest(ClosestIndex);
-		});
-	});
+		M_PendingHits.Reset();
+		return DamageAmount;
+	}
+
+	bM_IsApplyPendingHitsScheduled = true;
+	World->GetTimerManager().SetTimerForNextTick(
+		FTimerDelegate::CreateUObject(this, &AInstancedDestrucablesEnvActor::ApplyPendingHits));
 	return DamageAmount;
 }
 
@@ -164,7 +178,7 @@ void AInstancedDestrucablesEnvActor::OnInstanceDestroyed(const int32 InstanceInd
 		FRotator::ZeroRotator, FVector(0, 0, -500), FVector::OneVector);
 	NewInstanceTransform.Rotator().Normalize();
 	// Remove the intact instance.
-	if (not InstancedMeshComponent->UpdateInstanceTransform(InstanceIndex, NewInstanceTransform, true, true, true))
+	if (not InstancedMeshComponent->UpdateInstanceTransform(InstanceIndex, NewInstanceTransform, true, false, true))
 	{
 		RTSFunctionLibrary::ReportError(
 			"Could not move instance on (H)ISM component, a function AInstancedDestructablesEnvActor"
@@ -175,7 +189,6 @@ void AInstancedDestrucablesEnvActor::OnInstanceDestroyed(const int32 InstanceInd
 	{
 		InstanceTransform.SetLocation(InstanceTransform.GetLocation() + FVector(0,0,ZOffsetForDestroyedMesh));
 		M_DestroyedMeshComponent->AddInstance(InstanceTransform);
-		M_DestroyedMeshComponent->MarkRenderStateDirty();
 	}
 	else
 	{
@@ -231,37 +244,62 @@ void AInstancedDestrucablesEnvActor::AsyncLoadDestroyedMesh()
 	}));
 }
 
-void AInstancedDestrucablesEnvActor::OnFoundClosestInstance(const int32 InstanceIndex, const float DamageToDeal)
+void AInstancedDestrucablesEnvActor::ApplyPendingHits()
 {
+	bM_IsApplyPendingHitsScheduled = false;
 	if (not IsValid(InstancedMeshComponent))
 	{
+		M_PendingHits.Reset();
 		return;
 	}
-	if (InstanceIndex < 0 or InstanceIndex >= M_Health.Num() || not M_Health.IsValidIndex(InstanceIndex))
+
+	// Hits resolve in arrival order, so a hit after the one that destroyed an instance goes to its closest neighbour.
+	// A hit with no standing instance within reach is dropped instead of damaging one further down the line.
+	bool bDestroyedAny = false;
+	for (const FPendingInstanceHit& PendingHit : M_PendingHits)
 	{
-		RTSFunctionLibrary::ReportError("Invalid instance index found: " + FString::FromInt(InstanceIndex) +
-			"\n could also be invalid on cached health array which has size: " + FString::FromInt(M_Health.Num()) +
-			"\n Will not adjust health of any instance on : " + GetName());
-		return;
+		const int32 InstanceIndex = M_InstanceIndex.FindClosestInstance(PendingHit.HitLocation, M_MaxHitDistance);
+		if (InstanceIndex == INDEX_NONE)
+		{
+			continue;
+		}
+		bDestroyedAny |= ApplyDamageToInstance(InstanceIndex, PendingHit.Damage);
 	}
-	
-	if(M_Health[InstanceIndex] <= 0)
+	M_PendingHits.Reset();
+
+	if (bDestroyedAny)
 	{
-		if constexpr (DeveloperSettings::Debugging::GDestructableActors_Compile_DebugSymbols)
+		InstancedMeshComponent->MarkRenderStateDirty();
+		if (IsValid(M_DestroyedMeshComponent))
 		{
-				RTSFunctionLibrary::PrintString("Instance already destroyed: " + GetName() + " at index: " + FString::FromInt(InstanceIndex));
-			return;
+			M_DestroyedMeshComponent->MarkRenderStateDirty();
 		}
 	}
-	M_Health[InstanceIndex] -= DamageToDeal;
-	if(M_Health[InstanceIndex] <= 0)
+}
+
+bool AInstancedDestrucablesEnvActor::ApplyDamageToInstance(const int32 InstanceIndex, const float DamageToDeal)
+{
+	if (not M_Health.IsValidIndex(InstanceIndex))
 	{
-		OnInstanceDestroyed(InstanceIndex);
+		RTSFunctionLibrary::ReportError("Invalid instance index found: " + FString::FromInt(InstanceIndex) +
+			"\n could also be invalid on cached health array which has size: " + FString::FromInt(M_Health.Num()) +
+			"\n Will not adjust health of any instance on : " + GetName());
+		return false;
 	}
+
+	M_Health[InstanceIndex] -= DamageToDeal;
 	if constexpr (DeveloperSettings::Debugging::GDestructableActors_Compile_DebugSymbols)
 	{
 		RTSFunctionLibrary::PrintString("Damage taken for actor: " + GetName() +
 			"\n at Instance Index: " + FString::FromInt(InstanceIndex));
 	}
-	
+	if (M_Health[InstanceIndex] > 0)
+	{
+		return false;
+	}
+
+	// Removed from the index so later hits land on the closest instance that is still standing.
+	M_InstanceIndex.RemoveInstance(InstanceIndex);
+	OnInstanceDestroyed(InstanceIndex);
+	return true;
 }
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "RTS_Survival/Environment/DestructableEnvActor/DestructableEnvActor.h"
+#include "RTS_Survival/Environment/InstanceHelpers/FRTSInstanceSpatialIndex.h"
 #include "InstancedDestrucablesEnvActor.generated.h"
 
 struct FRTSRoadInstanceSetup;
@@ -30,8 +31,8 @@ public:
 	// Sets default values for this actor's properties
 	AInstancedDestrucablesEnvActor(const FObjectInitializer& ObjectInitializer);
 
-	// Casts the damage event to point and uses async programming to find the closest instance transform to the location
-	// of the hit. Then will process damage and or spawning a destroyed instance on the game thread.
+	// Casts the damage event to point and queues the hit; all hits of a frame are applied together next tick, each to
+	// the closest instance that is not destroyed yet.
 	virtual float TakeDamage(float DamageAmount, FDamageEvent const& DamageEvent, AController* EventInstigator, AActor* DamageCauser) override;
 
 protected:
@@ -87,21 +88,43 @@ protected:
 	FVector FXOffset = FVector::ZeroVector;
 
 private:
+	struct FPendingInstanceHit
+	{
+		FVector HitLocation = FVector::ZeroVector;
+		float Damage = 0.f;
+	};
+
 	// Keeps track of the health per instance.
 	TArray<float> M_Health;
-	
-	// keeps track of the location for each instance.
-	TArray<FVector> M_InstanceLocations;
+
+	// Nearest-instance lookup over the instance locations; destroyed instances are removed from it.
+	FRTSInstanceSpatialIndex M_InstanceIndex;
+
+	// Hits farther than this from every standing instance are dropped; derived from the mesh bounds.
+	float M_MaxHitDistance = 0.f;
+
+	// Hits taken this frame, applied together by ApplyPendingHits.
+	TArray<FPendingInstanceHit> M_PendingHits;
+	bool bM_IsApplyPendingHitsScheduled = false;
 
 	// Instanced mesh component for destroyed meshes.
 	TObjectPtr<UInstancedStaticMeshComponent> M_DestroyedMeshComponent;
 
-	/** @brief spawns a destroyed mesh instance on the transform of the regular instance that has no health left */
+	/** @brief Sets M_MaxHitDistance from the bounds of the instance mesh at the largest instance scale. */
+	void InitMaxHitDistance(const double MaxInstanceScale);
+
+	/**
+	 * @brief spawns a destroyed mesh instance on the transform of the regular instance that has no health left
+	 * @note Does not mark render state dirty; ApplyPendingHits does so once per batch.
+	 */
 	void OnInstanceDestroyed(int32 InstanceIndex) const;
 
 	// loads the destroyed mesh and sets it on the destroyed mesh component.
 	void AsyncLoadDestroyedMesh();
 
-	void OnFoundClosestInstance(const int32 InstanceIndex, const float DamageToDeal);
+	void ApplyPendingHits();
+
+	/** @return Whether the damage destroyed the instance. */
+	bool ApplyDamageToInstance(const int32 InstanceIndex, const float DamageToDeal);
 
 };
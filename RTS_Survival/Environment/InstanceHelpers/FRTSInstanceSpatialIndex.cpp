@@ -0,0 +1,172 @@
+#include "FRTSInstanceSpatialIndex.h"
+
+void FRTSInstanceSpatialIndex::Build(const TArray<FVector>& InstanceLocations)
+{
+	Reset();
+	const int32 NumInstances = InstanceLocations.Num();
+	M_InstanceBySlot.SetNumUninitialized(NumInstances);
+	for (int32 InstanceIndex = 0; InstanceIndex < NumInstances; ++InstanceIndex)
+	{
+		M_InstanceBySlot[InstanceIndex] = InstanceIndex;
+	}
+	M_SplitAxisBySlot.SetNumZeroed(NumInstances);
+	M_LiveCountBySlot.SetNumZeroed(NumInstances);
+	BuildRange(InstanceLocations, 0, NumInstances);
+
+	M_LocationBySlot.SetNumUninitialized(NumInstances);
+	M_SlotByInstance.SetNumUninitialized(NumInstances);
+	for (int32 Slot = 0; Slot < NumInstances; ++Slot)
+	{
+		M_LocationBySlot[Slot] = InstanceLocations[M_InstanceBySlot[Slot]];
+		M_SlotByInstance[M_InstanceBySlot[Slot]] = Slot;
+	}
+	M_IsLiveBySlot.Init(true, NumInstances);
+	M_NumLiveInstances = NumInstances;
+}
+
+void FRTSInstanceSpatialIndex::Reset()
+{
+	M_InstanceBySlot.Reset();
+	M_LocationBySlot.Reset();
+	M_SplitAxisBySlot.Reset();
+	M_LiveCountBySlot.Reset();
+	M_IsLiveBySlot.Reset();
+	M_SlotByInstance.Reset();
+	M_NumLiveInstances = 0;
+}
+
+int32 FRTSInstanceSpatialIndex::FindClosestInstance(const FVector& Location) const
+{
+	return FindClosestInstanceWithin(Location, TNumericLimits<double>::Max());
+}
+
+int32 FRTSInstanceSpatialIndex::FindClosestInstance(const FVector& Location, const double MaxDistance) const
+{
+	if (MaxDistance <= 0.0)
+	{
+		return INDEX_NONE;
+	}
+	return FindClosestInstanceWithin(Location, MaxDistance * MaxDistance);
+}
+
+void FRTSInstanceSpatialIndex::RemoveInstance(const int32 InstanceIndex)
+{
+	if (not GetIsInstanceLive(InstanceIndex))
+	{
+		return;
+	}
+
+	const int32 Slot = M_SlotByInstance[InstanceIndex];
+	M_IsLiveBySlot[Slot] = false;
+	--M_NumLiveInstances;
+
+	// Walk the ranges from the root down to the slot, updating the live count of every subtree that holds it.
+	int32 Begin = 0;
+	int32 End = M_InstanceBySlot.Num();
+	while (Begin < End)
+	{
+		const int32 Mid = Begin + (End - Begin) / 2;
+		--M_LiveCountBySlot[Mid];
+		if (Slot == Mid)
+		{
+			return;
+		}
+		if (Slot < Mid)
+		{
+			End = Mid;
+		}
+		else
+		{
+			Begin = Mid + 1;
+		}
+	}
+}
+
+bool FRTSInstanceSpatialIndex::GetIsInstanceLive(const int32 InstanceIndex) const
+{
+	return M_SlotByInstance.IsValidIndex(InstanceIndex) && M_IsLiveBySlot[M_SlotByInstance[InstanceIndex]];
+}
+
+void FRTSInstanceSpatialIndex::BuildRange(const TArray<FVector>& InstanceLocations, const int32 Begin,
+                                          const int32 End)
+{
+	if (Begin >= End)
+	{
+		return;
+	}
+
+	// Split along the axis the range spreads out most; fences and tree lines are mostly one-dimensional.
+	FBox RangeBounds(ForceInit);
+	for (int32 Slot = Begin; Slot < End; ++Slot)
+	{
+		RangeBounds += InstanceLocations[M_InstanceBySlot[Slot]];
+	}
+	const FVector Extent = RangeBounds.GetSize();
+	const uint8 Axis = Extent.X >= Extent.Y && Extent.X >= Extent.Z ? 0 : Extent.Y >= Extent.Z ? 1 : 2;
+
+	// Built once per actor, so a sort of the range is cheap enough to find its median.
+	MakeArrayView(M_InstanceBySlot.GetData() + Begin, End - Begin).Sort(
+		[&InstanceLocations, Axis](const int32 Left, const int32 Right)
+		{
+			return InstanceLocations[Left][Axis] < InstanceLocations[Right][Axis];
+		});
+
+	const int32 Mid = Begin + (End - Begin) / 2;
+	M_SplitAxisBySlot[Mid] = Axis;
+	M_LiveCountBySlot[Mid] = End - Begin;
+	BuildRange(InstanceLocations, Begin, Mid);
+	BuildRange(InstanceLocations, Mid + 1, End);
+}
+
+int32 FRTSInstanceSpatialIndex::FindClosestInstanceWithin(const FVector& Location,
+                                                          const double MaxDistanceSquared) const
+{
+	if (M_NumLiveInstances <= 0)
+	{
+		return INDEX_NONE;
+	}
+
+	int32 BestSlot = INDEX_NONE;
+	// Starting at the limit also prunes every subtree whose split plane lies beyond it.
+	double BestDistanceSquared = MaxDistanceSquared;
+	FindClosestInRange(Location, 0, M_InstanceBySlot.Num(), BestSlot, BestDistanceSquared);
+	return BestSlot == INDEX_NONE ? INDEX_NONE : M_InstanceBySlot[BestSlot];
+}
+
+void FRTSInstanceSpatialIndex::FindClosestInRange(const FVector& Location, const int32 Begin, const int32 End,
+                                                  int32& InOutBestSlot, double& InOutBestDistanceSquared) const
+{
+	if (Begin >= End)
+	{
+		return;
+	}
+
+	const int32 Mid = Begin + (End - Begin) / 2;
+	if (M_LiveCountBySlot[Mid] <= 0)
+	{
+		return;
+	}
+
+	const FVector& NodeLocation = M_LocationBySlot[Mid];
+	if (M_IsLiveBySlot[Mid])
+	{
+		const double DistanceSquared = FVector::DistSquared(Location, NodeLocation);
+		if (DistanceSquared < InOutBestDistanceSquared)
+		{
+			InOutBestDistanceSquared = DistanceSquared;
+			InOutBestSlot = Mid;
+		}
+	}
+
+	const uint8 Axis = M_SplitAxisBySlot[Mid];
+	const double PlaneDelta = Location[Axis] - NodeLocation[Axis];
+	const bool bIsLeftNear = PlaneDelta < 0.0;
+	FindClosestInRange(Location, bIsLeftNear ? Begin : Mid + 1, bIsLeftNear ? Mid : End,
+	                   InOutBestSlot, InOutBestDistanceSquared);
+	// The far side can only hold a closer instance if the split plane is closer than the best so far.
+	if (PlaneDelta * PlaneDelta < InOutBestDistanceSquared)
+	{
+		FindClosestInRange(Location, bIsLeftNear ? Mid + 1 : Begin, bIsLeftNear ? End : Mid,
+		                   InOutBestSlot, InOutBestDistanceSquared);
+	}
+}
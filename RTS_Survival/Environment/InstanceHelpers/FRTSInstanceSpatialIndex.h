@@ -0,0 +1,49 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * @brief Static nearest-instance index over the instance locations of one instanced actor.
+ * Built once as an implicit balanced kd-tree: the node of slot range [Begin, End) is its median slot, with the left
+ * subtree in [Begin, Mid) and the right one in [Mid + 1, End). Removed instances stay in the tree but every node
+ * counts the live instances of its subtree, so lookups skip them and prune subtrees that have none left.
+ */
+class RTS_SURVIVAL_API FRTSInstanceSpatialIndex
+{
+public:
+	/** @brief Rebuilds the tree; every instance starts live. Instance i is at InstanceLocations[i]. */
+	void Build(const TArray<FVector>& InstanceLocations);
+
+	void Reset();
+
+	/** @return Index of the live instance closest to the location, or INDEX_NONE if none is left. */
+	int32 FindClosestInstance(const FVector& Location) const;
+
+	/** @return Index of the closest live instance nearer than MaxDistance, or INDEX_NONE if none is that close. */
+	int32 FindClosestInstance(const FVector& Location, const double MaxDistance) const;
+
+	/** @brief Excludes the instance from later lookups; removing it twice is a no-op. */
+	void RemoveInstance(const int32 InstanceIndex);
+
+	bool GetIsInstanceLive(const int32 InstanceIndex) const;
+	int32 GetNumLiveInstances() const { return M_NumLiveInstances; }
+
+private:
+	// Entry s of the arrays below belongs to tree slot s.
+	TArray<int32> M_InstanceBySlot;
+	TArray<FVector> M_LocationBySlot;
+	TArray<uint8> M_SplitAxisBySlot;
+	// Live instances in the subtree rooted at the slot, the slot itself included.
+	TArray<int32> M_LiveCountBySlot;
+	TArray<bool> M_IsLiveBySlot;
+
+	TArray<int32> M_SlotByInstance;
+	int32 M_NumLiveInstances = 0;
+
+	void BuildRange(const TArray<FVector>& InstanceLocations, const int32 Begin, const int32 End);
+
+	int32 FindClosestInstanceWithin(const FVector& Location, const double MaxDistanceSquared) const;
+
+	void FindClosestInRange(const FVector& Location, const int32 Begin, const int32 End,
+	                        int32& InOutBestSlot, double& InOutBestDistanceSquared) const;
+};
@@ -0,0 +1,99 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+#include "RTS_Survival/Environment/InstanceHelpers/FRTSInstanceSpatialIndex.h"
+
+namespace FRTSInstanceSpatialIndexTestConstants
+{
+	constexpr int32 RandomSeed = 1337;
+	constexpr int32 InstanceCount = 3000;
+	constexpr int32 QueryCount = 2000;
+	// Instances lie along a long, narrow strip like a fence or tree line.
+	constexpr double StripLength = 60000.0;
+	constexpr double StripWidth = 800.0;
+	// The found instance is removed after every QueriesPerRemoval-th lookup.
+	constexpr int32 QueriesPerRemoval = 2;
+	constexpr double MaxHitDistance = 300.0;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FRTSInstanceSpatialIndexTest,
+	"RTS.Environment.InstanceSpatialIndex.MatchesLinearScan",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRTSInstanceSpatialIndexTest::RunTest(const FString& Parameters)
+{
+	using namespace FRTSInstanceSpatialIndexTestConstants;
+
+	FRandomStream Stream(RandomSeed);
+	TArray<FVector> Locations;
+	Locations.SetNum(InstanceCount);
+	for (FVector& Location : Locations)
+	{
+		Location = FVector(Stream.FRandRange(0.0, StripLength), Stream.FRandRange(0.0, StripWidth),
+		                   Stream.FRandRange(0.0, 200.0));
+	}
+
+	FRTSInstanceSpatialIndex Index;
+	Index.Build(Locations);
+	TArray<bool> IsRemoved;
+	IsRemoved.Init(false, InstanceCount);
+
+	int32 Mismatches = 0;
+	for (int32 QueryIndex = 0; QueryIndex < QueryCount; ++QueryIndex)
+	{
+		const FVector Query(Stream.FRandRange(-1000.0, StripLength + 1000.0),
+		                    Stream.FRandRange(-1000.0, StripWidth + 1000.0), Stream.FRandRange(0.0, 200.0));
+
+		// Reference: the linear scan over the instances that are still standing.
+		double BestDistanceSquared = TNumericLimits<double>::Max();
+		for (int32 InstanceIndex = 0; InstanceIndex < InstanceCount; ++InstanceIndex)
+		{
+			if (not IsRemoved[InstanceIndex])
+			{
+				BestDistanceSquared =
+					FMath::Min(BestDistanceSquared, FVector::DistSquared(Query, Locations[InstanceIndex]));
+			}
+		}
+
+		// Compare distances rather than indices so equally close instances do not count as mismatches.
+		const int32 FoundIndex = Index.FindClosestInstance(Query);
+		if (FoundIndex == INDEX_NONE || IsRemoved[FoundIndex]
+			|| not FMath::IsNearlyEqual(FVector::DistSquared(Query, Locations[FoundIndex]), BestDistanceSquared))
+		{
+			++Mismatches;
+		}
+
+		if (QueryIndex % QueriesPerRemoval == 0 && FoundIndex != INDEX_NONE)
+		{
+			// Destroy the hit instance, as a damage batch does, so later queries must skip it.
+			Index.RemoveInstance(FoundIndex);
+			IsRemoved[FoundIndex] = true;
+		}
+	}
+
+	TestEqual(TEXT("Index lookups match the linear scan"), Mismatches, 0);
+	TestEqual(TEXT("Removed instances are no longer counted as live"),
+	          Index.GetNumLiveInstances(), InstanceCount - QueryCount / QueriesPerRemoval);
+
+	// Every live instance lies on the strip, so a query far beside it has no instance within a short distance.
+	const FVector FarQuery(0.5 * StripLength, StripWidth + 10.0 * MaxHitDistance, 100.0);
+	TestEqual(TEXT("No instance is found beyond the max distance"),
+	          Index.FindClosestInstance(FarQuery, MaxHitDistance), static_cast<int32>(INDEX_NONE));
+	const int32 ClosestIndex = Index.FindClosestInstance(FarQuery);
+	const double ClosestDistance = FVector::Dist(FarQuery, Locations[ClosestIndex]);
+	TestEqual(TEXT("A max distance past the closest instance finds it"),
+	          Index.FindClosestInstance(FarQuery, ClosestDistance + 1.0), ClosestIndex);
+
+	for (int32 InstanceIndex = 0; InstanceIndex < InstanceCount; ++InstanceIndex)
+	{
+		Index.RemoveInstance(InstanceIndex);
+	}
+	TestEqual(TEXT("No instance is found once all are removed"),
+	          Index.FindClosestInstance(FVector::ZeroVector), static_cast<int32>(INDEX_NONE));
+
+	return not HasAnyErrors();
+}
+
+#endif
@@ -0,0 +1,203 @@
+// Copyright (C) 2020-2025 Bas Blokzijl - All rights reserved.
+
+#include "FowCpuVisibilityGrid.h"
+
+namespace FowCpuVisibilityGridConstants
+{
+	constexpr int32 BitsPerWord = 64;
+	// Caps memory for very large maps with a tiny cell size; the cell size grows instead.
+	constexpr int32 MaxCellsPerAxis = 4096;
+	constexpr float MinCellSize = 1.f;
+}
+
+FFowCpuVisibilityGrid::FFowCpuVisibilityGrid()
+	: M_Origin(FVector2D::ZeroVector)
+	  , M_CellSize(FowCpuVisibilityGridConstants::MinCellSize)
+	  , M_CellsPerAxis(0)
+	  , M_WordsPerRow(0)
+	  , M_DirtyRowMin(MAX_int32)
+	  , M_DirtyRowMax(INDEX_NONE)
+	  , M_NumRestampedSources(0)
+{
+}
+
+void FFowCpuVisibilityGrid::Init(const FVector2D& MapCenter, const float MapExtent, const float CellSize)
+{
+	const float MapSize = FMath::Max(2.f * MapExtent, FowCpuVisibilityGridConstants::MinCellSize);
+	M_CellSize = FMath::Max3(CellSize, FowCpuVisibilityGridConstants::MinCellSize,
+	                         MapSize / FowCpuVisibilityGridConstants::MaxCellsPerAxis);
+	M_CellsPerAxis = FMath::Max(1, FMath::CeilToInt32(MapSize / M_CellSize));
+	M_WordsPerRow = FMath::DivideAndRoundUp(M_CellsPerAxis, FowCpuVisibilityGridConstants::BitsPerWord);
+	M_Origin = MapCenter - FVector2D(MapExtent, MapExtent);
+
+	M_CoverageCounts.Init(0, M_CellsPerAxis * M_CellsPerAxis);
+	M_VisibleBits.Init(0, M_WordsPerRow * M_CellsPerAxis);
+	M_Stamps.Reset();
+	M_DirtyRowMin = MAX_int32;
+	M_DirtyRowMax = INDEX_NONE;
+	M_NumRestampedSources = 0;
+}
+
+void FFowCpuVisibilityGrid::ResetSources()
+{
+	M_Stamps.Reset();
+	FMemory::Memzero(M_CoverageCounts.GetData(), M_CoverageCounts.Num() * sizeof(uint16));
+	FMemory::Memzero(M_VisibleBits.GetData(), M_VisibleBits.Num() * sizeof(uint64));
+	M_DirtyRowMin = MAX_int32;
+	M_DirtyRowMax = INDEX_NONE;
+}
+
+void FFowCpuVisibilityGrid::BeginSourceUpdate()
+{
+	M_NumRestampedSources = 0;
+	for (TPair<uint32, FVisionStamp>& StampPair : M_Stamps)
+	{
+		StampPair.Value.bWasUpdated = false;
+	}
+}
+
+void FFowCpuVisibilityGrid::UpdateVisionSource(const uint32 SourceId, const FVector2D& Location,
+                                               const float VisionRadius)
+{
+	if (not GetIsInitialized())
+	{
+		return;
+	}
+
+	FVisionStamp NewStamp;
+	NewStamp.bWasUpdated = true;
+	// Sources outside the map give no vision, matching the render target which only covers the map.
+	if (GetCellFromLocation(Location, NewStamp.CellX, NewStamp.CellY))
+	{
+		NewStamp.RadiusCells = FMath::Max(0.f, VisionRadius / M_CellSize);
+	}
+
+	FVisionStamp* ExistingStamp = M_Stamps.Find(SourceId);
+	if (ExistingStamp)
+	{
+		if (ExistingStamp->CellX == NewStamp.CellX && ExistingStamp->CellY == NewStamp.CellY
+			&& ExistingStamp->RadiusCells == NewStamp.RadiusCells)
+		{
+			ExistingStamp->bWasUpdated = true;
+			return;
+		}
+		RasterizeStamp(*ExistingStamp, -1);
+		*ExistingStamp = NewStamp;
+	}
+	else
+	{
+		M_Stamps.Add(SourceId, NewStamp);
+	}
+	RasterizeStamp(NewStamp, 1);
+	++M_NumRestampedSources;
+}
+
+void FFowCpuVisibilityGrid::EndSourceUpdate()
+{
+	for (auto It = M_Stamps.CreateIterator(); It; ++It)
+	{
+		if (It.Value().bWasUpdated)
+		{
+			continue;
+		}
+		RasterizeStamp(It.Value(), -1);
+		It.RemoveCurrent();
+	}
+	RefreshDirtyBitsetRows();
+}
+
+float FFowCpuVisibilityGrid::GetVisibility(const FVector2D& Location) const
+{
+	int32 CellX = 0;
+	int32 CellY = 0;
+	if (not GetCellFromLocation(Location, CellX, CellY))
+	{
+		return 0.f;
+	}
+	return GetIsCellVisible(CellX, CellY) ? 1.f : 0.f;
+}
+
+bool FFowCpuVisibilityGrid::GetIsCellVisible(const int32 CellX, const int32 CellY) const
+{
+	if (CellX < 0 || CellY < 0 || CellX >= M_CellsPerAxis || CellY >= M_CellsPerAxis)
+	{
+		return false;
+	}
+	using FowCpuVisibilityGridConstants::BitsPerWord;
+	const uint64 Word = M_VisibleBits[CellY * M_WordsPerRow + CellX / BitsPerWord];
+	return (Word >> (CellX % BitsPerWord) & 1ull) != 0;
+}
+
+FVector2D FFowCpuVisibilityGrid::GetCellCenter(const int32 CellX, const int32 CellY) const
+{
+	return M_Origin + FVector2D((CellX + 0.5f) * M_CellSize, (CellY + 0.5f) * M_CellSize);
+}
+
+bool FFowCpuVisibilityGrid::GetCellFromLocation(const FVector2D& Location, int32& OutCellX, int32& OutCellY) const
+{
+	const int32 CellX = FMath::FloorToInt32((Location.X - M_Origin.X) / M_CellSize);
+	const int32 CellY = FMath::FloorToInt32((Location.Y - M_Origin.Y) / M_CellSize);
+	if (CellX < 0 || CellY < 0 || CellX >= M_CellsPerAxis || CellY >= M_CellsPerAxis)
+	{
+		return false;
+	}
+	OutCellX = CellX;
+	OutCellY = CellY;
+	return true;
+}
+
+void FFowCpuVisibilityGrid::RasterizeStamp(const FVisionStamp& Stamp, const int32 Delta)
+{
+	if (Stamp.RadiusCells <= 0.f)
+	{
+		return;
+	}
+
+	const int32 RadiusRows = FMath::FloorToInt32(Stamp.RadiusCells);
+	const float RadiusSquared = Stamp.RadiusCells * Stamp.RadiusCells;
+	const int32 MinRow = FMath::Max(0, Stamp.CellY - RadiusRows);
+	const int32 MaxRow = FMath::Min(M_CellsPerAxis - 1, Stamp.CellY + RadiusRows);
+	if (MinRow > MaxRow)
+	{
+		return;
+	}
+
+	for (int32 Row = MinRow; Row <= MaxRow; ++Row)
+	{
+		// Cell centers are whole cell offsets apart, so the span of a row only depends on its offset from the center.
+		const int32 RowOffset = Row - Stamp.CellY;
+		const int32 HalfSpan = FMath::FloorToInt32(FMath::Sqrt(RadiusSquared - RowOffset * RowOffset));
+		const int32 SpanStart = FMath::Max(0, Stamp.CellX - HalfSpan);
+		const int32 SpanEnd = FMath::Min(M_CellsPerAxis - 1, Stamp.CellX + HalfSpan);
+		uint16* RowCounts = M_CoverageCounts.GetData() + Row * M_CellsPerAxis;
+		for (int32 CellX = SpanStart; CellX <= SpanEnd; ++CellX)
+		{
+			RowCounts[CellX] = static_cast<uint16>(RowCounts[CellX] + Delta);
+		}
+	}
+	M_DirtyRowMin = FMath::Min(M_DirtyRowMin, MinRow);
+	M_DirtyRowMax = FMath::Max(M_DirtyRowMax, MaxRow);
+}
+
+void FFowCpuVisibilityGrid::RefreshDirtyBitsetRows()
+{
+	using FowCpuVisibilityGridConstants::BitsPerWord;
+	for (int32 Row = M_DirtyRowMin; Row <= M_DirtyRowMax; ++Row)
+	{
+		const uint16* RowCounts = M_CoverageCounts.GetData() + Row * M_CellsPerAxis;
+		uint64* RowWords = M_VisibleBits.GetData() + Row * M_WordsPerRow;
+		for (int32 WordIndex = 0; WordIndex < M_WordsPerRow; ++WordIndex)
+		{
+			const int32 FirstCell = WordIndex * BitsPerWord;
+			const int32 NumCells = FMath::Min(BitsPerWord, M_CellsPerAxis - FirstCell);
+			uint64 Word = 0;
+			for (int32 Bit = 0; Bit < NumCells; ++Bit)
+			{
+				Word |= static_cast<uint64>(RowCounts[FirstCell + Bit] != 0) << Bit;
+			}
+			RowWords[WordIndex] = Word;
+		}
+	}
+	M_DirtyRowMin = MAX_int32;
+	M_DirtyRowMax = INDEX_NONE;
+}
@@ -0,0 +1,98 @@
+// Copyright (C) 2020-2025 Bas Blokzijl - All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * @brief CPU vision grid covering the fow map: vision circles are rasterized into per-cell coverage counts and a
+ * bitset of visible cells is kept for queries.
+ *
+ * Sources are only re-rasterized when they move to another cell or change radius, so the cost of an update scales
+ * with the units that moved instead of with every unit. Results only depend on the supplied source data, which keeps
+ * them deterministic and testable without a GPU.
+ * @note Game thread only.
+ */
+class FFowCpuVisibilityGrid
+{
+public:
+	FFowCpuVisibilityGrid();
+
+	/**
+	 * @brief Sizes the grid to the fow map and removes all sources.
+	 * @param MapCenter World XY location of the fow manager, the center of the map.
+	 * @param MapExtent Half the size of the square map, in cm.
+	 * @param CellSize Size of one grid cell, in cm.
+	 */
+	void Init(const FVector2D& MapCenter, const float MapExtent, const float CellSize);
+
+	bool GetIsInitialized() const { return M_CellsPerAxis > 0; }
+
+	/** @brief Removes every source and clears all vision. */
+	void ResetSources();
+
+	/** @brief Starts an update; sources not updated before EndSourceUpdate are removed. */
+	void BeginSourceUpdate();
+
+	/**
+	 * @brief Adds or moves a vision circle; only re-rasterized if its cell or radius changed.
+	 * @param SourceId Stable ID of the source across updates.
+	 * @param Location World XY location of the source.
+	 * @param VisionRadius Vision radius in cm; zero or less removes the vision of this source.
+	 */
+	void UpdateVisionSource(const uint32 SourceId, const FVector2D& Location, const float VisionRadius);
+
+	/** @brief Removes the sources that were not updated and refreshes the bitset rows that changed. */
+	void EndSourceUpdate();
+
+	/** @return 1 if the location is inside any vision circle, 0 if not or outside the map. */
+	float GetVisibility(const FVector2D& Location) const;
+
+	bool GetIsCellVisible(const int32 CellX, const int32 CellY) const;
+
+	int32 GetCellsPerAxis() const { return M_CellsPerAxis; }
+
+	FVector2D GetCellCenter(const int32 CellX, const int32 CellY) const;
+
+	/** @return Sources re-rasterized during the last update, for profiling. */
+	int32 GetNumRestampedSources() const { return M_NumRestampedSources; }
+
+private:
+	/** The circle as it is currently rasterized into the coverage counts. */
+	struct FVisionStamp
+	{
+		int32 CellX = 0;
+		int32 CellY = 0;
+		// Radius in cells; zero stamps nothing.
+		float RadiusCells = 0.f;
+		bool bWasUpdated = false;
+	};
+
+	FVector2D M_Origin;
+	float M_CellSize;
+	int32 M_CellsPerAxis;
+	int32 M_WordsPerRow;
+
+	// Amount of circles covering each cell, row-major.
+	TArray<uint16> M_CoverageCounts;
+	// One bit per cell, set while its coverage count is above zero; rows are padded to whole 64-bit words.
+	TArray<uint64> M_VisibleBits;
+
+	TMap<uint32, FVisionStamp> M_Stamps;
+
+	// Rows whose coverage changed since the bitset was last refreshed.
+	int32 M_DirtyRowMin;
+	int32 M_DirtyRowMax;
+
+	int32 M_NumRestampedSources;
+
+	bool GetCellFromLocation(const FVector2D& Location, int32& OutCellX, int32& OutCellY) const;
+
+	/**
+	 * @brief Adds Delta to the coverage count of every cell whose center is inside the circle.
+	 * Each row is a contiguous span of counts, so the inner loop is a plain add the compiler can vectorize.
+	 */
+	void RasterizeStamp(const FVisionStamp& Stamp, const int32 Delta);
+
+	void RefreshDirtyBitsetRows();
+};
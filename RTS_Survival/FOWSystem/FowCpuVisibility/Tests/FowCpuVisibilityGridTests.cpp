@@ -0,0 +1,154 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+#include "RTS_Survival/FOWSystem/FowCpuVisibility/FowCpuVisibilityGrid.h"
+
+namespace FowCpuVisibilityGridTestConstants
+{
+	constexpr int32 RandomSeed = 1337;
+	constexpr float MapExtent = 20000.f;
+	constexpr float CellSize = 200.f;
+	constexpr int32 NumSources = 300;
+	constexpr int32 NumUpdateRounds = 8;
+	// Chance per round that a source moves; the rest stay put and must not be re-rasterized.
+	constexpr float MoveChance = 0.3f;
+	constexpr float RemoveChance = 0.05f;
+	constexpr float MinVisionRadius = 0.f;
+	constexpr float MaxVisionRadius = 3000.f;
+}
+
+namespace
+{
+	struct FTestVisionSource
+	{
+		FVector2D Location = FVector2D::ZeroVector;
+		float VisionRadius = 0.f;
+		bool bIsActive = true;
+	};
+
+	FVector2D RandomMapLocation(FRandomStream& Stream)
+	{
+		using namespace FowCpuVisibilityGridTestConstants;
+		// Slightly outside the map as well, those sources must not give vision.
+		return FVector2D(Stream.FRandRange(-MapExtent * 1.05f, MapExtent * 1.05f),
+		                 Stream.FRandRange(-MapExtent * 1.05f, MapExtent * 1.05f));
+	}
+
+	/** Reference: a cell is visible if its center is within the radius of a source snapped to its cell center. */
+	bool BruteForceIsCellVisible(const TArray<FTestVisionSource>& Sources, const int32 CellX, const int32 CellY)
+	{
+		using namespace FowCpuVisibilityGridTestConstants;
+		for (const FTestVisionSource& Source : Sources)
+		{
+			if (not Source.bIsActive || FMath::Abs(Source.Location.X) >= MapExtent
+				|| FMath::Abs(Source.Location.Y) >= MapExtent)
+			{
+				continue;
+			}
+			const int32 SourceCellX = FMath::FloorToInt32((Source.Location.X + MapExtent) / CellSize);
+			const int32 SourceCellY = FMath::FloorToInt32((Source.Location.Y + MapExtent) / CellSize);
+			const float RadiusCells = Source.VisionRadius / CellSize;
+			const int32 DeltaX = CellX - SourceCellX;
+			const int32 DeltaY = CellY - SourceCellY;
+			if (DeltaX * DeltaX + DeltaY * DeltaY <= RadiusCells * RadiusCells)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	void ApplySources(FFowCpuVisibilityGrid& Grid, const TArray<FTestVisionSource>& Sources)
+	{
+		Grid.BeginSourceUpdate();
+		for (int32 SourceIndex = 0; SourceIndex < Sources.Num(); ++SourceIndex)
+		{
+			if (Sources[SourceIndex].bIsActive)
+			{
+				Grid.UpdateVisionSource(static_cast<uint32>(SourceIndex + 1), Sources[SourceIndex].Location,
+				                        Sources[SourceIndex].VisionRadius);
+			}
+		}
+		Grid.EndSourceUpdate();
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FFowCpuVisibilityGridIncrementalTest,
+	"RTS.FowSystem.CpuVisibilityGrid.IncrementalMatchesBruteForce",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FFowCpuVisibilityGridIncrementalTest::RunTest(const FString& Parameters)
+{
+	using namespace FowCpuVisibilityGridTestConstants;
+
+	FRandomStream Stream(RandomSeed);
+	TArray<FTestVisionSource> Sources;
+	Sources.SetNum(NumSources);
+	for (FTestVisionSource& Source : Sources)
+	{
+		Source.Location = RandomMapLocation(Stream);
+		Source.VisionRadius = Stream.FRandRange(MinVisionRadius, MaxVisionRadius);
+	}
+
+	FFowCpuVisibilityGrid IncrementalGrid;
+	IncrementalGrid.Init(FVector2D::ZeroVector, MapExtent, CellSize);
+	for (int32 Round = 0; Round < NumUpdateRounds; ++Round)
+	{
+		int32 NumChangedSources = 0;
+		if (Round > 0)
+		{
+			for (FTestVisionSource& Source : Sources)
+			{
+				if (Stream.FRand() < RemoveChance)
+				{
+					NumChangedSources += Source.bIsActive ? 0 : 1;
+					Source.bIsActive = not Source.bIsActive;
+				}
+				else if (Stream.FRand() < MoveChance)
+				{
+					Source.Location = RandomMapLocation(Stream);
+					NumChangedSources += Source.bIsActive ? 1 : 0;
+				}
+			}
+		}
+		ApplySources(IncrementalGrid, Sources);
+
+		// A grid rebuilt from scratch must match exactly, the result may not depend on the update history.
+		FFowCpuVisibilityGrid RebuiltGrid;
+		RebuiltGrid.Init(FVector2D::ZeroVector, MapExtent, CellSize);
+		ApplySources(RebuiltGrid, Sources);
+
+		int32 NumBruteForceMismatches = 0;
+		int32 NumRebuildMismatches = 0;
+		for (int32 CellY = 0; CellY < IncrementalGrid.GetCellsPerAxis(); ++CellY)
+		{
+			for (int32 CellX = 0; CellX < IncrementalGrid.GetCellsPerAxis(); ++CellX)
+			{
+				const bool bIsVisible = IncrementalGrid.GetIsCellVisible(CellX, CellY);
+				NumBruteForceMismatches += bIsVisible != BruteForceIsCellVisible(Sources, CellX, CellY) ? 1 : 0;
+				NumRebuildMismatches += bIsVisible != RebuiltGrid.GetIsCellVisible(CellX, CellY) ? 1 : 0;
+			}
+		}
+		TestEqual(FString::Printf(TEXT("Round %d matches brute force"), Round), NumBruteForceMismatches, 0);
+		TestEqual(FString::Printf(TEXT("Round %d matches a rebuilt grid"), Round), NumRebuildMismatches, 0);
+		if (Round > 0)
+		{
+			// Moved and re-added sources are re-rasterized, sources that stayed in their cell are not.
+			TestTrue(FString::Printf(TEXT("Round %d only re-rasterizes changed sources"), Round),
+			         IncrementalGrid.GetNumRestampedSources() <= NumChangedSources);
+		}
+	}
+
+	FFowCpuVisibilityGrid EmptyGrid;
+	EmptyGrid.Init(FVector2D::ZeroVector, MapExtent, CellSize);
+	ApplySources(EmptyGrid, Sources);
+	EmptyGrid.BeginSourceUpdate();
+	EmptyGrid.EndSourceUpdate();
+	TestEqual(TEXT("Removing every source clears all vision"), EmptyGrid.GetVisibility(Sources[0].Location), 0.f);
+
+	return not HasAnyErrors();
+}
+
+#endif
@@ -10,6 +10,7 @@
 #include "Engine/TextureRenderTarget2D.h"
 #include "Engine/World.h"
 #include "TimerManager.h"
+#include "Misc/App.h"
 #include "RTS_Survival/GameUI/MiniMap/CustomIcons/MinimapIconDataAsset.h"
 #include "RTS_Survival/GameUI/MiniMap/CustomIcons/RTSMinimapDeveloperSettings.h"
 #include "RTS_Survival/DeveloperSettings.h"
@@ -37,6 +38,8 @@ AFowManager::AFowManager(const FObjectInitializer& ObjectInitializer)
 	MapExtent = 0.0f;
 	RenderTargetSize = 0;
 	FowTickRate = 0.1f;
+	VisibilityBackend = EFowVisibilityBackend::Gpu;
+	CpuVisibilityCellSize = 200.0f;
 	MiniMapTinyIconSizePixels = 1.0f;
 	MiniMapSmallIconSizePixels = 6.0f;
 	MiniMapMediumIconSizePixels = 8.0f;
@@ -385,9 +388,21 @@ void AFowManager::Tick(float DeltaTime)
 	Super::Tick(DeltaTime);
 	// Ensure passive and active components are valid.
 	EnsureComponentsAreValid();
-	UpdateDrawBuffer();
-	AskUpdateEnemyVision();
-	AskReadBack();
+	if (GetIsUsingCpuVisibility())
+	{
+		// Niagara only draws the fog here, the visibility comes from the CPU grids.
+		if (IsValid(NiagaraDraw))
+		{
+			UpdateDrawBuffer();
+		}
+		UpdateCpuVisibility();
+	}
+	else
+	{
+		UpdateDrawBuffer();
+		AskUpdateEnemyVision();
+		AskReadBack();
+	}
 	RefreshMiniMapIconDrawDataCache();
 	RefreshCustomMiniMapIconDrawDataCache();
 }
@@ -650,8 +665,13 @@ float AFowManager::GetCustomMinimapIconRotationDegrees(const FRotator& WorldRota
 
 void AFowManager::StartFow()
 {
-	if (bIsInitialized)
+	// Without rendering the render targets are never initialized, the Cpu backend does not need them.
+	if (bIsInitialized || not FApp::CanEverRender())
 	{
+		if (GetIsUsingCpuVisibility())
+		{
+			InitCpuVisibilityGrids();
+		}
 		SetActorTickInterval(FowTickRate);
 		SetActorTickEnabled(true);
 		bIsStarted = true;
@@ -683,6 +703,8 @@ void AFowManager::StopFow()
 	}
 	bIsStarted = false;
 	SetActorTickEnabled(false);
+	M_CpuPlayerVisionGrid.ResetSources();
+	M_CpuEnemyVisionGrid.ResetSources();
 	const TArray<FVector> EmptyArray = {};
 	if (IsValid(NiagaraDraw))
 	{
@@ -1065,6 +1087,84 @@ void AFowManager::OnReceivedReadBackUpdate(const TArray<FBasicParticleData>& Dat
 	RefreshMiniMapIconDrawDataCache();
 }
 
+bool AFowManager::GetIsUsingCpuVisibility() const
+{
+	return VisibilityBackend == EFowVisibilityBackend::Cpu || not FApp::CanEverRender();
+}
+
+void AFowManager::InitCpuVisibilityGrids()
+{
+	const FVector2D MapCenter(GetActorLocation());
+	M_CpuPlayerVisionGrid.Init(MapCenter, MapExtent, CpuVisibilityCellSize);
+	M_CpuEnemyVisionGrid.Init(MapCenter, MapExtent, CpuVisibilityCellSize);
+}
+
+void AFowManager::UpdateCpuVisibility()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FowManager_UpdateCpuVisibility);
+	if (not M_CpuPlayerVisionGrid.GetIsInitialized())
+	{
+		InitCpuVisibilityGrids();
+	}
+
+	// Only sources that moved to another cell are re-rasterized.
+	M_CpuPlayerVisionGrid.BeginSourceUpdate();
+	for (const TWeakObjectPtr<UFowComp>& ActiveComp : M_ActiveFowComponents)
+	{
+		const AActor* OwnerActor = ActiveComp->GetOwner();
+		const FVector Location = OwnerActor->GetActorLocation();
+		ActiveComp->CacheMiniMapWorldLocation(Location);
+		ActiveComp->SetShouldDrawMiniMapIcon(not OwnerActor->IsHidden());
+		M_CpuPlayerVisionGrid.UpdateVisionSource(ActiveComp->GetUniqueID(), FVector2D(Location),
+		                                         ActiveComp->GetVisionRadius());
+	}
+	M_CpuPlayerVisionGrid.EndSourceUpdate();
+
+	M_CpuEnemyVisionGrid.BeginSourceUpdate();
+	for (const TWeakObjectPtr<UFowComp>& PassiveComp : M_PassiveFowComponents)
+	{
+		const FVector Location = PassiveComp->GetOwner()->GetActorLocation();
+		PassiveComp->CacheMiniMapWorldLocation(Location);
+		if (PassiveComp->GetFowBehaviour() == EFowBehaviour::Fow_PassiveEnemyVision
+			&& PassiveComp->GetVisionRadius() > 0)
+		{
+			M_CpuEnemyVisionGrid.UpdateVisionSource(PassiveComp->GetUniqueID(), FVector2D(Location),
+			                                        PassiveComp->GetVisionRadius());
+		}
+	}
+	M_CpuEnemyVisionGrid.EndSourceUpdate();
+
+	// Visibility callbacks may hide actors or remove participants, so they are sent after both grids are complete
+	// and over copies of the component lists, like the readback path does.
+	const TArray<TWeakObjectPtr<UFowComp>> PassiveComps = M_PassiveFowComponents;
+	const TArray<TWeakObjectPtr<UFowComp>> ActiveComps = M_ActiveFowComponents;
+	for (const TWeakObjectPtr<UFowComp>& PassiveComp : PassiveComps)
+	{
+		if (PassiveComp.IsValid() && IsValid(PassiveComp->GetOwner()))
+		{
+			const FVector2D Location(PassiveComp->GetOwner()->GetActorLocation());
+			PassiveComp->OnFowVisibilityUpdated(M_CpuPlayerVisionGrid.GetVisibility(Location));
+		}
+	}
+	for (const TWeakObjectPtr<UFowComp>& ActiveComp : ActiveComps)
+	{
+		if (ActiveComp.IsValid() && IsValid(ActiveComp->GetOwner()))
+		{
+			const FVector2D Location(ActiveComp->GetOwner()->GetActorLocation());
+			ActiveComp->OnFowVisibilityUpdated(M_CpuEnemyVisionGrid.GetVisibility(Location));
+		}
+	}
+
+	if constexpr (DeveloperSettings::Debugging::GFowSystem_Compile_DebugSymbols)
+	{
+		RTSFunctionLibrary::PrintString(
+			"Cpu fow re-rasterized player sources: " + FString::FromInt(
+				M_CpuPlayerVisionGrid.GetNumRestampedSources()) +
+			"\n enemy sources: " + FString::FromInt(M_CpuEnemyVisionGrid.GetNumRestampedSources()),
+			FColor::Purple);
+	}
+}
+
 bool AFowManager::GetValidParticleIndex(const FVector& ParticleVector, int32& OutIndex) const
 {
 	OutIndex = FMath::TruncToInt32(ParticleVector.X);
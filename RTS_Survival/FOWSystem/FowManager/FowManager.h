@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "NiagaraDataInterfaceExport.h"
 #include "GameFramework/Actor.h"
+#include "RTS_Survival/FOWSystem/FowCpuVisibility/FowCpuVisibilityGrid.h"
 #include "RTS_Survival/GameUI/MiniMap/RTSMinimapIconHelpers.h"
 #include "RTS_Survival/GameUI/MiniMap/CustomIcons/MinimapIconTypes.h"
 #include "FowManager.generated.h"
@@ -14,6 +15,16 @@ class UNiagaraComponent;
 class UFowComp;
 class UMinimapIconDataAsset;
 
+/** Where the visibility of fow components is determined. */
+UENUM(BlueprintType)
+enum class EFowVisibilityBackend : uint8
+{
+	// Niagara systems read the visibility back from the GPU.
+	Gpu,
+	// Vision circles are rasterized into a CPU grid; needed on servers and headless builds without rendering.
+	Cpu
+};
+
 USTRUCT()
 struct FFowManagerCustomMinimapIcon
 {
@@ -230,6 +241,14 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
 	float FowTickRate;
 
+	// Determines the visibility of fow components; always Cpu when the process cannot render.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings|Visibility")
+	EFowVisibilityBackend VisibilityBackend;
+
+	// Size of one cell of the Cpu visibility grids, in cm.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings|Visibility", meta = (ClampMin = "25.0"))
+	float CpuVisibilityCellSize;
+
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Settings|MiniMap")
 	float MiniMapTinyIconSizePixels;
 
@@ -492,6 +511,25 @@ private:
 	 */
 	bool GetValidParticleIndex(const FVector& ParticleVector, int32& OutIndex) const;
 
+	bool GetIsUsingCpuVisibility() const;
+
+	void InitCpuVisibilityGrids();
+
+	/**
+	 * @brief Determines visibility on the CPU instead of through the Niagara readbacks.
+	 *
+	 * Stamps the vision of active components into the player grid and the vision of enemy vision components into
+	 * the enemy grid, then updates passive components with player vision and active components with enemy vision.
+	 * @pre Assumes all components in M_ActiveFowComponents and M_PassiveFowComponents and their owners are valid.
+	 */
+	void UpdateCpuVisibility();
+
+	// Cpu backend: vision of the active (player) components, used to reveal passive components.
+	FFowCpuVisibilityGrid M_CpuPlayerVisionGrid;
+
+	// Cpu backend: vision of the enemy vision components, used to tag player units visible to the enemy.
+	FFowCpuVisibilityGrid M_CpuEnemyVisionGrid;
+
 	// Cached once on the FOW side so the minimap widget can paint without rebuilding unit icon data every frame.
 	TArray<FRTSMinimapIconDrawData> M_CachedMiniMapIconDrawData;
 
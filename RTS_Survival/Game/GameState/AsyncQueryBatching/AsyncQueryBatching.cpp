@@ -0,0 +1,55 @@
+#include "AsyncQueryBatching.h"
+
+#include "Async/Async.h"
+
+int32 FAsyncGameThreadCallbackBatch::DispatchToGameThread()
+{
+	const int32 BatchSize = M_Callbacks.Num();
+	if (BatchSize == 0)
+	{
+		return 0;
+	}
+
+	AsyncTask(ENamedThreads::GameThread, [Callbacks = MoveTemp(M_Callbacks)]()
+	{
+		for (const TFunction<void()>& Callback : Callbacks)
+		{
+			Callback();
+		}
+	});
+	M_Callbacks.Reset();
+	return BatchSize;
+}
+
+void FAsyncQueryLatencyTracker::AddSample(const double EnqueueTimeSeconds, const double CompletedTimeSeconds)
+{
+	const float LatencyMs = static_cast<float>((CompletedTimeSeconds - EnqueueTimeSeconds) * 1000.0);
+	bM_IsSortedScratchValid = false;
+	if (M_SamplesMs.Num() < WindowSize)
+	{
+		M_SamplesMs.Add(LatencyMs);
+		return;
+	}
+	M_SamplesMs[M_NextSampleIndex] = LatencyMs;
+	M_NextSampleIndex = (M_NextSampleIndex + 1) % WindowSize;
+}
+
+float FAsyncQueryLatencyTracker::GetPercentileMs(const float Percentile) const
+{
+	if (M_SamplesMs.IsEmpty())
+	{
+		return 0.f;
+	}
+
+	if (not bM_IsSortedScratchValid)
+	{
+		M_SortedScratch = M_SamplesMs;
+		M_SortedScratch.Sort();
+		bM_IsSortedScratchValid = true;
+	}
+	const int32 Index = FMath::Clamp(
+		FMath::FloorToInt32(Percentile * (M_SortedScratch.Num() - 1)),
+		0,
+		M_SortedScratch.Num() - 1);
+	return M_SortedScratch[Index];
+}
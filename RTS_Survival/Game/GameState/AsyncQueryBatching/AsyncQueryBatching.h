@@ -0,0 +1,54 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "Templates/Function.h"
+
+// Stats for the async query threads (target and resource finding); view with "stat RTSAsyncQueries".
+DECLARE_STATS_GROUP(TEXT("RTS Async Queries"), STATGROUP_RTSAsyncQueries, STATCAT_Advanced);
+
+/**
+ * @brief Collects the results of one async thread wakeup so they reach the game thread as a single task
+ * instead of one task per request.
+ */
+class FAsyncGameThreadCallbackBatch
+{
+public:
+	void Add(TFunction<void()>&& Callback) { M_Callbacks.Add(MoveTemp(Callback)); }
+
+	int32 Num() const { return M_Callbacks.Num(); }
+
+	/**
+	 * @brief Schedules one game thread task that invokes all collected callbacks in the order they were added.
+	 * @return The amount of callbacks that were dispatched.
+	 */
+	int32 DispatchToGameThread();
+
+private:
+	TArray<TFunction<void()>> M_Callbacks;
+};
+
+/**
+ * @brief Rolling window of request latencies to report percentiles without keeping every sample.
+ * @note Not thread safe; owned by the async thread that processes the requests.
+ */
+class FAsyncQueryLatencyTracker
+{
+public:
+	/** @param EnqueueTimeSeconds FPlatformTime::Seconds() at the moment the request was enqueued. */
+	void AddSample(const double EnqueueTimeSeconds, const double CompletedTimeSeconds);
+
+	/**
+	 * @return The latency in milliseconds below which Percentile (0-1) of the recent samples fall.
+	 * @note The window is sorted once per batch of new samples, so asking several percentiles costs one sort.
+	 */
+	float GetPercentileMs(const float Percentile) const;
+
+private:
+	static constexpr int32 WindowSize = 256;
+
+	TArray<float> M_SamplesMs;
+	int32 M_NextSampleIndex = 0;
+	mutable TArray<float> M_SortedScratch;
+	mutable bool bM_IsSortedScratchValid = false;
+};
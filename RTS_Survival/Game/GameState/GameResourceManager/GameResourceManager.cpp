@@ -144,6 +144,20 @@ void UGameResourceManager::BeginDestroy()
 	Super::BeginDestroy();
 }
 
+#if RTS_WITH_PERF_BENCHMARK_SHIPPING_TESTS
+bool UGameResourceManager::PerfBenchmark_GetAsyncResourceLatency(float& OutP50Ms, float& OutP99Ms) const
+{
+	if (not M_GetAsyncResourceThread)
+	{
+		OutP50Ms = 0.f;
+		OutP99Ms = 0.f;
+		return false;
+	}
+	M_GetAsyncResourceThread->PerfBenchmark_GetResourceRequestLatency(OutP50Ms, OutP99Ms);
+	return true;
+}
+#endif
+
 void UGameResourceManager::InitAsyncResourceThread()
 {
 	if (not M_GetAsyncResourceThread)
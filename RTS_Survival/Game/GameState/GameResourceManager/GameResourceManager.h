@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "RTS_Survival/UnitTests/PerfBenchmarkShippingTestsDefine.h"
 #include "UObject/Object.h"
 #include "GameResourceManager.generated.h"
 
@@ -69,6 +70,11 @@ public:
 	virtual void BeginPlay() override;
 	virtual void BeginDestroy() override;
 
+#if RTS_WITH_PERF_BENCHMARK_SHIPPING_TESTS
+	/** @return False if the async resource thread is not running. */
+	bool PerfBenchmark_GetAsyncResourceLatency(float& OutP50Ms, float& OutP99Ms) const;
+#endif
+
 	
 
 private:
@@ -1,11 +1,21 @@
 ﻿#include "FGetAsyncResource.h"
-#include "Async/Async.h"
 #include "AsyncDropOffData/FAsyncResourceDropOffData.h"
+#include "HAL/Event.h"
 #include "RTS_Survival/DeveloperSettings.h"
 #include "RTS_Survival/Resources/HarvesterCargoSlot/HarvesterCargoSlot.h"
 
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Resource Thread Queue Depth"), STAT_AsyncResource_QueueDepth,
+                               STATGROUP_RTSAsyncQueries);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Resource Thread Batch Size"), STAT_AsyncResource_BatchSize,
+                               STATGROUP_RTSAsyncQueries);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Resource Request Latency P50 (ms)"), STAT_AsyncResource_LatencyP50,
+                               STATGROUP_RTSAsyncQueries);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Resource Request Latency P99 (ms)"), STAT_AsyncResource_LatencyP99,
+                               STATGROUP_RTSAsyncQueries);
+
 FGetAsyncResource::FGetAsyncResource()
 	: bM_StopThread(false)
+	  , M_WakeEvent(FPlatformProcess::GetSynchEventFromPool(false))
 {
 	M_Thread = FRunnableThread::Create(this, TEXT("AsyncGetResourceThread"));
 }
@@ -18,17 +28,21 @@ FGetAsyncResource::~FGetAsyncResource()
 		delete M_Thread;
 		M_Thread = nullptr;
 	}
+	FPlatformProcess::ReturnSynchEventToPool(M_WakeEvent);
+	M_WakeEvent = nullptr;
 }
 
 void FGetAsyncResource::ScheduleDropOffDataUpdate(const TArray<FAsyncDropOffData>& DropOffData)
 {
 	// Const reference lvalue DropOffData is copied to rvalue DropOffData.
 	M_PendingDropOffDataUpdates.Enqueue(DropOffData);
+	M_WakeEvent->Trigger();
 }
 
 void FGetAsyncResource::ScheduleResourceDataUpdate(const TArray<FAsyncResourceData>& ResourceData)
 {
 	M_PendingResourceDataUpdates.Enqueue(ResourceData);
+	M_WakeEvent->Trigger();
 }
 
 bool FGetAsyncResource::Init()
@@ -40,6 +54,17 @@ uint32 FGetAsyncResource::Run()
 {
 	while (!bM_StopThread)
 	{
+		M_WakeEvent->Wait(DeveloperSettings::Async::AsyncQueryThreadMaxIdleWaitMs);
+		if (bM_StopThread)
+		{
+			break;
+		}
+		if constexpr (DeveloperSettings::Async::AsyncGetResourceThreadCoalescingWindow > 0.f)
+		{
+			// Let requests issued in the same frame arrive so they are handled as one batch.
+			FPlatformProcess::Sleep(DeveloperSettings::Async::AsyncGetResourceThreadCoalescingWindow);
+		}
+
 		// Process any pending Resource System data updates
 		TArray<FAsyncDropOffData> NewDropOffData;
 		while (M_PendingDropOffDataUpdates.Dequeue(NewDropOffData))
@@ -53,11 +78,12 @@ uint32 FGetAsyncResource::Run()
 			M_ResourceData = MoveTemp(NewResourceData);
 		}
 
+		const int32 QueueDepth = M_PendingRequestCount.GetValue();
 		ProcessDropOffRequests();
 		ProcessResourceRequests();
 
-		// Sleep to prevent tight loop
-		FPlatformProcess::Sleep(DeveloperSettings::Async::AsyncGetResourceThreadUpdateInterval);
+		const int32 BatchSize = M_GameThreadBatch.DispatchToGameThread();
+		ReportStats(QueueDepth, BatchSize);
 	}
 	return 0;
 }
@@ -106,10 +132,12 @@ void FGetAsyncResource::ProcessDropOffRequests()
 		{
 			FoundDropOffs.Add(Candidates[i].Value);
 		}
+		M_PendingRequestCount.Decrement();
+		M_RequestLatency.AddSample(Request.EnqueueTimeSeconds, FPlatformTime::Seconds());
 		auto RequestCallback = MoveTemp(Request.Callback);
 
-		// Trigger callback back on the Game Thread:
-		AsyncTask(ENamedThreads::GameThread, [RequestCallback, FoundDropOffs]()
+		// Trigger callback back on the Game Thread, batched with the other results of this wakeup.
+		M_GameThreadBatch.Add([RequestCallback = MoveTemp(RequestCallback), FoundDropOffs = MoveTemp(FoundDropOffs)]()
 		{
 			RequestCallback(FoundDropOffs);
 		});
@@ -152,19 +180,47 @@ void FGetAsyncResource::ProcessResourceRequests()
 		{
 			FoundResources.Add(Candidates[i].Value);
 		}
+		M_PendingRequestCount.Decrement();
+		M_RequestLatency.AddSample(Request.EnqueueTimeSeconds, FPlatformTime::Seconds());
 		auto RequestCallback = MoveTemp(Request.Callback);
 
-		// Trigger callback back on the Game Thread:
-		AsyncTask(ENamedThreads::GameThread, [RequestCallback, FoundResources]()
+		// Trigger callback back on the Game Thread, batched with the other results of this wakeup.
+		M_GameThreadBatch.Add([RequestCallback = MoveTemp(RequestCallback), FoundResources = MoveTemp(FoundResources)]()
 		{
 			RequestCallback(FoundResources);
 		});
 	}
 }
 
+void FGetAsyncResource::ReportStats(const int32 QueueDepth, const int32 BatchSize) const
+{
+	SET_DWORD_STAT(STAT_AsyncResource_QueueDepth, QueueDepth);
+	SET_DWORD_STAT(STAT_AsyncResource_BatchSize, BatchSize);
+#if STATS || RTS_WITH_PERF_BENCHMARK_SHIPPING_TESTS
+	// Without stats or the benchmark nothing reads the percentiles, so skip sorting the window.
+	const float LatencyP50Ms = M_RequestLatency.GetPercentileMs(0.5f);
+	const float LatencyP99Ms = M_RequestLatency.GetPercentileMs(0.99f);
+	SET_FLOAT_STAT(STAT_AsyncResource_LatencyP50, LatencyP50Ms);
+	SET_FLOAT_STAT(STAT_AsyncResource_LatencyP99, LatencyP99Ms);
+#endif
+#if RTS_WITH_PERF_BENCHMARK_SHIPPING_TESTS
+	M_PerfBenchmarkLatencyP50Ms.store(LatencyP50Ms, std::memory_order_relaxed);
+	M_PerfBenchmarkLatencyP99Ms.store(LatencyP99Ms, std::memory_order_relaxed);
+#endif
+}
+
+#if RTS_WITH_PERF_BENCHMARK_SHIPPING_TESTS
+void FGetAsyncResource::PerfBenchmark_GetResourceRequestLatency(float& OutP50Ms, float& OutP99Ms) const
+{
+	OutP50Ms = M_PerfBenchmarkLatencyP50Ms.load(std::memory_order_relaxed);
+	OutP99Ms = M_PerfBenchmarkLatencyP99Ms.load(std::memory_order_relaxed);
+}
+#endif
+
 void FGetAsyncResource::Stop()
 {
 	bM_StopThread = true;
+	M_WakeEvent->Trigger();
 	FRunnable::Stop();
 }
 
@@ -185,9 +241,12 @@ void FGetAsyncResource::ScheduleDropOffRequest(
 	NewRequest.DropOffAmount = DropOffAmount;
 	NewRequest.ResourceType = ResourceType;
 	NewRequest.Callback = MoveTemp(Callback);
+	NewRequest.EnqueueTimeSeconds = FPlatformTime::Seconds();
 
 	// Enqueue the request, so it can be processed on Run()
 	M_DropOffRequestQueue.Enqueue(MoveTemp(NewRequest));
+	M_PendingRequestCount.Increment();
+	M_WakeEvent->Trigger();
 }
 
 void FGetAsyncResource::ScheduleResourceRequest(
@@ -202,7 +261,10 @@ void FGetAsyncResource::ScheduleResourceRequest(
 	NewRequest.NumResources = NumResources;
 	NewRequest.ResourceType = ResourceType;
 	NewRequest.Callback = MoveTemp(Callback);
+	NewRequest.EnqueueTimeSeconds = FPlatformTime::Seconds();
 
 	// Enqueue the request, so it can be processed on Run()
 	M_ResourceRequestQueue.Enqueue(MoveTemp(NewRequest));
+	M_PendingRequestCount.Increment();
+	M_WakeEvent->Trigger();
 }
@@ -6,11 +6,19 @@
 #include "HAL/RunnableThread.h"
 #include "Containers/Queue.h"
 #include "Delegates/Delegate.h"
+#include "RTS_Survival/Game/GameState/AsyncQueryBatching/AsyncQueryBatching.h"
+#include "RTS_Survival/UnitTests/PerfBenchmarkShippingTestsDefine.h"
 #include "Templates/Function.h"
+#include <atomic>
 
 enum class ERTSResourceType : uint8;
 class UResourceDropOff;
+class FEvent;
 
+/**
+ * @brief Finds the closest resources and drop-offs for harvesters off the game thread.
+ * Sleeps on an event until a request or new data arrives; all results of one wakeup reach the game thread as one task.
+ */
 class FGetAsyncResource : public FRunnable
 {
 public:
@@ -50,9 +58,34 @@ private:
 	void ProcessDropOffRequests();
 	void ProcessResourceRequests();
 	
+	void ReportStats(const int32 QueueDepth, const int32 BatchSize) const;
+
+#if RTS_WITH_PERF_BENCHMARK_SHIPPING_TESTS
+public:
+	/** @brief Game thread safe read of the drop-off and resource request latency percentiles of the latest wakeup. */
+	void PerfBenchmark_GetResourceRequestLatency(float& OutP50Ms, float& OutP99Ms) const;
+
+private:
+	// Stats are compiled out in shipping, so the benchmark target publishes the percentiles itself.
+	mutable std::atomic<float> M_PerfBenchmarkLatencyP50Ms{0.f};
+	mutable std::atomic<float> M_PerfBenchmarkLatencyP99Ms{0.f};
+#endif
+
 	/** Flag to signal the thread to stop */
 	FThreadSafeBool bM_StopThread;
 
+	/** Auto-reset event the thread sleeps on; triggered by new requests, data updates and Stop. */
+	FEvent* M_WakeEvent;
+
+	/** Amount of drop-off and resource requests enqueued but not yet processed. */
+	FThreadSafeCounter M_PendingRequestCount;
+
+	/** Results of the current wakeup, sent to the game thread as one task. */
+	FAsyncGameThreadCallbackBatch M_GameThreadBatch;
+
+	/** Enqueue-to-result latency of recent drop-off and resource requests. */
+	FAsyncQueryLatencyTracker M_RequestLatency;
+
 	FRunnableThread* M_Thread;
 
     struct FDropOffRequest
@@ -64,6 +97,7 @@ private:
         int32 DropOffAmount;
         ERTSResourceType ResourceType;
         TFunction<void(const TArray<TWeakObjectPtr<UResourceDropOff>>&)> Callback;
+        double EnqueueTimeSeconds;
     };
 
 	struct FResourceRequest
@@ -73,6 +107,7 @@ private:
 		int32 NumResources;
 		ERTSResourceType ResourceType;
 		TFunction<void(const TArray<TWeakObjectPtr<UResourceComponent>>&)> Callback;
+		double EnqueueTimeSeconds;
 	};
 
 	TQueue<FDropOffRequest> M_DropOffRequestQueue;
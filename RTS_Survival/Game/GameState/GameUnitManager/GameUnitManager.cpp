@@ -13,6 +13,8 @@
 #include "RTS_Survival/Interfaces/Commands.h"
 #include "RTS_Survival/MasterObjects/HealthBase/HPActorObjectsMaster.h"
 #include "RTS_Survival/MasterObjects/HealthBase/HpPawnMaster.h"
+#include "RTS_Survival/MasterObjects/SelectableBase/SelectableActorObjectsMaster.h"
+#include "RTS_Survival/MasterObjects/SelectableBase/SelectablePawnMaster.h"
 #include "RTS_Survival/RTSComponents/RTSComponent.h"
 #include "RTS_Survival/RTSComponents/HealthComponent.h"
 #include "RTS_Survival/RTSComponents/RTSOptimizer/RTSOptimizer.h"
@@ -631,13 +633,19 @@ void UGameUnitManager::UpdateActorData()
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(UpdateActorData);
 
-	TMap<uint32, TPair<ETargetPreference, FVector>> EnemyActorData;
-	TMap<uint32, TPair<ETargetPreference, FVector>> PlayerActorData;
+	if (not M_AsyncTargetProcessor)
+	{
+		return;
+	}
+
+	// Fill the snapshot in place; the async thread picks it up on publish without any copy.
+	FAsyncTargetSnapshot& TargetSnapshot = M_AsyncTargetProcessor->GetTargetSnapshotWriteBuffer();
+	TargetSnapshot.Reset();
+	TargetSnapshot.Reserve(M_PlayerActorIDToActorMap.Num() + M_EnemyActorIDToActorMap.Num());
 
-	// Obtain the pair data where the target type is set together with the location and can be identified with the
-	// unique actor ID.
-	GetAsyncActorData(false, EnemyActorData);
-	GetAsyncActorData(true, PlayerActorData);
+	// Obtain the target type together with the location, identified with the unique actor ID.
+	GetAsyncActorData(false, TargetSnapshot);
+	GetAsyncActorData(true, TargetSnapshot);
 
 	// safe logs inside UpdateActorData:
 	auto SafeName = [](AActor* In) -> FString
@@ -647,23 +655,21 @@ void UGameUnitManager::UpdateActorData()
 
 	if constexpr (DeveloperSettings::Debugging::GUnitManager_Compile_DebugSymbols)
 	{
-		for (const auto& EachEnemy : EnemyActorData)
+		for (int32 EntryIndex = 0; EntryIndex < TargetSnapshot.Num(); ++EntryIndex)
 		{
-			AActor* Actor = M_EnemyActorIDToActorMap.FindRef(EachEnemy.Key);
+			const uint32 ActorID = TargetSnapshot.ActorIDs[EntryIndex];
+			if (TargetSnapshot.OwningPlayers[EntryIndex] == 1)
+			{
+				AActor* Actor = M_PlayerActorIDToActorMap.FindRef(ActorID);
+				RTSFunctionLibrary::PrintString("Player Actor game state: " + SafeName(Actor), FColor::Green);
+				continue;
+			}
+			AActor* Actor = M_EnemyActorIDToActorMap.FindRef(ActorID);
 			RTSFunctionLibrary::PrintString("Enemy Actor game state: " + SafeName(Actor), FColor::Red);
 		}
-		for (const auto& EachPlayer : PlayerActorData)
-		{
-			AActor* Actor = M_PlayerActorIDToActorMap.FindRef(EachPlayer.Key);
-			RTSFunctionLibrary::PrintString("Player Actor game state: " + SafeName(Actor), FColor::Green);
-		}
 	}
 
-	// Schedule the actor data update on the async thread
-	if (M_AsyncTargetProcessor)
-	{
-		M_AsyncTargetProcessor->ScheduleUpdateActorData(EnemyActorData, PlayerActorData);
-	}
+	M_AsyncTargetProcessor->PublishTargetSnapshot();
 }
 
 void UGameUnitManager::UpdateDetailedActorData()
@@ -675,7 +681,9 @@ void UGameUnitManager::UpdateDetailedActorData()
 		return;
 	}
 
-	TArray<FAsyncDetailedUnitState> DetailedUnitStates;
+	// Fill the snapshot in place; the async thread picks it up on publish without any copy.
+	TArray<FAsyncDetailedUnitState>& DetailedUnitStates = M_AsyncTargetProcessor->GetDetailedSnapshotWriteBuffer();
+	DetailedUnitStates.Reset();
 	const int32 EstimatedSize = M_TankMastersAlivePlayer.Num()
 		+ M_TankMastersAliveEnemy.Num()
 		+ M_AircraftMastersAlivePlayer.Num()
@@ -705,7 +713,7 @@ void UGameUnitManager::UpdateDetailedActorData()
 		GameUnitManagerDetailedState::AppendDetailedUnitState(SquadController, DetailedUnitStates);
 	}
 
-	M_AsyncTargetProcessor->ScheduleUpdateDetailedActorData(DetailedUnitStates);
+	M_AsyncTargetProcessor->PublishDetailedSnapshot();
 }
 
 void UGameUnitManager::RequestClosestTargets(
@@ -1109,6 +1117,52 @@ TArray<ATankMaster*> UGameUnitManager::GetPlayerTanks(const uint8 Player) const
 	return M_TankMastersAliveEnemy;
 }
 
+void UGameUnitManager::GetPlayerSelectionCandidates(
+	TArray<ASquadUnit*>& OutSquadUnits,
+	TArray<ASelectableActorObjectsMaster*>& OutSelectableActors,
+	TArray<ASelectablePawnMaster*>& OutSelectablePawns) const
+{
+	OutSquadUnits.Reset(M_SquadUnitAlivePlayer.Num());
+	OutSelectableActors.Reset(M_BxpAlivePlayer.Num() + M_ActorsAlivePlayer.Num());
+	OutSelectablePawns.Reset(
+		M_TankMastersAlivePlayer.Num() + M_AircraftMastersAlivePlayer.Num() + M_ActorsAlivePlayer.Num());
+
+	OutSquadUnits.Append(M_SquadUnitAlivePlayer);
+	OutSelectablePawns.Append(M_TankMastersAlivePlayer);
+	OutSelectablePawns.Append(M_AircraftMastersAlivePlayer);
+	OutSelectableActors.Append(M_BxpAlivePlayer);
+	for (AActor* EachActor : M_ActorsAlivePlayer)
+	{
+		if (ASelectablePawnMaster* SelectablePawn = Cast<ASelectablePawnMaster>(EachActor))
+		{
+			OutSelectablePawns.Add(SelectablePawn);
+		}
+		else if (ASelectableActorObjectsMaster* SelectableActor = Cast<ASelectableActorObjectsMaster>(EachActor))
+		{
+			OutSelectableActors.Add(SelectableActor);
+		}
+	}
+}
+
+void UGameUnitManager::GetAliveUnitsOfTeam(const uint8 Player, TArray<AActor*>& OutUnits) const
+{
+	const bool bIsPlayerTeam = Player == 1;
+	const TArray<ASquadUnit*>& SquadUnits = bIsPlayerTeam ? M_SquadUnitAlivePlayer : M_SquadUnitsAliveEnemy;
+	const TArray<ATankMaster*>& Tanks = bIsPlayerTeam ? M_TankMastersAlivePlayer : M_TankMastersAliveEnemy;
+	const TArray<AAircraftMaster*>& Aircraft = bIsPlayerTeam
+		                                           ? M_AircraftMastersAlivePlayer
+		                                           : M_AircraftMastersAliveEnemy;
+	const TArray<ABuildingExpansion*>& Bxps = bIsPlayerTeam ? M_BxpAlivePlayer : M_BxpAliveEnemy;
+	const TArray<AActor*>& Actors = bIsPlayerTeam ? M_ActorsAlivePlayer : M_ActorsAliveEnemy;
+
+	OutUnits.Reset(SquadUnits.Num() + Tanks.Num() + Aircraft.Num() + Bxps.Num() + Actors.Num());
+	OutUnits.Append(SquadUnits);
+	OutUnits.Append(Tanks);
+	OutUnits.Append(Aircraft);
+	OutUnits.Append(Bxps);
+	OutUnits.Append(Actors);
+}
+
 #if RTS_WITH_SHIPPING_MAP_TESTS
 TArray<AAircraftMaster*> UGameUnitManager::ShippingTest_GetAircraftOfPlayer(const uint8 Player) const
 {
@@ -1121,6 +1175,20 @@ TArray<AAircraftMaster*> UGameUnitManager::ShippingTest_GetAircraftOfPlayer(cons
 }
 #endif
 
+#if RTS_WITH_PERF_BENCHMARK_SHIPPING_TESTS
+bool UGameUnitManager::PerfBenchmark_GetAsyncTargetLatency(float& OutP50Ms, float& OutP99Ms) const
+{
+	if (not M_AsyncTargetProcessor)
+	{
+		OutP50Ms = 0.f;
+		OutP99Ms = 0.f;
+		return false;
+	}
+	M_AsyncTargetProcessor->PerfBenchmark_GetTargetRequestLatency(OutP50Ms, OutP99Ms);
+	return true;
+}
+#endif
+
 
 
 void UGameUnitManager::IncrementTankOrNomadicCounter(ATankMaster* Tank, const uint8 Player)
@@ -1790,8 +1858,7 @@ void UGameUnitManager::OnTargetIDsReceived(
 
 
 void
-UGameUnitManager::GetAsyncActorData(const bool bGetPlayerUnits,
-                                    TMap<uint32, TPair<ETargetPreference, FVector>>& OutActorData)
+UGameUnitManager::GetAsyncActorData(const bool bGetPlayerUnits, FAsyncTargetSnapshot& OutTargetSnapshot)
 {
 	TArray<ATankMaster*>* TargetTankMasters;
 	TArray<ASquadUnit*>* TargetSquadUnits;
@@ -1803,6 +1870,8 @@ UGameUnitManager::GetAsyncActorData(const bool bGetPlayerUnits,
 	// If we are checking player units then the enemy is player 2 (CPU)
 	// If we are checking CPU units then the enemy is player 1 (Player)
 	const int32 EnemyOfCheckedUnit = bGetPlayerUnits ? 2 : 1;
+	const uint8 OwnerOfCheckedUnit = bGetPlayerUnits ? 1 : 2;
+	const int32 SnapshotNumBefore = OutTargetSnapshot.Num();
 
 	if (bGetPlayerUnits)
 	{
@@ -1835,7 +1904,7 @@ UGameUnitManager::GetAsyncActorData(const bool bGetPlayerUnits,
 		}
 		const uint32 ActorID = Actor->GetUniqueID();
 		CurrentActorIDMapping->Add(ActorID, Actor);
-		OutActorData.Add({ActorID, CreatePair(Actor->GetActorLocation(), ETargetPreference::Building)});
+		OutTargetSnapshot.Add(ActorID, Actor->GetActorLocation(), ETargetPreference::Building, OwnerOfCheckedUnit);
 	}
 
 	// Tanks
@@ -1847,7 +1916,7 @@ UGameUnitManager::GetAsyncActorData(const bool bGetPlayerUnits,
 		}
 		const uint32 ActorID = EachTank->GetUniqueID();
 		CurrentActorIDMapping->Add(ActorID, EachTank);
-		OutActorData.Add({ActorID, CreatePair(EachTank->GetActorLocation(), ETargetPreference::Tank)});
+		OutTargetSnapshot.Add(ActorID, EachTank->GetActorLocation(), ETargetPreference::Tank, OwnerOfCheckedUnit);
 	}
 
 	// Squads
@@ -1859,7 +1928,7 @@ UGameUnitManager::GetAsyncActorData(const bool bGetPlayerUnits,
 		}
 		const uint32 ActorID = EachSquadUnit->GetUniqueID();
 		CurrentActorIDMapping->Add(ActorID, EachSquadUnit);
-		OutActorData.Add({ActorID, CreatePair(EachSquadUnit->GetActorLocation(), ETargetPreference::Infantry)});
+		OutTargetSnapshot.Add(ActorID, EachSquadUnit->GetActorLocation(), ETargetPreference::Infantry, OwnerOfCheckedUnit);
 	}
 
 	// Aircraft
@@ -1871,7 +1940,7 @@ UGameUnitManager::GetAsyncActorData(const bool bGetPlayerUnits,
 		}
 		const uint32 ActorID = EachAircraft->GetUniqueID();
 		CurrentActorIDMapping->Add(ActorID, EachAircraft);
-		OutActorData.Add({ActorID, CreatePair(EachAircraft->GetActorLocation(), ETargetPreference::Aircraft)});
+		OutTargetSnapshot.Add(ActorID, EachAircraft->GetActorLocation(), ETargetPreference::Aircraft, OwnerOfCheckedUnit);
 	}
 
 	//  BXPs
@@ -1883,14 +1952,15 @@ UGameUnitManager::GetAsyncActorData(const bool bGetPlayerUnits,
 		}
 		const uint32 ActorID = EachBxp->GetUniqueID();
 		CurrentActorIDMapping->Add(ActorID, EachBxp);
-		OutActorData.Add({ActorID, CreatePair(EachBxp->GetActorLocation(), ETargetPreference::Building)});
+		OutTargetSnapshot.Add(ActorID, EachBxp->GetActorLocation(), ETargetPreference::Building, OwnerOfCheckedUnit);
 	}
 
 	if constexpr (DeveloperSettings::Debugging::GAsyncTargetFinding_Compile_DebugSymbols)
 	{
 		const FString Owner = bGetPlayerUnits ? TEXT("Player") : TEXT("Enemy");
 		RTSFunctionLibrary::PrintString(
-			TEXT("Amount of ") + Owner + TEXT(" possible targetable units ") + FString::FromInt(OutActorData.Num()),
+			TEXT("Amount of ") + Owner + TEXT(" possible targetable units ") +
+			FString::FromInt(OutTargetSnapshot.Num() - SnapshotNumBefore),
 			FColor::Purple);
 	}
 }
@@ -2028,12 +2098,6 @@ AActor* UGameUnitManager::FindBxpUnitOfPlayer(const EBuildingExpansionType BxpSu
 }
 
 
-TPair<ETargetPreference, FVector> UGameUnitManager::CreatePair(const FVector& ActorLocation,
-                                                               const ETargetPreference& Preference)
-{
-	return {Preference, ActorLocation};
-}
-
 void UGameUnitManager::ApplyTechToTanksOfPlayer(
 	UTechnologyEffect* TechEffect,
 	const TArray<ETankSubtype>& TankSubtypes,
@@ -7,6 +7,7 @@
 #include "RTS_Survival/Game/UserSettings/GameplaySettings/HealthbarVisibilityStrategy/HealthBarVisibilityStrategy.h"
 #include "RTS_Survival/Units/Aircraft/AircraftMaster/AAircraftMaster.h"
 #include "RTS_Survival/Units/Squads/SquadUnit/SquadUnit.h"
+#include "RTS_Survival/UnitTests/PerfBenchmarkShippingTestsDefine.h"
 #include "UObject/Object.h"
 #include "GameUnitManager.generated.h"
 
@@ -24,9 +25,12 @@ enum class ENomadicSubtype : uint8;
 enum class ETankSubtype : uint8;
 struct FTrainingOption;
 class AHpPawnMaster;
+class ASelectableActorObjectsMaster;
+class ASelectablePawnMaster;
 class UHealthComponent;
 enum class ETargetPreference : uint8;
 class FGetAsyncTarget;
+struct FAsyncTargetSnapshot;
 class ASquadUnit;
 class ATankMaster;
 struct FStrategicAIRequestBatch;
@@ -166,10 +170,32 @@ public:
 	 */
 	TArray<ATankMaster*> GetPlayerTanks(const uint8 Player) const;
 
+	/**
+	 * @brief Collects the alive units of player 1 grouped by the selectable base class marquee selection works with.
+	 * Tanks and aircraft are selectable pawns, building expansions are selectable actors.
+	 * @note Only units whose RTS component registered them with the game state are collected.
+	 */
+	void GetPlayerSelectionCandidates(
+		TArray<ASquadUnit*>& OutSquadUnits,
+		TArray<ASelectableActorObjectsMaster*>& OutSelectableActors,
+		TArray<ASelectablePawnMaster*>& OutSelectablePawns) const;
+
+	/**
+	 * @brief Collects every alive unit of the player's team: squad units, tanks, aircraft, building expansions and
+	 * other registered actors. Player 1 is the player team, any other player the enemy team.
+	 * @param OutUnits Reset and filled with the units.
+	 */
+	void GetAliveUnitsOfTeam(const uint8 Player, TArray<AActor*>& OutUnits) const;
+
 #if RTS_WITH_SHIPPING_MAP_TESTS
 	TArray<AAircraftMaster*> ShippingTest_GetAircraftOfPlayer(uint8 Player) const;
 #endif
 
+#if RTS_WITH_PERF_BENCHMARK_SHIPPING_TESTS
+	/** @return False if the async target thread is not running. */
+	bool PerfBenchmark_GetAsyncTargetLatency(float& OutP50Ms, float& OutP99Ms) const;
+#endif
+
 	void ApplyTechToTanksOfPlayer(UTechnologyEffect* TechEffect, const TArray<ETankSubtype>& TankSubtypes, uint8 Player) const;
 	void ApplyTechToNomadicsOfPlayer(UTechnologyEffect* TechEffect, const TArray<ENomadicSubtype>& NomadicSubtypes, uint8 Player) const;
 	void ApplyTechToSquadsOfPlayer(UTechnologyEffect* TechEffect, const TArray<ESquadSubtype>& SquadSubtypes, uint8 Player) const;
@@ -388,16 +414,13 @@ private:
 		const TArray<uint32>& TargetIDs,
 		TFunction<void(const TArray<AActor*>&)> Callback, int32 OwningPlayer);
 
-	TPair<ETargetPreference, FVector> CreatePair(const FVector& ActorLocation, const ETargetPreference& Preference);
-
 	/**
-	 * @brief Helper to get one array with valid target data computed over all different unit arrays.
+	 * @brief Helper to append valid target data computed over all different unit arrays of one player.
 	 * @param bGetPlayerUnits Whether to look through the player units or the enemy units. 
-	 * @param OutActorData The cumulated data over all different unit type arrays, those units are valid targets
-	 *  and are visible.
+	 * @param OutTargetSnapshot Appended with the data over all different unit type arrays, those units are valid
+	 *  targets and are visible.
 	 */
-	void GetAsyncActorData(const bool bGetPlayerUnits,
-	                       TMap<uint32, TPair<ETargetPreference, FVector>>& OutActorData);
+	void GetAsyncActorData(const bool bGetPlayerUnits, FAsyncTargetSnapshot& OutTargetSnapshot);
 
 	AActor* FindTankUnitOfPlayer(const ETankSubtype TankSubtype, const int32 OwningPlayer) const;
 	AActor* FindAircraftUnitOfPlayer(const EAircraftSubtype AircraftSubtype, const int32 OwningPlayer) const;
@@ -0,0 +1,272 @@
+#include "AsyncTargetSpatialGrid.h"
+
+#include "AsyncUnitSnapshot.h"
+
+namespace AsyncTargetSpatialGridConstants
+{
+	// Roughly the size of a typical aggro range so most requests touch a 3x3 block of cells.
+	constexpr double PreferredCellSize = 2500.0;
+	// Caps the per-layer offset tables; very spread out snapshots get larger cells instead.
+	constexpr int32 MaxCellsPerAxis = 128;
+}
+
+namespace
+{
+	/** @return True if Left is a closer target than Right; ties are broken on ID to keep results deterministic. */
+	bool GetIsCloserCandidate(const TPair<float, uint32>& Left, const TPair<float, uint32>& Right)
+	{
+		if (Left.Key != Right.Key)
+		{
+			return Left.Key < Right.Key;
+		}
+		return Left.Value < Right.Value;
+	}
+
+	bool GetCanUseLayerForTargetRequest(
+		const ETargetPreference LayerType,
+		const ETargetPreference RequestTargetPreference)
+	{
+		if (LayerType != ETargetPreference::Aircraft)
+		{
+			return true;
+		}
+
+		return RequestTargetPreference == ETargetPreference::Aircraft;
+	}
+}
+
+FAsyncTargetSpatialGrid::FAsyncTargetSpatialGrid()
+	: M_Origin(FVector2D::ZeroVector)
+	  , M_CellSize(AsyncTargetSpatialGridConstants::PreferredCellSize)
+	  , M_CellsX(0)
+	  , M_CellsY(0)
+	  , M_NumEntries(0)
+{
+}
+
+void FAsyncTargetSpatialGrid::Rebuild(const FAsyncTargetSnapshot& Snapshot, const uint8 OwningPlayer)
+{
+	for (FPreferenceLayer& Layer : M_Layers)
+	{
+		Layer.CellStarts.Reset();
+		Layer.Locations.Reset();
+		Layer.ActorIDs.Reset();
+	}
+
+	M_NumEntries = 0;
+	FBox2D Bounds(ForceInit);
+	for (int32 EntryIndex = 0; EntryIndex < Snapshot.Num(); ++EntryIndex)
+	{
+		if (Snapshot.OwningPlayers[EntryIndex] != OwningPlayer)
+		{
+			continue;
+		}
+		Bounds += FVector2D(Snapshot.Locations[EntryIndex]);
+		++M_NumEntries;
+	}
+	if (M_NumEntries == 0)
+	{
+		M_CellsX = 0;
+		M_CellsY = 0;
+		return;
+	}
+
+	const FVector2D Extent = Bounds.Max - Bounds.Min;
+	const double LargestAxis = FMath::Max(Extent.X, Extent.Y);
+	M_CellSize = FMath::Max(
+		AsyncTargetSpatialGridConstants::PreferredCellSize,
+		LargestAxis / AsyncTargetSpatialGridConstants::MaxCellsPerAxis);
+	M_Origin = Bounds.Min;
+	M_CellsX = FMath::Clamp(FMath::FloorToInt32(Extent.X / M_CellSize) + 1, 1,
+	                        AsyncTargetSpatialGridConstants::MaxCellsPerAxis);
+	M_CellsY = FMath::Clamp(FMath::FloorToInt32(Extent.Y / M_CellSize) + 1, 1,
+	                        AsyncTargetSpatialGridConstants::MaxCellsPerAxis);
+	const int32 NumCells = M_CellsX * M_CellsY;
+
+	// Counting sort: count entries per cell, prefix-sum into offsets, then scatter.
+	for (FPreferenceLayer& Layer : M_Layers)
+	{
+		Layer.CellStarts.SetNumZeroed(NumCells + 1);
+	}
+	for (int32 EntryIndex = 0; EntryIndex < Snapshot.Num(); ++EntryIndex)
+	{
+		if (Snapshot.OwningPlayers[EntryIndex] != OwningPlayer)
+		{
+			continue;
+		}
+		FPreferenceLayer& Layer = M_Layers[static_cast<int32>(Snapshot.TargetTypes[EntryIndex])];
+		++Layer.CellStarts[GetCellIndex(Snapshot.Locations[EntryIndex]) + 1];
+	}
+	for (FPreferenceLayer& Layer : M_Layers)
+	{
+		for (int32 CellIndex = 1; CellIndex <= NumCells; ++CellIndex)
+		{
+			Layer.CellStarts[CellIndex] += Layer.CellStarts[CellIndex - 1];
+		}
+		const int32 LayerNum = Layer.CellStarts[NumCells];
+		Layer.Locations.SetNumUninitialized(LayerNum);
+		Layer.ActorIDs.SetNumUninitialized(LayerNum);
+	}
+
+	for (int32 LayerIndex = 0; LayerIndex < NumPreferenceLayers; ++LayerIndex)
+	{
+		M_WriteCursors[LayerIndex] = M_Layers[LayerIndex].CellStarts;
+	}
+	for (int32 EntryIndex = 0; EntryIndex < Snapshot.Num(); ++EntryIndex)
+	{
+		if (Snapshot.OwningPlayers[EntryIndex] != OwningPlayer)
+		{
+			continue;
+		}
+		const int32 LayerIndex = static_cast<int32>(Snapshot.TargetTypes[EntryIndex]);
+		FPreferenceLayer& Layer = M_Layers[LayerIndex];
+		const FVector& Location = Snapshot.Locations[EntryIndex];
+		const int32 WriteIndex = M_WriteCursors[LayerIndex][GetCellIndex(Location)]++;
+		Layer.Locations[WriteIndex] = Location;
+		Layer.ActorIDs[WriteIndex] = Snapshot.ActorIDs[EntryIndex];
+	}
+}
+
+void FAsyncTargetSpatialGrid::QueryClosestTargets(
+	const FVector& SearchLocation,
+	const float SearchRadius,
+	const int32 NumTargets,
+	const ETargetPreference TargetPreference,
+	TArray<uint32>& OutActorIDs) const
+{
+	OutActorIDs.Reset();
+
+	FIntPoint MinCell;
+	FIntPoint MaxCell;
+	if (not GetCellRange(SearchLocation, SearchRadius, MinCell, MaxCell))
+	{
+		return;
+	}
+
+	// Matches the previous behaviour of always returning at least the closest target.
+	const int32 MaxTargets = FMath::Max(1, NumTargets);
+	const float SearchRadiusSquared = FMath::Square(SearchRadius);
+
+	M_PreferredCandidates.Reset();
+	M_OtherCandidates.Reset();
+	for (int32 LayerIndex = 0; LayerIndex < NumPreferenceLayers; ++LayerIndex)
+	{
+		const ETargetPreference LayerType = static_cast<ETargetPreference>(LayerIndex);
+		if (not GetCanUseLayerForTargetRequest(LayerType, TargetPreference))
+		{
+			continue;
+		}
+
+		TArray<FTargetCandidate>& Heap = LayerType == TargetPreference
+			                                 ? M_PreferredCandidates
+			                                 : M_OtherCandidates;
+		GatherClosestInLayer(M_Layers[LayerIndex], MinCell, MaxCell, SearchLocation, SearchRadiusSquared,
+		                     MaxTargets, Heap);
+	}
+
+	OutActorIDs.Reserve(MaxTargets);
+	AppendSortedCandidates(M_PreferredCandidates, MaxTargets, OutActorIDs);
+	AppendSortedCandidates(M_OtherCandidates, MaxTargets - OutActorIDs.Num(), OutActorIDs);
+}
+
+int32 FAsyncTargetSpatialGrid::GetCellIndex(const FVector& Location) const
+{
+	const int32 CellX = FMath::Clamp(FMath::FloorToInt32((Location.X - M_Origin.X) / M_CellSize), 0, M_CellsX - 1);
+	const int32 CellY = FMath::Clamp(FMath::FloorToInt32((Location.Y - M_Origin.Y) / M_CellSize), 0, M_CellsY - 1);
+	return CellY * M_CellsX + CellX;
+}
+
+bool FAsyncTargetSpatialGrid::GetCellRange(
+	const FVector& SearchLocation,
+	const float SearchRadius,
+	FIntPoint& OutMinCell,
+	FIntPoint& OutMaxCell) const
+{
+	if (M_NumEntries == 0 || SearchRadius < 0.f)
+	{
+		return false;
+	}
+
+	const int32 MinX = FMath::FloorToInt32((SearchLocation.X - SearchRadius - M_Origin.X) / M_CellSize);
+	const int32 MinY = FMath::FloorToInt32((SearchLocation.Y - SearchRadius - M_Origin.Y) / M_CellSize);
+	const int32 MaxX = FMath::FloorToInt32((SearchLocation.X + SearchRadius - M_Origin.X) / M_CellSize);
+	const int32 MaxY = FMath::FloorToInt32((SearchLocation.Y + SearchRadius - M_Origin.Y) / M_CellSize);
+	if (MaxX < 0 || MaxY < 0 || MinX >= M_CellsX || MinY >= M_CellsY)
+	{
+		return false;
+	}
+
+	OutMinCell = FIntPoint(FMath::Max(0, MinX), FMath::Max(0, MinY));
+	OutMaxCell = FIntPoint(FMath::Min(M_CellsX - 1, MaxX), FMath::Min(M_CellsY - 1, MaxY));
+	return true;
+}
+
+void FAsyncTargetSpatialGrid::GatherClosestInLayer(
+	const FPreferenceLayer& Layer,
+	const FIntPoint& MinCell,
+	const FIntPoint& MaxCell,
+	const FVector& SearchLocation,
+	const float SearchRadiusSquared,
+	const int32 MaxCandidates,
+	TArray<FTargetCandidate>& InOutHeap) const
+{
+	if (Layer.ActorIDs.IsEmpty())
+	{
+		return;
+	}
+
+	// Max-heap on distance: the top is the worst candidate kept so far.
+	const auto IsFartherCandidate = [](const FTargetCandidate& Left, const FTargetCandidate& Right)
+	{
+		return GetIsCloserCandidate(Right, Left);
+	};
+
+	for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; ++CellY)
+	{
+		const int32 RowStart = CellY * M_CellsX;
+		// Cells of one row are contiguous in the layer, so walk the row as a single span.
+		const int32 SpanStart = Layer.CellStarts[RowStart + MinCell.X];
+		const int32 SpanEnd = Layer.CellStarts[RowStart + MaxCell.X + 1];
+		for (int32 EntryIndex = SpanStart; EntryIndex < SpanEnd; ++EntryIndex)
+		{
+			const float DistanceSquared = FVector::DistSquared(SearchLocation, Layer.Locations[EntryIndex]);
+			if (DistanceSquared > SearchRadiusSquared)
+			{
+				continue;
+			}
+
+			const FTargetCandidate Candidate(DistanceSquared, Layer.ActorIDs[EntryIndex]);
+			if (InOutHeap.Num() < MaxCandidates)
+			{
+				InOutHeap.HeapPush(Candidate, IsFartherCandidate);
+				continue;
+			}
+			if (GetIsCloserCandidate(Candidate, InOutHeap.HeapTop()))
+			{
+				InOutHeap.HeapPopDiscard(IsFartherCandidate, EAllowShrinking::No);
+				InOutHeap.HeapPush(Candidate, IsFartherCandidate);
+			}
+		}
+	}
+}
+
+void FAsyncTargetSpatialGrid::AppendSortedCandidates(
+	TArray<FTargetCandidate>& Heap,
+	const int32 MaxToAdd,
+	TArray<uint32>& OutActorIDs)
+{
+	if (MaxToAdd <= 0 || Heap.IsEmpty())
+	{
+		return;
+	}
+
+	Heap.Sort([](const FTargetCandidate& Left, const FTargetCandidate& Right)
+	{
+		return GetIsCloserCandidate(Left, Right);
+	});
+	const int32 NumToAdd = FMath::Min(MaxToAdd, Heap.Num());
+	for (int32 Index = 0; Index < NumToAdd; ++Index)
+	{
+		OutActorIDs.Add(Heap[Index].Value);
+	}
+}
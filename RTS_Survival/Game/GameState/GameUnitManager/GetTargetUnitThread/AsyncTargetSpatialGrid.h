@@ -0,0 +1,95 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RTS_Survival/Game/GameState/GameUnitManager/TargetPreference/TargetPreference.h"
+
+struct FAsyncTargetSnapshot;
+
+/**
+ * @brief Flat uniform grid over the target snapshot of one team, bucketed per ETargetPreference.
+ * Rebuilt once per snapshot on the async target thread so closest-target requests only visit the
+ * cells their search radius overlaps instead of every actor of that team.
+ * @note Not thread safe; owned and queried by a single thread.
+ */
+class FAsyncTargetSpatialGrid
+{
+public:
+	FAsyncTargetSpatialGrid();
+
+	/**
+	 * @brief Rebuilds the grid from the entries of one player in a snapshot, previous contents are discarded.
+	 * @param Snapshot Latest target snapshot of both teams.
+	 * @param OwningPlayer Only entries owned by this player are indexed.
+	 */
+	void Rebuild(const FAsyncTargetSnapshot& Snapshot, const uint8 OwningPlayer);
+
+	/**
+	 * @brief Finds the closest actors within the search radius.
+	 * Actors of the preferred type are returned first, closest first, followed by the closest other actors.
+	 * Aircraft are only considered when the preference is Aircraft.
+	 * @param SearchLocation The location from which to search.
+	 * @param SearchRadius The radius within which to search.
+	 * @param NumTargets The maximum number of actor IDs to return.
+	 * @param TargetPreference The preferred target type.
+	 * @param OutActorIDs Reset and filled with the resulting actor IDs.
+	 */
+	void QueryClosestTargets(
+		const FVector& SearchLocation,
+		const float SearchRadius,
+		const int32 NumTargets,
+		const ETargetPreference TargetPreference,
+		TArray<uint32>& OutActorIDs) const;
+
+	int32 Num() const { return M_NumEntries; }
+
+private:
+	/** Entries of one target preference sorted by cell; entries of cell C are [CellStarts[C], CellStarts[C + 1]). */
+	struct FPreferenceLayer
+	{
+		TArray<int32> CellStarts;
+		TArray<FVector> Locations;
+		TArray<uint32> ActorIDs;
+	};
+
+	/** Squared distance and actor ID of a candidate target. */
+	using FTargetCandidate = TPair<float, uint32>;
+
+	static constexpr int32 NumPreferenceLayers = static_cast<int32>(ETargetPreference::Aircraft) + 1;
+
+	FPreferenceLayer M_Layers[NumPreferenceLayers];
+
+	FVector2D M_Origin;
+	double M_CellSize;
+	int32 M_CellsX;
+	int32 M_CellsY;
+	int32 M_NumEntries;
+
+	// Reused between rebuilds to avoid allocating per snapshot.
+	TArray<int32> M_WriteCursors[NumPreferenceLayers];
+
+	// Reused between queries to avoid allocating per request.
+	mutable TArray<FTargetCandidate> M_PreferredCandidates;
+	mutable TArray<FTargetCandidate> M_OtherCandidates;
+
+	int32 GetCellIndex(const FVector& Location) const;
+
+	/** @return False if the search circle does not overlap the grid at all. */
+	bool GetCellRange(const FVector& SearchLocation, const float SearchRadius, FIntPoint& OutMinCell,
+	                  FIntPoint& OutMaxCell) const;
+
+	/**
+	 * @brief Keeps the MaxCandidates closest entries of the layer in a bounded max-heap.
+	 * Avoids sorting every actor in range when only the top N are needed.
+	 */
+	void GatherClosestInLayer(
+		const FPreferenceLayer& Layer,
+		const FIntPoint& MinCell,
+		const FIntPoint& MaxCell,
+		const FVector& SearchLocation,
+		const float SearchRadiusSquared,
+		const int32 MaxCandidates,
+		TArray<FTargetCandidate>& InOutHeap) const;
+
+	static void AppendSortedCandidates(TArray<FTargetCandidate>& Heap, const int32 MaxToAdd,
+	                                   TArray<uint32>& OutActorIDs);
+};
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <atomic>
+
+#include "CoreMinimal.h"
+#include "RTS_Survival/Game/GameState/GameUnitManager/TargetPreference/TargetPreference.h"
+
+/**
+ * @brief Structure-of-arrays snapshot of every visible target of both teams.
+ * Entry i is described by ActorIDs[i], Locations[i], TargetTypes[i] and OwningPlayers[i].
+ */
+struct FAsyncTargetSnapshot
+{
+	TArray<uint32> ActorIDs;
+	TArray<FVector> Locations;
+	TArray<ETargetPreference> TargetTypes;
+	TArray<uint8> OwningPlayers;
+
+	/** Empties the snapshot while keeping the allocations for the next fill. */
+	void Reset()
+	{
+		ActorIDs.Reset();
+		Locations.Reset();
+		TargetTypes.Reset();
+		OwningPlayers.Reset();
+	}
+
+	void Reserve(const int32 Capacity)
+	{
+		ActorIDs.Reserve(Capacity);
+		Locations.Reserve(Capacity);
+		TargetTypes.Reserve(Capacity);
+		OwningPlayers.Reserve(Capacity);
+	}
+
+	void Add(const uint32 ActorID, const FVector& Location, const ETargetPreference TargetType,
+	         const uint8 OwningPlayer)
+	{
+		ActorIDs.Add(ActorID);
+		Locations.Add(Location);
+		TargetTypes.Add(TargetType);
+		OwningPlayers.Add(OwningPlayer);
+	}
+
+	int32 Num() const { return ActorIDs.Num(); }
+};
+
+/**
+ * @brief Lock-free single producer, single consumer triple buffer for async unit snapshots.
+ * The game thread fills the write buffer in place and publishes it with one atomic exchange; the
+ * worker acquires the latest published buffer with another exchange and reads it without copying.
+ * Buffers are recycled so their allocations survive between updates.
+ * @tparam SnapshotType Snapshot container, must be default constructible.
+ */
+template <typename SnapshotType>
+class TAsyncSnapshotTripleBuffer
+{
+public:
+	/** @return Game thread only: the buffer to fill for the next publish. */
+	SnapshotType& GetWriteBuffer() { return M_Buffers[M_WriteIndex]; }
+
+	/** @brief Game thread only: hands the write buffer to the worker and recycles the previously shared one. */
+	void Publish()
+	{
+		const int32 PreviousShared = M_SharedState.exchange(M_WriteIndex | DirtyFlag, std::memory_order_acq_rel);
+		M_WriteIndex = PreviousShared & IndexMask;
+	}
+
+	/**
+	 * @brief Worker only: swaps in the latest published buffer if there is one.
+	 * @return True if a new snapshot was acquired since the last call.
+	 */
+	bool AcquireLatest()
+	{
+		if ((M_SharedState.load(std::memory_order_acquire) & DirtyFlag) == 0)
+		{
+			return false;
+		}
+		const int32 PreviousShared = M_SharedState.exchange(M_ReadIndex, std::memory_order_acq_rel);
+		M_ReadIndex = PreviousShared & IndexMask;
+		return true;
+	}
+
+	/** @return Worker only: the latest acquired snapshot. */
+	const SnapshotType& GetReadBuffer() const { return M_Buffers[M_ReadIndex]; }
+
+private:
+	static constexpr int32 IndexMask = 0x3;
+	static constexpr int32 DirtyFlag = 0x4;
+
+	SnapshotType M_Buffers[3];
+
+	// Owned by the game thread.
+	int32 M_WriteIndex = 0;
+	// Owned by the worker.
+	int32 M_ReadIndex = 1;
+	// Index of the buffer in flight between both threads, with DirtyFlag set when it is unread.
+	std::atomic<int32> M_SharedState{2};
+};
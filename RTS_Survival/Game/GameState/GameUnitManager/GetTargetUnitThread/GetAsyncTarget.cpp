@@ -1,10 +1,22 @@
 ﻿#include "GetAsyncTarget.h"
-#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "HAL/Event.h"
 #include "RTS_Survival/DeveloperSettings.h"
 #include "RTS_Survival/Enemy/StrategicAI/StrategicAIHelpers.h"
+#include "RTS_Survival/Utils/HFunctionLibary.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Target Thread Queue Depth"), STAT_AsyncTarget_QueueDepth,
+                               STATGROUP_RTSAsyncQueries);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Target Thread Batch Size"), STAT_AsyncTarget_BatchSize,
+                               STATGROUP_RTSAsyncQueries);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Target Request Latency P50 (ms)"), STAT_AsyncTarget_LatencyP50,
+                               STATGROUP_RTSAsyncQueries);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Target Request Latency P99 (ms)"), STAT_AsyncTarget_LatencyP99,
+                               STATGROUP_RTSAsyncQueries);
 
 FGetAsyncTarget::FGetAsyncTarget()
 	: bM_StopThread(false)
+	  , M_WakeEvent(FPlatformProcess::GetSynchEventFromPool(false))
 {
 	M_Thread = FRunnableThread::Create(this, TEXT("AsyncGetTargetThread"));
 }
@@ -23,6 +35,8 @@ FGetAsyncTarget::~FGetAsyncTarget()
 		delete M_Thread;
 		M_Thread = nullptr;
 	}
+	FPlatformProcess::ReturnSynchEventToPool(M_WakeEvent);
+	M_WakeEvent = nullptr;
 }
 
 bool FGetAsyncTarget::Init()
@@ -34,30 +48,39 @@ uint32 FGetAsyncTarget::Run()
 {
 	while (not bM_StopThread)
 	{
-		// Process any pending actor data updates
-		TMap<uint32, TPair<ETargetPreference, FVector>> NewActorData;
-		while (M_PendingPlayerActorDataUpdates.Dequeue(NewActorData))
+		M_WakeEvent->Wait(DeveloperSettings::Async::AsyncQueryThreadMaxIdleWaitMs);
+		if (bM_StopThread)
 		{
-			M_PlayerActorData = MoveTemp(NewActorData);
+			break;
 		}
-		while (M_PendingEnemyActorDataUpdates.Dequeue(NewActorData))
+		if constexpr (DeveloperSettings::Async::AsyncGetTargetThreadCoalescingWindow > 0.f)
 		{
-			M_EnemyActorData = MoveTemp(NewActorData);
+			// Let requests issued in the same frame arrive so they are handled as one batch.
+			FPlatformProcess::Sleep(DeveloperSettings::Async::AsyncGetTargetThreadCoalescingWindow);
 		}
 
-		TArray<FAsyncDetailedUnitState> NewDetailedUnitStates;
-		while (M_PendingDetailedUnitStateUpdates.Dequeue(NewDetailedUnitStates))
+		// Only the latest published snapshot is used; snapshots published in between are skipped.
+		if (M_TargetSnapshots.AcquireLatest())
 		{
-			M_DetailedUnitStates = MoveTemp(NewDetailedUnitStates);
+			const FAsyncTargetSnapshot& TargetSnapshot = M_TargetSnapshots.GetReadBuffer();
+			M_PlayerTargetGrid.Rebuild(TargetSnapshot, 1);
+			M_EnemyTargetGrid.Rebuild(TargetSnapshot, 2);
+		}
+		if (M_DetailedSnapshots.AcquireLatest())
+		{
+			M_PlayerThreatGrid.Rebuild(M_DetailedSnapshots.GetReadBuffer());
+			if constexpr (DeveloperSettings::Debugging::GEnemyController_StrategicAIThreatGrid_Compile_DebugSymbols)
+			{
+				UE_LOG(LogRTS, Log, TEXT("%s"), *M_PlayerThreatGrid.BuildDebugString());
+			}
 		}
 
-
-		// Process target requests
+		const int32 QueueDepth = M_PendingRequestCount.GetValue();
 		ProcessTargetRequests();
 		ProcessStrategicAIRequests();
 
-		// Sleep to prevent tight loop
-		FPlatformProcess::Sleep(DeveloperSettings::Async::AsyncGetTargetThreadUpdateInterval);
+		const int32 BatchSize = M_GameThreadBatch.DispatchToGameThread();
+		ReportStats(QueueDepth, BatchSize);
 	}
 
 	return 0;
@@ -66,20 +89,19 @@ uint32 FGetAsyncTarget::Run()
 void FGetAsyncTarget::Stop()
 {
 	bM_StopThread = true;
+	M_WakeEvent->Trigger();
 }
 
-void FGetAsyncTarget::ScheduleUpdateActorData(const TMap<uint32, TPair<ETargetPreference, FVector>>& NewEnemyActorData,
-                                              const TMap<uint32, TPair<ETargetPreference,
-                                                                       FVector>>& NewPlayerActorData)
+void FGetAsyncTarget::PublishTargetSnapshot()
 {
-	// Enqueue the new actor data for processing on the thread
-	M_PendingPlayerActorDataUpdates.Enqueue(NewPlayerActorData);
-	M_PendingEnemyActorDataUpdates.Enqueue(NewEnemyActorData);
+	M_TargetSnapshots.Publish();
+	M_WakeEvent->Trigger();
 }
 
-void FGetAsyncTarget::ScheduleUpdateDetailedActorData(const TArray<FAsyncDetailedUnitState>& NewDetailedUnitStates)
+void FGetAsyncTarget::PublishDetailedSnapshot()
 {
-	M_PendingDetailedUnitStateUpdates.Enqueue(NewDetailedUnitStates);
+	M_DetailedSnapshots.Publish();
+	M_WakeEvent->Trigger();
 }
 
 void FGetAsyncTarget::AddStrategicAIRequest(
@@ -90,6 +112,8 @@ void FGetAsyncTarget::AddStrategicAIRequest(
 	NewRequest.RequestBatch = RequestBatch;
 	NewRequest.Callback = MoveTemp(Callback);
 	M_StrategicAIRequestQueue.Enqueue(MoveTemp(NewRequest));
+	M_PendingRequestCount.Increment();
+	M_WakeEvent->Trigger();
 }
 
 void FGetAsyncTarget::AddTargetRequest(
@@ -110,24 +134,12 @@ void FGetAsyncTarget::AddTargetRequest(
 	NewRequest.OwningPlayer = OwningPlayer;
 	NewRequest.TargetPreference = TargetPreference;
 	NewRequest.Callback = MoveTemp(Callback);
+	NewRequest.EnqueueTimeSeconds = FPlatformTime::Seconds();
 
-	// Enqueue the request
+	// Enqueue the request and wake the thread.
 	M_RequestQueue.Enqueue(MoveTemp(NewRequest));
-}
-
-namespace
-{
-	bool GetCanUseActorForTargetRequest(
-		const ETargetPreference ActorType,
-		const ETargetPreference RequestTargetPreference)
-	{
-		if (ActorType != ETargetPreference::Aircraft)
-		{
-			return true;
-		}
-
-		return RequestTargetPreference == ETargetPreference::Aircraft;
-	}
+	M_PendingRequestCount.Increment();
+	M_WakeEvent->Trigger();
 }
 
 void FGetAsyncTarget::ProcessTargetRequests()
@@ -135,182 +147,273 @@ void FGetAsyncTarget::ProcessTargetRequests()
 	FTargetRequest Request;
 	while (M_RequestQueue.Dequeue(Request))
 	{
-		// Determine which actor data map to search based on the owning player.
-		// If OwningPlayer == 1 (player), search M_EnemyActorData.
-		// If OwningPlayer != 1 (enemy), search M_PlayerActorData.
-		const TMap<uint32, TPair<ETargetPreference, FVector>>* ActorDataMap = Request.OwningPlayer == 1
-			? &M_EnemyActorData
-			: &M_PlayerActorData;
-
-		// Arrays to store actors within range, categorized by preference.
-		TArray<TPair<float, uint32>> PreferredTargets;
-		TArray<TPair<float, uint32>> OtherTargets;
-
-		// Iterate through the actor data map to find actors within range.
-		for (const auto& Pair : *ActorDataMap)
-		{
-			const uint32 ActorID = Pair.Key;
-			const TPair<ETargetPreference, FVector>& ActorInfo = Pair.Value;
-			const ETargetPreference ActorType = ActorInfo.Key;
-			const FVector& ActorLocation = ActorInfo.Value;
-
-			if (not GetCanUseActorForTargetRequest(ActorType, Request.TargetPreference))
-			{
-				continue;
-			}
-
-			const float Distance = FVector::Dist(Request.SearchLocation, ActorLocation);
-			if (Distance > Request.SearchRadius)
-			{
-				continue;
-			}
-
-			// Categorize actors based on the requested target preference.
-			if (ActorType == Request.TargetPreference)
-			{
-				PreferredTargets.Emplace(Distance, ActorID);
-				continue;
-			}
+		// Determine which team to search based on the owning player.
+		// If OwningPlayer == 1 (player), search the enemy actors.
+		// If OwningPlayer != 1 (enemy), search the player actors.
+		const FAsyncTargetSpatialGrid& TargetGrid = Request.OwningPlayer == 1
+			                                            ? M_EnemyTargetGrid
+			                                            : M_PlayerTargetGrid;
+
+		// Preferred targets first, then other targets, both closest first.
+		TArray<uint32> ClosestActorIDs;
+		TargetGrid.QueryClosestTargets(
+			Request.SearchLocation,
+			Request.SearchRadius,
+			Request.NumTargets,
+			Request.TargetPreference,
+			ClosestActorIDs);
 
-			OtherTargets.Emplace(Distance, ActorID);
-		}
+		M_PendingRequestCount.Decrement();
+		M_TargetRequestLatency.AddSample(Request.EnqueueTimeSeconds, FPlatformTime::Seconds());
 
-		// Sort both arrays based on distance to prioritize closer targets.
-		PreferredTargets.Sort([](const TPair<float, uint32>& Left, const TPair<float, uint32>& Right)
-		{
-			return Left.Key < Right.Key;
-		});
+		// Capture the callback and IDs for use in the game thread.
+		TFunction<void(const TArray<uint32>&)> Callback = MoveTemp(Request.Callback);
 
-		OtherTargets.Sort([](const TPair<float, uint32>& Left, const TPair<float, uint32>& Right)
+		// Invoke the callback on the game thread with the collected target IDs, batched with the other results.
+		M_GameThreadBatch.Add([Callback = MoveTemp(Callback), ClosestActorIDs = MoveTemp(ClosestActorIDs)]()
 		{
-			return Left.Key < Right.Key;
+			Callback(ClosestActorIDs);
 		});
+	}
+}
 
-		// Collect the top N targets, filling from preferred targets first.
-		TArray<uint32> ClosestActorIDs;
-		int32 RemainingTargets = Request.NumTargets;
+namespace GetAsyncTargetStrategicAI
+{
+	/** Sub-request families of a strategic AI batch that only read the detailed unit snapshot. */
+	enum class ESnapshotWorkFamily : uint8
+	{
+		ClosestFlankableEnemyHeavy,
+		PlayerUnitCounts,
+		AlliedTanksToRetreat,
+		EnemyBaseClusters,
+		LocationsUnderPlayerAttack,
+		PlayerUnitBulkLocations,
+		MineLocations
+	};
+
+	/** One sub-request to evaluate; the result is written to the matching slot of its batch. */
+	struct FSnapshotWorkItem
+	{
+		int32 BatchIndex = INDEX_NONE;
+		ESnapshotWorkFamily Family = ESnapshotWorkFamily::ClosestFlankableEnemyHeavy;
+		int32 RequestIndex = INDEX_NONE;
+	};
 
-		// Add actors from PreferredTargets.
-		for (const auto& Target : PreferredTargets)
+	struct FConstructionWorkItem
+	{
+		int32 BatchIndex = INDEX_NONE;
+		int32 RequestIndex = INDEX_NONE;
+		// Base-cluster result this request builds against; INDEX_NONE uses the cache of earlier wakeups.
+		int32 BaseClusterBatchIndex = INDEX_NONE;
+		int32 BaseClusterResultIndex = INDEX_NONE;
+	};
+
+	void AddSnapshotWorkItems(
+		const int32 BatchIndex,
+		const ESnapshotWorkFamily Family,
+		const int32 NumRequests,
+		TArray<FSnapshotWorkItem>& OutWorkItems)
+	{
+		for (int32 RequestIndex = 0; RequestIndex < NumRequests; ++RequestIndex)
 		{
-			ClosestActorIDs.Add(Target.Value);
-			RemainingTargets--;
-			if (RemainingTargets <= 0)
-			{
-				break;
-			}
+			OutWorkItems.Add({BatchIndex, Family, RequestIndex});
 		}
+	}
 
-		// If more targets are needed, add actors from OtherTargets.
-		if (RemainingTargets > 0)
+	/** Sizes the result arrays up front so every work item owns a fixed slot and merging keeps request order. */
+	void SizeResultBatch(const FStrategicAIRequestBatch& RequestBatch, FStrategicAIResultBatch& OutResults)
+	{
+		OutResults.FindClosestFlankableEnemyHeavyResults.SetNum(
+			RequestBatch.FindClosestFlankableEnemyHeavyRequests.Num());
+		OutResults.PlayerUnitCountsResults.SetNum(RequestBatch.GetPlayerUnitCountsAndBaseRequests.Num());
+		OutResults.AlliedTanksToRetreatResults.SetNum(RequestBatch.FindAlliedTanksToRetreatRequests.Num());
+		OutResults.EnemyBaseClustersResults.SetNum(RequestBatch.FindEnemyBaseClustersRequests.Num());
+		OutResults.LocationsUnderPlayerAttackResults.SetNum(
+			RequestBatch.FindLocationsUnderPlayerAttackRequests.Num());
+		OutResults.PlayerUnitBulkLocationsResults.SetNum(RequestBatch.FindPlayerUnitBulkLocationsRequests.Num());
+		OutResults.ConstructionLocationsResults.SetNum(RequestBatch.FindConstructionLocationsRequests.Num());
+		OutResults.MineLocationsResults.SetNum(RequestBatch.FindMineLocationsRequests.Num());
+	}
+
+	void EvaluateSnapshotWorkItem(
+		const FSnapshotWorkItem& WorkItem,
+		const FStrategicAIRequestBatch& RequestBatch,
+		const TArray<FAsyncDetailedUnitState>& DetailedUnitStates,
+		const FStrategicAIThreatGrid& PlayerThreatGrid,
+		FStrategicAIResultBatch& OutResults)
+	{
+		const int32 Index = WorkItem.RequestIndex;
+		switch (WorkItem.Family)
 		{
-			for (const auto& Target : OtherTargets)
-			{
-				ClosestActorIDs.Add(Target.Value);
-				RemainingTargets--;
-				if (RemainingTargets <= 0)
-				{
-					break;
-				}
-			}
+		case ESnapshotWorkFamily::ClosestFlankableEnemyHeavy:
+			OutResults.FindClosestFlankableEnemyHeavyResults[Index] =
+				FStrategicAIHelpers::BuildClosestFlankableEnemyHeavyResult(
+					RequestBatch.FindClosestFlankableEnemyHeavyRequests[Index], DetailedUnitStates);
+			return;
+		case ESnapshotWorkFamily::PlayerUnitCounts:
+			OutResults.PlayerUnitCountsResults[Index] = FStrategicAIHelpers::BuildPlayerUnitCountsResult(
+				RequestBatch.GetPlayerUnitCountsAndBaseRequests[Index], DetailedUnitStates);
+			return;
+		case ESnapshotWorkFamily::AlliedTanksToRetreat:
+			OutResults.AlliedTanksToRetreatResults[Index] = FStrategicAIHelpers::BuildAlliedTanksToRetreatResult(
+				RequestBatch.FindAlliedTanksToRetreatRequests[Index], DetailedUnitStates);
+			return;
+		case ESnapshotWorkFamily::EnemyBaseClusters:
+			OutResults.EnemyBaseClustersResults[Index] = FStrategicAIHelpers::BuildEnemyBaseClustersResult(
+				RequestBatch.FindEnemyBaseClustersRequests[Index], DetailedUnitStates);
+			return;
+		case ESnapshotWorkFamily::LocationsUnderPlayerAttack:
+			OutResults.LocationsUnderPlayerAttackResults[Index] =
+				FStrategicAIHelpers::BuildLocationsUnderPlayerAttackResult(
+					RequestBatch.FindLocationsUnderPlayerAttackRequests[Index], DetailedUnitStates, PlayerThreatGrid);
+			return;
+		case ESnapshotWorkFamily::PlayerUnitBulkLocations:
+			OutResults.PlayerUnitBulkLocationsResults[Index] =
+				FStrategicAIHelpers::BuildPlayerUnitBulkLocationsResult(
+					RequestBatch.FindPlayerUnitBulkLocationsRequests[Index], DetailedUnitStates, PlayerThreatGrid);
+			return;
+		case ESnapshotWorkFamily::MineLocations:
+			OutResults.MineLocationsResults[Index] = FStrategicAIHelpers::BuildMineLocationsResult(
+				RequestBatch.FindMineLocationsRequests[Index]);
+			return;
 		}
-
-		// Capture the callback and IDs for use in the game thread.
-		TFunction<void(const TArray<uint32>&)> Callback = MoveTemp(Request.Callback);
-
-		// Invoke the callback on the game thread with the collected target IDs.
-		AsyncTask(ENamedThreads::GameThread,
-			[Callback = MoveTemp(Callback), ClosestActorIDs = MoveTemp(ClosestActorIDs)]()
-			{
-				Callback(ClosestActorIDs);
-			});
 	}
 }
 
 void FGetAsyncTarget::ProcessStrategicAIRequests()
 {
-	FStrategicAIRequest Request;
-	while (M_StrategicAIRequestQueue.Dequeue(Request))
+	using namespace GetAsyncTargetStrategicAI;
+
+	TArray<FStrategicAIRequest> Requests;
+	FStrategicAIRequest DequeuedRequest;
+	while (M_StrategicAIRequestQueue.Dequeue(DequeuedRequest))
 	{
-		FStrategicAIResultBatch Results;
+		Requests.Add(MoveTemp(DequeuedRequest));
+	}
+	if (Requests.IsEmpty())
+	{
+		return;
+	}
 
-		Results.FindClosestFlankableEnemyHeavyResults.Reserve(
-			Request.RequestBatch.FindClosestFlankableEnemyHeavyRequests.Num());
-		for (const FFindClosestFlankableEnemyHeavy& FindRequest : Request.RequestBatch.FindClosestFlankableEnemyHeavyRequests)
-		{
-			Results.FindClosestFlankableEnemyHeavyResults.Add(
-				FStrategicAIHelpers::BuildClosestFlankableEnemyHeavyResult(FindRequest, M_DetailedUnitStates));
-		}
+	const TArray<FAsyncDetailedUnitState>& DetailedUnitStates = M_DetailedSnapshots.GetReadBuffer();
+	TArray<FStrategicAIResultBatch> Results;
+	Results.SetNum(Requests.Num());
 
-		Results.PlayerUnitCountsResults.Reserve(
-			Request.RequestBatch.GetPlayerUnitCountsAndBaseRequests.Num());
-		for (const FGetPlayerUnitCountsAndBase& CountRequest : Request.RequestBatch.GetPlayerUnitCountsAndBaseRequests)
+	// Flatten the sub-requests of every queued batch so they are spread over the task graph workers together.
+	TArray<FSnapshotWorkItem> SnapshotWorkItems;
+	TArray<FConstructionWorkItem> ConstructionWorkItems;
+	int32 LatestBaseClusterBatchIndex = INDEX_NONE;
+	int32 LatestBaseClusterResultIndex = INDEX_NONE;
+	for (int32 BatchIndex = 0; BatchIndex < Requests.Num(); ++BatchIndex)
+	{
+		const FStrategicAIRequestBatch& RequestBatch = Requests[BatchIndex].RequestBatch;
+		SizeResultBatch(RequestBatch, Results[BatchIndex]);
+
+		AddSnapshotWorkItems(BatchIndex, ESnapshotWorkFamily::ClosestFlankableEnemyHeavy,
+		                     RequestBatch.FindClosestFlankableEnemyHeavyRequests.Num(), SnapshotWorkItems);
+		AddSnapshotWorkItems(BatchIndex, ESnapshotWorkFamily::PlayerUnitCounts,
+		                     RequestBatch.GetPlayerUnitCountsAndBaseRequests.Num(), SnapshotWorkItems);
+		AddSnapshotWorkItems(BatchIndex, ESnapshotWorkFamily::AlliedTanksToRetreat,
+		                     RequestBatch.FindAlliedTanksToRetreatRequests.Num(), SnapshotWorkItems);
+		AddSnapshotWorkItems(BatchIndex, ESnapshotWorkFamily::EnemyBaseClusters,
+		                     RequestBatch.FindEnemyBaseClustersRequests.Num(), SnapshotWorkItems);
+		AddSnapshotWorkItems(BatchIndex, ESnapshotWorkFamily::LocationsUnderPlayerAttack,
+		                     RequestBatch.FindLocationsUnderPlayerAttackRequests.Num(), SnapshotWorkItems);
+		AddSnapshotWorkItems(BatchIndex, ESnapshotWorkFamily::PlayerUnitBulkLocations,
+		                     RequestBatch.FindPlayerUnitBulkLocationsRequests.Num(), SnapshotWorkItems);
+		AddSnapshotWorkItems(BatchIndex, ESnapshotWorkFamily::MineLocations,
+		                     RequestBatch.FindMineLocationsRequests.Num(), SnapshotWorkItems);
+
+		// Construction requests depend on the latest base-cluster result at or before their own batch,
+		// the same result the sequential evaluation order would have cached for them.
+		if (not RequestBatch.FindEnemyBaseClustersRequests.IsEmpty())
 		{
-			Results.PlayerUnitCountsResults.Add(
-				FStrategicAIHelpers::BuildPlayerUnitCountsResult(CountRequest, M_DetailedUnitStates));
+			LatestBaseClusterBatchIndex = BatchIndex;
+			LatestBaseClusterResultIndex = RequestBatch.FindEnemyBaseClustersRequests.Num() - 1;
 		}
-
-		Results.AlliedTanksToRetreatResults.Reserve(
-			Request.RequestBatch.FindAlliedTanksToRetreatRequests.Num());
-		for (const FFindAlliedTanksToRetreat& RetreatRequest : Request.RequestBatch.FindAlliedTanksToRetreatRequests)
+		for (int32 RequestIndex = 0; RequestIndex < RequestBatch.FindConstructionLocationsRequests.Num(); ++
+		     RequestIndex)
 		{
-			Results.AlliedTanksToRetreatResults.Add(
-				FStrategicAIHelpers::BuildAlliedTanksToRetreatResult(RetreatRequest, M_DetailedUnitStates));
+			ConstructionWorkItems.Add({
+				BatchIndex, RequestIndex, LatestBaseClusterBatchIndex, LatestBaseClusterResultIndex
+			});
 		}
+	}
 
-		Results.EnemyBaseClustersResults.Reserve(
-			Request.RequestBatch.FindEnemyBaseClustersRequests.Num());
-		for (const FFindEnemyBaseClusters& BaseClusterRequest : Request.RequestBatch.FindEnemyBaseClustersRequests)
+	// Every work item writes only its own pre-sized result slot and reads the shared snapshot.
+	ParallelFor(SnapshotWorkItems.Num(), [&](const int32 WorkIndex)
+	{
+		const FSnapshotWorkItem& WorkItem = SnapshotWorkItems[WorkIndex];
+		EvaluateSnapshotWorkItem(
+			WorkItem,
+			Requests[WorkItem.BatchIndex].RequestBatch,
+			DetailedUnitStates,
+			M_PlayerThreatGrid,
+			Results[WorkItem.BatchIndex]);
+	});
+
+	// Second phase: the base-cluster results it depends on are complete and no longer written.
+	ParallelFor(ConstructionWorkItems.Num(), [&](const int32 WorkIndex)
+	{
+		const FConstructionWorkItem& WorkItem = ConstructionWorkItems[WorkIndex];
+		const TArray<FEnemyBasePointCoreBuildings>* CoreBuildingsByBase =
+			&M_EnemyBaseClusterAsyncCache.CoreBuildingsByBase;
+		const TArray<FEnemyBasePointSatelliteBuildings>* SatelliteBuildingsByBase =
+			&M_EnemyBaseClusterAsyncCache.SatelliteBuildingsByBase;
+		if (WorkItem.BaseClusterBatchIndex != INDEX_NONE)
 		{
-			FResultEnemyBaseClusters BaseClusterResult = FStrategicAIHelpers::BuildEnemyBaseClustersResult(
-				BaseClusterRequest,
-				M_DetailedUnitStates);
-			M_EnemyBaseClusterAsyncCache.UpdateFromResult(BaseClusterResult);
-			Results.EnemyBaseClustersResults.Add(MoveTemp(BaseClusterResult));
+			const FResultEnemyBaseClusters& BaseClusterResult =
+				Results[WorkItem.BaseClusterBatchIndex].EnemyBaseClustersResults[WorkItem.BaseClusterResultIndex];
+			CoreBuildingsByBase = &BaseClusterResult.BasePoints;
+			SatelliteBuildingsByBase = &BaseClusterResult.SatelliteBasePoints;
 		}
 
-		Results.LocationsUnderPlayerAttackResults.Reserve(
-			Request.RequestBatch.FindLocationsUnderPlayerAttackRequests.Num());
-		for (const FFindLocationsUnderPlayerAttack& AttackLocationRequest : Request.RequestBatch.FindLocationsUnderPlayerAttackRequests)
-		{
-			Results.LocationsUnderPlayerAttackResults.Add(
-				FStrategicAIHelpers::BuildLocationsUnderPlayerAttackResult(AttackLocationRequest, M_DetailedUnitStates));
-		}
+		Results[WorkItem.BatchIndex].ConstructionLocationsResults[WorkItem.RequestIndex] =
+			FStrategicAIHelpers::BuildConstructionLocationsResult(
+				Requests[WorkItem.BatchIndex].RequestBatch.FindConstructionLocationsRequests[WorkItem.RequestIndex],
+				*CoreBuildingsByBase,
+				*SatelliteBuildingsByBase);
+	});
 
-		Results.PlayerUnitBulkLocationsResults.Reserve(
-			Request.RequestBatch.FindPlayerUnitBulkLocationsRequests.Num());
-		for (const FFindPlayerUnitBulkLocations& BulkLocationsRequest :
-			Request.RequestBatch.FindPlayerUnitBulkLocationsRequests)
-		{
-			Results.PlayerUnitBulkLocationsResults.Add(
-				FStrategicAIHelpers::BuildPlayerUnitBulkLocationsResult(BulkLocationsRequest, M_DetailedUnitStates));
-		}
+	if (LatestBaseClusterBatchIndex != INDEX_NONE)
+	{
+		M_EnemyBaseClusterAsyncCache.UpdateFromResult(
+			Results[LatestBaseClusterBatchIndex].EnemyBaseClustersResults[LatestBaseClusterResultIndex]);
+	}
 
-		Results.ConstructionLocationsResults.Reserve(
-			Request.RequestBatch.FindConstructionLocationsRequests.Num());
-		for (const FFindConstructionLocations& ConstructionLocationsRequest :
-			Request.RequestBatch.FindConstructionLocationsRequests)
-		{
-			Results.ConstructionLocationsResults.Add(
-				FStrategicAIHelpers::BuildConstructionLocationsResult(
-					ConstructionLocationsRequest,
-					M_EnemyBaseClusterAsyncCache.CoreBuildingsByBase,
-					M_EnemyBaseClusterAsyncCache.SatelliteBuildingsByBase));
-		}
+	for (int32 BatchIndex = 0; BatchIndex < Requests.Num(); ++BatchIndex)
+	{
+		M_PendingRequestCount.Decrement();
 
-		Results.MineLocationsResults.Reserve(
-			Request.RequestBatch.FindMineLocationsRequests.Num());
-		for (const FFindMineLocations& MineLocationsRequest : Request.RequestBatch.FindMineLocationsRequests)
+		TFunction<void(const FStrategicAIResultBatch&)> Callback = MoveTemp(Requests[BatchIndex].Callback);
+		M_GameThreadBatch.Add([Callback = MoveTemp(Callback), Results = MoveTemp(Results[BatchIndex])]()
 		{
-			Results.MineLocationsResults.Add(
-				FStrategicAIHelpers::BuildMineLocationsResult(MineLocationsRequest));
-		}
-
-		TFunction<void(const FStrategicAIResultBatch&)> Callback = MoveTemp(Request.Callback);
-		AsyncTask(ENamedThreads::GameThread,
-			[Callback = MoveTemp(Callback), Results = MoveTemp(Results)]() mutable
-			{
-				Callback(Results);
-			});
+			Callback(Results);
+		});
 	}
 }
+
+void FGetAsyncTarget::ReportStats(const int32 QueueDepth, const int32 BatchSize) const
+{
+	SET_DWORD_STAT(STAT_AsyncTarget_QueueDepth, QueueDepth);
+	SET_DWORD_STAT(STAT_AsyncTarget_BatchSize, BatchSize);
+#if STATS || RTS_WITH_PERF_BENCHMARK_SHIPPING_TESTS
+	// Sorting the latency window is only worth it when a stat or the benchmark reads the percentiles.
+	const float LatencyP50Ms = M_TargetRequestLatency.GetPercentileMs(0.5f);
+	const float LatencyP99Ms = M_TargetRequestLatency.GetPercentileMs(0.99f);
+	SET_FLOAT_STAT(STAT_AsyncTarget_LatencyP50, LatencyP50Ms);
+	SET_FLOAT_STAT(STAT_AsyncTarget_LatencyP99, LatencyP99Ms);
+#endif
+#if RTS_WITH_PERF_BENCHMARK_SHIPPING_TESTS
+	M_PerfBenchmarkLatencyP50Ms.store(LatencyP50Ms, std::memory_order_relaxed);
+	M_PerfBenchmarkLatencyP99Ms.store(LatencyP99Ms, std::memory_order_relaxed);
+#endif
+}
+
+#if RTS_WITH_PERF_BENCHMARK_SHIPPING_TESTS
+void FGetAsyncTarget::PerfBenchmark_GetTargetRequestLatency(float& OutP50Ms, float& OutP99Ms) const
+{
+	OutP50Ms = M_PerfBenchmarkLatencyP50Ms.load(std::memory_order_relaxed);
+	OutP99Ms = M_PerfBenchmarkLatencyP99Ms.load(std::memory_order_relaxed);
+}
+#endif
@@ -6,12 +6,22 @@
 #include "Containers/Queue.h"
 #include "Delegates/Delegate.h"
 #include "RTS_Survival/Enemy/StrategicAI/Requests/StrategicAIRequests.h"
+#include "RTS_Survival/Enemy/StrategicAI/ThreatGrid/StrategicAIThreatGrid.h"
+#include "RTS_Survival/Game/GameState/AsyncQueryBatching/AsyncQueryBatching.h"
 #include "RTS_Survival/Game/GameState/GameUnitManager/AsyncUnitDetailedState/AsyncUnitDetailedState.h"
+#include "RTS_Survival/Game/GameState/GameUnitManager/GetTargetUnitThread/AsyncTargetSpatialGrid.h"
+#include "RTS_Survival/Game/GameState/GameUnitManager/GetTargetUnitThread/AsyncUnitSnapshot.h"
 #include "RTS_Survival/Game/GameState/GameUnitManager/TargetPreference/TargetPreference.h"
+#include "RTS_Survival/UnitTests/PerfBenchmarkShippingTestsDefine.h"
 #include "Templates/Function.h"
+#include <atomic>
+
+class FEvent;
 
 /**
  * @brief A thread as runnable class that processes actor target requests asynchronously.
+ * The thread sleeps on an event until a request or snapshot arrives and returns all results of one wakeup to the
+ * game thread in a single task.
  */
 class FGetAsyncTarget : public FRunnable
 {
@@ -26,18 +36,22 @@ public:
 	virtual void Stop() override;
 
 	/**
-	 * @brief Schedules an update to the mapping of IDs to locations.
-	 * @param NewActorData The new mapping of Actor IDs to their locations.
+	 * @brief Game thread only: the target snapshot to fill in place before PublishTargetSnapshot.
+	 * @note Contains stale data from an older publish; reset it before filling.
 	 */
-	void ScheduleUpdateActorData(const TMap<uint32, TPair<ETargetPreference, FVector>>& NewEnemyActorData,
-	                             const TMap<uint32, TPair<ETargetPreference,
-	                                                      FVector>>& NewPlayerActorData);
+	FAsyncTargetSnapshot& GetTargetSnapshotWriteBuffer() { return M_TargetSnapshots.GetWriteBuffer(); }
+
+	/** @brief Game thread only: makes the filled target snapshot visible to the async thread without copying it. */
+	void PublishTargetSnapshot();
 
 	/**
-	 * @brief Schedules an update to the detailed unit data used for strategic AI processing.
-	 * @param NewDetailedUnitStates Latest detailed unit snapshot for both players.
+	 * @brief Game thread only: the detailed unit snapshot to fill in place before PublishDetailedSnapshot.
+	 * @note Contains stale data from an older publish; reset it before filling.
 	 */
-	void ScheduleUpdateDetailedActorData(const TArray<FAsyncDetailedUnitState>& NewDetailedUnitStates);
+	TArray<FAsyncDetailedUnitState>& GetDetailedSnapshotWriteBuffer() { return M_DetailedSnapshots.GetWriteBuffer(); }
+
+	/** @brief Game thread only: makes the filled detailed snapshot visible to the async thread without copying it. */
+	void PublishDetailedSnapshot();
 
 	/**
 	 * @brief Adds a strategic AI request batch to the async queue.
@@ -80,6 +94,7 @@ private:
 		int32 OwningPlayer;
 		ETargetPreference TargetPreference;
 		TFunction<void(const TArray<uint32>&)> Callback;
+		double EnqueueTimeSeconds;
 	};
 
 	/** Structure representing a strategic AI request batch */
@@ -98,12 +113,18 @@ private:
 		TArray<FEnemyBasePointSatelliteBuildings> SatelliteBuildingsByBase;
 	};
 
-	/** Mapping of Actor IDs to their Target-type and location */
-	TMap<uint32, TPair<ETargetPreference, FVector>> M_PlayerActorData;
-	TMap<uint32, TPair<ETargetPreference, FVector>> M_EnemyActorData;
+	/** Spatial index over the latest target snapshot of each team, rebuilt whenever a new snapshot arrives. */
+	FAsyncTargetSpatialGrid M_PlayerTargetGrid;
+	FAsyncTargetSpatialGrid M_EnemyTargetGrid;
+
+	/** Target snapshots published by the game thread; the read buffer is only touched by this thread. */
+	TAsyncSnapshotTripleBuffer<FAsyncTargetSnapshot> M_TargetSnapshots;
+
+	/** Detailed unit state snapshots used by strategic AI requests. */
+	TAsyncSnapshotTripleBuffer<TArray<FAsyncDetailedUnitState>> M_DetailedSnapshots;
 
-	/** Detailed unit state snapshot used by strategic AI requests. */
-	TArray<FAsyncDetailedUnitState> M_DetailedUnitStates;
+	/** Player threat per cell of the latest detailed snapshot, rebuilt whenever a new snapshot arrives. */
+	FStrategicAIThreatGrid M_PlayerThreatGrid;
 
 	/** Latest async base-cluster result used to keep construction candidates outside enemy bases. */
 	FEnemyBaseClusterAsyncCache M_EnemyBaseClusterAsyncCache;
@@ -111,15 +132,6 @@ private:
 	/** Queue of target requests */
 	TQueue<FTargetRequest> M_RequestQueue;
 
-	/** Queue of pending actor data updates */
-	TQueue<TMap<uint32, TPair<ETargetPreference, FVector>>> M_PendingPlayerActorDataUpdates;
-
-	/** Queue of pending actor data updates */
-	TQueue<TMap<uint32, TPair<ETargetPreference, FVector>>> M_PendingEnemyActorDataUpdates;
-
-	/** Queue of pending detailed unit data updates */
-	TQueue<TArray<FAsyncDetailedUnitState>> M_PendingDetailedUnitStateUpdates;
-
 	/** Queue of strategic AI requests */
 	TQueue<FStrategicAIRequest> M_StrategicAIRequestQueue;
 
@@ -127,6 +139,18 @@ private:
 	/** Flag to signal the thread to stop */
 	FThreadSafeBool bM_StopThread;
 
+	/** Auto-reset event the thread sleeps on; triggered by new requests, snapshots and Stop. */
+	FEvent* M_WakeEvent;
+
+	/** Amount of target and strategic AI requests enqueued but not yet processed. */
+	FThreadSafeCounter M_PendingRequestCount;
+
+	/** Results of the current wakeup, sent to the game thread as one task. */
+	FAsyncGameThreadCallbackBatch M_GameThreadBatch;
+
+	/** Enqueue-to-result latency of recent target requests. */
+	FAsyncQueryLatencyTracker M_TargetRequestLatency;
+
 	/**
 	 * @brief Processes the queued target requests.
 	 */
@@ -137,5 +161,18 @@ private:
 	 */
 	void ProcessStrategicAIRequests();
 
+	void ReportStats(const int32 QueueDepth, const int32 BatchSize) const;
+
+#if RTS_WITH_PERF_BENCHMARK_SHIPPING_TESTS
+public:
+	/** @brief Game thread safe read of the target request latency percentiles of the latest wakeup. */
+	void PerfBenchmark_GetTargetRequestLatency(float& OutP50Ms, float& OutP99Ms) const;
+
+private:
+	// Stats are compiled out in shipping, so the benchmark target publishes the percentiles itself.
+	mutable std::atomic<float> M_PerfBenchmarkLatencyP50Ms{0.f};
+	mutable std::atomic<float> M_PerfBenchmarkLatencyP99Ms{0.f};
+#endif
+
 	FRunnableThread* M_Thread;
 };
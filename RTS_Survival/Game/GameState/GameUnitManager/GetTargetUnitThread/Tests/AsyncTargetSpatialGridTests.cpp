@@ -0,0 +1,187 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+#include "RTS_Survival/Game/GameState/GameUnitManager/GetTargetUnitThread/AsyncTargetSpatialGrid.h"
+#include "RTS_Survival/Game/GameState/GameUnitManager/GetTargetUnitThread/AsyncUnitSnapshot.h"
+
+namespace AsyncTargetSpatialGridTestConstants
+{
+	constexpr int32 RandomSeed = 1337;
+	constexpr uint8 IndexedPlayer = 1;
+	constexpr uint8 OtherPlayer = 2;
+	constexpr int32 QueriesPerActorCount = 2000;
+	constexpr int32 NumTargetsPerQuery = 3;
+	constexpr float MapHalfExtent = 40000.f;
+	constexpr float MinSearchRadius = 1500.f;
+	constexpr float MaxSearchRadius = 6000.f;
+	constexpr int32 BenchmarkActorCounts[] = {100, 500, 2000};
+	constexpr ETargetPreference PreferencesByIndex[] = {
+		ETargetPreference::Infantry,
+		ETargetPreference::Tank,
+		ETargetPreference::Building,
+		ETargetPreference::Other,
+		ETargetPreference::Aircraft
+	};
+}
+
+namespace
+{
+	struct FTargetQuery
+	{
+		FVector SearchLocation = FVector::ZeroVector;
+		float SearchRadius = 0.f;
+		ETargetPreference TargetPreference = ETargetPreference::None;
+	};
+
+	void BuildRandomActorData(
+		const int32 ActorCount,
+		FRandomStream& Stream,
+		TMap<uint32, TPair<ETargetPreference, FVector>>& OutActorData)
+	{
+		using namespace AsyncTargetSpatialGridTestConstants;
+		OutActorData.Reset();
+		OutActorData.Reserve(ActorCount);
+		for (int32 ActorIndex = 0; ActorIndex < ActorCount; ++ActorIndex)
+		{
+			const ETargetPreference Type = PreferencesByIndex[Stream.RandRange(0, UE_ARRAY_COUNT(PreferencesByIndex) - 1)];
+			const FVector Location(
+				Stream.FRandRange(-MapHalfExtent, MapHalfExtent),
+				Stream.FRandRange(-MapHalfExtent, MapHalfExtent),
+				Stream.FRandRange(0.f, 500.f));
+			OutActorData.Add(static_cast<uint32>(ActorIndex + 1), TPair<ETargetPreference, FVector>(Type, Location));
+		}
+	}
+
+	/** Reference implementation of the closest-target request that scans and sorts every actor. */
+	void BruteForceClosestTargets(
+		const TMap<uint32, TPair<ETargetPreference, FVector>>& ActorData,
+		const FTargetQuery& Query,
+		const int32 NumTargets,
+		TArray<uint32>& OutActorIDs)
+	{
+		TArray<TPair<float, uint32>> PreferredTargets;
+		TArray<TPair<float, uint32>> OtherTargets;
+		for (const auto& Pair : ActorData)
+		{
+			const ETargetPreference ActorType = Pair.Value.Key;
+			if (ActorType == ETargetPreference::Aircraft && Query.TargetPreference != ETargetPreference::Aircraft)
+			{
+				continue;
+			}
+			const float DistanceSquared = FVector::DistSquared(Query.SearchLocation, Pair.Value.Value);
+			if (DistanceSquared > FMath::Square(Query.SearchRadius))
+			{
+				continue;
+			}
+			TArray<TPair<float, uint32>>& Targets = ActorType == Query.TargetPreference
+				                                        ? PreferredTargets
+				                                        : OtherTargets;
+			Targets.Emplace(DistanceSquared, Pair.Key);
+		}
+
+		const auto IsCloser = [](const TPair<float, uint32>& Left, const TPair<float, uint32>& Right)
+		{
+			return Left.Key != Right.Key ? Left.Key < Right.Key : Left.Value < Right.Value;
+		};
+		PreferredTargets.Sort(IsCloser);
+		OtherTargets.Sort(IsCloser);
+
+		OutActorIDs.Reset();
+		for (const TArray<TPair<float, uint32>>* Targets : {&PreferredTargets, &OtherTargets})
+		{
+			for (const TPair<float, uint32>& Target : *Targets)
+			{
+				if (OutActorIDs.Num() >= NumTargets)
+				{
+					return;
+				}
+				OutActorIDs.Add(Target.Value);
+			}
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FAsyncTargetSpatialGridBenchmarkTest,
+	"RTS.GameUnitManager.AsyncTargetSpatialGrid.QueryBenchmark",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAsyncTargetSpatialGridBenchmarkTest::RunTest(const FString& Parameters)
+{
+	using namespace AsyncTargetSpatialGridTestConstants;
+
+	for (const int32 ActorCount : BenchmarkActorCounts)
+	{
+		FRandomStream Stream(RandomSeed + ActorCount);
+		TMap<uint32, TPair<ETargetPreference, FVector>> ActorData;
+		BuildRandomActorData(ActorCount, Stream, ActorData);
+
+		TArray<FTargetQuery> Queries;
+		Queries.SetNum(QueriesPerActorCount);
+		for (FTargetQuery& Query : Queries)
+		{
+			Query.SearchLocation = FVector(
+				Stream.FRandRange(-MapHalfExtent, MapHalfExtent),
+				Stream.FRandRange(-MapHalfExtent, MapHalfExtent),
+				0.f);
+			Query.SearchRadius = Stream.FRandRange(MinSearchRadius, MaxSearchRadius);
+			Query.TargetPreference = PreferencesByIndex[Stream.RandRange(0, UE_ARRAY_COUNT(PreferencesByIndex) - 1)];
+		}
+
+		// Entries of the other player are interleaved to verify the grid only indexes the requested owner.
+		FAsyncTargetSnapshot Snapshot;
+		for (const auto& Pair : ActorData)
+		{
+			Snapshot.Add(Pair.Key, Pair.Value.Value, Pair.Value.Key, IndexedPlayer);
+			Snapshot.Add(Pair.Key + ActorCount, Pair.Value.Value, Pair.Value.Key, OtherPlayer);
+		}
+
+		FAsyncTargetSpatialGrid Grid;
+		const double RebuildStart = FPlatformTime::Seconds();
+		Grid.Rebuild(Snapshot, IndexedPlayer);
+		const double RebuildSeconds = FPlatformTime::Seconds() - RebuildStart;
+
+		TArray<uint32> GridResult;
+		const double GridStart = FPlatformTime::Seconds();
+		for (const FTargetQuery& Query : Queries)
+		{
+			Grid.QueryClosestTargets(Query.SearchLocation, Query.SearchRadius, NumTargetsPerQuery,
+			                         Query.TargetPreference, GridResult);
+		}
+		const double GridSeconds = FPlatformTime::Seconds() - GridStart;
+
+		TArray<uint32> BruteForceResult;
+		const double BruteForceStart = FPlatformTime::Seconds();
+		for (const FTargetQuery& Query : Queries)
+		{
+			BruteForceClosestTargets(ActorData, Query, NumTargetsPerQuery, BruteForceResult);
+		}
+		const double BruteForceSeconds = FPlatformTime::Seconds() - BruteForceStart;
+
+		int32 NumMismatches = 0;
+		for (const FTargetQuery& Query : Queries)
+		{
+			Grid.QueryClosestTargets(Query.SearchLocation, Query.SearchRadius, NumTargetsPerQuery,
+			                         Query.TargetPreference, GridResult);
+			BruteForceClosestTargets(ActorData, Query, NumTargetsPerQuery, BruteForceResult);
+			if (GridResult != BruteForceResult)
+			{
+				++NumMismatches;
+			}
+		}
+		TestEqual(FString::Printf(TEXT("Grid matches brute force for %d actors"), ActorCount), NumMismatches, 0);
+
+		AddInfo(FString::Printf(
+			TEXT("%d actors: rebuild %.3f ms, grid %.3f us/query, brute force %.3f us/query"),
+			ActorCount,
+			RebuildSeconds * 1000.0,
+			GridSeconds * 1000000.0 / QueriesPerActorCount,
+			BruteForceSeconds * 1000000.0 / QueriesPerActorCount));
+	}
+
+	return not HasAnyErrors();
+}
+
+#endif
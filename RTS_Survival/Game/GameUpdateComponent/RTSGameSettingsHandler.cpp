@@ -2,34 +2,34 @@
 #include "RTSGameSettingsHandler.h"
 #include "RTS_Survival/RTSComponents/SelectionComponent.h"
 #include "Engine/World.h"
-#include "GameFramework/Actor.h"
-#include "Kismet/GameplayStatics.h"
+#include "RTS_Survival/Subsystems/ComponentRegistrySubsystem/RTSComponentRegistrySubsystem.h"
 #include "RTS_Survival/Utils/HFunctionLibary.h"
 
 URTSGameSettingsHandler::URTSGameSettingsHandler()
 {
 }
 
-void URTSGameSettingsHandler::OnDeselectedDecalUpdate(bool bIsUsed)
+void URTSGameSettingsHandler::OnDeselectedDecalUpdate(const bool bIsUsed)
 {
-	// We use a lambda to capter the this pointer to bind our member function as a callaback.
-	const TWeakObjectPtr<URTSGameSettingsHandler> WeakSettingsHandler = this;
-	UpdateComponentsOfTypeAsync<USelectionComponent, bool>(
-		this,
-		// Capture a weak owner because callback execution is asynchronous.
-		[WeakSettingsHandler](const TArray<USelectionComponent*>& Components, ERTSGameSetting SettingUpdated, bool ValueUpdatedSetting)
-		{
-			if (not WeakSettingsHandler.IsValid())
-			{
-				return;
-			}
+	// Stored first so selection components that begin play during the dispatch pick up the new value themselves.
+	M_GameSettings.bUseDeselectedDecals = bIsUsed;
+
+	const UWorld* World = GetWorld();
+	URTSComponentRegistrySubsystem* ComponentRegistry =
+		IsValid(World) ? World->GetSubsystem<URTSComponentRegistrySubsystem>() : nullptr;
+	if (not IsValid(ComponentRegistry))
+	{
+		RTSFunctionLibrary::ReportError("No component registry to propagate the deselected decal setting with."
+			"\n See URTSGameSettingsHandler::OnDeselectedDecalUpdate");
+		return;
+	}
 
-			URTSGameSettingsHandler* StrongSettingsHandler = WeakSettingsHandler.Get();
-			StrongSettingsHandler->UpdateSelectionComponentsCallBack(Components, SettingUpdated, ValueUpdatedSetting);
-		},
+	ComponentRegistry->DispatchSettingToComponents<USelectionComponent>(
 		ERTSGameSetting::UseDeselectedDecals,
-		bIsUsed
-	);
+		[bIsUsed](USelectionComponent& SelectionComponent)
+		{
+			SelectionComponent.SetDeselectedDecalSetting(bIsUsed);
+		});
 }
 
 void URTSGameSettingsHandler::UpdateGameSetting(ERTSGameSetting Setting, const bool bValue, float fValue, int iValue)
@@ -55,20 +55,6 @@ void URTSGameSettingsHandler::UpdateGameSetting(ERTSGameSetting Setting, const b
 }
 
 
-void URTSGameSettingsHandler::UpdateSelectionComponentsCallBack(
-	const TArray<USelectionComponent*>& SelectionComponents,
-	ERTSGameSetting SettingUpdated, bool bValue)
-{
-	for (auto& SelectionComponent : SelectionComponents)
-	{
-		if (IsValid(SelectionComponent))
-		{
-			SelectionComponent->SetDeselectedDecalSetting(bValue);
-		}
-	}
-}
-
-
 template <typename SettingType>
 SettingType URTSGameSettingsHandler::GetGameSetting(const ERTSGameSetting Setting) const
 {
@@ -122,44 +108,3 @@ int32 URTSGameSettingsHandler::GetGameSetting<int32>(const ERTSGameSetting Setti
 	return 0;
 }
 
-
-template <typename ComponentType, typename SettingValue>
-void URTSGameSettingsHandler::UpdateComponentsOfTypeAsync(
-	UObject* WorldContextObject,
-	TFunction<void(const TArray<ComponentType*>&, ERTSGameSetting, SettingValue)> Callback,
-	ERTSGameSetting SettingUpdated,
-	SettingValue ValueUpdatedSetting)
-{
-	if(IsValid(WorldContextObject))
-	{
-		AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask,
-		  [WorldContextObject, Callback, SettingUpdated, ValueUpdatedSetting]()
-		  {
-			  TArray<ComponentType*> Components;
-			  TArray<AActor*> AllActors;
-			  UGameplayStatics::GetAllActorsOfClass(WorldContextObject->GetWorld(), AActor::StaticClass(),
-													AllActors);
-
-			  for (AActor* Actor : AllActors)
-			  {
-				  if (RTSFunctionLibrary::RTSIsValid(Actor))
-				  {
-					  TArray<ComponentType*> ActorComponents;
-					  Actor->GetComponents<ComponentType>(ActorComponents);
-					  Components.Append(ActorComponents);
-				  }
-			  }
-
-			  // Ensure updates occur on the game thread
-			  AsyncTask(ENamedThreads::GameThread, [Components, Callback, SettingUpdated, ValueUpdatedSetting]()
-			  {
-				  Callback(Components, SettingUpdated, ValueUpdatedSetting);
-			  });
-		  });
-	}
-	else
-	{
-		RTSFunctionLibrary::ReportError("Invalid WorldContextObject provided in UpdateComponentsOfTypeAsync");
-	}
-
-}
@@ -3,6 +3,7 @@
 #include "Components/WidgetComponent.h"
 #include "RTS_Survival/DeveloperSettings.h"
 #include "RTS_Survival/GameUI/Healthbar/AmmoHealthBar/UW_AmmoHealthBar.h"
+#include "RTS_Survival/RTSComponents/HealthComponent.h"
 #include "RTS_Survival/Units/Tanks/TankMaster.h"
 #include "RTS_Survival/Utils/HFunctionLibary.h"
 #include "RTS_Survival/Weapons/WeaponData/WeaponData.h"
@@ -48,6 +49,14 @@ void FAmmoHpBarTrackerState::SetupTrackingLogic()
 		return;
 	}
 
+	// Batched health bars have no widget; the health component shows the ammo itself.
+	UHealthComponent* HealthComponent = M_ActorToCheckForAmmoHpBarWidget->FindComponentByClass<UHealthComponent>();
+	if (IsValid(HealthComponent) && HealthComponent->GetUsesBatchedHealthBar())
+	{
+		HealthComponent->TrackAmmoOfWeapon(M_TrackWeapon.Get());
+		return;
+	}
+
 	TInlineComponentArray<UWidgetComponent*> WidgetComps;
 	M_ActorToCheckForAmmoHpBarWidget->GetComponents(WidgetComps);
 
@@ -6,6 +6,7 @@
 #include "Components/WidgetComponent.h"
 #include "RTS_Survival/DeveloperSettings.h"
 #include "RTS_Survival/GameUI/Healthbar/AmmoHealthBar/UW_AmmoHealthBar.h"
+#include "RTS_Survival/RTSComponents/HealthComponent.h"
 #include "RTS_Survival/Utils/HFunctionLibary.h"
 #include "RTS_Survival/Weapons/BombComponent/BombComponent.h"
 
@@ -96,6 +97,14 @@ void FBombHpBarTrackerState::SetupTrackingLogic()
 		return;
 	}
 
+	// Batched health bars have no widget; the health component shows the bombs itself.
+	UHealthComponent* HealthComponent = M_ActorToCheckForAmmoHpBarWidget->FindComponentByClass<UHealthComponent>();
+	if (IsValid(HealthComponent) && HealthComponent->GetUsesBatchedHealthBar())
+	{
+		HealthComponent->TrackBombsOf(M_TrackBombComponent.Get());
+		return;
+	}
+
 	if (not BombTrackerInitSettings.EnsureIsValid())
 	{
 		return;
@@ -0,0 +1,14 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "HealthBarRenderMode.generated.h"
+
+UENUM(BlueprintType)
+enum class EHealthBarRenderMode : uint8
+{
+	// Drawn by the HUD together with all other batched bars in one paint pass.
+	Batched,
+	// Own UW_HealthBar in a screen space widget component; fallback for bars with custom widget blueprint elements.
+	WidgetComponent
+};
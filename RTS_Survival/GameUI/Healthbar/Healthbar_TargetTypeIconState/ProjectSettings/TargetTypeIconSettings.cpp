@@ -4,6 +4,7 @@
 #include "UObject/ConstructorHelpers.h"
 #include "Misc/MessageDialog.h"
 #include "RTS_Survival/GameUI/Healthbar/Healthbar_TargetTypeIconState/TargetTypeIconState.h"
+#include "RTS_Survival/RTSComponents/ExperienceComponent/RTSExperienceLevels.h"
 
 
 UTargetTypeIconSettings::UTargetTypeIconSettings()
@@ -33,3 +34,19 @@ void UTargetTypeIconSettings::ResolveTypeToBrushMap(TMap<ETargetTypeIcon, FTarge
 		OutMap.Add(Pair.Key, MoveTemp(Resolved));
 	}
 }
+
+void UTargetTypeIconSettings::ResolveRankIconMap(TMap<EVeterancyIconSet, FVeterancyRankIcons>& OutMap) const
+{
+	OutMap.Reset();
+
+	for (const TPair<EVeterancyIconSet, FVeterancyRankIcons_Soft>& Pair : VeterancySetToRankIcons)
+	{
+		FVeterancyRankIcons Resolved;
+		Resolved.RankTextures.Reserve(Pair.Value.RankTextures.Num());
+		for (const TSoftObjectPtr<UTexture2D>& RankTexture : Pair.Value.RankTextures)
+		{
+			Resolved.RankTextures.Add(RankTexture.IsNull() ? nullptr : RankTexture.LoadSynchronous());
+		}
+		OutMap.Add(Pair.Key, MoveTemp(Resolved));
+	}
+}
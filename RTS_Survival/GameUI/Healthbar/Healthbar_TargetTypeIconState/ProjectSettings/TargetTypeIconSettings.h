@@ -6,6 +6,7 @@
 #include "TargetTypeIconSettings.generated.h"
 
 enum class ETargetTypeIcon : uint8;
+enum class EVeterancyIconSet : uint8;
 
 USTRUCT(BlueprintType)
 struct FTargetTypeIconBrushes_Soft
@@ -21,6 +22,25 @@ struct FTargetTypeIconBrushes_Soft
 	TSoftObjectPtr<UTexture2D> EnemyTexture;
 };
 
+USTRUCT(BlueprintType)
+struct FVeterancyRankIcons_Soft
+{
+	GENERATED_BODY()
+
+	/** Rank icon per rank level, indexed by the level; leave an entry empty for a level without an icon. */
+	UPROPERTY(EditAnywhere, Config, BlueprintReadOnly, Category="Icons")
+	TArray<TSoftObjectPtr<UTexture2D>> RankTextures;
+};
+
+USTRUCT()
+struct FVeterancyRankIcons
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<TObjectPtr<UTexture2D>> RankTextures;
+};
+
 /**
  * @brief Project settings for mapping target type -> (player/enemy) brushes.
  * Appears under Project Settings as: UI ► Health Bar Icons (configurable per project).
@@ -37,6 +57,13 @@ public:
 	UPROPERTY(EditAnywhere, Config, Category="Icons", meta=(ForceInlineRow))
 	TMap<ETargetTypeIcon, FTargetTypeIconBrushes_Soft> TypeToBrush;
 
+	/**
+	 * Rank icons drawn on batched health bars; widget health bars pick their rank icon in the widget blueprint.
+	 * Should show the same textures as the veterancy icon data table.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category="Rank Icons", meta=(ForceInlineRow))
+	TMap<EVeterancyIconSet, FVeterancyRankIcons_Soft> VeterancySetToRankIcons;
+
 
 	/** Convenience accessor. */
 	static const UTargetTypeIconSettings* Get()
@@ -49,4 +76,7 @@ public:
 	 * Loads assets synchronously the first time (they’ll stay in memory afterwards).
 	 */
 	void ResolveTypeToBrushMap(TMap<ETargetTypeIcon, struct FTargetTypeIconBrushes>& OutMap) const;
+
+	/** Resolves the rank icons the same way; entries left empty in the settings stay null. */
+	void ResolveRankIconMap(TMap<EVeterancyIconSet, FVeterancyRankIcons>& OutMap) const;
 };
@@ -2,6 +2,7 @@
 
 #include "LandscapeDataManager.h"
 
+#include "Async/ParallelFor.h"
 #include "Data/PCGSpatialData.h"
 #include "Engine/Level.h"
 #include "Engine/Texture2D.h"
@@ -14,6 +15,7 @@
 #include "PCGComponent.h"
 #include "Sound/SoundAttenuation.h"
 #include "RTS_Survival/Utils/HFunctionLibary.h"
+#include "RTS_Survival/Utils/TextureRegionUpload/FRTSTextureRegionUpload.h"
 #include "TextureResource.h"
 #include "TimerManager.h"
 #include "UObject/ObjectSaveContext.h"
@@ -42,6 +44,8 @@ namespace LandscapeDataManagerConstants
 	constexpr float MinimumBoundsScale = 0.01f;
 	constexpr int32 MinimumNoiseOctaves = 1;
 	constexpr int32 MaximumNoiseOctaves = 6;
+	// Power of two so tile borders stay aligned in every mip; 256 texels is a 256 KiB RGBA8 tile.
+	constexpr int32 TileResolution = 256;
 
 	float SanitizeClampedFloat(
 		const float Value,
@@ -112,13 +116,46 @@ namespace LandscapeDataManagerConstants
 			static_cast<uint8>(AlphaTotal / TexelsPerMipFilter));
 	}
 
+	FIntPoint GetNextMipResolution(const FIntPoint& SourceResolution)
+	{
+		return FIntPoint(FMath::Max(1, SourceResolution.X / 2), FMath::Max(1, SourceResolution.Y / 2));
+	}
+
+	/** Pixels of the next mip that average any pixel of SourceRect. */
+	FIntRect GetNextMipRect(const FIntRect& SourceRect, const FIntPoint& NextResolution)
+	{
+		return FIntRect(
+			FMath::Min(SourceRect.Min.X / 2, NextResolution.X - 1),
+			FMath::Min(SourceRect.Min.Y / 2, NextResolution.Y - 1),
+			FMath::Clamp(FMath::DivideAndRoundUp(SourceRect.Max.X, 2), 1, NextResolution.X),
+			FMath::Clamp(FMath::DivideAndRoundUp(SourceRect.Max.Y, 2), 1, NextResolution.Y));
+	}
+
+	void UpdateAverageMipRect(
+		const TArray<FColor>& SourcePixels,
+		const FIntPoint& SourceResolution,
+		const FIntRect& DestinationRect,
+		const FIntPoint& DestinationResolution,
+		TArray<FColor>& InOutDestinationPixels)
+	{
+		for (int32 PixelY = DestinationRect.Min.Y; PixelY < DestinationRect.Max.Y; ++PixelY)
+		{
+			for (int32 PixelX = DestinationRect.Min.X; PixelX < DestinationRect.Max.X; ++PixelX)
+			{
+				InOutDestinationPixels[PixelY * DestinationResolution.X + PixelX] = GetAverageSourceColor(
+					SourcePixels,
+					SourceResolution,
+					FIntPoint(PixelX, PixelY));
+			}
+		}
+	}
+
 	TArray<FColor> BuildNextAverageMip(
 		const TArray<FColor>& SourcePixels,
 		const FIntPoint& SourceResolution,
 		FIntPoint& OutResolution)
 	{
-		OutResolution.X = FMath::Max(1, SourceResolution.X / 2);
-		OutResolution.Y = FMath::Max(1, SourceResolution.Y / 2);
+		OutResolution = GetNextMipResolution(SourceResolution);
 
 		TArray<FColor> Result;
 		Result.SetNumZeroed(OutResolution.X * OutResolution.Y);
@@ -525,7 +562,12 @@ void ALandscapeDataManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
 	M_StagedContributions.Reset();
 	M_PendingRemovals.Reset();
 	M_CombinedPixels.Reset();
+	M_LowerMipPixels.Reset();
+	M_TileContributions.Reset();
+	M_DirtyTiles.Reset();
+	M_TileCount = FIntPoint::ZeroValue;
 	M_LandscapeDataTexture = nullptr;
+	bM_NeedsFullPublish = true;
 	Super::EndPlay(EndPlayReason);
 }
 
@@ -747,7 +789,7 @@ bool ALandscapeDataManager::StoreContribution(
 {
 	if (SourceComponent == nullptr)
 	{
-		M_Contributions.Add(ContributionId, MoveTemp(Contribution));
+		AddCommittedContribution(ContributionId, MoveTemp(Contribution));
 		bM_IsDirty = true;
 		RebuildLandscapeData();
 		return true;
@@ -784,7 +826,7 @@ bool ALandscapeDataManager::CommitStagedContributions(const FObjectKey& SourceCo
 		FRTSLandscapeDataManagerContribution Contribution;
 		if (M_StagedContributions.RemoveAndCopyValue(ContributionId, Contribution))
 		{
-			M_Contributions.Add(ContributionId, MoveTemp(Contribution));
+			AddCommittedContribution(ContributionId, MoveTemp(Contribution));
 			bChanged = true;
 		}
 	}
@@ -806,7 +848,7 @@ bool ALandscapeDataManager::ApplyPendingRemovals(const FObjectKey& SourceCompone
 	for (const FGuid& ContributionId : ContributionIds)
 	{
 		M_PendingRemovals.Remove(ContributionId);
-		bChanged = M_Contributions.Remove(ContributionId) > 0 || bChanged;
+		bChanged = RemoveCommittedContribution(ContributionId) || bChanged;
 	}
 	return bChanged;
 }
@@ -986,7 +1028,7 @@ void ALandscapeDataManager::RemoveContribution(
 		return;
 	}
 
-	if (M_Contributions.Remove(ContributionId) > 0)
+	if (RemoveCommittedContribution(ContributionId))
 	{
 		bM_IsDirty = true;
 		RebuildLandscapeData();
@@ -1044,7 +1086,7 @@ bool ALandscapeDataManager::RemoveContributionsForSource(
 	bool bRemovedContribution = false;
 	for (const FGuid& ContributionId : ContributionIds)
 	{
-		bRemovedContribution = M_Contributions.Remove(ContributionId) > 0
+		bRemovedContribution = RemoveCommittedContribution(ContributionId)
 			|| bRemovedContribution;
 	}
 	return bRemovedContribution;
@@ -1058,36 +1100,216 @@ void ALandscapeDataManager::RebuildLandscapeData()
 	}
 
 	TGuardValue<bool> RebuildGuard(bM_IsRebuilding, true);
-	TArray<FColor> Pixels;
-	RasterizeContributions(Pixels);
-	if (PublishPixels(MoveTemp(Pixels)))
+	TArray<int32> DirtyTileIndices;
+	for (TConstSetBitIterator<> DirtyTileIterator(M_DirtyTiles); DirtyTileIterator; ++DirtyTileIterator)
+	{
+		DirtyTileIndices.Add(DirtyTileIterator.GetIndex());
+	}
+	if (DirtyTileIndices.IsEmpty())
 	{
 		bM_IsDirty = false;
+		return;
 	}
+
+	// Rasterized in place: tiles are disjoint and rendering only ever reads copies of finished tiles.
+	TArray<FColor>& CombinedPixels = M_CombinedPixels;
+	ParallelFor(DirtyTileIndices.Num(), [this, &DirtyTileIndices, &CombinedPixels](const int32 WorkIndex)
+	{
+		RasterizeTile(DirtyTileIndices[WorkIndex], CombinedPixels);
+	});
+
+	if (GetCanUpdatePublishedTexture())
+	{
+		PublishDirtyTiles(DirtyTileIndices);
+	}
+	else if (not PublishCombinedPixels())
+	{
+		// The CPU image is already correct; the tiles stay dirty so the next rebuild retries publication.
+		return;
+	}
+	M_DirtyTiles.SetRange(0, M_DirtyTiles.Num(), false);
+	bM_IsDirty = false;
 }
 
-void ALandscapeDataManager::RasterizeContributions(TArray<FColor>& OutPixels) const
+void ALandscapeDataManager::AddCommittedContribution(
+	const FGuid& ContributionId,
+	FRTSLandscapeDataManagerContribution&& Contribution)
 {
-	const int32 PixelCount = M_TextureMapping.TextureResolution.X * M_TextureMapping.TextureResolution.Y;
-	OutPixels.Init(FColor::Transparent, PixelCount);
-	for (const TPair<FGuid, FRTSLandscapeDataManagerContribution>& ContributionEntry : M_Contributions)
+	RemoveCommittedContribution(ContributionId);
+	Contribution.PixelBounds = GetContributionPixelBounds(Contribution);
+	AddContributionToTiles(ContributionId, Contribution.PixelBounds);
+	M_Contributions.Add(ContributionId, MoveTemp(Contribution));
+}
+
+bool ALandscapeDataManager::RemoveCommittedContribution(const FGuid& ContributionId)
+{
+	FRTSLandscapeDataManagerContribution Contribution;
+	if (not M_Contributions.RemoveAndCopyValue(ContributionId, Contribution))
+	{
+		return false;
+	}
+
+	RemoveContributionFromTiles(ContributionId, Contribution.PixelBounds);
+	return true;
+}
+
+void ALandscapeDataManager::ResetTileIndex()
+{
+	using LandscapeDataManagerConstants::TileResolution;
+	M_TileCount = FIntPoint(
+		FMath::DivideAndRoundUp(M_TextureMapping.TextureResolution.X, TileResolution),
+		FMath::DivideAndRoundUp(M_TextureMapping.TextureResolution.Y, TileResolution));
+	const int32 TileCount = M_TileCount.X * M_TileCount.Y;
+	M_TileContributions.Reset();
+	M_TileContributions.SetNum(TileCount);
+	M_DirtyTiles.Init(false, TileCount);
+	M_LowerMipPixels.Reset();
+	bM_NeedsFullPublish = true;
+
+	// The CPU image was just cleared, so only tiles holding committed contributions need rasterizing.
+	for (TPair<FGuid, FRTSLandscapeDataManagerContribution>& Entry : M_Contributions)
+	{
+		Entry.Value.PixelBounds = GetContributionPixelBounds(Entry.Value);
+		AddContributionToTiles(Entry.Key, Entry.Value.PixelBounds);
+	}
+	bM_IsDirty = bM_IsDirty || not M_Contributions.IsEmpty();
+}
+
+FIntRect ALandscapeDataManager::GetContributionPixelBounds(
+	const FRTSLandscapeDataManagerContribution& Contribution) const
+{
+	FIntRect UnionBounds;
+	bool bHasBounds = false;
+	const auto AddBounds = [&UnionBounds, &bHasBounds](const FIntRect& PixelBounds)
 	{
-		const FRTSLandscapeDataManagerContribution& Contribution = ContributionEntry.Value;
-		for (const FRTSLandscapeDataPointStamp& PointStamp : Contribution.PointStamps)
+		UnionBounds = bHasBounds ? UnionBounds.Union(PixelBounds) : PixelBounds;
+		bHasBounds = true;
+	};
+
+	for (const FRTSLandscapeDataPointStamp& PointStamp : Contribution.PointStamps)
+	{
+		FIntRect PointBounds;
+		if (GetPointStampPixelBounds(PointStamp, PointBounds))
 		{
-			RasterizePointStamp(PointStamp, Contribution.Channel, OutPixels);
+			AddBounds(PointBounds);
 		}
-		for (const FRTSLandscapeDataRasterContribution& Raster : Contribution.Rasters)
+	}
+	for (const FRTSLandscapeDataRasterContribution& Raster : Contribution.Rasters)
+	{
+		if (Raster.PixelBounds.Width() > 0 && Raster.PixelBounds.Height() > 0)
 		{
-			ApplyRasterContribution(Contribution, Raster, OutPixels);
+			AddBounds(Raster.PixelBounds);
 		}
 	}
+	return UnionBounds;
 }
 
-void ALandscapeDataManager::RasterizePointStamp(
+void ALandscapeDataManager::AddContributionToTiles(
+	const FGuid& ContributionId,
+	const FIntRect& PixelBounds)
+{
+	FIntRect TileRange;
+	if (not GetTileRangeForPixelBounds(PixelBounds, TileRange))
+	{
+		return;
+	}
+
+	for (int32 TileY = TileRange.Min.Y; TileY < TileRange.Max.Y; ++TileY)
+	{
+		for (int32 TileX = TileRange.Min.X; TileX < TileRange.Max.X; ++TileX)
+		{
+			const int32 TileIndex = TileY * M_TileCount.X + TileX;
+			M_TileContributions[TileIndex].Add(ContributionId);
+			M_DirtyTiles[TileIndex] = true;
+		}
+	}
+}
+
+void ALandscapeDataManager::RemoveContributionFromTiles(
+	const FGuid& ContributionId,
+	const FIntRect& PixelBounds)
+{
+	FIntRect TileRange;
+	if (not GetTileRangeForPixelBounds(PixelBounds, TileRange))
+	{
+		return;
+	}
+
+	for (int32 TileY = TileRange.Min.Y; TileY < TileRange.Max.Y; ++TileY)
+	{
+		for (int32 TileX = TileRange.Min.X; TileX < TileRange.Max.X; ++TileX)
+		{
+			const int32 TileIndex = TileY * M_TileCount.X + TileX;
+			M_TileContributions[TileIndex].RemoveSwap(ContributionId, EAllowShrinking::No);
+			M_DirtyTiles[TileIndex] = true;
+		}
+	}
+}
+
+bool ALandscapeDataManager::GetTileRangeForPixelBounds(
+	const FIntRect& PixelBounds,
+	FIntRect& OutTileRange) const
+{
+	using LandscapeDataManagerConstants::TileResolution;
+	if (PixelBounds.Width() <= 0
+		|| PixelBounds.Height() <= 0
+		|| M_TileContributions.Num() != M_TileCount.X * M_TileCount.Y)
+	{
+		return false;
+	}
+
+	OutTileRange.Min.X = FMath::Clamp(PixelBounds.Min.X / TileResolution, 0, M_TileCount.X);
+	OutTileRange.Min.Y = FMath::Clamp(PixelBounds.Min.Y / TileResolution, 0, M_TileCount.Y);
+	OutTileRange.Max.X = FMath::Clamp(FMath::DivideAndRoundUp(PixelBounds.Max.X, TileResolution), 0, M_TileCount.X);
+	OutTileRange.Max.Y = FMath::Clamp(FMath::DivideAndRoundUp(PixelBounds.Max.Y, TileResolution), 0, M_TileCount.Y);
+	return OutTileRange.Width() > 0 && OutTileRange.Height() > 0;
+}
+
+FIntRect ALandscapeDataManager::GetTilePixelRect(const int32 TileIndex) const
+{
+	using LandscapeDataManagerConstants::TileResolution;
+	const int32 TileX = TileIndex % M_TileCount.X;
+	const int32 TileY = TileIndex / M_TileCount.X;
+	return FIntRect(
+		TileX * TileResolution,
+		TileY * TileResolution,
+		FMath::Min((TileX + 1) * TileResolution, M_TextureMapping.TextureResolution.X),
+		FMath::Min((TileY + 1) * TileResolution, M_TextureMapping.TextureResolution.Y));
+}
+
+void ALandscapeDataManager::RasterizeTile(const int32 TileIndex, TArray<FColor>& InOutPixels) const
+{
+	const FIntRect TileRect = GetTilePixelRect(TileIndex);
+	for (int32 PixelY = TileRect.Min.Y; PixelY < TileRect.Max.Y; ++PixelY)
+	{
+		FColor* RowPixels = InOutPixels.GetData() + PixelY * M_TextureMapping.TextureResolution.X;
+		for (int32 PixelX = TileRect.Min.X; PixelX < TileRect.Max.X; ++PixelX)
+		{
+			RowPixels[PixelX] = FColor::Transparent;
+		}
+	}
+
+	for (const FGuid& ContributionId : M_TileContributions[TileIndex])
+	{
+		const FRTSLandscapeDataManagerContribution* Contribution = M_Contributions.Find(ContributionId);
+		if (Contribution == nullptr)
+		{
+			continue;
+		}
+		for (const FRTSLandscapeDataPointStamp& PointStamp : Contribution->PointStamps)
+		{
+			RasterizePointStamp(PointStamp, Contribution->Channel, TileRect, InOutPixels);
+		}
+		for (const FRTSLandscapeDataRasterContribution& Raster : Contribution->Rasters)
+		{
+			ApplyRasterContribution(*Contribution, Raster, TileRect, InOutPixels);
+		}
+	}
+}
+
+bool ALandscapeDataManager::GetPointStampPixelBounds(
 	const FRTSLandscapeDataPointStamp& PointStamp,
-	const ERTSLandscapeDataChannel Channel,
-	TArray<FColor>& InOutPixels) const
+	FIntRect& OutPixelBounds) const
 {
 	const FVector PointScale = PointStamp.Transform.GetScale3D();
 	if (PointStamp.Transform.ContainsNaN()
@@ -1099,16 +1321,26 @@ void ALandscapeDataManager::RasterizePointStamp(
 		|| FMath::Abs(PointScale.X) <= UE_KINDA_SMALL_NUMBER
 		|| FMath::Abs(PointScale.Y) <= UE_KINDA_SMALL_NUMBER)
 	{
-		return;
+		return false;
 	}
 
 	const FBox LocalBounds = LandscapeDataManagerConstants::GetPointStampRasterBounds(PointStamp);
+	return GetPixelRectForWorldBounds(LocalBounds.TransformBy(PointStamp.Transform), OutPixelBounds);
+}
+
+void ALandscapeDataManager::RasterizePointStamp(
+	const FRTSLandscapeDataPointStamp& PointStamp,
+	const ERTSLandscapeDataChannel Channel,
+	const FIntRect& ClipBounds,
+	TArray<FColor>& InOutPixels) const
+{
 	FIntRect PixelBounds;
-	if (not GetPixelRectForWorldBounds(LocalBounds.TransformBy(PointStamp.Transform), PixelBounds))
+	if (not GetPointStampPixelBounds(PointStamp, PixelBounds))
 	{
 		return;
 	}
 
+	PixelBounds.Clip(ClipBounds);
 	for (int32 PixelY = PixelBounds.Min.Y; PixelY < PixelBounds.Max.Y; ++PixelY)
 	{
 		RasterizePointStampRow(PointStamp, Channel, PixelBounds, PixelY, InOutPixels);
@@ -1173,6 +1405,7 @@ void ALandscapeDataManager::RasterizePointStampPixel(
 void ALandscapeDataManager::ApplyRasterContribution(
 	const FRTSLandscapeDataManagerContribution& Contribution,
 	const FRTSLandscapeDataRasterContribution& Raster,
+	const FIntRect& ClipBounds,
 	TArray<FColor>& InOutPixels) const
 {
 	const int32 RasterWidth = Raster.PixelBounds.Width();
@@ -1184,9 +1417,16 @@ void ALandscapeDataManager::ApplyRasterContribution(
 		return;
 	}
 
-	for (int32 LocalY = 0; LocalY < RasterHeight; ++LocalY)
+	FIntRect ClippedBounds = Raster.PixelBounds;
+	ClippedBounds.Clip(ClipBounds);
+	for (int32 PixelY = ClippedBounds.Min.Y; PixelY < ClippedBounds.Max.Y; ++PixelY)
 	{
-		ApplyRasterContributionRow(Contribution, Raster, LocalY, InOutPixels);
+		ApplyRasterContributionRow(
+			Contribution,
+			Raster,
+			PixelY - Raster.PixelBounds.Min.Y,
+			ClippedBounds,
+			InOutPixels);
 	}
 }
 
@@ -1194,13 +1434,14 @@ void ALandscapeDataManager::ApplyRasterContributionRow(
 	const FRTSLandscapeDataManagerContribution& Contribution,
 	const FRTSLandscapeDataRasterContribution& Raster,
 	const int32 LocalY,
+	const FIntRect& ClippedBounds,
 	TArray<FColor>& InOutPixels) const
 {
 	const int32 RasterWidth = Raster.PixelBounds.Width();
 	const int32 PixelY = Raster.PixelBounds.Min.Y + LocalY;
-	for (int32 LocalX = 0; LocalX < RasterWidth; ++LocalX)
+	for (int32 PixelX = ClippedBounds.Min.X; PixelX < ClippedBounds.Max.X; ++PixelX)
 	{
-		const int32 PixelX = Raster.PixelBounds.Min.X + LocalX;
+		const int32 LocalX = PixelX - Raster.PixelBounds.Min.X;
 		const int32 SourceIndex = LocalY * RasterWidth + LocalX;
 		const int32 DestinationIndex = PixelY * M_TextureMapping.TextureResolution.X + PixelX;
 		if (Raster.Coverage.IsValidIndex(SourceIndex) && InOutPixels.IsValidIndex(DestinationIndex))
@@ -1277,7 +1518,8 @@ FVector ALandscapeDataManager::GetWorldPositionForPixel(
 
 UTexture2D* ALandscapeDataManager::CreatePublishedTexture(
 	const TArray<FColor>& BasePixels,
-	const FIntPoint& Resolution)
+	const FIntPoint& Resolution,
+	TArray<TArray<FColor>>& OutLowerMipPixels)
 {
 	if (Resolution.X <= 0
 		|| Resolution.Y <= 0
@@ -1303,18 +1545,17 @@ UTexture2D* ALandscapeDataManager::CreatePublishedTexture(
 	PlatformData->PixelFormat = PF_B8G8R8A8;
 	NewTexture->SetPlatformData(PlatformData);
 
-	TArray<FColor> CurrentPixels = BasePixels;
+	OutLowerMipPixels.Reset();
+	LandscapeDataManagerConstants::AddTextureMip(*PlatformData, BasePixels, Resolution);
 	FIntPoint CurrentResolution = Resolution;
-	while (true)
+	while (CurrentResolution.X > 1 || CurrentResolution.Y > 1)
 	{
-		LandscapeDataManagerConstants::AddTextureMip(*PlatformData, CurrentPixels, CurrentResolution);
-		if (CurrentResolution.X == 1 && CurrentResolution.Y == 1)
-		{
-			break;
-		}
+		const TArray<FColor>& SourcePixels = OutLowerMipPixels.IsEmpty() ? BasePixels : OutLowerMipPixels.Last();
 		FIntPoint NextResolution;
-		CurrentPixels = LandscapeDataManagerConstants::BuildNextAverageMip(
-			CurrentPixels, CurrentResolution, NextResolution);
+		TArray<FColor> NextPixels = LandscapeDataManagerConstants::BuildNextAverageMip(
+			SourcePixels, CurrentResolution, NextResolution);
+		LandscapeDataManagerConstants::AddTextureMip(*PlatformData, NextPixels, NextResolution);
+		OutLowerMipPixels.Add(MoveTemp(NextPixels));
 		CurrentResolution = NextResolution;
 	}
 
@@ -1336,7 +1577,8 @@ UTexture2D* ALandscapeDataManager::CreateBlankPublishedTexture()
 	const FIntPoint PlaceholderResolution(
 		LandscapeDataManagerConstants::PlaceholderTextureResolution,
 		LandscapeDataManagerConstants::PlaceholderTextureResolution);
-	return CreatePublishedTexture(BlankPixels, PlaceholderResolution);
+	TArray<TArray<FColor>> PlaceholderLowerMipPixels;
+	return CreatePublishedTexture(BlankPixels, PlaceholderResolution, PlaceholderLowerMipPixels);
 }
 
 bool ALandscapeDataManager::PublishInitialBlankPixels(TArray<FColor>&& BlankPixels)
@@ -1351,28 +1593,86 @@ bool ALandscapeDataManager::PublishInitialBlankPixels(TArray<FColor>&& BlankPixe
 
 	M_CombinedPixels = MoveTemp(BlankPixels);
 	M_LandscapeDataTexture = NewTexture;
+	ResetTileIndex();
 	BindPublishedTextureToLandscape();
 	return true;
 }
 
-bool ALandscapeDataManager::PublishPixels(TArray<FColor>&& Pixels)
+bool ALandscapeDataManager::PublishCombinedPixels()
 {
+	TArray<TArray<FColor>> LowerMipPixels;
 	UTexture2D* NewTexture = CreatePublishedTexture(
-		Pixels,
-		M_TextureMapping.TextureResolution);
+		M_CombinedPixels,
+		M_TextureMapping.TextureResolution,
+		LowerMipPixels);
 	if (not IsValid(NewTexture))
 	{
 		RTSFunctionLibrary::ReportError(TEXT("LandscapeDataManager failed to publish its runtime texture."));
 		return false;
 	}
 
-	// The old texture remains immutable while Unreal safely retires its render resource after this swap.
-	M_CombinedPixels = MoveTemp(Pixels);
+	// The old texture stays untouched while Unreal safely retires its render resource after this swap.
+	M_LowerMipPixels = MoveTemp(LowerMipPixels);
 	M_LandscapeDataTexture = NewTexture;
+	bM_NeedsFullPublish = false;
 	BindPublishedTextureToLandscape();
 	return true;
 }
 
+bool ALandscapeDataManager::GetCanUpdatePublishedTexture() const
+{
+	const FIntPoint& Resolution = M_TextureMapping.TextureResolution;
+	return not bM_NeedsFullPublish
+		&& IsValid(M_LandscapeDataTexture)
+		&& M_LandscapeDataTexture->GetResource() != nullptr
+		&& M_LandscapeDataTexture->GetSizeX() == Resolution.X
+		&& M_LandscapeDataTexture->GetSizeY() == Resolution.Y
+		&& M_LandscapeDataTexture->GetNumMips() == M_LowerMipPixels.Num() + 1;
+}
+
+void ALandscapeDataManager::PublishDirtyTiles(const TArray<int32>& DirtyTileIndices)
+{
+	TArray<FIntRect> MipRects;
+	MipRects.Reserve(DirtyTileIndices.Num());
+	for (const int32 TileIndex : DirtyTileIndices)
+	{
+		MipRects.Add(GetTilePixelRect(TileIndex));
+	}
+	FRTSTextureRegionUpload::UploadPixelRects(
+		*M_LandscapeDataTexture, 0, M_CombinedPixels, M_TextureMapping.TextureResolution.X, MipRects);
+
+	FIntPoint SourceResolution = M_TextureMapping.TextureResolution;
+	for (int32 LowerMipIndex = 0; LowerMipIndex < M_LowerMipPixels.Num(); ++LowerMipIndex)
+	{
+		const FIntPoint MipResolution = LandscapeDataManagerConstants::GetNextMipResolution(SourceResolution);
+		// Tile borders are power-of-two aligned, so rects in a lower mip are either identical or disjoint.
+		TArray<FIntRect> NextMipRects;
+		for (const FIntRect& SourceRect : MipRects)
+		{
+			NextMipRects.AddUnique(LandscapeDataManagerConstants::GetNextMipRect(SourceRect, MipResolution));
+		}
+
+		const TArray<FColor>& SourcePixels = LowerMipIndex == 0
+			? M_CombinedPixels
+			: M_LowerMipPixels[LowerMipIndex - 1];
+		TArray<FColor>& MipPixels = M_LowerMipPixels[LowerMipIndex];
+		ParallelFor(NextMipRects.Num(), [&](const int32 WorkIndex)
+		{
+			LandscapeDataManagerConstants::UpdateAverageMipRect(
+				SourcePixels,
+				SourceResolution,
+				NextMipRects[WorkIndex],
+				MipResolution,
+				MipPixels);
+		});
+		FRTSTextureRegionUpload::UploadPixelRects(
+			*M_LandscapeDataTexture, LowerMipIndex + 1, MipPixels, MipResolution.X, NextMipRects);
+
+		MipRects = MoveTemp(NextMipRects);
+		SourceResolution = MipResolution;
+	}
+}
+
 bool ALandscapeDataManager::GetAreLandscapeDynamicMaterialInstancesEnabled(
 	const bool bReportError) const
 {
@@ -1675,6 +1975,7 @@ void ALandscapeDataManager::EndPlay_ClearPublishedTexture(
 		return;
 	}
 	M_LandscapeDataTexture = BlankTexture;
+	bM_NeedsFullPublish = true;
 	BindPublishedTextureToLandscape();
 }
 
@@ -2049,7 +2350,12 @@ void ALandscapeDataManager::ClearLandscapeData()
 		return;
 	}
 
-	M_Contributions.Reset();
+	TArray<FGuid> ContributionIds;
+	M_Contributions.GetKeys(ContributionIds);
+	for (const FGuid& ContributionId : ContributionIds)
+	{
+		RemoveCommittedContribution(ContributionId);
+	}
 	M_StagedContributions.Reset();
 	M_PendingRemovals.Reset();
 	bM_IsDirty = true;
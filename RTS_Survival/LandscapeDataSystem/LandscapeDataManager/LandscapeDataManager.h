@@ -31,11 +31,15 @@ struct FRTSLandscapeDataManagerContribution
 	ERTSLandscapeDataChannel Channel = ERTSLandscapeDataChannel::Scorched;
 	TArray<FRTSLandscapeDataPointStamp> PointStamps;
 	TArray<FRTSLandscapeDataRasterContribution> Rasters;
+
+	// Union of every stamp and raster in texture pixels, cached when committed so tile indexing never re-projects.
+	FIntRect PixelBounds;
 };
 
 /**
  * @brief Place one in a level to turn PCG footprints and volumes into a Landscape material mask.
- * It publishes immutable texture snapshots so rendering never reads storage while it is being written.
+ * Contributions are indexed per texture tile, so a commit or removal only re-rasterizes and uploads the tiles its
+ * bounds touch; rendering only ever receives copies of finished tiles.
  * @note The Landscape material must expose the texture and mapping parameters configured on this actor.
  */
 UCLASS(BlueprintType)
@@ -106,7 +110,7 @@ public:
 		const FGuid& ContributionId,
 		UPCGComponent* NewSourceComponent);
 
-	/** Rebuilds and atomically publishes the current contribution set. */
+	/** Re-rasterizes the dirty tiles of the current contribution set and publishes them atomically. */
 	UFUNCTION(BlueprintCallable, CallInEditor, Category = "Landscape Data")
 	void RebuildLandscapeData();
 
@@ -240,17 +244,56 @@ private:
 	void BindLevelStreaming();
 	void EndPlay_UnbindLevelStreaming();
 	void EndPlay_ClearPublishedTexture(EEndPlayReason::Type EndPlayReason);
-	void RasterizeContributions(TArray<FColor>& OutPixels) const;
+
+	/**
+	 * @brief Moves a contribution into the committed set and marks the tiles of its old and new bounds dirty.
+	 * @param ContributionId Stable managed-resource handle; an existing contribution with this handle is replaced.
+	 * @param Contribution Complete value-only contribution to commit.
+	 */
+	void AddCommittedContribution(
+		const FGuid& ContributionId,
+		FRTSLandscapeDataManagerContribution&& Contribution);
+
+	/** @return True when a committed contribution was removed and its tiles were marked dirty. */
+	bool RemoveCommittedContribution(const FGuid& ContributionId);
+
+	/** Sizes the tile index to the texture mapping and re-indexes every committed contribution. */
+	void ResetTileIndex();
+	FIntRect GetContributionPixelBounds(const FRTSLandscapeDataManagerContribution& Contribution) const;
+	void AddContributionToTiles(const FGuid& ContributionId, const FIntRect& PixelBounds);
+	void RemoveContributionFromTiles(const FGuid& ContributionId, const FIntRect& PixelBounds);
+	bool GetTileRangeForPixelBounds(const FIntRect& PixelBounds, FIntRect& OutTileRange) const;
+	FIntRect GetTilePixelRect(int32 TileIndex) const;
+
+	/**
+	 * @brief Clears one tile and composites every contribution indexed in it, clipped to the tile.
+	 * Tiles never share pixels, so different tiles may be rasterized concurrently into the same buffer.
+	 * @param TileIndex Row-major tile to rebuild.
+	 * @param InOutPixels Full-resolution CPU mask; only the pixels of this tile are written.
+	 */
+	void RasterizeTile(int32 TileIndex, TArray<FColor>& InOutPixels) const;
+
+	/**
+	 * @brief Validates a point footprint and projects its transformed local bounds to texture pixels.
+	 * @param PointStamp Value-only PCG point footprint.
+	 * @param OutPixelBounds Clipped axis-aligned pixel rectangle covering the footprint.
+	 * @return True when the footprint is valid and overlaps the mapped Landscape.
+	 */
+	bool GetPointStampPixelBounds(
+		const FRTSLandscapeDataPointStamp& PointStamp,
+		FIntRect& OutPixelBounds) const;
 
 	/**
 	 * @brief Projects the transformed local point bounds without losing their orientation.
 	 * @param PointStamp Value-only PCG point footprint.
 	 * @param Channel Logical texture channel receiving coverage.
+	 * @param ClipBounds Only pixels inside this rectangle are written.
 	 * @param InOutPixels Full-resolution CPU mask being composed.
 	 */
 	void RasterizePointStamp(
 		const FRTSLandscapeDataPointStamp& PointStamp,
 		ERTSLandscapeDataChannel Channel,
+		const FIntRect& ClipBounds,
 		TArray<FColor>& InOutPixels) const;
 
 	/**
@@ -285,11 +328,13 @@ private:
 	 * @brief Composites cropped coverage by maximum so overlapping writers remain independent.
 	 * @param Contribution Owner and destination-channel metadata.
 	 * @param Raster Cropped byte coverage to composite.
+	 * @param ClipBounds Only pixels inside this rectangle are written.
 	 * @param InOutPixels Full-resolution CPU mask being composed.
 	 */
 	void ApplyRasterContribution(
 		const FRTSLandscapeDataManagerContribution& Contribution,
 		const FRTSLandscapeDataRasterContribution& Raster,
+		const FIntRect& ClipBounds,
 		TArray<FColor>& InOutPixels) const;
 
 	/**
@@ -297,25 +342,41 @@ private:
 	 * @param Contribution Owner and destination-channel metadata.
 	 * @param Raster Cropped byte coverage to composite.
 	 * @param LocalY Row inside the cropped raster.
+	 * @param ClippedBounds Part of the raster inside the clip rectangle, in texture pixels.
 	 * @param InOutPixels Full-resolution CPU mask being composed.
 	 */
 	void ApplyRasterContributionRow(
 		const FRTSLandscapeDataManagerContribution& Contribution,
 		const FRTSLandscapeDataRasterContribution& Raster,
 		int32 LocalY,
+		const FIntRect& ClippedBounds,
 		TArray<FColor>& InOutPixels) const;
 	/**
-	 * @brief Builds every mip before the new immutable texture becomes visible to rendering.
+	 * @brief Builds every mip before the new texture becomes visible to rendering.
 	 * @param BasePixels Complete semantic RGBA base image.
 	 * @param Resolution Dimensions matching BasePixels.
+	 * @param OutLowerMipPixels Receives the CPU copy of every mip below mip 0.
 	 * @return An unpublished transient texture with a complete mip chain, or null.
 	 */
 	UTexture2D* CreatePublishedTexture(
 		const TArray<FColor>& BasePixels,
-		const FIntPoint& Resolution);
+		const FIntPoint& Resolution,
+		TArray<TArray<FColor>>& OutLowerMipPixels);
 	UTexture2D* CreateBlankPublishedTexture();
 	bool PublishInitialBlankPixels(TArray<FColor>&& BlankPixels);
-	bool PublishPixels(TArray<FColor>&& Pixels);
+
+	/** Publishes a new full-resolution texture built from the CPU image; used when no matching texture exists yet. */
+	bool PublishCombinedPixels();
+
+	/** @return Whether the published texture matches the CPU image layout and can receive region updates. */
+	bool GetCanUpdatePublishedTexture() const;
+
+	/**
+	 * @brief Re-filters the lower mips under the dirty tiles and uploads only those regions of every mip.
+	 * @param DirtyTileIndices Tiles rasterized since the last publication.
+	 */
+	void PublishDirtyTiles(const TArray<int32>& DirtyTileIndices);
+
 	FVector GetWorldPositionForPixel(const FIntPoint& Pixel, double WorldZ) const;
 	static void ApplyChannelMaximum(FColor& Pixel, ERTSLandscapeDataChannel Channel, uint8 Value);
 	static uint8 GetChannelValue(const FColor& Pixel, ERTSLandscapeDataChannel Channel);
@@ -398,9 +459,22 @@ private:
 
 	// CPU authority supports recomposition and gameplay queries without GPU readback.
 	TArray<FColor> M_CombinedPixels;
+
+	// CPU copies of mip 1 and lower of the published texture, so dirty tiles are re-filtered without a full chain.
+	TArray<TArray<FColor>> M_LowerMipPixels;
+
+	// Committed contribution handles whose pixel bounds overlap each tile, row-major.
+	TArray<TArray<FGuid>> M_TileContributions;
+
+	// Tiles whose composited pixels no longer match the committed contribution set.
+	TBitArray<> M_DirtyTiles;
+	FIntPoint M_TileCount = FIntPoint::ZeroValue;
 	FDelegateHandle M_LevelAddedToWorldHandle;
 	FTimerHandle M_InvalidSourceCleanupTimerHandle;
 	bool bM_IsInitialized = false;
 	bool bM_IsDirty = false;
 	bool bM_IsRebuilding = false;
+
+	// Set while the published texture is a placeholder or was built for another mapping.
+	bool bM_NeedsFullPublish = true;
 };
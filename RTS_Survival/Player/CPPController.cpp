@@ -1032,20 +1032,16 @@ void ACPPController::Tick(float DeltaTime)
 	Super::Tick(DeltaTime);
 	DeltaSeconds = DeltaTime;
 
-	// Get current mouse position in screen space.
-	FVector2D MouseScreenPosition;
-	GetMousePosition(MouseScreenPosition.X, MouseScreenPosition.Y);
-
-	// Get the current projected mouse location on the landscape.
-	FHitResult HitResultCursorProjection;
-	const bool bHit = GetHitResultUnderCursor(ECC_Visibility, false, HitResultCursorProjection);
+	// Mouse position and the projected mouse location; only traced again if the cursor, camera or hovered actor moved.
+	const FRTSHoverState& HoverState = GetHoverState();
+	const FVector2D MouseScreenPosition = HoverState.MouseScreenPosition;
 
 	// --------------------------------------------------------
 	// ----- Tick player component updates
 	// --------------------------------------------------------
-	PlayerRotationArrow.TickArrowRotation(MouseScreenPosition, HitResultCursorProjection.Location);
-	UpdateHoveringActorInfo(DeltaTime, MouseScreenPosition, HitResultCursorProjection, bHit);
-	UpdateAimAbilityAtCursorProjection(DeltaTime, HitResultCursorProjection);
+	PlayerRotationArrow.TickArrowRotation(MouseScreenPosition, HoverState.CursorHit.Location);
+	UpdateHoveringActorInfo(DeltaTime, MouseScreenPosition, HoverState.CursorHit, HoverState.bHasCursorHit);
+	UpdateAimAbilityAtCursorProjection(DeltaTime, HoverState.CursorHit);
 
 
 	M_LastFrameMousePosition = MouseScreenPosition;
@@ -1420,6 +1416,18 @@ FVector ACPPController::GetCursorWorldPosition(
 	return FVector::Zero();
 }
 
+FVector ACPPController::GetCachedCursorGroundPosition(bool& bOutIsValidCalculation) const
+{
+	const FRTSHoverState& HoverState = GetHoverState();
+	bOutIsValidCalculation = HoverState.bHasGroundLocation;
+	return HoverState.bHasGroundLocation ? HoverState.GroundLocation : FVector::Zero();
+}
+
+const FRTSHoverState& ACPPController::GetHoverState(const bool bForceRetrace) const
+{
+	return M_HoverResolver.Resolve(*this, bForceRetrace);
+}
+
 void ACPPController::SetIsPlayerInTechTree(const bool bIsInTechTree)
 {
 	if (GetIsValidPlayerCameraController())
@@ -1428,6 +1436,8 @@ void ACPPController::SetIsPlayerInTechTree(const bool bIsInTechTree)
 	}
 	// Important; needs to be set before changing pause so the pause function can check techtree-status.
 	this->bM_IsInTechTree = bIsInTechTree;
+	// The view changed without the mouse or the game camera moving, so the cached cursor hit is stale.
+	M_HoverResolver.Invalidate();
 	if (bIsInTechTree)
 	{
 		if (not M_PauseGameState.bM_IsGamePaused)
@@ -2072,17 +2082,13 @@ void ACPPController::SecondaryClickStart()
 	}
 	// This captures the primary click for formation widget creation.
 	M_PrimaryClickContext = ERTSPrimaryClickContext::SecondaryActive;
-	// Get current mouse position in screen space.
-	FVector2D MouseScreenPosition;
-	GetMousePosition(MouseScreenPosition.X, MouseScreenPosition.Y);
-
-	// Get the current projected mouse location on the landscape.
-	FHitResult HitResult;
-	if (GetHitResultUnderCursor(ECC_Visibility, false, HitResult))
+	// Get current mouse position in screen space and the projected mouse location on the landscape.
+	const FRTSHoverState& HoverState = GetHoverState(true);
+	if (HoverState.bHasCursorHit)
 	{
-		M_SecondaryStartMouseProjectedLocation = HitResult.Location;
-		M_SecondaryStartClickedActor = HitResult.GetActor();
-		PlayerRotationArrow.InitRotationArrowAction(MouseScreenPosition, HitResult.Location,
+		M_SecondaryStartMouseProjectedLocation = HoverState.CursorHit.Location;
+		M_SecondaryStartClickedActor = HoverState.CursorHit.GetActor();
+		PlayerRotationArrow.InitRotationArrowAction(HoverState.MouseScreenPosition, HoverState.CursorHit.Location,
 		                                            GetRotationArrowArcSettings());
 	}
 	else
@@ -2521,11 +2527,12 @@ void ACPPController::HandleBxpPlacementVoiceLine(const TScriptInterface<IBuildin
 
 void ACPPController::RegularPrimaryClick()
 {
-	FHitResult HitUnderCursor;
-	if (not GetHitResultUnderCursor(ECC_Visibility, false, HitUnderCursor))
+	const FRTSHoverState& HoverState = GetHoverState(true);
+	if (not HoverState.bHasCursorHit)
 	{
 		return;
 	}
+	const FHitResult& HitUnderCursor = HoverState.CursorHit;
 
 	EnsureSelectionsAreRTSValid();
 	AActor* ClickedActor = HitUnderCursor.GetActor();
@@ -3484,11 +3491,10 @@ bool ACPPController::GetSecondaryClickHitActorAndLocation(AActor*& OutClickedAct
 {
 	if (not M_SecondaryStartClickedActor.IsValid() || M_SecondaryStartMouseProjectedLocation.IsNearlyZero())
 	{
-		FHitResult HitResult;
-		const bool bHit = GetHitResultUnderCursor(ECC_Visibility, false, HitResult);
-		OutClickedActor = HitResult.GetActor();
-		OutHitLocation = HitResult.Location;
-		return bHit;
+		const FRTSHoverState& HoverState = GetHoverState(true);
+		OutClickedActor = HoverState.CursorHit.GetActor();
+		OutHitLocation = HoverState.CursorHit.Location;
+		return HoverState.bHasCursorHit;
 	}
 	OutClickedActor = M_SecondaryStartClickedActor.Get();
 	OutHitLocation = M_SecondaryStartMouseProjectedLocation;
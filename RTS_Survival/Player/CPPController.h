@@ -31,6 +31,7 @@
 #include "ConstructionPreview/BuildingPreviewMode/PlayerBuildingPreviewMode.h"
 #include "Formation/FormationPositionEffects/PlayerFormationPositionEffects.h"
 #include "FViewportScreenshotTask/FViewportScreenshotTask.h"
+#include "HoverState/RTSHoverState.h"
 #include "GameInitCallbacks/MainMenuUICallbacks.h"
 #include "PlayerFieldConstructionData/PlayerFieldConstructionCandidate.h"
 #include "PlayerRotationArrowSettings/PlayerRotationArrowSettings.h"
@@ -585,6 +586,23 @@ public:
 	UFUNCTION(BlueprintCallable)
 	FVector GetCursorWorldPosition(const float SightDistance, bool& bOutIsValidCalculation) const;
 
+	/**
+	 * @brief The landscape location under the cursor from the cached hover state, within
+	 * DeveloperSettings::UIUX::SightDistanceMouse; for callers that ask every frame.
+	 * @note Takes the visibility hit as ground location when that component blocks ECC_GameTraceChannel2, so unlike
+	 * GetCursorWorldPosition it passes through a nearer component that only blocks ECC_GameTraceChannel2.
+	 * @param bOutIsValidCalculation Whether a ground location was found.
+	 * @return The cursor world position.
+	 */
+	FVector GetCachedCursorGroundPosition(bool& bOutIsValidCalculation) const;
+
+	/**
+	 * @brief The cached hover state of the cursor; the cursor is traced again only if the mouse, camera or hovered
+	 * actor moved since the last trace.
+	 * @param bForceRetrace Trace this frame even if nothing moved; for clicks that must not use a stale hit.
+	 */
+	const FRTSHoverState& GetHoverState(const bool bForceRetrace = false) const;
+
 	/**
 	 * @brief Inits the bxp entry on the owner and updates the ui. Instantly places the bxp on its socket
 	 * or origin position depending on the type of instant spawn.
@@ -1851,6 +1869,9 @@ private:
 	UPROPERTY()
 	TWeakObjectPtr<UMissionCinematicTakeOverSession> M_ActiveMissionCinematicTakeOverSession;
 
+	// Shared cursor query of all hover, click and placement logic; mutable as resolving only refreshes the cache.
+	mutable FRTSHoverResolver M_HoverResolver;
+
 	// Tracks mouse position for hovering logic
 	FVector2D M_LastFrameMousePosition;
 	float M_TimeWithoutMouseMovement = 0.0f;
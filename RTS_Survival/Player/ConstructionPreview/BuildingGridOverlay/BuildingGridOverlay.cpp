@@ -5,6 +5,7 @@
 #include "Components/InstancedStaticMeshComponent.h"
 #include "Components/SceneComponent.h"
 #include "DrawDebugHelpers.h"
+#include "Engine/OverlapResult.h"
 #include "Engine/StaticMesh.h"
 #include "Engine/World.h"
 #include "Materials/MaterialInstanceDynamic.h"
@@ -17,6 +18,14 @@
 namespace GridOverlay_Constants
 {
 	static constexpr int32 MaxAllowedGridSize = 1024;
+	// Cached results without a static blocker are queried again after this long, so units moving into or out of a
+	// tile the preview stays on are picked up.
+	static constexpr double DynamicBlockerRefreshSeconds = 0.25;
+	// Marks an instance that has not been evaluated on any cell yet.
+	static const FIntVector UnevaluatedCell(TNumericLimits<int32>::Min());
+	// Height of a cell's Z bucket as a fraction of the overlap box half height; a tile whose center moved into
+	// another bucket, e.g. when the preview climbs a slope, is queried again at its new height.
+	static constexpr float CellHeightFractionOfOverlapHalfHeight = 0.25f;
 }
 
 ABuildingGridOverlay::ABuildingGridOverlay()
@@ -96,9 +105,17 @@ void ABuildingGridOverlay::UpdateOverlaps_ForAllTiles()
 		return;
 	}
 
+	const UWorld* World = GetWorld();
+	if (not IsValid(World))
+	{
+		RTSFunctionLibrary::ReportError(TEXT("GridOverlay: World is null in UpdateOverlaps_ForAllTiles."));
+		return;
+	}
+
+	const double TimeSeconds = World->GetTimeSeconds();
 	for (int32 Index = 0; Index < InstanceCount; ++Index)
 	{
-		UpdateSingleInstanceOverlapState(Index);
+		UpdateSingleInstanceOverlapState(Index, TimeSeconds);
 	}
 
 	FlushCustomDataRenderState();
@@ -127,6 +144,14 @@ void ABuildingGridOverlay::UpdateOverlaps_ForTiles(const TArray<int32>& Instance
 		return;
 	}
 
+	const UWorld* World = GetWorld();
+	if (not IsValid(World))
+	{
+		RTSFunctionLibrary::ReportError(TEXT("GridOverlay: World is null in UpdateOverlaps_ForTiles."));
+		return;
+	}
+
+	const double TimeSeconds = World->GetTimeSeconds();
 	for (const int32 Index : InstanceIndices)
 	{
 		if (Index < 0 || Index >= InstanceCount)
@@ -135,7 +160,7 @@ void ABuildingGridOverlay::UpdateOverlaps_ForTiles(const TArray<int32>& Instance
 				FString::Printf(TEXT("GridOverlay: Instance index %d out of range [0..%d)."), Index, InstanceCount));
 			continue;
 		}
-		UpdateSingleInstanceOverlapState(Index);
+		UpdateSingleInstanceOverlapState(Index, TimeSeconds);
 	}
 
 	FlushCustomDataRenderState();
@@ -152,6 +177,20 @@ void ABuildingGridOverlay::UpdateOverlaps_ForTiles(const TArray<int32>& Instance
 void ABuildingGridOverlay::SetExtraOverlapActorsToIgnore(const TArray<AActor*>& ActorsToIgnore)
 {
 	M_ExtraOverlapActorsToIgnore = ActorsToIgnore;
+	// Cached results may have been blocked by an actor that is ignored now.
+	InvalidateOverlapCache();
+}
+
+void ABuildingGridOverlay::InvalidateOverlapCache()
+{
+	M_CellOverlapCache.Reset();
+	M_CellsWithQueryInFlight.Reset();
+	M_OverlappedIndexSet.Reset();
+	for (FIntVector& Cell : M_CellByInstance)
+	{
+		Cell = GridOverlay_Constants::UnevaluatedCell;
+	}
+	++M_OverlapCacheGeneration;
 }
 
 void ABuildingGridOverlay::SetConstructionPreviewSquares(const TArray<int32>& InstanceIndices)
@@ -193,13 +232,17 @@ void ABuildingGridOverlay::SetConstructionPreviewSquares(const TArray<int32>& In
 
 bool ABuildingGridOverlay::AreConstructionPreviewSquaresValid() const
 {
-	// Valid if none of the footprint indices are overlapped.
+	// Valid if none of the footprint indices are overlapped and all of them have a result for their cell.
 	for (int32 Idx : M_ConstructPreviewIndices)
 	{
 		if (M_OverlappedIndexSet.Contains(Idx))
 		{
 			return false;
 		}
+		if (not M_CellByInstance.IsValidIndex(Idx) || not M_CellOverlapCache.Contains(M_CellByInstance[Idx]))
+		{
+			return false;
+		}
 	}
 	return true;
 }
@@ -349,6 +392,9 @@ void ABuildingGridOverlay::BuildInstances()
 	M_MinCellY = FMath::FloorToInt(ActorWorld.Y / Step - HalfSpan);
 
 	M_GridISM->PreAllocateInstancesMemory(N * N);
+	// Cells are keyed by step, which may have changed with the settings.
+	M_CellByInstance.Init(GridOverlay_Constants::UnevaluatedCell, N * N);
+	InvalidateOverlapCache();
 
 	for (int32 Iy = 0; Iy < N; ++Iy)
 	{
@@ -503,7 +549,27 @@ ECollisionChannel ABuildingGridOverlay::GetPlacementQueryChannel() const
 }
 
 
-void ABuildingGridOverlay::UpdateSingleInstanceOverlapState(const int32 InstanceIndex)
+FIntVector ABuildingGridOverlay::GetWorldCell(const FVector& WorldLocation) const
+{
+	const float Step = M_GridOverlaySettings.CellSize + M_GridOverlaySettings.InstanceGap;
+	const float CellHeight = FMath::Max(1.f, M_PerTileOverlapHalfHeight
+	                                    * GridOverlay_Constants::CellHeightFractionOfOverlapHalfHeight);
+	return FIntVector(FMath::RoundToInt(WorldLocation.X / Step), FMath::RoundToInt(WorldLocation.Y / Step),
+	                  FMath::RoundToInt(WorldLocation.Z / CellHeight));
+}
+
+bool ABuildingGridOverlay::GetIsCellOverlapFresh(const FIntVector& Cell, const double TimeSeconds) const
+{
+	const FGridCellOverlapState* State = M_CellOverlapCache.Find(Cell);
+	if (not State)
+	{
+		return false;
+	}
+	return State->bHasStaticBlocker
+		|| TimeSeconds - State->QueryTimeSeconds < GridOverlay_Constants::DynamicBlockerRefreshSeconds;
+}
+
+void ABuildingGridOverlay::UpdateSingleInstanceOverlapState(const int32 InstanceIndex, const double TimeSeconds)
 {
 	FTransform WorldXf;
 	if (not GetInstanceWorldTransform(InstanceIndex, WorldXf))
@@ -511,8 +577,31 @@ void ABuildingGridOverlay::UpdateSingleInstanceOverlapState(const int32 Instance
 		return;
 	}
 
-	const FVector Center = WorldXf.GetLocation();
-	const FQuat Rot = WorldXf.GetRotation();
+	if (not M_CellByInstance.IsValidIndex(InstanceIndex))
+	{
+		RTSFunctionLibrary::ReportError(
+			FString::Printf(TEXT("GridOverlay: No cell slot for instance %d; was the grid rebuilt?"), InstanceIndex));
+		return;
+	}
+
+	// The overlay moves with the preview, so the same instance covers a different cell after every snap.
+	const FIntVector Cell = GetWorldCell(WorldXf.GetLocation());
+	M_CellByInstance[InstanceIndex] = Cell;
+	if (not GetIsCellOverlapFresh(Cell, TimeSeconds) && not M_CellsWithQueryInFlight.Contains(Cell))
+	{
+		RequestCellOverlap(Cell, WorldXf.GetLocation());
+	}
+	ApplyCachedOverlapState(InstanceIndex);
+}
+
+void ABuildingGridOverlay::RequestCellOverlap(const FIntVector& Cell, const FVector& TileCenter)
+{
+	UWorld* World = GetWorld();
+	if (not IsValid(World))
+	{
+		RTSFunctionLibrary::ReportError(TEXT("GridOverlay: World is null in RequestCellOverlap."));
+		return;
+	}
 
 	const float S   = M_GridOverlaySettings.CellSize;
 	const float Gap = M_GridOverlaySettings.InstanceGap;
@@ -538,21 +627,83 @@ void ABuildingGridOverlay::UpdateSingleInstanceOverlapState(const int32 Instance
 		}
 	}
 
-	UWorld* World = GetWorld();
-	if (not IsValid(World))
+	FOverlapDelegate OverlapDelegate;
+	TWeakObjectPtr<ABuildingGridOverlay> WeakThis(this);
+	OverlapDelegate.BindLambda([WeakThis, Cell](const FTraceHandle& /*TraceHandle*/, FOverlapDatum& OverlapDatum)
+	{
+		if (not WeakThis.IsValid())
+		{
+			return;
+		}
+		WeakThis->OnCellOverlapCompleted(Cell, OverlapDatum.UserData, OverlapDatum.OutOverlaps);
+	});
+
+	// The multi overlap respects per-component responses on the placement channel: it returns components set to
+	// ECR_Overlap as well as ECR_Block, which previously took an any-test and a blocking-test per tile.
+	World->AsyncOverlapByChannel(TileCenter, FQuat::Identity, GetPlacementQueryChannel(), Shape, Params,
+	                             FCollisionResponseParams::DefaultResponseParam, &OverlapDelegate,
+	                             M_OverlapCacheGeneration);
+	M_CellsWithQueryInFlight.Add(Cell);
+}
+
+void ABuildingGridOverlay::OnCellOverlapCompleted(const FIntVector& Cell, const uint32 Generation,
+                                                  const TArray<FOverlapResult>& Overlaps)
+{
+	if (Generation != M_OverlapCacheGeneration)
 	{
-		RTSFunctionLibrary::ReportError(TEXT("GridOverlay: World is null in UpdateSingleInstanceOverlapState."));
+		// Issued before the cache was invalidated; the ignore list or grid it was queried with is outdated.
 		return;
 	}
+	M_CellsWithQueryInFlight.Remove(Cell);
 
-	const ECollisionChannel PlacementChannel = GetPlacementQueryChannel();
+	const UWorld* World = GetWorld();
+	FGridCellOverlapState& State = M_CellOverlapCache.FindOrAdd(Cell);
+	State.bHasStaticBlocker = false;
+	State.bHasDynamicBlocker = false;
+	State.QueryTimeSeconds = IsValid(World) ? World->GetTimeSeconds() : 0.0;
+	for (const FOverlapResult& Overlap : Overlaps)
+	{
+		const UPrimitiveComponent* Component = Overlap.GetComponent();
+		if (not IsValid(Component))
+		{
+			continue;
+		}
+		if (Component->Mobility == EComponentMobility::Static)
+		{
+			State.bHasStaticBlocker = true;
+		}
+		else
+		{
+			State.bHasDynamicBlocker = true;
+		}
+	}
+
+	// Every query of a batch completes in the same frame; write the tiles once the last one is in.
+	if (not M_CellsWithQueryInFlight.IsEmpty())
+	{
+		return;
+	}
+	ApplyCachedOverlapStates_ForEvaluatedTiles();
+	FlushCustomDataRenderState();
+
+	if constexpr (DeveloperSettings::Debugging::GBuilding_Mode_Compile_DebugSymbols)
+	{
+		if (M_ConstructPreviewIndices.Num() > 0)
+		{
+			Debug_DrawConstructionPreviewSquares(0.25f);
+		}
+	}
+}
 
-	// Respect per-component responses:
-	// - OverlapAnyTestByChannel: finds components set to ECR_Overlap on this channel.
-	// - OverlapBlockingTestByChannel: finds components set to ECR_Block on this channel.
-	const bool bOverlaps = World->OverlapAnyTestByChannel(Center, Rot, PlacementChannel, Shape, Params);
-	const bool bBlocks   = World->OverlapBlockingTestByChannel(Center, Rot, PlacementChannel, Shape, Params);
-	const bool bHasConflict = bOverlaps || bBlocks;
+void ABuildingGridOverlay::ApplyCachedOverlapState(const int32 InstanceIndex)
+{
+	const FGridCellOverlapState* State = M_CellOverlapCache.Find(M_CellByInstance[InstanceIndex]);
+	if (not State)
+	{
+		// Keep the last known state until the query of the new cell completes.
+		return;
+	}
+	const bool bHasConflict = State->bHasStaticBlocker || State->bHasDynamicBlocker;
 
 	if (bHasConflict) { M_OverlappedIndexSet.Add(InstanceIndex); }
 	else { M_OverlappedIndexSet.Remove(InstanceIndex); }
@@ -567,6 +718,23 @@ void ABuildingGridOverlay::UpdateSingleInstanceOverlapState(const int32 Instance
 	M_GridISM->SetCustomDataValue(InstanceIndex, 0, CustomValue, false);
 }
 
+void ABuildingGridOverlay::ApplyCachedOverlapStates_ForEvaluatedTiles()
+{
+	if (not GetIsValidGridISM())
+	{
+		return;
+	}
+
+	const int32 InstanceCount = FMath::Min(M_GridISM->GetInstanceCount(), M_CellByInstance.Num());
+	for (int32 Index = 0; Index < InstanceCount; ++Index)
+	{
+		if (M_CellByInstance[Index] != GridOverlay_Constants::UnevaluatedCell)
+		{
+			ApplyCachedOverlapState(Index);
+		}
+	}
+}
+
 float ABuildingGridOverlay::TileTypeToCustomData(const EGridOverlayTileType TileType)
 {
 	switch (TileType)
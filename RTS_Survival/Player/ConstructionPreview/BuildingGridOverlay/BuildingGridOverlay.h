@@ -9,11 +9,16 @@
 
 class UInstancedStaticMeshComponent;
 class UMaterialInstanceDynamic;
+struct FOverlapResult;
 
 /**
  * @brief Draws a flat, instanced grid overlay used during building placement.
  *        World-aligned to a virtual grid so preview sessions are consistent.
  * @note RebuildGrid: call in blueprint after changing settings at runtime to rebuild the grid.
+ * @note Tile overlaps are evaluated with one async overlap query per world cell; a cell is keyed on XY and a Z bucket,
+ *       so a tile at another height is queried again. Results are cached per cell, so only tiles that moved onto a
+ *       cell without a fresh result are queried again; static blockers stay cached until InvalidateOverlapCache.
+ *       A tile shows its last known state until the batch of queries it waits on completes.
  */
 UCLASS()
 class RTS_SURVIVAL_API ABuildingGridOverlay : public AActor
@@ -30,22 +35,28 @@ public:
 	UFUNCTION(BlueprintCallable, Category="GridOverlay")
 	void RebuildGrid();
 
-	/** Recompute overlap state for all instances (Vacant/Invalid + Valid for footprint). */
+	/** Refresh overlap state for all instances (Vacant/Invalid + Valid for footprint), querying uncached cells. */
 	UFUNCTION(BlueprintCallable, Category="GridOverlay|Collision")
 	void UpdateOverlaps_ForAllTiles();
 
-	/** Recompute overlap state for a given set of instances (Vacant/Invalid + Valid for footprint). */
+	/** Refresh overlap state for a given set of instances (Vacant/Invalid + Valid for footprint). */
 	UFUNCTION(BlueprintCallable, Category="GridOverlay|Collision")
 	void UpdateOverlaps_ForTiles(const TArray<int32>& InstanceIndices);
 
 	/** External ignore list (e.g., the preview actor) for overlap tests. */
 	void SetExtraOverlapActorsToIgnore(const TArray<AActor*>& ActorsToIgnore);
 
+	/** Drops all cached cell results; call when a new preview session starts as the world may have changed. */
+	void InvalidateOverlapCache();
+
 	// ---------- Construction preview footprint ----------
 	/** Set which instances are the construction preview footprint (pre-colored Valid when free). */
 	void SetConstructionPreviewSquares(const TArray<int32>& InstanceIndices);
 
-	/** @return true if all construction preview squares are NOT overlapped (i.e., all valid/green). */
+	/**
+	 * @return true if all construction preview squares are NOT overlapped (i.e., all valid/green).
+	 * A square whose cell has not been queried yet counts as overlapped until its result arrives.
+	 */
 	bool AreConstructionPreviewSquaresValid() const;
 
 	// ---------- Public read-only grid info for helpers ----------
@@ -103,6 +114,28 @@ private:
 	// Indices currently overlapped (blocked).
 	UPROPERTY()
 	TSet<int32> M_OverlappedIndexSet;
+
+	// ---------- Cached cell overlaps ----------
+	struct FGridCellOverlapState
+	{
+		// Static geometry cannot move, so a cell blocked by it is never queried again this session.
+		bool bHasStaticBlocker = false;
+		// Movable blockers can leave or enter the cell; refreshed once the result is older than the refresh interval.
+		bool bHasDynamicBlocker = false;
+		double QueryTimeSeconds = 0.0;
+	};
+
+	// Last completed query result per world cell (cell = world XY / step and a Z bucket, see GetWorldCell).
+	TMap<FIntVector, FGridCellOverlapState> M_CellOverlapCache;
+
+	// Cells with an async query in flight; no second query is issued for them.
+	TSet<FIntVector> M_CellsWithQueryInFlight;
+
+	// World cell each instance covered when it was last evaluated; entry i belongs to instance i.
+	TArray<FIntVector> M_CellByInstance;
+
+	// Incremented on invalidation so results of queries issued before it are discarded.
+	uint32 M_OverlapCacheGeneration = 0;
 	
 	ECollisionChannel GetPlacementQueryChannel() const;
 
@@ -122,7 +155,15 @@ private:
 	// ---------- Collision / overlap logic ----------
 	void EnsureCollisionSetup();
 	static FCollisionObjectQueryParams BuildObjectQueryForPlacement();
-	void UpdateSingleInstanceOverlapState(int32 InstanceIndex);
+	FIntVector GetWorldCell(const FVector& WorldLocation) const;
+	bool GetIsCellOverlapFresh(const FIntVector& Cell, double TimeSeconds) const;
+	void RequestCellOverlap(const FIntVector& Cell, const FVector& TileCenter);
+	void OnCellOverlapCompleted(const FIntVector& Cell, uint32 Generation, const TArray<FOverlapResult>& Overlaps);
+	/** Evaluates the instance on its current cell, queues a query if needed and writes the known state. */
+	void UpdateSingleInstanceOverlapState(int32 InstanceIndex, double TimeSeconds);
+	/** Writes the cached state of the instance's cell; a cell without a result yet keeps the tile's last state. */
+	void ApplyCachedOverlapState(int32 InstanceIndex);
+	void ApplyCachedOverlapStates_ForEvaluatedTiles();
 	static float TileTypeToCustomData(EGridOverlayTileType TileType);
 	void FlushCustomDataRenderState() const;
 
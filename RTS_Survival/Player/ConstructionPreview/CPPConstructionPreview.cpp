@@ -10,6 +10,7 @@
 #include "RTS_Survival/Player/ConstructionPreview/BuildingGridOverlay/BuildingGridOverlay.h"
 #include "PreviewWidget/W_PreviewStats.h"
 #include "RTS_Survival/Player/CPPController.h"
+#include "RTS_Survival/Player/PlayerBuildRadiusManager/PlayerBuildRadiusManager.h"
 #include "RTS_Survival/Utils/HFunctionLibary.h"
 #include "StaticMeshPreview/StaticPreviewMesh.h"
 #include "RTS_Survival/DeveloperSettings.h"
@@ -18,6 +19,7 @@
 #include "RTS_Survival/Player/Camera/CameraPawn.h"
 #include "RTS_Survival/Units/Tanks/WheeledTank/BaseTruck/NomadicVehicle.h"
 #include "RTS_Survival/Utils/CollisionSetup/FRTS_CollisionSetup.h"
+#include "RTS_Survival/Utils/RTS_Statics/RTS_Statics.h"
 FName ACPPConstructionPreview::PreviewMeshComponentName(TEXT("PreviewMesh"));
 
 
@@ -384,9 +386,7 @@ void ACPPConstructionPreview::Tick(float DetlaTime)
 	{
 		return;
 	}
-	SetCursorPosition(
-		PlayerController->GetCursorWorldPosition(DeveloperSettings::UIUX::SightDistanceMouse,
-		                                         bM_IsValidCursorLocation));
+	SetCursorPosition(PlayerController->GetCachedCursorGroundPosition(bM_IsValidCursorLocation));
 	if (not bM_IsValidCursorLocation)
 	{
 		// Location outside of view.
@@ -641,6 +641,19 @@ bool ACPPConstructionPreview::GetisWithinBuildRadii(const FVector& PreviewLocati
 		}
 		return false;
 	}
+	if (const UPlayerBuildRadiusManager* BuildRadiusManager = M_BuildRadiusManager.Get())
+	{
+		float DistanceToCenter = 0.0f;
+		float Radius = 0.0f;
+		if (not BuildRadiusManager->FindBuildRadiusForLocation(PreviewLocation, DistanceToCenter, Radius))
+		{
+			return false;
+		}
+		M_DistanceToClosestRadius = DistanceToCenter;
+		M_MaXDistanceToClosestRadius = Radius;
+		return DistanceToCenter <= Radius;
+	}
+	// Radii that are not the player's, such as the expansion radius of a bxp, are few; test each of them.
 	bool bIsWithinAnyRadius = false;
 
 	// For outside all radii
@@ -774,6 +787,7 @@ void ACPPConstructionPreview::StartNomadicPreview(
 	bM_IsValidBuildingLocation = false;
 	bM_NeedWithinBuildRadius = bNeedWithinBuildRadius;
 	M_BuildRadii = BuildRadii;
+	M_BuildRadiusManager = BuildRadii.IsEmpty() ? nullptr : FRTS_Statics::GetPlayerBuildRadiusManager(this);
 	InitPreviewAndStatWidgetForConstruction(NewPreviewMesh, EConstructionPreviewMode::Construct_NomadicPreview
 	                                        , true);
 }
@@ -796,6 +810,7 @@ void ACPPConstructionPreview::StartBxpPreview(UStaticMesh* NewPreviewMesh,
 	BxpConstructionData = ConstructionData;
 	bM_IsValidBuildingLocation = false;
 	bM_NeedWithinBuildRadius = bNeedWithinBuildRadius;
+	M_BuildRadiusManager.Reset();
 	switch (ConstructionData.GetConstructionType())
 	{
 	// Already checked in EnsureBxpPreviewRequestIsValid.
@@ -857,6 +872,7 @@ void ACPPConstructionPreview::StartFieldConstructionPreview(UStaticMesh* FieldPr
 	bM_IsValidBuildingLocation = false;
 	bM_NeedWithinBuildRadius = ConstructionData.bNeedsToBeWithinBuildRadii;
 	M_BuildRadii = BuildRadii;
+	M_BuildRadiusManager = BuildRadii.IsEmpty() ? nullptr : FRTS_Statics::GetPlayerBuildRadiusManager(this);
 	SetGridOverlayEnabled(true);
 	// Also sets the mode of construction.
 	InitPreviewAndStatWidgetForConstruction(FieldPreviewMesh, EConstructionPreviewMode::Construct_FieldConstruction,
@@ -1085,6 +1101,8 @@ void ACPPConstructionPreview::SetGridOverlayEnabled(const bool bEnabled) const
 	}
 	if (bEnabled)
 	{
+		// A new preview session; buildings may have been placed or destroyed since the cells were cached.
+		M_GridOverlay->InvalidateOverlapCache();
 		M_GridOverlay->SetActorHiddenInGame(false);
 		M_GridOverlay->SetActorEnableCollision(true);
 	}
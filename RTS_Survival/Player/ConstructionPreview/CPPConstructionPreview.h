@@ -28,6 +28,7 @@ struct FBxpConstructionData;
 enum class EPlayerBuildingPreviewMode : uint8;
 class AConstructionRadiusHelper;
 class UW_PreviewStats;
+class UPlayerBuildRadiusManager;
 class RTS_SURVIVAL_API ACPPController;
 // Forward declarations.
 class RTS_SURVIVAL_API AStaticPreviewMesh;
@@ -342,6 +343,10 @@ private:
 	UPROPERTY()
 	TArray<URadiusComp*> M_BuildRadii;
 
+	// Set when M_BuildRadii are the player's build radii, so placement is checked against the manager's coverage
+	// index instead of every radius.
+	TWeakObjectPtr<UPlayerBuildRadiusManager> M_BuildRadiusManager;
+
 	UPROPERTY()
 	float M_DistanceToClosestRadius;
 
@@ -2,12 +2,141 @@
 #include "CPPHUD.h"
 
 #include "components/BoxComponent.h"
+#include "Engine/GameViewportClient.h"
+#include "Engine/LocalPlayer.h"
+#include "SceneView.h"
+#include "RTS_Survival/DeveloperSettings.h"
+#include "RTS_Survival/Game/GameState/GameUnitManager/GameUnitManager.h"
 #include "RTS_Survival/MasterObjects/SelectableBase/SelectableActorObjectsMaster.h"
 #include "RTS_Survival/MasterObjects/SelectableBase/SelectablePawnMaster.h"
 #include "RTS_Survival/Player/CPPController.h"
 #include "RTS_Survival/RTSComponents/RTSComponent.h"
 #include "RTS_Survival/RTSComponents/SelectionComponent.h"
+#include "RTS_Survival/Subsystems/HealthBarRenderSubsystem/RTSHealthBarRenderSubsystem.h"
 #include "RTS_Survival/Utils/HFunctionLibary.h"
+#include "RTS_Survival/Utils/RTS_Statics/RTS_Statics.h"
+
+namespace MarqueeSelectionConstants
+{
+	// The screen circle is only derived when the camera is at least this many cm outside the bounds sphere; closer
+	// to it the circle grows without limit and the corner test decides.
+	constexpr double MinCameraDistanceToBoundsSphere = 10.0;
+}
+
+namespace
+{
+	const FVector BoundsPointMapping[8] =
+	{
+		FVector(1.f, 1.f, 1.f),
+		FVector(1.f, 1.f, -1.f),
+		FVector(1.f, -1.f, 1.f),
+		FVector(1.f, -1.f, -1.f),
+		FVector(-1.f, 1.f, 1.f),
+		FVector(-1.f, 1.f, -1.f),
+		FVector(-1.f, -1.f, 1.f),
+		FVector(-1.f, -1.f, -1.f)
+	};
+
+	enum class EMarqueeOverlap : uint8
+	{
+		Outside,
+		Inside,
+		// The screen circle alone cannot decide; the projected corners are tested.
+		Border
+	};
+
+	bool GetIsHiddenFromMarquee(const ASquadUnit*)
+	{
+		return false;
+	}
+
+	bool GetIsHiddenFromMarquee(const ASelectableActorObjectsMaster* SelectableActor)
+	{
+		return SelectableActor->bIsHidden;
+	}
+
+	bool GetIsHiddenFromMarquee(const ASelectablePawnMaster* SelectablePawn)
+	{
+		return SelectablePawn->GetIsHidden();
+	}
+
+	/** @return The selection area of the candidate if player 1 can currently select it, nullptr otherwise. */
+	template <typename TSelectable>
+	const UBoxComponent* GetSelectableArea(const TSelectable* Candidate)
+	{
+		if (not IsValid(Candidate))
+		{
+			return nullptr;
+		}
+		const USelectionComponent* SelectionComponent = Candidate->GetSelectionComponent();
+		const URTSComponent* RTSComponent = Candidate->GetRTSComponent();
+		if (not SelectionComponent || not SelectionComponent->GetSelectionArea() || not RTSComponent)
+		{
+			return nullptr;
+		}
+		if (not SelectionComponent->GetCanBeSelected() || RTSComponent->GetOwningPlayer() != 1
+			|| GetIsHiddenFromMarquee(Candidate))
+		{
+			return nullptr;
+		}
+		return SelectionComponent->GetSelectionArea();
+	}
+
+	bool GetViewOfPlayer(const APlayerController* PlayerController, FMarqueeView& OutView)
+	{
+		const ULocalPlayer* LocalPlayer = PlayerController->GetLocalPlayer();
+		if (not IsValid(LocalPlayer) || not IsValid(LocalPlayer->ViewportClient)
+			|| not LocalPlayer->ViewportClient->Viewport)
+		{
+			return false;
+		}
+		FSceneViewProjectionData ProjectionData;
+		if (not LocalPlayer->GetProjectionData(LocalPlayer->ViewportClient->Viewport, ProjectionData))
+		{
+			return false;
+		}
+		// Same projection as APlayerController::ProjectWorldLocationToScreen, computed once per pass.
+		OutView.ViewProjectionMatrix = ProjectionData.ComputeViewProjectionMatrix();
+		OutView.ViewRotationMatrix = ProjectionData.ViewRotationMatrix;
+		OutView.ViewOrigin = ProjectionData.ViewOrigin;
+		OutView.ViewRect = ProjectionData.GetConstrainedViewRect();
+		OutView.PixelsPerViewSlope = 0.5 * FVector2D(
+			ProjectionData.ProjectionMatrix.M[0][0] * OutView.ViewRect.Width(),
+			ProjectionData.ProjectionMatrix.M[1][1] * OutView.ViewRect.Height());
+		OutView.bIsPerspective = ProjectionData.IsPerspectiveProjection();
+		OutView.bIsValid = true;
+		return true;
+	}
+
+	/**
+	 * Inside and Outside are only returned when the rectangle of the projected corners is guaranteed to give the same
+	 * answer: the corners lie within the screen circle, and with the whole bounds in front of the camera the
+	 * projected center lies within their rectangle.
+	 */
+	EMarqueeOverlap GetScreenCircleOverlap(const FBox2D& SelectionRectangle, const FMarqueeScreenBounds& ScreenBounds,
+	                                       const bool bActorMustBeFullyEnclosed)
+	{
+		if (ScreenBounds.ScreenRadius < 0.f)
+		{
+			return EMarqueeOverlap::Border;
+		}
+		const FVector2D RadiusOffset(ScreenBounds.ScreenRadius);
+		const FBox2D CircleBox(ScreenBounds.ScreenCenter - RadiusOffset, ScreenBounds.ScreenCenter + RadiusOffset);
+		if (not SelectionRectangle.Intersect(CircleBox))
+		{
+			return EMarqueeOverlap::Outside;
+		}
+		if (SelectionRectangle.IsInside(CircleBox))
+		{
+			return EMarqueeOverlap::Inside;
+		}
+		if (not bActorMustBeFullyEnclosed && SelectionRectangle.IsInside(ScreenBounds.ScreenCenter))
+		{
+			return EMarqueeOverlap::Inside;
+		}
+		return EMarqueeOverlap::Border;
+	}
+}
 
 
 FVector2D ACPPHUD::GetMousePosition2D() const
@@ -51,284 +180,156 @@ void ACPPHUD::GetAllSelectableUnitsOnScreen(
 	}
 
 	const FVector2D ScreenBottomRight(static_cast<float>(ViewportWidth), static_cast<float>(ViewportHeight));
-	GetSquadUnitsInSelectionRectangle(FVector2D::ZeroVector, ScreenBottomRight, OutSquadUnits, false);
-	GetSelectableActorsInRectangle(FVector2D::ZeroVector, ScreenBottomRight, OutSelectableActors, false);
-	GetSelectablePawnsInRectangle(FVector2D::ZeroVector, ScreenBottomRight, OutSelectablePawns, false);
+	GetUnitsInSelectionRectangle(FVector2D::ZeroVector, ScreenBottomRight, OutSquadUnits, OutSelectableActors,
+	                             OutSelectablePawns, false);
 }
 
 
-void ACPPHUD::GetSquadUnitsInSelectionRectangle(const FVector2D& FirstPoint,
-                                                const FVector2D& SecondPoint,
-                                                TArray<ASquadUnit*>& OutActors,
-                                                bool bActorMustBeFullyEnclosed) const
+void ACPPHUD::GetUnitsInSelectionRectangle(const FVector2D& FirstPoint,
+                                           const FVector2D& SecondPoint,
+                                           TArray<ASquadUnit*>& OutSquadUnits,
+                                           TArray<ASelectableActorObjectsMaster*>& OutSelectableActors,
+                                           TArray<ASelectablePawnMaster*>& OutSelectablePawns,
+                                           bool bActorMustBeFullyEnclosed)
 {
 	// Clear previous content.
-	OutActors.Reset();
+	OutSquadUnits.Reset();
+	OutSelectableActors.Reset();
+	OutSelectablePawns.Reset();
 
-	// Create the selection rectangle.
-	FBox2D SelectionRectangle(ForceInit);
-	SelectionRectangle += FirstPoint;
-	SelectionRectangle += SecondPoint;
-
-	const FVector BoundsPointMapping[8] =
+	if (not UpdateMarqueeView() || not CollectSelectionCandidates())
 	{
-		FVector(1.f, 1.f, 1.f),
-		FVector(1.f, 1.f, -1.f),
-		FVector(1.f, -1.f, 1.f),
-		FVector(1.f, -1.f, -1.f),
-		FVector(-1.f, 1.f, 1.f),
-		FVector(-1.f, 1.f, -1.f),
-		FVector(-1.f, -1.f, 1.f),
-		FVector(-1.f, -1.f, -1.f)
-	};
-
-	// Iterate through all squad units.
-	for (TActorIterator<ASquadUnit> Itr(GetWorld(), ASquadUnit::StaticClass()); Itr; ++Itr)
-	{
-		ASquadUnit* EachActor = *Itr;
-
-		if (not EachActor || not EachActor->GetSelectionComponent() || not EachActor->GetSelectionComponent()->
-			GetSelectionArea() ||
-			not EachActor->GetRTSComponent())
-		{
-			continue;
-		}
-
-
-		// Get the actor's bounding box.
-		const FBox EachActorBounds = EachActor->GetSelectionComponent()->GetSelectionArea()->Bounds.GetBox();
-		const FVector BoxCenter = EachActorBounds.GetCenter();
-		const FVector BoxExtents = EachActorBounds.GetExtent();
-
-		// Check if actor is in view frustum.
-		if (not IsInViewFrustum(BoxCenter))
-		{
-			continue; // Skip if not in view.
-		}
-
-		// Build 2D bounding box of actor in screen space.
-		FBox2D ActorBox2D(ForceInit);
-		for (uint8 BoundsPointItr = 0; BoundsPointItr < 8; BoundsPointItr++)
-		{
-			FVector2D ScreenLocation;
-			if (ProjectWorldLocationToScreenSafely(
-				BoxCenter + (BoundsPointMapping[BoundsPointItr] * BoxExtents), ScreenLocation))
-			{
-				ActorBox2D += ScreenLocation;
-			}
-		}
-
-		// Check for selection conditions.
-		if (EachActor->GetSelectionComponent()->GetCanBeSelected() && EachActor->GetRTSComponent()->GetOwningPlayer() ==
-			1)
-		{
-			if (bActorMustBeFullyEnclosed)
-			{
-				if (SelectionRectangle.IsInside(ActorBox2D))
-				{
-					OutActors.Add(EachActor);
-				}
-			}
-			else
-			{
-				if (SelectionRectangle.Intersect(ActorBox2D))
-				{
-					OutActors.Add(EachActor);
-				}
-			}
-		}
+		return;
 	}
-}
-
-void ACPPHUD::GetSelectableActorsInRectangle(const FVector2D& FirstPoint, const FVector2D& SecondPoint,
-                                             TArray<ASelectableActorObjectsMaster*>& OutActors,
-                                             bool bActorMustBeFullyEnclosed)
-{
-	// Clear previous content.
-	OutActors.Reset();
 
 	// Create the selection rectangle.
 	FBox2D SelectionRectangle(ForceInit);
 	SelectionRectangle += FirstPoint;
 	SelectionRectangle += SecondPoint;
 
-	const FVector BoundsPointMapping[8] =
-	{
-		FVector(1.f, 1.f, 1.f),
-		FVector(1.f, 1.f, -1.f),
-		FVector(1.f, -1.f, 1.f),
-		FVector(1.f, -1.f, -1.f),
-		FVector(-1.f, 1.f, 1.f),
-		FVector(-1.f, 1.f, -1.f),
-		FVector(-1.f, -1.f, 1.f),
-		FVector(-1.f, -1.f, -1.f)
-	};
+	FilterCandidatesInRectangle(M_CandidateSquadUnits, SelectionRectangle, OutSquadUnits, bActorMustBeFullyEnclosed);
+	FilterCandidatesInRectangle(M_CandidateSelectableActors, SelectionRectangle, OutSelectableActors,
+	                            bActorMustBeFullyEnclosed);
+	FilterCandidatesInRectangle(M_CandidateSelectablePawns, SelectionRectangle, OutSelectablePawns,
+	                            bActorMustBeFullyEnclosed);
+}
 
-	// Iterate through all selectable actors.
-	for (TActorIterator<ASelectableActorObjectsMaster> Itr(GetWorld(), ASelectableActorObjectsMaster::StaticClass());
-	     Itr; ++Itr)
+template <typename TSelectable>
+void ACPPHUD::FilterCandidatesInRectangle(const TArray<TSelectable*>& Candidates,
+                                          const FBox2D& SelectionRectangle,
+                                          TArray<TSelectable*>& OutSelected,
+                                          bool bActorMustBeFullyEnclosed)
+{
+	for (TSelectable* EachCandidate : Candidates)
 	{
-		ASelectableActorObjectsMaster* EachActor = *Itr;
-
-		if (not EachActor || not EachActor->GetSelectionComponent() || not EachActor->GetSelectionComponent()->
-			GetSelectionArea() ||
-			not EachActor->GetRTSComponent())
+		const UBoxComponent* SelectionArea = GetSelectableArea(EachCandidate);
+		if (not SelectionArea)
 		{
 			continue;
 		}
-
-
-		// Get the actor's bounding box.
-		const FBox EachActorBounds = EachActor->GetSelectionComponent()->GetSelectionArea()->Bounds.GetBox();
-		const FVector BoxCenter = EachActorBounds.GetCenter();
-		const FVector BoxExtents = EachActorBounds.GetExtent();
-
-		// Check if actor is in view frustum.
-		if (not IsInViewFrustum(BoxCenter))
+		FMarqueeScreenBounds ScreenBounds = ProjectMarqueeScreenBounds(SelectionArea->Bounds);
+		if (not ScreenBounds.bIsCenterInFront)
 		{
 			continue; // Skip if not in view.
 		}
 
-		// Build 2D bounding box of actor in screen space.
-		FBox2D ActorBox2D(ForceInit);
-		for (uint8 BoundsPointItr = 0; BoundsPointItr < 8; BoundsPointItr++)
+		bool bIsSelected = false;
+		switch (GetScreenCircleOverlap(SelectionRectangle, ScreenBounds, bActorMustBeFullyEnclosed))
 		{
-			FVector2D ScreenLocation;
-			if (ProjectWorldLocationToScreenSafely(
-				BoxCenter + (BoundsPointMapping[BoundsPointItr] * BoxExtents), ScreenLocation))
+		case EMarqueeOverlap::Outside:
+			break;
+		case EMarqueeOverlap::Inside:
+			bIsSelected = true;
+			break;
+		case EMarqueeOverlap::Border:
+			if (not ScreenBounds.bHasCornerBox)
 			{
-				ActorBox2D += ScreenLocation;
+				ProjectBoundsCorners(ScreenBounds);
 			}
-		}
-
-		// Check for selection conditions.
-		if (EachActor->GetSelectionComponent()->GetCanBeSelected() && EachActor->GetRTSComponent()->GetOwningPlayer() ==
-			1 && not EachActor->bIsHidden)
-		{
-			if (bActorMustBeFullyEnclosed)
+			if (ScreenBounds.CornerBox.bIsValid)
 			{
-				if (SelectionRectangle.IsInside(ActorBox2D))
-				{
-					OutActors.Add(EachActor);
-				}
-			}
-			else
-			{
-				if (SelectionRectangle.Intersect(ActorBox2D))
-				{
-					OutActors.Add(EachActor);
-				}
+				bIsSelected = bActorMustBeFullyEnclosed
+					              ? SelectionRectangle.IsInside(ScreenBounds.CornerBox)
+					              : SelectionRectangle.Intersect(ScreenBounds.CornerBox);
 			}
+			break;
+		}
+		if (bIsSelected)
+		{
+			OutSelected.Add(EachCandidate);
 		}
 	}
 }
 
-void ACPPHUD::GetSelectablePawnsInRectangle(const FVector2D& FirstPoint,
-                                            const FVector2D& SecondPoint,
-                                            TArray<ASelectablePawnMaster*>& OutActors,
-                                            bool bActorMustBeFullyEnclosed)
+bool ACPPHUD::CollectSelectionCandidates()
 {
-	// Clear previous content.
-	OutActors.Reset();
-
-	// Create the selection rectangle.
-	FBox2D SelectionRectangle(ForceInit);
-	SelectionRectangle += FirstPoint;
-	SelectionRectangle += SecondPoint;
-
-	const FVector BoundsPointMapping[8] =
-	{
-		FVector(1.f, 1.f, 1.f),
-		FVector(1.f, 1.f, -1.f),
-		FVector(1.f, -1.f, 1.f),
-		FVector(1.f, -1.f, -1.f),
-		FVector(-1.f, 1.f, 1.f),
-		FVector(-1.f, 1.f, -1.f),
-		FVector(-1.f, -1.f, 1.f),
-		FVector(-1.f, -1.f, -1.f)
-	};
-
-	// Iterate through all selectable pawns.
-	for (TActorIterator<ASelectablePawnMaster> Itr(GetWorld(), ASelectablePawnMaster::StaticClass()); Itr; ++Itr)
+	UGameUnitManager* GameUnitManager = FRTS_Statics::GetGameUnitManager(this);
+	if (not IsValid(GameUnitManager))
 	{
-		ASelectablePawnMaster* EachActor = *Itr;
-
-		// Get the actor's bounding box.
-		if (not EachActor || not EachActor->GetSelectionComponent() || not EachActor->GetSelectionComponent()->
-			GetSelectionArea() ||
-			not EachActor->GetRTSComponent())
-		{
-			continue;
-		}
-		const FBox EachActorBounds = EachActor->GetSelectionComponent()->GetSelectionArea()->Bounds.GetBox();
-		const FVector BoxCenter = EachActorBounds.GetCenter();
-		const FVector BoxExtents = EachActorBounds.GetExtent();
-
-		// Check if actor is in view frustum.
-		if (not IsInViewFrustum(BoxCenter))
-		{
-			continue; // Skip if not in view.
-		}
-
-		// Build 2D bounding box of actor in screen space.
-		FBox2D ActorBox2D(ForceInit);
-		for (uint8 BoundsPointItr = 0; BoundsPointItr < 8; BoundsPointItr++)
-		{
-			FVector2D ScreenLocation;
-			if (ProjectWorldLocationToScreenSafely(
-				BoxCenter + (BoundsPointMapping[BoundsPointItr] * BoxExtents), ScreenLocation))
-			{
-				ActorBox2D += ScreenLocation;
-			}
-		}
-
-		// Check for selection conditions.
-		if ((EachActor->GetSelectionComponent()->GetCanBeSelected() && EachActor->GetRTSComponent()->GetOwningPlayer()
-			== 1) && not EachActor->GetIsHidden())
-		{
-			if (bActorMustBeFullyEnclosed)
-			{
-				if (SelectionRectangle.IsInside(ActorBox2D))
-				{
-					OutActors.Add(EachActor);
-				}
-			}
-			else
-			{
-				if (SelectionRectangle.Intersect(ActorBox2D))
-				{
-					OutActors.Add(EachActor);
-				}
-			}
-		}
+		M_CandidateSquadUnits.Reset();
+		M_CandidateSelectableActors.Reset();
+		M_CandidateSelectablePawns.Reset();
+		return false;
 	}
+	GameUnitManager->GetPlayerSelectionCandidates(
+		M_CandidateSquadUnits, M_CandidateSelectableActors, M_CandidateSelectablePawns);
+	return true;
 }
 
-bool ACPPHUD::IsInViewFrustum(const FVector& ObjectLocation) const
+bool ACPPHUD::UpdateMarqueeView()
 {
 	const APlayerController* OwningPlayerController = GetValidOwningPlayerController();
-	if (not IsValid(OwningPlayerController) || not IsValid(OwningPlayerController->PlayerCameraManager))
+	M_MarqueeView = FMarqueeView();
+	return IsValid(OwningPlayerController) && GetViewOfPlayer(OwningPlayerController, M_MarqueeView);
+}
+
+FMarqueeScreenBounds ACPPHUD::ProjectMarqueeScreenBounds(const FBoxSphereBounds& SelectionBounds) const
+{
+	using namespace MarqueeSelectionConstants;
+	FMarqueeScreenBounds ScreenBounds;
+	ScreenBounds.BoundsOrigin = SelectionBounds.Origin;
+	ScreenBounds.BoundsExtent = SelectionBounds.BoxExtent;
+	ScreenBounds.bIsCenterInFront = FSceneView::ProjectWorldToScreen(
+		ScreenBounds.BoundsOrigin, M_MarqueeView.ViewRect, M_MarqueeView.ViewProjectionMatrix,
+		ScreenBounds.ScreenCenter);
+	if (not ScreenBounds.bIsCenterInFront || not M_MarqueeView.bIsPerspective)
 	{
-		return false;
+		return ScreenBounds;
 	}
 
-	const FVector CameraLocation = OwningPlayerController->PlayerCameraManager->GetCameraLocation();
-	const FVector CameraForward = OwningPlayerController->PlayerCameraManager->GetActorForwardVector();
-	const FVector DirectionToObject = (ObjectLocation - CameraLocation).GetSafeNormal();
-
-	// Check if the dot product is above a certain threshold (e.g., 0.0)
-	return FVector::DotProduct(CameraForward, DirectionToObject) > 0.0f;
+	// Every corner lies in the sphere around the box. For a sphere point P at view depth Pz >= Depth - Radius,
+	// |Px/Pz - Cx/Depth| <= Radius * (Depth + |Cx|) / (Depth * (Depth - Radius)), and likewise for Y; scaled to
+	// pixels this bounds how far any corner projects from the projected center.
+	const FVector ViewSpaceCenter = M_MarqueeView.ViewRotationMatrix.TransformPosition(
+		ScreenBounds.BoundsOrigin - M_MarqueeView.ViewOrigin);
+	const double Depth = ViewSpaceCenter.Z;
+	const double SphereRadius = ScreenBounds.BoundsExtent.Size();
+	if (Depth - SphereRadius < MinCameraDistanceToBoundsSphere)
+	{
+		return ScreenBounds;
+	}
+	const double SlopeScale = SphereRadius / (Depth * (Depth - SphereRadius));
+	ScreenBounds.ScreenRadius = SlopeScale * FMath::Max(
+		M_MarqueeView.PixelsPerViewSlope.X * (Depth + FMath::Abs(ViewSpaceCenter.X)),
+		M_MarqueeView.PixelsPerViewSlope.Y * (Depth + FMath::Abs(ViewSpaceCenter.Y)));
+	return ScreenBounds;
 }
 
-bool ACPPHUD::ProjectWorldLocationToScreenSafely(const FVector& WorldLocation, FVector2D& OutScreenLocation) const
+void ACPPHUD::ProjectBoundsCorners(FMarqueeScreenBounds& ScreenBounds) const
 {
-	APlayerController* OwningPlayerController = GetValidOwningPlayerController();
-	if (not IsValid(OwningPlayerController))
+	// Build 2D bounding box of actor in screen space; corners behind the camera are left out.
+	ScreenBounds.CornerBox = FBox2D(ForceInit);
+	for (const FVector& BoundsPoint : BoundsPointMapping)
 	{
-		return false;
+		FVector2D ScreenLocation;
+		if (FSceneView::ProjectWorldToScreen(ScreenBounds.BoundsOrigin + BoundsPoint * ScreenBounds.BoundsExtent,
+		                                     M_MarqueeView.ViewRect, M_MarqueeView.ViewProjectionMatrix,
+		                                     ScreenLocation))
+		{
+			ScreenBounds.CornerBox += ScreenLocation;
+		}
 	}
-
-	return OwningPlayerController->ProjectWorldLocationToScreen(WorldLocation, OutScreenLocation);
+	ScreenBounds.bHasCornerBox = true;
 }
 
 APlayerController* ACPPHUD::GetValidOwningPlayerController() const
@@ -361,6 +362,12 @@ bool ACPPHUD::GetIsValidPlayerController() const
 
 void ACPPHUD::DrawHUD()
 {
+	// Batched unit health bars are drawn first so the marquee is painted over them.
+	if (URTSHealthBarRenderSubsystem* HealthBarRenderSubsystem =
+		GetWorld()->GetSubsystem<URTSHealthBarRenderSubsystem>())
+	{
+		HealthBarRenderSubsystem->DrawHealthBars(Canvas);
+	}
 	if (not GetIsValidPlayerController())
 	{
 		return;
@@ -402,12 +409,8 @@ void ACPPHUD::OnSelectionEnded(const FVector2D MarqueeEndPoint)
 
 
 		// Obtain units from marquee.
-		GetSquadUnitsInSelectionRectangle(M_InitialPoint, MarqueeEndPoint,
-		                                  M_TSquadUnitsInRectangle, false);
-		GetSelectableActorsInRectangle(M_InitialPoint, MarqueeEndPoint,
-		                               M_TSelectableActorsInRectangle, false);
-		GetSelectablePawnsInRectangle(M_InitialPoint, MarqueeEndPoint,
-		                              M_TSelectablePawnsInRectangle, false);
+		GetUnitsInSelectionRectangle(M_InitialPoint, MarqueeEndPoint, M_TSquadUnitsInRectangle,
+		                             M_TSelectableActorsInRectangle, M_TSelectablePawnsInRectangle, false);
 		PLayerController->SelectUnitsFromMarquee(M_TSquadUnitsInRectangle,
 		                                         M_TSelectableActorsInRectangle, M_TSelectablePawnsInRectangle);
 		M_TSquadUnitsInRectangle.Empty();
@@ -13,6 +13,35 @@
 class RTS_SURVIVAL_API ACPPController;
 class RTS_SURVIVAL_API ASelectableActorObjectsMaster;
 class RTS_SURVIVAL_API ASelectablePawnMaster;
+
+/** @brief View projection of the owning player's viewport that a marquee selection pass projects with. */
+struct FMarqueeView
+{
+	FMatrix ViewProjectionMatrix = FMatrix::Identity;
+	FMatrix ViewRotationMatrix = FMatrix::Identity;
+	FVector ViewOrigin = FVector::ZeroVector;
+	FIntRect ViewRect;
+	// Screen pixels per unit of view space X/Z and Y/Z.
+	FVector2D PixelsPerViewSlope = FVector2D::ZeroVector;
+	bool bIsPerspective = false;
+	bool bIsValid = false;
+};
+
+/** @brief Screen space footprint of a unit's selection bounds for the marquee view of the current pass. */
+struct FMarqueeScreenBounds
+{
+	FVector BoundsOrigin = FVector::ZeroVector;
+	FVector BoundsExtent = FVector::ZeroVector;
+	FVector2D ScreenCenter = FVector2D::ZeroVector;
+	// Radius of a screen circle that contains all projected corners; negative if no such circle could be derived
+	// (camera inside or behind the bounds sphere), in which case only the corner test decides.
+	double ScreenRadius = -1.0;
+	bool bIsCenterInFront = false;
+	// Screen rectangle of the corners that project, computed lazily for units on the marquee border.
+	FBox2D CornerBox = FBox2D(ForceInit);
+	bool bHasCornerBox = false;
+};
+
 /**
  * @brief Used by the player controller to draw marquee selection and collect selectable actors under it.
  */
@@ -66,45 +95,48 @@ private:
     FVector2D GetMousePosition2D() const;
 
 	/**
-	* @brief Selects all Actors of type UnitMaster inside the marquee selection box given by the two passed on points.
-	* Uses a projection to screen space.
+	* @brief Selects all player units inside the marquee selection box given by the two passed on points.
+	* Candidates come from the player unit lists of the game unit manager. Each unit's selection bounds are projected
+	* once as a screen space circle using the view projection matrix of this pass; only units whose circle lies on
+	* the rectangle border are tested precisely with their eight projected bounds corners.
 	* @param FirstPoint: Begin point of the drawn marquee selection.
 	* @param SecondPoint: Current/last point of the marquee that is drawn.
-	* @param OutActors: TArray with all unitmasters that are selected.
+	* @param OutSquadUnits: All squad units that are selected.
+	* @param OutSelectableActors: All SelectableActors that are selected.
+	* @param OutSelectablePawns: All ASelectablePawnMaster that are selected.
 	* @param bActorMustBeFullyEnclosed: If the marquee needs to contain all of the actor's bounds.
-	*/ 
-	void GetSquadUnitsInSelectionRectangle(const FVector2D& FirstPoint,
-	                                        const FVector2D& SecondPoint,
-	                                        TArray<ASquadUnit*>& OutActors,
-	                                        bool bActorMustBeFullyEnclosed) const;
+	*/
+	void GetUnitsInSelectionRectangle(const FVector2D& FirstPoint,
+	                                  const FVector2D& SecondPoint,
+	                                  TArray<ASquadUnit*>& OutSquadUnits,
+	                                  TArray<ASelectableActorObjectsMaster*>& OutSelectableActors,
+	                                  TArray<ASelectablePawnMaster*>& OutSelectablePawns,
+	                                  bool bActorMustBeFullyEnclosed);
+
+	template <typename TSelectable>
+	void FilterCandidatesInRectangle(const TArray<TSelectable*>& Candidates,
+	                                 const FBox2D& SelectionRectangle,
+	                                 TArray<TSelectable*>& OutSelected,
+	                                 bool bActorMustBeFullyEnclosed);
 
 	/**
-	* @brief Selects all Actors of type SelectableActor inside the marquee selection box given by the two passed on points.
-	* Uses a projection to screen space.
-	* @param FirstPoint: Begin point of the drawn marquee selection.
-	* @param SecondPoint: Current/last point of the marquee that is drawn.
-	* @param OutActors: TArray with all SelectableActors that are selected.
-	* @param bActorMustBeFullyEnclosed: If the marquee needs to contain all of the actor's bounds.
-	*/ 
-	void GetSelectableActorsInRectangle( const FVector2D& FirstPoint,
-		const FVector2D& SecondPoint,
-		TArray<ASelectableActorObjectsMaster*>& OutActors,
-		bool bActorMustBeFullyEnclosed);
-	
+	 * @brief Fetches the player's selectable units from the game unit manager into the candidate arrays.
+	 * @return False if there is no game unit manager.
+	 */
+	bool CollectSelectionCandidates();
+
 	/**
-	* @brief Selects all Actors of type ASelectablePawnMaster inside the marquee selection box given by the two passed on points.
-	* Uses a projection to screen space.
-	* @param FirstPoint: Begin point of the drawn marquee selection.
-	* @param SecondPoint: Current/last point of the marquee that is drawn.
-	* @param OutActors: TArray with all ASelectablePawnMaster that are selected.
-	* @param bActorMustBeFullyEnclosed: If the marquee needs to contain all of the actor's bounds.
-	*/ 
-	void GetSelectablePawnsInRectangle( const FVector2D& FirstPoint,
-		const FVector2D& SecondPoint,
-		TArray<ASelectablePawnMaster*>& OutActors,
-		bool bActorMustBeFullyEnclosed);
-	bool IsInViewFrustum(const FVector& ObjectLocation) const;
-	bool ProjectWorldLocationToScreenSafely(const FVector& WorldLocation, FVector2D& OutScreenLocation) const;
+	 * @brief Caches the view projection of the owning player's viewport for this selection pass.
+	 * @return False if the view could not be obtained.
+	 */
+	bool UpdateMarqueeView();
+
+	/** @brief Projects the center of the selection bounds and derives the screen circle around its corners. */
+	FMarqueeScreenBounds ProjectMarqueeScreenBounds(const FBoxSphereBounds& SelectionBounds) const;
+
+	/** @brief Projects the eight corners of the selection bounds and stores their screen rectangle on the bounds. */
+	void ProjectBoundsCorners(FMarqueeScreenBounds& ScreenBounds) const;
+
 	APlayerController* GetValidOwningPlayerController() const;
 	bool GetIsValidPlayerController() const;
 
@@ -128,5 +160,16 @@ private:
 
 	UPROPERTY()
 	TArray<ASelectablePawnMaster*> M_TSelectablePawnsInRectangle;
-	
+
+	// Player units fetched from the game unit manager for the current selection pass.
+	UPROPERTY()
+	TArray<ASquadUnit*> M_CandidateSquadUnits;
+
+	UPROPERTY()
+	TArray<ASelectableActorObjectsMaster*> M_CandidateSelectableActors;
+
+	UPROPERTY()
+	TArray<ASelectablePawnMaster*> M_CandidateSelectablePawns;
+
+	FMarqueeView M_MarqueeView;
 };
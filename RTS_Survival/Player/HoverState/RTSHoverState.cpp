@@ -0,0 +1,145 @@
+﻿#include "RTSHoverState.h"
+
+#include "Camera/PlayerCameraManager.h"
+#include "GameFramework/PlayerController.h"
+#include "Kismet/GameplayStatics.h"
+#include "RTS_Survival/DeveloperSettings.h"
+
+namespace HoverResolverConstants
+{
+	// Same channel as ACPPController::GetCursorWorldPosition uses for the landscape.
+	constexpr ECollisionChannel GroundChannel = ECC_GameTraceChannel2;
+}
+
+const FRTSHoverState& FRTSHoverResolver::Resolve(const APlayerController& PlayerController, const bool bForceRetrace)
+{
+	const UWorld* World = PlayerController.GetWorld();
+	if (not World)
+	{
+		return M_HoverState;
+	}
+	if (M_ResolveFrame == GFrameCounter && (not bForceRetrace || M_TraceFrame == GFrameCounter))
+	{
+		return M_HoverState;
+	}
+	M_ResolveFrame = GFrameCounter;
+
+	FVector2D MouseScreenPosition = M_HoverState.MouseScreenPosition;
+	PlayerController.GetMousePosition(MouseScreenPosition.X, MouseScreenPosition.Y);
+
+	FVector CameraLocation = FVector::ZeroVector;
+	FRotator CameraRotation = FRotator::ZeroRotator;
+	if (PlayerController.PlayerCameraManager)
+	{
+		CameraLocation = PlayerController.PlayerCameraManager->GetCameraLocation();
+		CameraRotation = PlayerController.PlayerCameraManager->GetCameraRotation();
+	}
+
+	const double RealTimeSeconds = World->GetRealTimeSeconds();
+	if (not bForceRetrace && not GetNeedsRetrace(MouseScreenPosition, CameraLocation, CameraRotation, RealTimeSeconds))
+	{
+		return M_HoverState;
+	}
+
+	M_CameraLocation = CameraLocation;
+	M_CameraRotation = CameraRotation;
+	M_TraceRealTimeSeconds = RealTimeSeconds;
+	M_TraceFrame = GFrameCounter;
+	bM_HasTraced = true;
+	Retrace(PlayerController, MouseScreenPosition);
+	return M_HoverState;
+}
+
+void FRTSHoverResolver::Invalidate()
+{
+	bM_HasTraced = false;
+	M_ResolveFrame = 0;
+}
+
+bool FRTSHoverResolver::GetNeedsRetrace(const FVector2D& MouseScreenPosition, const FVector& CameraLocation,
+                                        const FRotator& CameraRotation, const double RealTimeSeconds) const
+{
+	using namespace DeveloperSettings::UIUX;
+	if (not bM_HasTraced || RealTimeSeconds - M_TraceRealTimeSeconds > HoverMaxCacheAge)
+	{
+		return true;
+	}
+	if (FVector2D::DistSquared(MouseScreenPosition, M_HoverState.MouseScreenPosition)
+		> FMath::Square(HoverRetraceMouseThreshold))
+	{
+		return true;
+	}
+	if (FVector::DistSquared(CameraLocation, M_CameraLocation) > FMath::Square(HoverRetraceCameraMoveThreshold)
+		|| not CameraRotation.Equals(M_CameraRotation, HoverRetraceCameraRotationThreshold))
+	{
+		return true;
+	}
+	if (M_HoveredActor.IsStale())
+	{
+		return true;
+	}
+	if (const AActor* HoveredActor = M_HoveredActor.Get())
+	{
+		return FVector::DistSquared(HoveredActor->GetActorLocation(), M_HoveredActorLocation)
+			> FMath::Square(HoverRetraceActorMoveThreshold);
+	}
+	return false;
+}
+
+void FRTSHoverResolver::Retrace(const APlayerController& PlayerController, const FVector2D& MouseScreenPosition)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(RTSHoverResolver_Retrace);
+	M_HoverState.MouseScreenPosition = MouseScreenPosition;
+	M_HoverState.CursorHit = FHitResult();
+	M_HoverState.bHasCursorHit = false;
+	M_HoverState.GroundLocation = FVector::ZeroVector;
+	M_HoverState.bHasGroundLocation = false;
+	M_HoveredActor.Reset();
+
+	const UWorld* World = PlayerController.GetWorld();
+	FVector RayOrigin;
+	FVector RayDirection;
+	if (not World || not UGameplayStatics::DeprojectScreenToWorld(
+		&PlayerController, MouseScreenPosition, RayOrigin, RayDirection))
+	{
+		return;
+	}
+
+	// Same query as APlayerController::GetHitResultAtScreenPosition without complex collision.
+	const FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(ClickableTrace), false);
+	M_HoverState.bHasCursorHit = World->LineTraceSingleByChannel(
+		M_HoverState.CursorHit, RayOrigin, RayOrigin + RayDirection * PlayerController.HitResultTraceDistance,
+		ECC_Visibility, QueryParams);
+	if (AActor* HoveredActor = M_HoverState.GetHoveredActor())
+	{
+		M_HoveredActor = HoveredActor;
+		M_HoveredActorLocation = HoveredActor->GetActorLocation();
+	}
+	TraceGroundLocation(*World, RayOrigin, RayDirection, QueryParams);
+}
+
+void FRTSHoverResolver::TraceGroundLocation(const UWorld& World, const FVector& RayOrigin, const FVector& RayDirection,
+                                            const FCollisionQueryParams& QueryParams)
+{
+	using DeveloperSettings::UIUX::SightDistanceMouse;
+	const FHitResult& CursorHit = M_HoverState.CursorHit;
+	const UPrimitiveComponent* CursorHitComponent = CursorHit.GetComponent();
+	if (M_HoverState.bHasCursorHit && CursorHit.GetActor() && CursorHitComponent
+		&& CursorHit.Distance <= SightDistanceMouse
+		&& CursorHitComponent->GetCollisionResponseToChannel(HoverResolverConstants::GroundChannel) == ECR_Block)
+	{
+		// The cursor is already on the landscape; no second trace needed.
+		M_HoverState.GroundLocation = CursorHit.Location;
+		M_HoverState.bHasGroundLocation = true;
+		return;
+	}
+
+	FHitResult GroundHit;
+	World.LineTraceSingleByChannel(GroundHit, RayOrigin, RayOrigin + RayDirection * SightDistanceMouse,
+	                               HoverResolverConstants::GroundChannel, QueryParams);
+	if (GroundHit.GetActor() != nullptr)
+	{
+		M_HoverState.GroundLocation = GroundHit.Location;
+		M_HoverState.bHasGroundLocation = true;
+	}
+}
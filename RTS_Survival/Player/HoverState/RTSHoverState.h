@@ -0,0 +1,74 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/HitResult.h"
+
+#include "RTSHoverState.generated.h"
+
+class APlayerController;
+
+/** @brief What is under the player's cursor; resolved at most once per frame by FRTSHoverResolver. */
+USTRUCT()
+struct FRTSHoverState
+{
+	GENERATED_BODY()
+
+	FVector2D MouseScreenPosition = FVector2D::ZeroVector;
+
+	// Visibility trace under the cursor, as GetHitResultUnderCursor(ECC_Visibility) returns it.
+	FHitResult CursorHit;
+	bool bHasCursorHit = false;
+
+	// Landscape location under the cursor within DeveloperSettings::UIUX::SightDistanceMouse; used for placement.
+	FVector GroundLocation = FVector::ZeroVector;
+	bool bHasGroundLocation = false;
+
+	AActor* GetHoveredActor() const { return bHasCursorHit ? CursorHit.GetActor() : nullptr; }
+};
+
+/**
+ * @brief Caches the hover state of the cursor so the player controller and its consumers share one cursor query.
+ * The cursor is only traced again when the mouse, the camera or the hovered actor moved past a threshold, or when the
+ * cached state is older than DeveloperSettings::UIUX::HoverMaxCacheAge so units moving under a resting cursor are
+ * still picked up.
+ * One ray is deprojected for both the visibility hit and the landscape location; the landscape trace is skipped when
+ * the visibility hit already is on a component that blocks the landscape channel.
+ */
+USTRUCT()
+struct FRTSHoverResolver
+{
+	GENERATED_BODY()
+
+	/**
+	 * @brief Returns the hover state for this frame, tracing again only if needed.
+	 * @param PlayerController The controller whose cursor and camera are used.
+	 * @param bForceRetrace Trace even if nothing moved, unless already traced this frame; used by clicks.
+	 */
+	const FRTSHoverState& Resolve(const APlayerController& PlayerController, const bool bForceRetrace = false);
+
+	/** @brief The next Resolve traces again, e.g. after the view switched to or from the tech tree. */
+	void Invalidate();
+
+private:
+	bool GetNeedsRetrace(const FVector2D& MouseScreenPosition, const FVector& CameraLocation,
+	                     const FRotator& CameraRotation, const double RealTimeSeconds) const;
+
+	void Retrace(const APlayerController& PlayerController, const FVector2D& MouseScreenPosition);
+
+	void TraceGroundLocation(const UWorld& World, const FVector& RayOrigin, const FVector& RayDirection,
+	                         const FCollisionQueryParams& QueryParams);
+
+	UPROPERTY()
+	FRTSHoverState M_HoverState;
+
+	// Camera and hovered actor at the last trace; moving either past its threshold invalidates the state.
+	FVector M_CameraLocation = FVector::ZeroVector;
+	FRotator M_CameraRotation = FRotator::ZeroRotator;
+	FVector M_HoveredActorLocation = FVector::ZeroVector;
+	TWeakObjectPtr<AActor> M_HoveredActor;
+
+	double M_TraceRealTimeSeconds = 0.0;
+	uint64 M_TraceFrame = 0;
+	uint64 M_ResolveFrame = 0;
+	bool bM_HasTraced = false;
+};
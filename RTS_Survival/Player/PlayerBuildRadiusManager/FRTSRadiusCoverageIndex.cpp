@@ -0,0 +1,376 @@
+#include "FRTSRadiusCoverageIndex.h"
+
+namespace RadiusCoverageConstants
+{
+	// Points this close outside a circle still count as covered, so touching circles leave no hairline gaps.
+	constexpr double CoverageTolerance = 0.01;
+	constexpr double MinCellSize = 1.0;
+}
+
+namespace
+{
+	using FCoverageCircle = FRTSRadiusCoverageIndex::FCoverageCircle;
+
+	FBox2D GetCircleBounds(const FVector2D& Center, const double Radius)
+	{
+		return FBox2D(Center - FVector2D(Radius), Center + FVector2D(Radius));
+	}
+
+	FVector2D GetPointOnCircle(const FCoverageCircle& Circle, const double Angle)
+	{
+		return Circle.Center + Circle.Radius * FVector2D(FMath::Cos(Angle), FMath::Sin(Angle));
+	}
+
+	bool GetIsPointInAnyCircle(const FVector2D& Point, const TArray<FCoverageCircle>& Circles,
+	                           const int32 SkippedIndex = INDEX_NONE)
+	{
+		for (int32 Index = 0; Index < Circles.Num(); ++Index)
+		{
+			const double CoveredRadius = Circles[Index].Radius + RadiusCoverageConstants::CoverageTolerance;
+			if (Index != SkippedIndex
+				&& FVector2D::DistSquared(Point, Circles[Index].Center) <= CoveredRadius * CoveredRadius)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/** @brief Adds the angles on Circle at which the Other circle's boundary crosses it. */
+	void AddCircleIntersectionAngles(const FCoverageCircle& Circle, const FCoverageCircle& Other,
+	                                 TArray<double>& OutAngles)
+	{
+		const FVector2D Delta = Other.Center - Circle.Center;
+		const double Distance = Delta.Size();
+		if (Distance <= UE_DOUBLE_KINDA_SMALL_NUMBER || Distance > Circle.Radius + Other.Radius
+			|| Distance < FMath::Abs(Circle.Radius - Other.Radius))
+		{
+			return;
+		}
+		const double DirectionAngle = FMath::Atan2(Delta.Y, Delta.X);
+		const double CosHalfAngle =
+			(FMath::Square(Circle.Radius) + FMath::Square(Distance) - FMath::Square(Other.Radius))
+			/ (2.0 * Circle.Radius * Distance);
+		const double HalfAngle = FMath::Acos(FMath::Clamp(CosHalfAngle, -1.0, 1.0));
+		OutAngles.Add(DirectionAngle - HalfAngle);
+		OutAngles.Add(DirectionAngle + HalfAngle);
+	}
+
+	/**
+	 * @brief Splits the circle at the angles and returns the midpoint angle of every piece between two of them.
+	 * A circle without angles is a single piece.
+	 */
+	void GetArcPieceMidAngles(TArray<double>& InOutAngles, TArray<double>& OutMidAngles)
+	{
+		OutMidAngles.Reset();
+		if (InOutAngles.IsEmpty())
+		{
+			OutMidAngles.Add(0.0);
+			return;
+		}
+		for (double& Angle : InOutAngles)
+		{
+			Angle = FMath::Fmod(Angle + UE_DOUBLE_TWO_PI, UE_DOUBLE_TWO_PI);
+		}
+		InOutAngles.Sort();
+		for (int32 Index = 0; Index + 1 < InOutAngles.Num(); ++Index)
+		{
+			OutMidAngles.Add(0.5 * (InOutAngles[Index] + InOutAngles[Index + 1]));
+		}
+		OutMidAngles.Add(0.5 * (InOutAngles.Last() + InOutAngles[0] + UE_DOUBLE_TWO_PI));
+	}
+
+	/**
+	 * @brief Checks that every piece of every circle boundary inside the region is covered by the other circles.
+	 * @param AddRegionIntersectionAngles Adds where a circle crosses the region boundary, as coverage of the region can
+	 * change there too.
+	 */
+	template <typename IsInsideRegionFunction, typename AddAnglesFunction>
+	bool GetAreInnerArcsCovered(const TArray<FCoverageCircle>& Circles, IsInsideRegionFunction IsInsideRegion,
+	                            AddAnglesFunction AddRegionIntersectionAngles)
+	{
+		TArray<double> Angles;
+		TArray<double> MidAngles;
+		for (int32 CircleIndex = 0; CircleIndex < Circles.Num(); ++CircleIndex)
+		{
+			const FCoverageCircle& Circle = Circles[CircleIndex];
+			Angles.Reset();
+			for (int32 OtherIndex = 0; OtherIndex < Circles.Num(); ++OtherIndex)
+			{
+				if (OtherIndex != CircleIndex)
+				{
+					AddCircleIntersectionAngles(Circle, Circles[OtherIndex], Angles);
+				}
+			}
+			AddRegionIntersectionAngles(Circle, Angles);
+
+			GetArcPieceMidAngles(Angles, MidAngles);
+			for (const double MidAngle : MidAngles)
+			{
+				const FVector2D Point = GetPointOnCircle(Circle, MidAngle);
+				if (IsInsideRegion(Point) && not GetIsPointInAnyCircle(Point, Circles, CircleIndex))
+				{
+					// Just outside this arc lies an uncovered hole.
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+
+}
+
+FRTSRadiusCoverageIndex::FRTSRadiusCoverageIndex(const double InCellSize)
+	: M_CellSize(FMath::Max(InCellSize, RadiusCoverageConstants::MinCellSize))
+{
+}
+
+void FRTSRadiusCoverageIndex::SetCircle(const int32 CircleId, const FVector2D& Center, const double Radius)
+{
+	FCoverageCircle NewCircle;
+	NewCircle.Center = Center;
+	NewCircle.Radius = FMath::Max(Radius, 0.0);
+
+	if (FCoverageCircle* ExistingCircle = M_CirclesById.Find(CircleId))
+	{
+		if (ExistingCircle->Center == NewCircle.Center && ExistingCircle->Radius == NewCircle.Radius)
+		{
+			return;
+		}
+		RemoveFromCells(CircleId, *ExistingCircle);
+		*ExistingCircle = NewCircle;
+	}
+	else
+	{
+		M_CirclesById.Add(CircleId, NewCircle);
+	}
+	AddToCells(CircleId, NewCircle);
+}
+
+void FRTSRadiusCoverageIndex::RemoveCircle(const int32 CircleId)
+{
+	FCoverageCircle RemovedCircle;
+	if (M_CirclesById.RemoveAndCopyValue(CircleId, RemovedCircle))
+	{
+		RemoveFromCells(CircleId, RemovedCircle);
+	}
+}
+
+void FRTSRadiusCoverageIndex::Reset()
+{
+	M_CirclesById.Reset();
+	M_CircleIdsByCell.Reset();
+}
+
+bool FRTSRadiusCoverageIndex::IsPointCovered(const FVector2D& Point) const
+{
+	TArray<FCoverageCircle> Circles;
+	GatherCirclesNear(FBox2D(Point, Point), TSet<int32>(), Circles);
+	return GetIsPointInAnyCircle(Point, Circles);
+}
+
+bool FRTSRadiusCoverageIndex::FindClosestCircle(const FVector2D& Point, FCoverageCircle& OutCircle) const
+{
+	if (M_CirclesById.IsEmpty())
+	{
+		return false;
+	}
+
+	// Every circle that holds the point is bucketed in the cell of the point.
+	TArray<FCoverageCircle> Circles;
+	GatherCirclesNear(FBox2D(Point, Point), TSet<int32>(), Circles);
+	bool bIsHeld = false;
+	for (const FCoverageCircle& Circle : Circles)
+	{
+		if (FVector2D::DistSquared(Point, Circle.Center) <= FMath::Square(Circle.Radius)
+			&& (not bIsHeld || Circle.Radius > OutCircle.Radius))
+		{
+			OutCircle = Circle;
+			bIsHeld = true;
+		}
+	}
+	if (bIsHeld)
+	{
+		return true;
+	}
+
+	double ClosestEdgeDistance = TNumericLimits<double>::Max();
+	const auto ConsiderCircle = [&Point, &OutCircle, &ClosestEdgeDistance](const FCoverageCircle& Circle)
+	{
+		const double EdgeDistance = FVector2D::Distance(Point, Circle.Center) - Circle.Radius;
+		if (EdgeDistance < ClosestEdgeDistance)
+		{
+			ClosestEdgeDistance = EdgeDistance;
+			OutCircle = Circle;
+		}
+	};
+
+	const FIntPoint PointCell(FMath::FloorToInt32(Point.X / M_CellSize), FMath::FloorToInt32(Point.Y / M_CellSize));
+	int32 NumVisitedCells = 0;
+	for (int32 Ring = 0;; ++Ring)
+	{
+		if (NumVisitedCells > M_CirclesById.Num())
+		{
+			// Far from every circle the rings hold more empty cells than there are circles.
+			for (const TPair<int32, FCoverageCircle>& CircleById : M_CirclesById)
+			{
+				ConsiderCircle(CircleById.Value);
+			}
+			return true;
+		}
+		for (int32 OffsetY = -Ring; OffsetY <= Ring; ++OffsetY)
+		{
+			// Inner rows of the ring only hold its left and right cell.
+			const int32 StepX = FMath::Abs(OffsetY) == Ring ? 1 : 2 * Ring;
+			for (int32 OffsetX = -Ring; OffsetX <= Ring; OffsetX += StepX)
+			{
+				++NumVisitedCells;
+				const TArray<int32>* CellCircleIds = M_CircleIdsByCell.Find(PointCell + FIntPoint(OffsetX, OffsetY));
+				if (not CellCircleIds)
+				{
+					continue;
+				}
+				for (const int32 CircleId : *CellCircleIds)
+				{
+					ConsiderCircle(M_CirclesById.FindChecked(CircleId));
+				}
+			}
+		}
+		// Circles not seen yet only touch cells beyond this ring, which are at least Ring cells away; their bounds
+		// hold them, so their edges are at least as far.
+		if (ClosestEdgeDistance <= Ring * M_CellSize)
+		{
+			return true;
+		}
+	}
+}
+
+bool FRTSRadiusCoverageIndex::IsCircleCovered(const FVector2D& Center, const double Radius,
+                                              const TSet<int32>& IgnoredCircleIds) const
+{
+	if (Radius <= 0.0)
+	{
+		return IsPointCovered(Center);
+	}
+
+	TArray<FCoverageCircle> Circles;
+	GatherCirclesNear(GetCircleBounds(Center, Radius), IgnoredCircleIds, Circles);
+	Circles.RemoveAll([&Center, Radius](const FCoverageCircle& Circle)
+	{
+		return FVector2D::Distance(Center, Circle.Center) >= Radius + Circle.Radius;
+	});
+
+	FCoverageCircle Region;
+	Region.Center = Center;
+	Region.Radius = Radius;
+	TArray<double> Angles;
+	for (const FCoverageCircle& Circle : Circles)
+	{
+		if (FVector2D::Distance(Center, Circle.Center) + Radius
+			<= Circle.Radius + RadiusCoverageConstants::CoverageTolerance)
+		{
+			// Common case of a single circle holding the whole region.
+			return true;
+		}
+		AddCircleIntersectionAngles(Region, Circle, Angles);
+	}
+
+	TArray<double> MidAngles;
+	GetArcPieceMidAngles(Angles, MidAngles);
+	for (const double MidAngle : MidAngles)
+	{
+		if (not GetIsPointInAnyCircle(GetPointOnCircle(Region, MidAngle), Circles))
+		{
+			return false;
+		}
+	}
+
+	const double InnerRadius = Radius - RadiusCoverageConstants::CoverageTolerance;
+	return GetAreInnerArcsCovered(
+		Circles,
+		[&Center, InnerRadius](const FVector2D& Point)
+		{
+			return FVector2D::DistSquared(Point, Center) < InnerRadius * InnerRadius;
+		},
+		[&Region](const FCoverageCircle& Circle, TArray<double>& OutAngles)
+		{
+			AddCircleIntersectionAngles(Circle, Region, OutAngles);
+		});
+}
+
+void FRTSRadiusCoverageIndex::GetCellRange(const FBox2D& Bounds, FIntPoint& OutMinCell, FIntPoint& OutMaxCell) const
+{
+	OutMinCell = FIntPoint(FMath::FloorToInt32(Bounds.Min.X / M_CellSize),
+	                       FMath::FloorToInt32(Bounds.Min.Y / M_CellSize));
+	OutMaxCell = FIntPoint(FMath::FloorToInt32(Bounds.Max.X / M_CellSize),
+	                       FMath::FloorToInt32(Bounds.Max.Y / M_CellSize));
+}
+
+void FRTSRadiusCoverageIndex::AddToCells(const int32 CircleId, const FCoverageCircle& Circle)
+{
+	FIntPoint MinCell;
+	FIntPoint MaxCell;
+	GetCellRange(GetCircleBounds(Circle.Center, Circle.Radius), MinCell, MaxCell);
+	for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; ++CellY)
+	{
+		for (int32 CellX = MinCell.X; CellX <= MaxCell.X; ++CellX)
+		{
+			M_CircleIdsByCell.FindOrAdd(FIntPoint(CellX, CellY)).Add(CircleId);
+		}
+	}
+}
+
+void FRTSRadiusCoverageIndex::RemoveFromCells(const int32 CircleId, const FCoverageCircle& Circle)
+{
+	FIntPoint MinCell;
+	FIntPoint MaxCell;
+	GetCellRange(GetCircleBounds(Circle.Center, Circle.Radius), MinCell, MaxCell);
+	for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; ++CellY)
+	{
+		for (int32 CellX = MinCell.X; CellX <= MaxCell.X; ++CellX)
+		{
+			const FIntPoint Cell(CellX, CellY);
+			TArray<int32>* CellCircleIds = M_CircleIdsByCell.Find(Cell);
+			if (not CellCircleIds)
+			{
+				continue;
+			}
+			CellCircleIds->RemoveSingleSwap(CircleId);
+			if (CellCircleIds->IsEmpty())
+			{
+				M_CircleIdsByCell.Remove(Cell);
+			}
+		}
+	}
+}
+
+void FRTSRadiusCoverageIndex::GatherCirclesNear(const FBox2D& Bounds, const TSet<int32>& IgnoredCircleIds,
+                                                TArray<FCoverageCircle>& OutCircles) const
+{
+	OutCircles.Reset();
+	FIntPoint MinCell;
+	FIntPoint MaxCell;
+	GetCellRange(Bounds, MinCell, MaxCell);
+
+	TSet<int32, DefaultKeyFuncs<int32>, TInlineSetAllocator<32>> GatheredIds;
+	for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; ++CellY)
+	{
+		for (int32 CellX = MinCell.X; CellX <= MaxCell.X; ++CellX)
+		{
+			const TArray<int32>* CellCircleIds = M_CircleIdsByCell.Find(FIntPoint(CellX, CellY));
+			if (not CellCircleIds)
+			{
+				continue;
+			}
+			for (const int32 CircleId : *CellCircleIds)
+			{
+				bool bIsAlreadyGathered = false;
+				GatheredIds.Add(CircleId, &bIsAlreadyGathered);
+				if (not bIsAlreadyGathered && not IgnoredCircleIds.Contains(CircleId))
+				{
+					OutCircles.Add(M_CirclesById.FindChecked(CircleId));
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * @brief Answers whether a circle on the XY plane is fully covered by the union of a set of circles, and which circle
+ * a point is measured against.
+ * Circles are bucketed in a uniform grid by their bounds, so a query only visits the circles near it.
+ * The test is exact: a region is covered iff its boundary is covered and so is every circle arc inside it, since an
+ * uncovered hole is always bounded by such arcs. Coverage only changes where arcs intersect, so each arc is split at
+ * its intersection points and one point per piece decides it.
+ */
+class RTS_SURVIVAL_API FRTSRadiusCoverageIndex
+{
+public:
+	static constexpr double DefaultCellSize = 2000.0;
+
+	struct FCoverageCircle
+	{
+		FVector2D Center = FVector2D::ZeroVector;
+		double Radius = 0.0;
+	};
+
+	explicit FRTSRadiusCoverageIndex(const double InCellSize = DefaultCellSize);
+
+	/** @brief Adds the circle, or moves and resizes it if the id is already present. */
+	void SetCircle(const int32 CircleId, const FVector2D& Center, const double Radius);
+
+	/** @brief Removing an id that is not present is a no-op. */
+	void RemoveCircle(const int32 CircleId);
+
+	void Reset();
+
+	bool ContainsCircle(const int32 CircleId) const { return M_CirclesById.Contains(CircleId); }
+	int32 GetNumCircles() const { return M_CirclesById.Num(); }
+
+	bool IsPointCovered(const FVector2D& Point) const;
+
+	/**
+	 * @brief Finds the largest circle that holds the point or, if none does, the circle whose edge is nearest to it.
+	 * Cells are visited in growing rings around the point, so only circles near it are tested.
+	 * @return False if the index holds no circles.
+	 */
+	bool FindClosestCircle(const FVector2D& Point, FCoverageCircle& OutCircle) const;
+
+	/** @param IgnoredCircleIds Circles that do not count towards the coverage, e.g. the queried circle itself. */
+	bool IsCircleCovered(const FVector2D& Center, const double Radius,
+	                     const TSet<int32>& IgnoredCircleIds = TSet<int32>()) const;
+
+private:
+	double M_CellSize;
+	TMap<int32, FCoverageCircle> M_CirclesById;
+	TMap<FIntPoint, TArray<int32>> M_CircleIdsByCell;
+
+	void GetCellRange(const FBox2D& Bounds, FIntPoint& OutMinCell, FIntPoint& OutMaxCell) const;
+	void AddToCells(const int32 CircleId, const FCoverageCircle& Circle);
+	void RemoveFromCells(const int32 CircleId, const FCoverageCircle& Circle);
+
+	/** @brief Collects each circle in the cells touched by the bounds once, skipping the ignored ids. */
+	void GatherCirclesNear(const FBox2D& Bounds, const TSet<int32>& IgnoredCircleIds,
+	                       TArray<FCoverageCircle>& OutCircles) const;
+};
@@ -6,6 +6,14 @@
 #include "RTS_Survival/Units/Tanks/WheeledTank/BaseTruck/BuildRadiusComp/BuildRadiusComp.h"
 #include "RTS_Survival/Utils/HFunctionLibary.h"
 
+namespace
+{
+	int32 GetCoverageId(const UBuildRadiusComp* RadiusComp)
+	{
+		return static_cast<int32>(RadiusComp->GetUniqueID());
+	}
+}
+
 UPlayerBuildRadiusManager::UPlayerBuildRadiusManager()
 {
 	PrimaryComponentTick.bCanEverTick = false;
@@ -24,6 +32,8 @@ void UPlayerBuildRadiusManager::EnsureRadiiAreValid()
 		if (IsValid(RadiusComp) && IsValid(RadiusComp->GetOwner()))
 		{
 			ValidRadii.Add(RadiusComp);
+			// Picks up radii whose owner moved since they were indexed; a no-op for the others.
+			UpdateCoverageEntry(RadiusComp);
 			continue;
 		}
 		FString OwnerName = RadiusComp ? RadiusComp->GetOwner()->GetName() : TEXT("INVALID");
@@ -33,7 +43,37 @@ void UPlayerBuildRadiusManager::EnsureRadiiAreValid()
 			"\n see UPlayerBuildRadiusManager::UnregisterBuildRadiusComponent"
 			"\n Owner: " + OwnerName);
 	}
-	M_BuildRadii = ValidRadii;
+	if (ValidRadii.Num() != M_BuildRadii.Num())
+	{
+		// The ids of destroyed components are gone, so their circles cannot be removed one by one.
+		M_BuildRadii = ValidRadii;
+		RebuildCoverageIndex();
+	}
+}
+
+void UPlayerBuildRadiusManager::UpdateCoverageEntry(const UBuildRadiusComp* RadiusComp)
+{
+	if (not IsValid(RadiusComp))
+	{
+		return;
+	}
+	const AActor* Owner = RadiusComp->GetOwner();
+	if (not IsValid(Owner) || not RadiusComp->GetIsEnabled() || RadiusComp->GetRadius() <= 0.f)
+	{
+		M_CoverageIndex.RemoveCircle(GetCoverageId(RadiusComp));
+		return;
+	}
+	const FVector Center = Owner->GetActorLocation();
+	M_CoverageIndex.SetCircle(GetCoverageId(RadiusComp), FVector2D(Center.X, Center.Y), RadiusComp->GetRadius());
+}
+
+void UPlayerBuildRadiusManager::RebuildCoverageIndex()
+{
+	M_CoverageIndex.Reset();
+	for (const UBuildRadiusComp* RadiusComp : M_BuildRadii)
+	{
+		UpdateCoverageEntry(RadiusComp);
+	}
 }
 
 
@@ -89,6 +129,7 @@ void UPlayerBuildRadiusManager::RegisterBuildRadiusComponent(UBuildRadiusComp* R
 		if (!M_BuildRadii.Contains(RadiusComp))
 		{
 			M_BuildRadii.Add(RadiusComp);
+			UpdateCoverageEntry(RadiusComp);
 		}
 	}
 }
@@ -100,6 +141,7 @@ void UPlayerBuildRadiusManager::UnregisterBuildRadiusComponent(UBuildRadiusComp*
 		if (M_BuildRadii.Contains(RadiusComp))
 		{
 			M_BuildRadii.Remove(RadiusComp);
+			M_CoverageIndex.RemoveCircle(GetCoverageId(RadiusComp));
 			return;
 		}
 		RTSFunctionLibrary::ReportError(
@@ -108,13 +150,38 @@ void UPlayerBuildRadiusManager::UnregisterBuildRadiusComponent(UBuildRadiusComp*
 	}
 }
 
+void UPlayerBuildRadiusManager::OnBuildRadiusEnabledChanged(UBuildRadiusComp* RadiusComp)
+{
+	if (not M_BuildRadii.Contains(RadiusComp))
+	{
+		// Not registered yet; registration indexes it with its current state.
+		return;
+	}
+	UpdateCoverageEntry(RadiusComp);
+}
+
+bool UPlayerBuildRadiusManager::FindBuildRadiusForLocation(const FVector& Location, float& OutDistanceToCenter,
+                                                           float& OutRadius) const
+{
+	const FVector2D Location2D(Location.X, Location.Y);
+	FRTSRadiusCoverageIndex::FCoverageCircle Circle;
+	if (not M_CoverageIndex.FindClosestCircle(Location2D, Circle))
+	{
+		return false;
+	}
+	OutDistanceToCenter = FVector2D::Distance(Location2D, Circle.Center);
+	OutRadius = Circle.Radius;
+	return true;
+}
+
 TArray<UBuildRadiusComp*> UPlayerBuildRadiusManager::GetRadiiToShow()
 {
 	TArray<UBuildRadiusComp*> RadiiToShow;
+	TSet<int32> HiddenCoverageIds;
 
 	for (UBuildRadiusComp* RadiusCompI : M_BuildRadii)
 	{
-		bool bIsCompletelyCovered = IsRadiusCompletelyCovered(RadiusCompI);
+		bool bIsCompletelyCovered = IsRadiusCompletelyCovered(RadiusCompI, HiddenCoverageIds);
 
 		if (!bIsCompletelyCovered)
 		{
@@ -123,35 +190,23 @@ TArray<UBuildRadiusComp*> UPlayerBuildRadiusManager::GetRadiiToShow()
 		else
 		{
 			RadiusCompI->HideRadius();
+			HiddenCoverageIds.Add(GetCoverageId(RadiusCompI));
 		}
 	}
 
 	return RadiiToShow;
 }
 
-bool UPlayerBuildRadiusManager::IsRadiusCompletelyCovered(UBuildRadiusComp* ValidRadiusCompI)
+bool UPlayerBuildRadiusManager::IsRadiusCompletelyCovered(UBuildRadiusComp* ValidRadiusCompI,
+                                                          const TSet<int32>& HiddenCoverageIds) const
 {
-	FVector CenterI = ValidRadiusCompI->GetOwner()->GetActorLocation();
-	float RadiusI = ValidRadiusCompI->GetRadius();
-
-	for (UBuildRadiusComp* RadiusCompJ : M_BuildRadii)
-	{
-		if (ValidRadiusCompI == RadiusCompJ)
-			continue;
-
-		FVector CenterJ = RadiusCompJ->GetOwner()->GetActorLocation();
-		float RadiusJ = RadiusCompJ->GetRadius();
-
-		float DistanceCenters = FVector::Dist(CenterI, CenterJ);
-
-		if (DistanceCenters + RadiusI <= RadiusJ)
-		{
-			// RadiusI is completely covered by RadiusJ
-			return true;
-		}
-	}
+	const FVector CenterI = ValidRadiusCompI->GetOwner()->GetActorLocation();
+	const float RadiusI = ValidRadiusCompI->GetRadius();
 
-	return false;
+	// A radius never covers itself.
+	TSet<int32> IgnoredCoverageIds = HiddenCoverageIds;
+	IgnoredCoverageIds.Add(GetCoverageId(ValidRadiusCompI));
+	return M_CoverageIndex.IsCircleCovered(FVector2D(CenterI.X, CenterI.Y), RadiusI, IgnoredCoverageIds);
 }
 
 void UPlayerBuildRadiusManager::SetupRadiusComponentMaterial(
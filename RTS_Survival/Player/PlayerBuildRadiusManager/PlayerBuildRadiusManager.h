@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "FRTSRadiusCoverageIndex.h"
 #include "PlayerBuildRadiusManager.generated.h"
 
 
@@ -85,6 +86,27 @@ public:
      */
     void UnregisterBuildRadiusComponent(UBuildRadiusComp* RadiusComp);
 
+    /**
+     * @brief Updates the coverage index after a registered radius was enabled or disabled, e.g. when its nomadic
+     * vehicle unpacks or packs up.
+     *
+     * @param RadiusComp The registered build radius component whose enabled state changed.
+     */
+    void OnBuildRadiusEnabledChanged(UBuildRadiusComp* RadiusComp);
+
+    /**
+     * @brief Finds the enabled build radius a placement at the location is measured against, using the coverage index
+     * instead of testing every radius.
+     *
+     * @param Location The placement location; only its XY position is used.
+     * @param OutDistanceToCenter Distance on the XY plane from the location to the center of that radius.
+     * @param OutRadius The size of that radius.
+     * @return `false` if no build radius is enabled.
+     * @note Inside any radius this is the largest radius holding the location, outside all of them the radius whose
+     * edge is nearest.
+     */
+    bool FindBuildRadiusForLocation(const FVector& Location, float& OutDistanceToCenter, float& OutRadius) const;
+
 protected:
     /**
      * @brief Called when the game starts; performs any necessary initialization.
@@ -96,6 +118,18 @@ private:
     UPROPERTY()
     TArray<UBuildRadiusComp*> M_BuildRadii;
 
+    /** Circles of the enabled build radii on the XY plane, keyed by the unique id of their component. */
+    FRTSRadiusCoverageIndex M_CoverageIndex;
+
+    /**
+     * @brief Adds, moves or removes the circle of the radius component in the coverage index depending on whether it
+     * is enabled and where its owner stands; unchanged circles are left as they are.
+     */
+    void UpdateCoverageEntry(const UBuildRadiusComp* RadiusComp);
+
+    /** @brief Rebuilds the coverage index from the registered components. */
+    void RebuildCoverageIndex();
+
     /**
      * @brief Validates and cleans up the list of build radius components.
      *
@@ -110,19 +144,24 @@ private:
      *
      * @return An array of pointers to `URadiusComp` representing the radii that are not completely covered by others.
      * @note This function helps optimize visual performance by hiding radii that are entirely overlapped by others.
+     * Radii are visited in order; every radius that was not hidden yet counts as covering, including radii later in
+     * the list that have not been visited. A hidden radius no longer covers others, so two radii can never hide each
+     * other.
      */
     TArray<UBuildRadiusComp*> GetRadiiToShow();
 
     /**
      * @brief Checks if a given radius component is completely covered by other radii.
      *
-     * Compares the specified `ValidRadiusCompI` against other registered radii to determine if it is entirely within any of them.
+     * Tests the circle of `ValidRadiusCompI` against the union of the other enabled radii in the coverage index, so a
+     * radius spanned by several overlapping radii counts as covered as well.
      *
      * @param ValidRadiusCompI The radius component to check; used as the reference for coverage comparison.
-     * @return `true` if the radius is completely covered by any other radius; `false` otherwise.
+     * @param HiddenCoverageIds Coverage ids of radii that are hidden and therefore do not cover others.
+     * @return `true` if the radius is completely covered by the union of the other radii; `false` otherwise.
      * @pre `ValidRadiusCompI` must be a valid pointer with a valid owner.
      */
-    bool IsRadiusCompletelyCovered(UBuildRadiusComp* ValidRadiusCompI);
+    bool IsRadiusCompletelyCovered(UBuildRadiusComp* ValidRadiusCompI, const TSet<int32>& HiddenCoverageIds) const;
 
     /**
      * @brief Sets up the dynamic material parameters for a radius component to visualize overlapping areas.
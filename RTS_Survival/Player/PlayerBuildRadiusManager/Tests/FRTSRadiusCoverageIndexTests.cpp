@@ -0,0 +1,216 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+#include "RTS_Survival/Player/PlayerBuildRadiusManager/FRTSRadiusCoverageIndex.h"
+
+namespace FRTSRadiusCoverageIndexTestConstants
+{
+	constexpr int32 RandomSeed = 4242;
+	constexpr int32 CircleCount = 40;
+	constexpr double AreaSize = 10000.0;
+	constexpr double MinCircleRadius = 600.0;
+	constexpr double MaxCircleRadius = 2500.0;
+	constexpr int32 QueryCount = 200;
+	// Sample points per axis of the brute-force sampler.
+	constexpr int32 SamplerResolution = 48;
+	// The sampler can step over gaps smaller than its spacing; the index may report those, but only rarely.
+	constexpr int32 MaxMissedGapsBySampler = QueryCount / 50;
+}
+
+namespace
+{
+	struct FTestCircle
+	{
+		FVector2D Center;
+		double Radius;
+	};
+
+	bool GetIsSampleCovered(const FVector2D& Point, const TArray<FTestCircle>& Circles)
+	{
+		for (const FTestCircle& Circle : Circles)
+		{
+			if (FVector2D::DistSquared(Point, Circle.Center) <= FMath::Square(Circle.Radius))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	bool GetIsCircleCoveredBySampling(const FVector2D& Center, const double Radius, const TArray<FTestCircle>& Circles)
+	{
+		using namespace FRTSRadiusCoverageIndexTestConstants;
+		for (int32 Step = 0; Step < 4 * SamplerResolution; ++Step)
+		{
+			const double Angle = UE_DOUBLE_TWO_PI * Step / (4 * SamplerResolution);
+			if (not GetIsSampleCovered(Center + Radius * FVector2D(FMath::Cos(Angle), FMath::Sin(Angle)), Circles))
+			{
+				return false;
+			}
+		}
+		for (int32 StepY = 0; StepY <= SamplerResolution; ++StepY)
+		{
+			for (int32 StepX = 0; StepX <= SamplerResolution; ++StepX)
+			{
+				const FVector2D Point = Center - FVector2D(Radius)
+					+ 2.0 * Radius * FVector2D(StepX, StepY) / SamplerResolution;
+				if (FVector2D::DistSquared(Point, Center) <= FMath::Square(Radius)
+					&& not GetIsSampleCovered(Point, Circles))
+				{
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+
+	/**
+	 * @return Radius of the largest circle holding the point as a positive value, or the distance to the nearest
+	 * circle edge as a negative value; identical circles give identical keys, so ties do not matter.
+	 */
+	double GetClosestCircleKey(const FVector2D& Point, const FTestCircle& Circle)
+	{
+		const double EdgeDistance = FVector2D::Distance(Point, Circle.Center) - Circle.Radius;
+		return EdgeDistance <= 0.0 ? Circle.Radius : -EdgeDistance;
+	}
+
+	double GetClosestCircleKeyByScan(const FVector2D& Point, const TArray<FTestCircle>& Circles)
+	{
+		double BestKey = -TNumericLimits<double>::Max();
+		for (const FTestCircle& Circle : Circles)
+		{
+			BestKey = FMath::Max(BestKey, GetClosestCircleKey(Point, Circle));
+		}
+		return BestKey;
+	}
+
+	struct FCoverageComparison
+	{
+		int32 NumCovered = 0;
+		int32 NumUncovered = 0;
+		// The index called the region covered while the sampler found an uncovered point: always a bug.
+		int32 NumFalseCovered = 0;
+		// The index found a gap the sampler stepped over.
+		int32 NumMissedBySampler = 0;
+
+		void Add(const bool bIndexCovered, const bool bSamplerCovered)
+		{
+			bIndexCovered ? ++NumCovered : ++NumUncovered;
+			if (bIndexCovered && not bSamplerCovered)
+			{
+				++NumFalseCovered;
+			}
+			else if (not bIndexCovered && bSamplerCovered)
+			{
+				++NumMissedBySampler;
+			}
+		}
+	};
+
+	FCoverageComparison CompareWithSampler(const FRTSRadiusCoverageIndex& Index, const TArray<FTestCircle>& Circles,
+	                                       FRandomStream& Stream)
+	{
+		using namespace FRTSRadiusCoverageIndexTestConstants;
+		FCoverageComparison Comparison;
+		for (int32 QueryIndex = 0; QueryIndex < QueryCount; ++QueryIndex)
+		{
+			const FVector2D Center(Stream.FRandRange(0.0, AreaSize), Stream.FRandRange(0.0, AreaSize));
+			const double Radius = Stream.FRandRange(100.0, 1500.0);
+			Comparison.Add(Index.IsCircleCovered(Center, Radius),
+			               GetIsCircleCoveredBySampling(Center, Radius, Circles));
+		}
+		return Comparison;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FRTSRadiusCoverageIndexTest,
+	"RTS.Player.BuildRadius.CoverageIndex.MatchesSampler",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRTSRadiusCoverageIndexTest::RunTest(const FString& Parameters)
+{
+	using namespace FRTSRadiusCoverageIndexTestConstants;
+
+	FRandomStream Stream(RandomSeed);
+	FRTSRadiusCoverageIndex Index;
+	TMap<int32, FTestCircle> CirclesById;
+	for (int32 CircleId = 0; CircleId < CircleCount; ++CircleId)
+	{
+		const FTestCircle Circle{
+			FVector2D(Stream.FRandRange(0.0, AreaSize), Stream.FRandRange(0.0, AreaSize)),
+			Stream.FRandRange(MinCircleRadius, MaxCircleRadius)
+		};
+		CirclesById.Add(CircleId, Circle);
+		Index.SetCircle(CircleId, Circle.Center, Circle.Radius);
+	}
+
+	const auto CheckAgainstSampler = [&](const TCHAR* Phase)
+	{
+		TArray<FTestCircle> Circles;
+		CirclesById.GenerateValueArray(Circles);
+		int32 NumClosestCircleMismatches = 0;
+		for (int32 QueryIndex = 0; QueryIndex < QueryCount; ++QueryIndex)
+		{
+			// Points well outside the area also exercise the far fallback of the ring search.
+			const FVector2D Point(Stream.FRandRange(-AreaSize, 2.0 * AreaSize),
+			                      Stream.FRandRange(-AreaSize, 2.0 * AreaSize));
+			FRTSRadiusCoverageIndex::FCoverageCircle Closest;
+			const bool bFound = Index.FindClosestCircle(Point, Closest);
+			if (not bFound || not FMath::IsNearlyEqual(
+				GetClosestCircleKey(Point, FTestCircle{Closest.Center, Closest.Radius}),
+				GetClosestCircleKeyByScan(Point, Circles), 0.001))
+			{
+				++NumClosestCircleMismatches;
+			}
+		}
+		TestEqual(FString::Printf(TEXT("%s: the closest circle matches a scan of all circles"), Phase),
+		          NumClosestCircleMismatches, 0);
+
+		const FCoverageComparison Comparison = CompareWithSampler(Index, Circles, Stream);
+		TestEqual(FString::Printf(TEXT("%s: no region is covered while the sampler finds a gap"), Phase),
+		          Comparison.NumFalseCovered, 0);
+		TestTrue(FString::Printf(TEXT("%s: the sampler rarely steps over a gap the index finds"), Phase),
+		         Comparison.NumMissedBySampler <= MaxMissedGapsBySampler);
+		TestTrue(FString::Printf(TEXT("%s: queries include covered and uncovered regions"), Phase),
+		         Comparison.NumCovered > 0 && Comparison.NumUncovered > 0);
+		AddInfo(FString::Printf(TEXT("%s: %d covered, %d uncovered, %d gaps missed by the sampler"), Phase,
+		                        Comparison.NumCovered, Comparison.NumUncovered, Comparison.NumMissedBySampler));
+	};
+
+	CheckAgainstSampler(TEXT("Initial"));
+
+	// Incremental updates, as when radii are packed up, unpacked elsewhere or destroyed.
+	for (int32 CircleId = 0; CircleId < CircleCount; CircleId += 3)
+	{
+		Index.RemoveCircle(CircleId);
+		CirclesById.Remove(CircleId);
+	}
+	for (int32 CircleId = 1; CircleId < CircleCount; CircleId += 3)
+	{
+		FTestCircle& Circle = CirclesById.FindChecked(CircleId);
+		Circle.Center = FVector2D(Stream.FRandRange(0.0, AreaSize), Stream.FRandRange(0.0, AreaSize));
+		Index.SetCircle(CircleId, Circle.Center, Circle.Radius);
+	}
+	TestEqual(TEXT("Removed circles are no longer counted"), Index.GetNumCircles(), CirclesById.Num());
+	CheckAgainstSampler(TEXT("After updates"));
+
+	// A circle spanned by two overlapping circles is covered by their union but by neither alone.
+	FRTSRadiusCoverageIndex UnionIndex;
+	UnionIndex.SetCircle(0, FVector2D(-300.0, 0.0), 1000.0);
+	UnionIndex.SetCircle(1, FVector2D(300.0, 0.0), 1000.0);
+	TestTrue(TEXT("Union of two circles covers a circle neither holds"),
+	         UnionIndex.IsCircleCovered(FVector2D::ZeroVector, 900.0));
+	TestFalse(TEXT("Ignoring one of them uncovers it"),
+	          UnionIndex.IsCircleCovered(FVector2D::ZeroVector, 900.0, TSet<int32>{1}));
+
+	Index.Reset();
+	TestFalse(TEXT("Nothing is covered by an empty index"), Index.IsPointCovered(FVector2D::ZeroVector));
+	FRTSRadiusCoverageIndex::FCoverageCircle Closest;
+	TestFalse(TEXT("An empty index has no closest circle"), Index.FindClosestCircle(FVector2D::ZeroVector, Closest));
+
+	return not HasAnyErrors();
+}
+
+#endif
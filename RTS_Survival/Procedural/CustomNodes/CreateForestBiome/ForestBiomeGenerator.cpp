@@ -1,26 +1,102 @@
 // Copyright (C) CoreMinimal Software, Bas Blokzijl - All rights reserved.
 #include "ForestBiomeGenerator.h"
 
+#include "Async/ParallelFor.h"
+
 namespace ForestBiomeGenConstants
 {
 	// One density tile is DensityAreaUnit x DensityAreaUnit units (1000 x 1000 = 10 m x 10 m).
 	constexpr double DensityAreaUnit = 1000.0;
 
-	// Rejection sampling budget: attempts allowed per requested placement before giving up. Keeps
-	// generation bounded when the area is nearly full and no free spot remains.
-	constexpr int32 AttemptsPerPlacement = 6;
-
 	// Spatial-hash cell size; roughly the typical query reach for good locality.
 	constexpr double OccupancyCellSize = 600.0;
 
 	// Number of Monte Carlo samples used to estimate the spawnable fraction of the bounds.
 	constexpr int32 InsideFractionSampleCount = 1024;
 
-	// Lower bound on the spawnable fraction when sizing the attempt budget, so a mostly-excluded
-	// biome cannot inflate the attempt count without limit.
-	constexpr double MinInsideFractionForBudget = 0.05;
-
 	constexpr double TwoPi = 2.0 * PI;
+
+	// A maximal Poisson-disk set with sample distance D covers roughly 0.7 * Area / D^2 samples. Sizing
+	// D for 0.4 * Area / Target overshoots the target by ~75%, which leaves room for the space earlier
+	// categories reserved; trimming removes the surplus again.
+	constexpr double PoissonAreaPerSampleFactor = 0.4;
+
+	// Bridson's k: candidates tried around an active sample before it is retired.
+	constexpr int32 PoissonCandidatesPerActiveSample = 30;
+
+	// Lower bound of the distance between two samples of a pass. Props with zero scale and zero spacing would
+	// otherwise accept candidates on top of their parent and the sampler would never run out of room.
+	constexpr double MinPoissonSeparation = 10.0;
+
+	// Tiles are at least this wide, and at least twice the interaction reach of a pass so tiles of the
+	// same phase (one tile apart) can never constrain each other.
+	constexpr double MinPoissonTileSize = 4000.0;
+
+	// Each tile is seeded from a SeedCellsPerTileAxis^2 lattice so pockets cut off by exclusions or the
+	// area shape still get a starting sample.
+	constexpr int32 SeedCellsPerTileAxis = 4;
+	constexpr int32 SeedAttemptsPerCell = 4;
+
+	// Per-pass stream salts; auxiliary entries add their resolved index to the auxiliary salt.
+	constexpr int32 LargeTreeStreamSalt = 101;
+	constexpr int32 RegularTreeStreamSalt = 202;
+	constexpr int32 BushStreamSalt = 303;
+	constexpr int32 FoliageStreamSalt = 404;
+	constexpr int32 DecalStreamSalt = 505;
+	constexpr int32 AuxiliaryStreamSalt = 1000;
+
+	// Pass-local grids store spacing circles only; the type is irrelevant, so every query matches all.
+	constexpr uint8 AnyOccupancyMask = 0xFF;
+}
+
+namespace
+{
+	FRandomStream MakeTileStream(const int32 RandomSeed, const int32 StreamSalt, const int32 TileIndex)
+	{
+		return FRandomStream(static_cast<int32>(
+			HashCombine(GetTypeHash(RandomSeed + StreamSalt), GetTypeHash(TileIndex))));
+	}
+
+	double GetSpacingRadius(const FForestPoissonPass& Pass, const FForestPoissonSample& Sample)
+	{
+		return Pass.bSpaceByRadius ? Sample.Radius : 0.0;
+	}
+
+	/** @return Clearance added between two samples of the pass; positive even if the props have no size. */
+	double GetPoissonClearance(const FForestPoissonPass& Pass)
+	{
+		return FMath::Max(Pass.SelfClearance, ForestBiomeGenConstants::MinPoissonSeparation);
+	}
+
+	/** @return Weighted mean clearance radius at unit scale, used to turn a density spacing into clearance. */
+	template <typename TEntry>
+	double GetWeightedMeanRadius(const TArray<TEntry>& Entries)
+	{
+		double WeightSum = 0.0;
+		double RadiusSum = 0.0;
+		for (const TEntry& Entry : Entries)
+		{
+			const double Weight = FMath::Max(0.0f, Entry.Weight);
+			WeightSum += Weight;
+			RadiusSum += Weight * Entry.Radius;
+		}
+		return WeightSum > 0.0 ? RadiusSum / WeightSum : 0.0;
+	}
+
+	/** @brief Keeps a uniform random subset of TargetCount samples; a subset of a Poisson set keeps its spacing. */
+	void TrimToTargetCount(TArray<FForestPoissonSample>& Samples, const int32 TargetCount, FRandomStream& Random)
+	{
+		if (Samples.Num() <= TargetCount)
+		{
+			return;
+		}
+
+		for (int32 Index = 0; Index < TargetCount; ++Index)
+		{
+			Samples.Swap(Index, Random.RandRange(Index, Samples.Num() - 1));
+		}
+		Samples.SetNum(TargetCount);
+	}
 }
 
 FForestBiomeGenerator::FForestBiomeGenerator(const FForestBiomeGenParams& InParams)
@@ -48,7 +124,7 @@ void FForestBiomeGenerator::Generate(FForestBiomeGenResult& OutResult)
 	ScatterFoliage(ComputeTargetCount(M_Params.FoliagePer1000), OutResult.Foliage);
 
 	const double GlobalDecalSizeMultiplier = PickScale(
-		true, M_Params.MinGlobalDecalSizeMultiplier, M_Params.MaxGlobalDecalSizeMultiplier);
+		true, M_Params.MinGlobalDecalSizeMultiplier, M_Params.MaxGlobalDecalSizeMultiplier, M_Random);
 	ScatterDecals(
 		ComputeTargetCount(M_Params.DecalsPer1000), GlobalDecalSizeMultiplier, OutResult.Decals);
 
@@ -91,12 +167,15 @@ int32 FForestBiomeGenerator::ComputeTargetCount(const double DensityPer1000) con
 	return FMath::Max(0, FMath::RoundToInt32(Count));
 }
 
-int32 FForestBiomeGenerator::ComputeAttemptBudget(const int32 TargetCount) const
+double FForestBiomeGenerator::ComputeDensitySpacing(const int32 TargetCount) const
 {
-	// Most attempts land outside the spawnable area when the fraction is small; scale the budget by
-	// its inverse so the target can still be reached, with a floor to keep it bounded.
-	const double Fraction = FMath::Max(ForestBiomeGenConstants::MinInsideFractionForBudget, M_InsideFraction);
-	return FMath::CeilToInt32(TargetCount * ForestBiomeGenConstants::AttemptsPerPlacement / Fraction);
+	if (TargetCount <= 0)
+	{
+		return 0.0;
+	}
+
+	const double SpawnableArea = M_Params.BiomeLengthX * M_Params.BiomeLengthY * M_InsideFraction;
+	return FMath::Sqrt(ForestBiomeGenConstants::PoissonAreaPerSampleFactor * SpawnableArea / TargetCount);
 }
 
 void FForestBiomeGenerator::ScatterProps(
@@ -111,38 +190,48 @@ void FForestBiomeGenerator::ScatterProps(
 		return;
 	}
 
-	const int32 MaxAttempts = ComputeAttemptBudget(TargetCount);
-	int32 Placed = 0;
-	for (int32 Attempt = 0; Attempt < MaxAttempts && Placed < TargetCount; ++Attempt)
+	double MaxRadius = 0.0;
+	for (const FForestResolvedProp& Entry : Entries)
 	{
-		const int32 EntryIndex = PickWeightedProp(Entries);
-		if (EntryIndex == INDEX_NONE)
-		{
-			return;
-		}
+		const double MaxScale = Entry.bOverrideScale ? FMath::Max(Entry.MinScale, Entry.MaxScale) : 1.0;
+		MaxRadius = FMath::Max(MaxRadius, Entry.Radius * MaxScale);
+	}
 
-		const FForestResolvedProp& Entry = Entries[EntryIndex];
-		const double Scale = PickScale(Entry.bOverrideScale, Entry.MinScale, Entry.MaxScale);
-		const double Radius = Entry.Radius * Scale;
+	// Samples of one category keep at least PropSpacing apart, more when the density asks for sparser props.
+	const double DensityClearance = ComputeDensitySpacing(TargetCount) - 2.0 * GetWeightedMeanRadius(Entries);
 
-		const FVector2D Point = RandomLocalPoint();
-		if (not IsAllowedPoint(Point))
-		{
-			continue;
-		}
-		if (M_Occupancy.OverlapsAny(Point, Radius, AvoidMask, M_Params.PropSpacing))
-		{
-			continue;
-		}
+	FForestPoissonPass Pass;
+	Pass.TargetCount = TargetCount;
+	Pass.SelfClearance = FMath::Max(M_Params.PropSpacing, DensityClearance);
+	Pass.bSpaceByRadius = true;
+	Pass.MaxRadius = MaxRadius;
+	Pass.StreamSalt = ReserveType == EForestOccupancy::LargeTree
+		? ForestBiomeGenConstants::LargeTreeStreamSalt
+		: ReserveType == EForestOccupancy::RegularTree
+		? ForestBiomeGenConstants::RegularTreeStreamSalt
+		: ForestBiomeGenConstants::BushStreamSalt;
+	Pass.AvoidRules.Add(FForestAvoidRule{AvoidMask, M_Params.PropSpacing});
+	Pass.PickCandidate = [this, &Entries](FRandomStream& Random, FForestPoissonSample& OutSample)
+	{
+		OutSample.EntryIndex = PickWeightedProp(Entries, Random);
+		const FForestResolvedProp& Entry = Entries[OutSample.EntryIndex];
+		OutSample.UniformScale = PickScale(Entry.bOverrideScale, Entry.MinScale, Entry.MaxScale, Random);
+		OutSample.Radius = Entry.Radius * OutSample.UniformScale;
+	};
 
-		M_Occupancy.Add(Point, Radius, ReserveType);
+	TArray<FForestPoissonSample> Samples;
+	SamplePoissonPass(Pass, Samples);
+
+	OutPlacements.Reserve(OutPlacements.Num() + Samples.Num());
+	for (const FForestPoissonSample& Sample : Samples)
+	{
+		M_Occupancy.Add(Sample.Position, Sample.Radius, ReserveType);
 
 		FForestPlacement& Placement = OutPlacements.Emplace_GetRef();
-		Placement.EntryIndex = EntryIndex;
-		Placement.Position = Point;
-		Placement.YawRadians = M_Random.FRandRange(0.0, ForestBiomeGenConstants::TwoPi);
-		Placement.UniformScale = Scale;
-		++Placed;
+		Placement.EntryIndex = Sample.EntryIndex;
+		Placement.Position = Sample.Position;
+		Placement.YawRadians = Sample.YawRadians;
+		Placement.UniformScale = Sample.UniformScale;
 	}
 }
 
@@ -153,37 +242,40 @@ void FForestBiomeGenerator::ScatterFoliage(const int32 TargetCount, TArray<FFore
 		return;
 	}
 
-	const int32 MaxAttempts = ComputeAttemptBudget(TargetCount);
-	int32 Placed = 0;
-	for (int32 Attempt = 0; Attempt < MaxAttempts && Placed < TargetCount; ++Attempt)
+	double MaxRadius = 0.0;
+	for (const FForestResolvedFoliage& Entry : M_Params.Foliage)
 	{
-		const int32 EntryIndex = PickWeightedFoliage(M_Params.Foliage);
-		if (EntryIndex == INDEX_NONE)
-		{
-			return;
-		}
+		MaxRadius = FMath::Max(MaxRadius, Entry.Radius * FMath::Max(Entry.MinScale, Entry.MaxScale));
+	}
 
-		const FForestResolvedFoliage& Entry = M_Params.Foliage[EntryIndex];
-		const double Scale = PickScale(true, Entry.MinScale, Entry.MaxScale);
-		const double Radius = Entry.Radius * Scale;
+	// Groundcover: keep clear of tree/bush trunks, but foliage may overlap other foliage, so samples
+	// are spaced by density alone.
+	FForestPoissonPass Pass;
+	Pass.TargetCount = TargetCount;
+	Pass.SelfClearance = ComputeDensitySpacing(TargetCount);
+	Pass.bSpaceByRadius = false;
+	Pass.MaxRadius = MaxRadius;
+	Pass.StreamSalt = ForestBiomeGenConstants::FoliageStreamSalt;
+	Pass.AvoidRules.Add(FForestAvoidRule{ForestSolidPropMask(), 0.0});
+	Pass.PickCandidate = [this](FRandomStream& Random, FForestPoissonSample& OutSample)
+	{
+		OutSample.EntryIndex = PickWeightedFoliage(M_Params.Foliage, Random);
+		const FForestResolvedFoliage& Entry = M_Params.Foliage[OutSample.EntryIndex];
+		OutSample.UniformScale = PickScale(true, Entry.MinScale, Entry.MaxScale, Random);
+		OutSample.Radius = Entry.Radius * OutSample.UniformScale;
+	};
 
-		const FVector2D Point = RandomLocalPoint();
-		if (not IsAllowedPoint(Point))
-		{
-			continue;
-		}
-		// Groundcover: keep clear of tree/bush trunks, but foliage may overlap other foliage.
-		if (M_Occupancy.OverlapsAny(Point, Radius, ForestSolidPropMask(), 0.0))
-		{
-			continue;
-		}
+	TArray<FForestPoissonSample> Samples;
+	SamplePoissonPass(Pass, Samples);
 
+	OutPlacements.Reserve(OutPlacements.Num() + Samples.Num());
+	for (const FForestPoissonSample& Sample : Samples)
+	{
 		FForestPlacement& Placement = OutPlacements.Emplace_GetRef();
-		Placement.EntryIndex = EntryIndex;
-		Placement.Position = Point;
-		Placement.YawRadians = M_Random.FRandRange(0.0, ForestBiomeGenConstants::TwoPi);
-		Placement.UniformScale = Scale;
-		++Placed;
+		Placement.EntryIndex = Sample.EntryIndex;
+		Placement.Position = Sample.Position;
+		Placement.YawRadians = Sample.YawRadians;
+		Placement.UniformScale = Sample.UniformScale;
 	}
 }
 
@@ -197,29 +289,29 @@ void FForestBiomeGenerator::ScatterDecals(
 		return;
 	}
 
-	const int32 MaxAttempts = ComputeAttemptBudget(TargetCount);
-	int32 Placed = 0;
-	for (int32 Attempt = 0; Attempt < MaxAttempts && Placed < TargetCount; ++Attempt)
+	// Decals reserve nothing and avoid nothing; the pass only spreads them evenly.
+	FForestPoissonPass Pass;
+	Pass.TargetCount = TargetCount;
+	Pass.SelfClearance = ComputeDensitySpacing(TargetCount);
+	Pass.bSpaceByRadius = false;
+	Pass.StreamSalt = ForestBiomeGenConstants::DecalStreamSalt;
+	Pass.PickCandidate = [this](FRandomStream& Random, FForestPoissonSample& OutSample)
 	{
-		const int32 EntryIndex = PickWeightedDecal(M_Params.Decals);
-		if (EntryIndex == INDEX_NONE)
-		{
-			return;
-		}
+		OutSample.EntryIndex = PickWeightedDecal(M_Params.Decals, Random);
+	};
 
-		const FVector2D Point = RandomLocalPoint();
-		if (not IsAllowedPoint(Point))
-		{
-			continue;
-		}
+	TArray<FForestPoissonSample> Samples;
+	SamplePoissonPass(Pass, Samples);
 
-		const FForestResolvedDecal& Entry = M_Params.Decals[EntryIndex];
+	OutPlacements.Reserve(OutPlacements.Num() + Samples.Num());
+	for (const FForestPoissonSample& Sample : Samples)
+	{
+		const FForestResolvedDecal& Entry = M_Params.Decals[Sample.EntryIndex];
 		FForestDecalPlacement& Placement = OutPlacements.Emplace_GetRef();
-		Placement.EntryIndex = EntryIndex;
-		Placement.Position = Point;
-		Placement.YawRadians = M_Random.FRandRange(0.0, ForestBiomeGenConstants::TwoPi);
+		Placement.EntryIndex = Sample.EntryIndex;
+		Placement.Position = Sample.Position;
+		Placement.YawRadians = Sample.YawRadians;
 		Placement.DecalSize = Entry.DecalSize * GlobalSizeMultiplier;
-		++Placed;
 	}
 }
 
@@ -278,42 +370,209 @@ void FForestBiomeGenerator::ScatterAuxiliaryEntry(
 	}
 
 	const FForestResolvedAuxiliary& Entry = M_Params.Auxiliaries[ResolvedIndex];
-	const uint8 AuxiliaryMask = ForestOccupancyMask(EForestOccupancy::Auxiliary);
+	const double MaxScale = Entry.bOverrideScale ? FMath::Max(Entry.MinScale, Entry.MaxScale) : 1.0;
+	const double DensityClearance = ComputeDensitySpacing(TargetCount) - 2.0 * Entry.Radius;
+
+	FForestPoissonPass Pass;
+	Pass.TargetCount = TargetCount;
+	Pass.SelfClearance = FMath::Max(Entry.IsolationDistance, DensityClearance);
+	Pass.bSpaceByRadius = true;
+	Pass.MaxRadius = Entry.Radius * MaxScale;
+	Pass.StreamSalt = ForestBiomeGenConstants::AuxiliaryStreamSalt + ResolvedIndex;
+	// Never sit on a tree or bush, and keep the size-scaled isolation distance clear of every
+	// auxiliary placed by the larger entries before this one.
+	Pass.AvoidRules.Add(FForestAvoidRule{ForestSolidPropMask(), 0.0});
+	Pass.AvoidRules.Add(FForestAvoidRule{ForestOccupancyMask(EForestOccupancy::Auxiliary), Entry.IsolationDistance});
+	Pass.PickCandidate = [this, &Entry, ResolvedIndex](FRandomStream& Random, FForestPoissonSample& OutSample)
+	{
+		OutSample.EntryIndex = ResolvedIndex;
+		OutSample.UniformScale = PickScale(Entry.bOverrideScale, Entry.MinScale, Entry.MaxScale, Random);
+		OutSample.Radius = Entry.Radius * OutSample.UniformScale;
+	};
+
+	TArray<FForestPoissonSample> Samples;
+	SamplePoissonPass(Pass, Samples);
+
+	OutPlacements.Reserve(OutPlacements.Num() + Samples.Num());
+	for (const FForestPoissonSample& Sample : Samples)
+	{
+		M_Occupancy.Add(Sample.Position, Sample.Radius, EForestOccupancy::Auxiliary);
 
-	const int32 MaxAttempts = ComputeAttemptBudget(TargetCount);
-	int32 Placed = 0;
-	for (int32 Attempt = 0; Attempt < MaxAttempts && Placed < TargetCount; ++Attempt)
+		FForestPlacement& Placement = OutPlacements.Emplace_GetRef();
+		Placement.EntryIndex = ResolvedIndex;
+		Placement.Position = Sample.Position;
+		Placement.YawRadians = Sample.YawRadians;
+		Placement.UniformScale = Sample.UniformScale;
+	}
+}
+
+void FForestBiomeGenerator::SamplePoissonPass(const FForestPoissonPass& Pass, TArray<FForestPoissonSample>& OutSamples)
+{
+	OutSamples.Reset();
+	if (Pass.TargetCount <= 0 || not Pass.PickCandidate || M_Params.BiomeLengthX <= 0.0 || M_Params.BiomeLengthY <= 0.0)
 	{
-		const double Scale = PickScale(Entry.bOverrideScale, Entry.MinScale, Entry.MaxScale);
-		const double Radius = Entry.Radius * Scale;
+		return;
+	}
+
+	// Two samples of the pass constrain each other up to this center distance.
+	const double MaxSpacingRadius = Pass.bSpaceByRadius ? Pass.MaxRadius : 0.0;
+	const double Reach = 2.0 * MaxSpacingRadius + GetPoissonClearance(Pass);
+	const double TileSize = FMath::Max(ForestBiomeGenConstants::MinPoissonTileSize, 2.0 * Reach);
+	const int32 NumTilesX = FMath::Max(1, FMath::CeilToInt32(M_Params.BiomeLengthX / TileSize));
+	const int32 NumTilesY = FMath::Max(1, FMath::CeilToInt32(M_Params.BiomeLengthY / TileSize));
+	const FVector2D BiomeMin(-0.5 * M_Params.BiomeLengthX, -0.5 * M_Params.BiomeLengthY);
+	const FVector2D BiomeMax(0.5 * M_Params.BiomeLengthX, 0.5 * M_Params.BiomeLengthY);
+
+	FForestOccupancyGrid PassGrid(Reach);
+	TArray<TArray<FForestPoissonSample>> SamplesByTile;
+	SamplesByTile.SetNum(NumTilesX * NumTilesY);
 
-		const FVector2D Point = RandomLocalPoint();
-		if (not IsAllowedPoint(Point))
+	// 2x2 coloring: tiles of one phase are a full tile apart and run concurrently; each phase reads the
+	// samples earlier phases committed, which stitches the borders between neighbouring tiles.
+	TArray<int32> PhaseTiles;
+	for (int32 Phase = 0; Phase < 4; ++Phase)
+	{
+		PhaseTiles.Reset();
+		for (int32 TileY = Phase / 2; TileY < NumTilesY; TileY += 2)
 		{
-			continue;
+			for (int32 TileX = Phase % 2; TileX < NumTilesX; TileX += 2)
+			{
+				PhaseTiles.Add(TileY * NumTilesX + TileX);
+			}
 		}
-		// Never sit on a tree or bush.
-		if (M_Occupancy.OverlapsAny(Point, Radius, ForestSolidPropMask(), 0.0))
+
+		ParallelFor(PhaseTiles.Num(), [&](const int32 WorkIndex)
 		{
-			continue;
+			const int32 TileIndex = PhaseTiles[WorkIndex];
+			const FVector2D TileMin = BiomeMin + TileSize * FVector2D(
+				static_cast<double>(TileIndex % NumTilesX), static_cast<double>(TileIndex / NumTilesX));
+			const FBox2D TileBounds(TileMin, FVector2D::Min(TileMin + FVector2D(TileSize), BiomeMax));
+
+			FRandomStream TileRandom = MakeTileStream(M_Params.RandomSeed, Pass.StreamSalt, TileIndex);
+			SamplePoissonTile(Pass, TileBounds, PassGrid, TileRandom, SamplesByTile[TileIndex]);
+		}, EParallelForFlags::Unbalanced);
+
+		for (const int32 TileIndex : PhaseTiles)
+		{
+			for (const FForestPoissonSample& Sample : SamplesByTile[TileIndex])
+			{
+				PassGrid.Add(Sample.Position, GetSpacingRadius(Pass, Sample), EForestOccupancy::LargeTree);
+			}
 		}
-		// Keep the size-scaled isolation distance clear of every other auxiliary.
-		if (M_Occupancy.OverlapsAny(Point, Radius, AuxiliaryMask, Entry.IsolationDistance))
+	}
+
+	for (TArray<FForestPoissonSample>& TileSamples : SamplesByTile)
+	{
+		OutSamples.Append(MoveTemp(TileSamples));
+	}
+	TrimToTargetCount(OutSamples, Pass.TargetCount, M_Random);
+}
+
+void FForestBiomeGenerator::SamplePoissonTile(
+	const FForestPoissonPass& Pass,
+	const FBox2D& TileBounds,
+	const FForestOccupancyGrid& PassGrid,
+	FRandomStream& Random,
+	TArray<FForestPoissonSample>& OutSamples) const
+{
+	const double MaxSpacingRadius = Pass.bSpaceByRadius ? Pass.MaxRadius : 0.0;
+	FForestOccupancyGrid TileGrid(2.0 * MaxSpacingRadius + GetPoissonClearance(Pass));
+	TArray<int32> ActiveSamples;
+
+	const auto TryAccept = [&](FForestPoissonSample& Candidate) -> bool
+	{
+		if (not TileBounds.IsInside(Candidate.Position)
+			|| not IsPoissonCandidateFree(Pass, Candidate, PassGrid, TileGrid))
 		{
-			continue;
+			return false;
 		}
 
-		M_Occupancy.Add(Point, Radius, EForestOccupancy::Auxiliary);
+		Candidate.YawRadians = Random.FRandRange(0.0, ForestBiomeGenConstants::TwoPi);
+		TileGrid.Add(Candidate.Position, GetSpacingRadius(Pass, Candidate), EForestOccupancy::LargeTree);
+		ActiveSamples.Add(OutSamples.Add(Candidate));
+		return true;
+	};
 
-		FForestPlacement& Placement = OutPlacements.Emplace_GetRef();
-		Placement.EntryIndex = ResolvedIndex;
-		Placement.Position = Point;
-		Placement.YawRadians = M_Random.FRandRange(0.0, ForestBiomeGenConstants::TwoPi);
-		Placement.UniformScale = Scale;
-		++Placed;
+	const FVector2D SeedCellSize =
+		TileBounds.GetSize() / static_cast<double>(ForestBiomeGenConstants::SeedCellsPerTileAxis);
+	for (int32 SeedCell = 0; SeedCell < FMath::Square(ForestBiomeGenConstants::SeedCellsPerTileAxis); ++SeedCell)
+	{
+		const FVector2D SeedCellMin = TileBounds.Min + SeedCellSize * FVector2D(
+			static_cast<double>(SeedCell % ForestBiomeGenConstants::SeedCellsPerTileAxis),
+			static_cast<double>(SeedCell / ForestBiomeGenConstants::SeedCellsPerTileAxis));
+		for (int32 Attempt = 0; Attempt < ForestBiomeGenConstants::SeedAttemptsPerCell; ++Attempt)
+		{
+			FForestPoissonSample Seed;
+			Pass.PickCandidate(Random, Seed);
+			Seed.Position = SeedCellMin + FVector2D(
+				Random.FRandRange(0.0, SeedCellSize.X), Random.FRandRange(0.0, SeedCellSize.Y));
+			if (TryAccept(Seed))
+			{
+				break;
+			}
+		}
+
+		// Bridson: grow from random active samples through the annulus [Separation, 2 * Separation],
+		// retiring a sample once k candidates around it all failed.
+		while (not ActiveSamples.IsEmpty())
+		{
+			const int32 ActiveIndex = Random.RandRange(0, ActiveSamples.Num() - 1);
+			const FForestPoissonSample Parent = OutSamples[ActiveSamples[ActiveIndex]];
+
+			bool bAcceptedAny = false;
+			for (int32 Attempt = 0; Attempt < ForestBiomeGenConstants::PoissonCandidatesPerActiveSample; ++Attempt)
+			{
+				FForestPoissonSample Candidate;
+				Pass.PickCandidate(Random, Candidate);
+				const double Separation =
+					GetSpacingRadius(Pass, Parent) + GetSpacingRadius(Pass, Candidate) + GetPoissonClearance(Pass);
+				const double Distance = Random.FRandRange(Separation, 2.0 * Separation);
+				const double Angle = Random.FRandRange(0.0, ForestBiomeGenConstants::TwoPi);
+				Candidate.Position = Parent.Position + Distance * FVector2D(FMath::Cos(Angle), FMath::Sin(Angle));
+				if (TryAccept(Candidate))
+				{
+					bAcceptedAny = true;
+					break;
+				}
+			}
+
+			if (not bAcceptedAny)
+			{
+				ActiveSamples.RemoveAtSwap(ActiveIndex);
+			}
+		}
 	}
 }
 
+bool FForestBiomeGenerator::IsPoissonCandidateFree(
+	const FForestPoissonPass& Pass,
+	const FForestPoissonSample& Candidate,
+	const FForestOccupancyGrid& PassGrid,
+	const FForestOccupancyGrid& TileGrid) const
+{
+	// Cheapest and most often failing first: Bridson candidates mostly land near their own tile's samples,
+	// while the area and exclusion tests may sample PCG spatial data.
+	const double SpacingRadius = GetSpacingRadius(Pass, Candidate);
+	const double Clearance = GetPoissonClearance(Pass);
+	if (TileGrid.OverlapsAny(Candidate.Position, SpacingRadius, ForestBiomeGenConstants::AnyOccupancyMask,
+			Clearance)
+		|| PassGrid.OverlapsAny(Candidate.Position, SpacingRadius, ForestBiomeGenConstants::AnyOccupancyMask,
+			Clearance))
+	{
+		return false;
+	}
+
+	for (const FForestAvoidRule& Rule : Pass.AvoidRules)
+	{
+		if (M_Occupancy.OverlapsAny(Candidate.Position, Candidate.Radius, Rule.TypeMask, Rule.ExtraClearance))
+		{
+			return false;
+		}
+	}
+
+	return IsAllowedPoint(Candidate.Position);
+}
+
 FVector2D FForestBiomeGenerator::RandomLocalPoint()
 {
 	return FVector2D(
@@ -334,7 +593,11 @@ bool FForestBiomeGenerator::IsAllowedPoint(const FVector2D& Point) const
 	return true;
 }
 
-double FForestBiomeGenerator::PickScale(const bool bOverride, const float MinScale, const float MaxScale)
+double FForestBiomeGenerator::PickScale(
+	const bool bOverride,
+	const float MinScale,
+	const float MaxScale,
+	FRandomStream& Random) const
 {
 	if (not bOverride)
 	{
@@ -343,10 +606,12 @@ double FForestBiomeGenerator::PickScale(const bool bOverride, const float MinSca
 
 	const double Low = FMath::Min(MinScale, MaxScale);
 	const double High = FMath::Max(MinScale, MaxScale);
-	return M_Random.FRandRange(Low, High);
+	return Random.FRandRange(Low, High);
 }
 
-int32 FForestBiomeGenerator::PickWeightedProp(const TArray<FForestResolvedProp>& Entries)
+int32 FForestBiomeGenerator::PickWeightedProp(
+	const TArray<FForestResolvedProp>& Entries,
+	FRandomStream& Random) const
 {
 	if (Entries.IsEmpty())
 	{
@@ -363,7 +628,7 @@ int32 FForestBiomeGenerator::PickWeightedProp(const TArray<FForestResolvedProp>&
 		return 0;
 	}
 
-	double Roll = M_Random.FRandRange(0.0, WeightSum);
+	double Roll = Random.FRandRange(0.0, WeightSum);
 	for (int32 Index = 0; Index < Entries.Num(); ++Index)
 	{
 		Roll -= FMath::Max(0.0f, Entries[Index].Weight);
@@ -375,7 +640,9 @@ int32 FForestBiomeGenerator::PickWeightedProp(const TArray<FForestResolvedProp>&
 	return Entries.Num() - 1;
 }
 
-int32 FForestBiomeGenerator::PickWeightedFoliage(const TArray<FForestResolvedFoliage>& Entries)
+int32 FForestBiomeGenerator::PickWeightedFoliage(
+	const TArray<FForestResolvedFoliage>& Entries,
+	FRandomStream& Random) const
 {
 	if (Entries.IsEmpty())
 	{
@@ -392,7 +659,7 @@ int32 FForestBiomeGenerator::PickWeightedFoliage(const TArray<FForestResolvedFol
 		return 0;
 	}
 
-	double Roll = M_Random.FRandRange(0.0, WeightSum);
+	double Roll = Random.FRandRange(0.0, WeightSum);
 	for (int32 Index = 0; Index < Entries.Num(); ++Index)
 	{
 		Roll -= FMath::Max(0.0f, Entries[Index].Weight);
@@ -404,7 +671,9 @@ int32 FForestBiomeGenerator::PickWeightedFoliage(const TArray<FForestResolvedFol
 	return Entries.Num() - 1;
 }
 
-int32 FForestBiomeGenerator::PickWeightedDecal(const TArray<FForestResolvedDecal>& Entries)
+int32 FForestBiomeGenerator::PickWeightedDecal(
+	const TArray<FForestResolvedDecal>& Entries,
+	FRandomStream& Random) const
 {
 	if (Entries.IsEmpty())
 	{
@@ -421,7 +690,7 @@ int32 FForestBiomeGenerator::PickWeightedDecal(const TArray<FForestResolvedDecal
 		return 0;
 	}
 
-	double Roll = M_Random.FRandRange(0.0, WeightSum);
+	double Roll = Random.FRandRange(0.0, WeightSum);
 	for (int32 Index = 0; Index < Entries.Num(); ++Index)
 	{
 		Roll -= FMath::Max(0.0f, Entries[Index].Weight);
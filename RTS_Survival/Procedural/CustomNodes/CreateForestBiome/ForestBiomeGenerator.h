@@ -97,6 +97,48 @@ struct FForestBiomeGenResult
 	TArray<FForestPlacement> Auxiliaries;
 };
 
+/** @brief One accepted Poisson-disk sample before its pass is trimmed to the target count. */
+struct FForestPoissonSample
+{
+	int32 EntryIndex = INDEX_NONE;
+	FVector2D Position = FVector2D::ZeroVector;
+	double YawRadians = 0.0;
+	double UniformScale = 1.0;
+
+	// Clearance radius of the picked entry at its scale; reserved in the occupancy grid.
+	double Radius = 0.0;
+};
+
+/** @brief Earlier placements a Poisson candidate must keep clear of. */
+struct FForestAvoidRule
+{
+	uint8 TypeMask = 0;
+	double ExtraClearance = 0.0;
+};
+
+/**
+ * @brief Spacing rules of one Poisson-disk pass (one category, or one auxiliary entry).
+ * Samples of the pass keep (SpacingRadius A + SpacingRadius B + SelfClearance) apart, where the
+ * spacing radius is the sample radius, or 0 for categories that may overlap (foliage, decals).
+ */
+struct FForestPoissonPass
+{
+	int32 TargetCount = 0;
+	double SelfClearance = 0.0;
+	bool bSpaceByRadius = true;
+
+	// Largest radius PickCandidate can produce; sizes the tiles so same-phase tiles never interact.
+	double MaxRadius = 0.0;
+
+	// Salt for the per-tile streams, so passes draw independent random sequences.
+	int32 StreamSalt = 0;
+
+	TArray<FForestAvoidRule, TInlineAllocator<2>> AvoidRules;
+
+	// Picks entry, scale and radius for one candidate from the tile's stream.
+	TFunction<void(FRandomStream&, FForestPoissonSample&)> PickCandidate;
+};
+
 /**
  * @brief Full parameter snapshot for one generation run. Filled by the PCG element from the node
  * settings and resolved assets; every length is in biome-local space (pivot at the origin).
@@ -130,6 +172,7 @@ struct FForestBiomeGenParams
 	TArray<FForestResolvedAuxiliary> Auxiliaries;
 
 	// Optional exclusion test in biome-local space (fed by the node's Exclusion input pin).
+	// Both tests are called concurrently from the tile workers and must be read-only.
 	TFunction<bool(const FVector2D&)> IsExcluded;
 
 	// Optional area test in biome-local space (the input spawn volume / spline shape). When set,
@@ -142,6 +185,11 @@ struct FForestBiomeGenParams
  * foliage, decals and auxiliaries in that order into a shared occupancy grid, so later categories only
  * take space earlier ones left free. Consumes no UObjects; the element resolves assets before and
  * spawns actors / instances / points after.
+ *
+ * Every category is a Poisson-disk pass (Bridson, with per-entry radii) generated in tiles on worker
+ * threads: tiles run in four 2x2-colored phases, so tiles of one phase are too far apart to interact,
+ * and each phase sees the samples committed by earlier phases across tile borders. Passes space
+ * samples for their density, overshoot the target slightly and are trimmed to the exact count.
  */
 class FForestBiomeGenerator
 {
@@ -166,8 +214,11 @@ private:
 	/** @return Target placement count for an areal density over the spawnable biome area. */
 	int32 ComputeTargetCount(double DensityPer1000) const;
 
-	/** @return Rejection-sampling attempt budget for a target, scaled up for small spawnable fractions. */
-	int32 ComputeAttemptBudget(int32 TargetCount) const;
+	/**
+	 * @return Sample distance at which a maximal Poisson-disk set over the spawnable area holds
+	 * somewhat more than TargetCount samples, so trimming to the target keeps spacing even.
+	 */
+	double ComputeDensitySpacing(int32 TargetCount) const;
 
 	/**
 	 * @brief Scatters one solid-prop category (large trees, regular trees or bushes), reserving a
@@ -193,11 +244,26 @@ private:
 	void ScatterAuxiliaries(FForestBiomeGenResult& OutResult);
 	void ScatterAuxiliaryEntry(int32 ResolvedIndex, int32 TargetCount, TArray<FForestPlacement>& OutPlacements);
 
+	// --- Poisson-disk sampling ---
+
+	/** @brief Runs the tiled phases of one pass and trims the samples to its target count. */
+	void SamplePoissonPass(const FForestPoissonPass& Pass, TArray<FForestPoissonSample>& OutSamples);
+
+	/**
+	 * @brief Bridson sampling inside one tile; candidates outside the tile are left to its neighbours.
+	 * @param PassGrid Samples committed by earlier phases of this pass (read-only while tiles run).
+	 */
+	void SamplePoissonTile(const FForestPoissonPass& Pass, const FBox2D& TileBounds,
+		const FForestOccupancyGrid& PassGrid, FRandomStream& Random, TArray<FForestPoissonSample>& OutSamples) const;
+
+	bool IsPoissonCandidateFree(const FForestPoissonPass& Pass, const FForestPoissonSample& Candidate,
+		const FForestOccupancyGrid& PassGrid, const FForestOccupancyGrid& TileGrid) const;
+
 	// --- Sampling helpers ---
 	FVector2D RandomLocalPoint();
 	bool IsAllowedPoint(const FVector2D& Point) const;
-	double PickScale(bool bOverride, float MinScale, float MaxScale);
-	int32 PickWeightedProp(const TArray<FForestResolvedProp>& Entries);
-	int32 PickWeightedFoliage(const TArray<FForestResolvedFoliage>& Entries);
-	int32 PickWeightedDecal(const TArray<FForestResolvedDecal>& Entries);
+	double PickScale(bool bOverride, float MinScale, float MaxScale, FRandomStream& Random) const;
+	int32 PickWeightedProp(const TArray<FForestResolvedProp>& Entries, FRandomStream& Random) const;
+	int32 PickWeightedFoliage(const TArray<FForestResolvedFoliage>& Entries, FRandomStream& Random) const;
+	int32 PickWeightedDecal(const TArray<FForestResolvedDecal>& Entries, FRandomStream& Random) const;
 };
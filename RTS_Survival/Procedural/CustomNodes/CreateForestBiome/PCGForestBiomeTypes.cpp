@@ -55,9 +55,9 @@ bool FForestOccupancyGrid::OverlapsAny(
 	const double Reach = Radius + FMath::Max(0.0, ExtraClearance);
 	const FBox2D QueryAABB(Center - FVector2D(Reach), Center + FVector2D(Reach));
 
+	// Entries spanning several cells may be distance-tested more than once; the test is idempotent and
+	// cheaper than de-duplicating, and keeping the query free of scratch lets tile workers share the grid.
 	bool bOverlaps = false;
-	// Entries can span multiple cells; remember which were already distance-tested.
-	TSet<int32> TestedEntries;
 
 	ForEachCellOf(QueryAABB, [&](const FIntPoint& Cell)
 	{
@@ -74,13 +74,6 @@ bool FForestOccupancyGrid::OverlapsAny(
 
 		for (const int32 EntryIndex : *CellEntries)
 		{
-			bool bAlreadyTested = false;
-			TestedEntries.Add(EntryIndex, &bAlreadyTested);
-			if (bAlreadyTested)
-			{
-				continue;
-			}
-
 			const FEntry& Entry = M_Entries[EntryIndex];
 			if ((ForestOccupancyMask(Entry.Type) & TypeMask) == 0)
 			{
@@ -199,6 +199,7 @@ constexpr uint8 ForestSolidPropMask()
  * @brief Spatial hash of reserved circles so overlap and isolation queries stay O(local) even for
  * dense biomes. Each circle is registered in every cell its bounding box covers; queries only
  * distance-test the circles found in the cells the query reaches.
+ * @note Queries keep no scratch state, so concurrent queries are safe as long as nothing is added.
  */
 class FForestOccupancyGrid
 {
@@ -0,0 +1,155 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include "RTS_Survival/Procedural/CustomNodes/CreateForestBiome/ForestBiomeGenerator.h"
+
+namespace ForestBiomeGeneratorTestConstants
+{
+	constexpr int32 RandomSeed = 1337;
+	constexpr double BenchmarkBiomeLengths[] = {20000.0, 60000.0, 120000.0};
+	constexpr double DensityAreaUnit = 1000.0;
+	constexpr double SeparationTolerance = 0.01;
+}
+
+namespace
+{
+	FForestResolvedProp MakeProp(const int32 SettingsIndex, const double Radius)
+	{
+		FForestResolvedProp Prop;
+		Prop.SettingsIndex = SettingsIndex;
+		Prop.Radius = Radius;
+		Prop.bOverrideScale = true;
+		Prop.MinScale = 0.8f;
+		Prop.MaxScale = 1.2f;
+		return Prop;
+	}
+
+	/** Dense parameter set in the shape the PCG element builds, without any UObject assets. */
+	FForestBiomeGenParams MakeDenseParams(const double BiomeLength)
+	{
+		using namespace ForestBiomeGeneratorTestConstants;
+
+		FForestBiomeGenParams Params;
+		Params.BiomeLengthX = BiomeLength;
+		Params.BiomeLengthY = BiomeLength;
+		Params.RandomSeed = RandomSeed;
+		Params.LargeTreesPer1000 = 0.1;
+		Params.RegularTreesPer1000 = 1.0;
+		Params.BushesPer1000 = 1.0;
+		Params.FoliagePer1000 = 12.0;
+		Params.DecalsPer1000 = 2.0;
+		Params.AuxiliariesPer1000 = 1.0;
+		Params.LargeTrees.Add(MakeProp(0, 250.0));
+		Params.RegularTrees.Add(MakeProp(0, 150.0));
+		Params.RegularTrees.Add(MakeProp(1, 120.0));
+		Params.Bushes.Add(MakeProp(0, 80.0));
+		Params.Foliage.AddDefaulted(2);
+		Params.Decals.AddDefaulted(1);
+
+		FForestResolvedAuxiliary& Auxiliary = Params.Auxiliaries.AddDefaulted_GetRef();
+		Auxiliary.Size = EForestAuxiliarySize::Large;
+		Auxiliary.IsolationDistance = 600.0;
+		return Params;
+	}
+
+	int32 GetExpectedCount(const FForestBiomeGenParams& Params, const double DensityPer1000)
+	{
+		using namespace ForestBiomeGeneratorTestConstants;
+		const double AreaTiles = Params.BiomeLengthX * Params.BiomeLengthY / (DensityAreaUnit * DensityAreaUnit);
+		return FMath::RoundToInt32(DensityPer1000 * AreaTiles * Params.GlobalDensityMultiplier);
+	}
+
+	bool ArePlacementsEqual(const TArray<FForestPlacement>& A, const TArray<FForestPlacement>& B)
+	{
+		if (A.Num() != B.Num())
+		{
+			return false;
+		}
+
+		for (int32 Index = 0; Index < A.Num(); ++Index)
+		{
+			if (A[Index].EntryIndex != B[Index].EntryIndex || not A[Index].Position.Equals(B[Index].Position))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/** @return Number of regular tree pairs closer than both radii plus the prop spacing. */
+	int32 CountSpacingViolations(const FForestBiomeGenParams& Params, const TArray<FForestPlacement>& Placements)
+	{
+		using namespace ForestBiomeGeneratorTestConstants;
+
+		int32 Violations = 0;
+		for (int32 Index = 0; Index < Placements.Num(); ++Index)
+		{
+			const FForestPlacement& Placement = Placements[Index];
+			const double Radius = Params.RegularTrees[Placement.EntryIndex].Radius * Placement.UniformScale;
+			for (int32 OtherIndex = Index + 1; OtherIndex < Placements.Num(); ++OtherIndex)
+			{
+				const FForestPlacement& Other = Placements[OtherIndex];
+				const double OtherRadius = Params.RegularTrees[Other.EntryIndex].Radius * Other.UniformScale;
+				const double MinSeparation = Radius + OtherRadius + Params.PropSpacing - SeparationTolerance;
+				if (FVector2D::DistSquared(Placement.Position, Other.Position) < MinSeparation * MinSeparation)
+				{
+					++Violations;
+				}
+			}
+		}
+		return Violations;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FForestBiomeGeneratorBenchmarkTest,
+	"RTS.Procedural.ForestBiome.GeneratorBenchmark",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FForestBiomeGeneratorBenchmarkTest::RunTest(const FString& Parameters)
+{
+	using namespace ForestBiomeGeneratorTestConstants;
+
+	for (const double BiomeLength : BenchmarkBiomeLengths)
+	{
+		const FForestBiomeGenParams Params = MakeDenseParams(BiomeLength);
+
+		FForestBiomeGenResult FirstResult;
+		const double GenerateStart = FPlatformTime::Seconds();
+		FForestBiomeGenerator(Params).Generate(FirstResult);
+		const double GenerateSeconds = FPlatformTime::Seconds() - GenerateStart;
+
+		FForestBiomeGenResult SecondResult;
+		FForestBiomeGenerator(Params).Generate(SecondResult);
+
+		// Tiles run on worker threads; the result must not depend on how they were scheduled.
+		TestTrue(FString::Printf(TEXT("Generation is deterministic for a %.0f biome"), BiomeLength),
+			ArePlacementsEqual(FirstResult.RegularTrees, SecondResult.RegularTrees)
+			&& ArePlacementsEqual(FirstResult.Foliage, SecondResult.Foliage)
+			&& ArePlacementsEqual(FirstResult.Auxiliaries, SecondResult.Auxiliaries));
+
+		// A dense biome with room to spare must reach its density targets instead of running out of attempts.
+		TestEqual(FString::Printf(TEXT("Regular trees reach their target in a %.0f biome"), BiomeLength),
+			FirstResult.RegularTrees.Num(), GetExpectedCount(Params, Params.RegularTreesPer1000));
+		TestEqual(FString::Printf(TEXT("Foliage reaches its target in a %.0f biome"), BiomeLength),
+			FirstResult.Foliage.Num(), GetExpectedCount(Params, Params.FoliagePer1000));
+		TestEqual(FString::Printf(TEXT("Decals reach their target in a %.0f biome"), BiomeLength),
+			FirstResult.Decals.Num(), GetExpectedCount(Params, Params.DecalsPer1000));
+		if (BiomeLength <= BenchmarkBiomeLengths[0])
+		{
+			TestEqual(TEXT("Regular trees keep their spacing across tile borders"),
+				CountSpacingViolations(Params, FirstResult.RegularTrees), 0);
+		}
+
+		AddInfo(FString::Printf(
+			TEXT("%.0f biome: %d large trees, %d trees, %d bushes, %d foliage, %d decals, %d auxiliaries in %.3f ms"),
+			BiomeLength, FirstResult.LargeTrees.Num(), FirstResult.RegularTrees.Num(), FirstResult.Bushes.Num(),
+			FirstResult.Foliage.Num(), FirstResult.Decals.Num(), FirstResult.Auxiliaries.Num(),
+			GenerateSeconds * 1000.0));
+	}
+
+	return not HasAnyErrors();
+}
+
+#endif
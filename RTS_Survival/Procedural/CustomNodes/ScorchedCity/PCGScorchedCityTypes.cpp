@@ -133,47 +133,149 @@ int32 FScorchedSpatialHashGrid::Add(const FScorchedFootprint& Footprint, const E
 
 bool FScorchedSpatialHashGrid::OverlapsAny(const FScorchedFootprint& Footprint, const uint8 TypeMask) const
 {
-	bool bOverlaps = false;
-	// Entries can span multiple cells; remember which were already SAT-tested.
-	TSet<int32> TestedEntries;
+	return OverlapsAny(Footprint, TypeMask, M_QueryScratch);
+}
 
-	ForEachCellOf(Footprint.GetAABB(), [this, &Footprint, TypeMask, &bOverlaps, &TestedEntries](const FIntPoint& Cell)
+bool FScorchedSpatialHashGrid::OverlapsAny(
+	const FScorchedFootprint& Footprint,
+	const uint8 TypeMask,
+	FScorchedSpatialQueryScratch& Scratch) const
+{
+	if (Scratch.TestedEpochByEntry.Num() < M_Entries.Num())
 	{
-		if (bOverlaps)
-		{
-			return;
-		}
+		Scratch.TestedEpochByEntry.SetNumZeroed(M_Entries.Num());
+	}
+
+	++Scratch.Epoch;
+	if (Scratch.Epoch == 0)
+	{
+		// Epoch wrapped around; clear so stale stamps cannot skip entries.
+		FMemory::Memzero(Scratch.TestedEpochByEntry.GetData(), Scratch.TestedEpochByEntry.Num() * sizeof(uint32));
+		Scratch.Epoch = 1;
+	}
 
-		const TArray<int32>* CellEntries = M_Cells.Find(Cell);
-		if (CellEntries == nullptr)
+	// Entries can span multiple cells; the epoch stamp remembers which were already SAT-tested.
+	const FBox2D AABB = Footprint.GetAABB();
+	const FIntPoint MinCell = CellOf(AABB.Min);
+	const FIntPoint MaxCell = CellOf(AABB.Max);
+	for (int32 CellX = MinCell.X; CellX <= MaxCell.X; ++CellX)
+	{
+		for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; ++CellY)
 		{
-			return;
+			const TArray<int32>* CellEntries = M_Cells.Find(FIntPoint(CellX, CellY));
+			if (CellEntries == nullptr)
+			{
+				continue;
+			}
+
+			for (const int32 EntryIndex : *CellEntries)
+			{
+				if (Scratch.TestedEpochByEntry[EntryIndex] == Scratch.Epoch)
+				{
+					continue;
+				}
+				Scratch.TestedEpochByEntry[EntryIndex] = Scratch.Epoch;
+
+				const FEntry& Entry = M_Entries[EntryIndex];
+				if ((ScorchedOccupancyMask(Entry.Type) & TypeMask) == 0)
+				{
+					continue;
+				}
+
+				if (Entry.Footprint.Overlaps(Footprint))
+				{
+					return true;
+				}
+			}
 		}
+	}
+
+	return false;
+}
+
+// ---------------------------------------------------------------------------
+// FScorchedNodeHashGrid
+// ---------------------------------------------------------------------------
+
+FScorchedNodeHashGrid::FScorchedNodeHashGrid(const double InCellSize)
+	: M_CellSize(FMath::Max(100.0, InCellSize))
+{
+}
+
+FIntPoint FScorchedNodeHashGrid::CellOf(const FVector2D& Position) const
+{
+	return FIntPoint(
+		FMath::FloorToInt32(Position.X / M_CellSize),
+		FMath::FloorToInt32(Position.Y / M_CellSize));
+}
 
-		for (const int32 EntryIndex : *CellEntries)
+void FScorchedNodeHashGrid::Add(const int32 NodeIndex, const FVector2D& Position)
+{
+	M_Cells.FindOrAdd(CellOf(Position)).Add(FNodeEntry{NodeIndex, Position});
+}
+
+int32 FScorchedNodeHashGrid::FindLowestIndexWithin(const FVector2D& Position, const double Radius) const
+{
+	const double RadiusSquared = Radius * Radius;
+	const FIntPoint MinCell = CellOf(Position - FVector2D(Radius));
+	const FIntPoint MaxCell = CellOf(Position + FVector2D(Radius));
+
+	int32 LowestIndex = INDEX_NONE;
+	for (int32 CellX = MinCell.X; CellX <= MaxCell.X; ++CellX)
+	{
+		for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; ++CellY)
 		{
-			bool bAlreadyTested = false;
-			TestedEntries.Add(EntryIndex, &bAlreadyTested);
-			if (bAlreadyTested)
+			const TArray<FNodeEntry>* CellNodes = M_Cells.Find(FIntPoint(CellX, CellY));
+			if (CellNodes == nullptr)
 			{
 				continue;
 			}
 
-			const FEntry& Entry = M_Entries[EntryIndex];
-			if ((ScorchedOccupancyMask(Entry.Type) & TypeMask) == 0)
+			for (const FNodeEntry& Node : *CellNodes)
+			{
+				if ((LowestIndex == INDEX_NONE || Node.NodeIndex < LowestIndex)
+					&& FVector2D::DistSquared(Node.Position, Position) <= RadiusSquared)
+				{
+					LowestIndex = Node.NodeIndex;
+				}
+			}
+		}
+	}
+	return LowestIndex;
+}
+
+int32 FScorchedNodeHashGrid::FindNearest(const FVector2D& Position, const double Radius) const
+{
+	const FIntPoint MinCell = CellOf(Position - FVector2D(Radius));
+	const FIntPoint MaxCell = CellOf(Position + FVector2D(Radius));
+
+	int32 NearestIndex = INDEX_NONE;
+	double NearestDistanceSquared = Radius * Radius;
+	for (int32 CellX = MinCell.X; CellX <= MaxCell.X; ++CellX)
+	{
+		for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; ++CellY)
+		{
+			const TArray<FNodeEntry>* CellNodes = M_Cells.Find(FIntPoint(CellX, CellY));
+			if (CellNodes == nullptr)
 			{
 				continue;
 			}
 
-			if (Entry.Footprint.Overlaps(Footprint))
+			for (const FNodeEntry& Node : *CellNodes)
 			{
-				bOverlaps = true;
-				return;
+				const double DistanceSquared = FVector2D::DistSquared(Node.Position, Position);
+				const bool bCloser = DistanceSquared < NearestDistanceSquared
+					|| (DistanceSquared == NearestDistanceSquared
+						&& (NearestIndex == INDEX_NONE || Node.NodeIndex > NearestIndex));
+				if (bCloser)
+				{
+					NearestDistanceSquared = DistanceSquared;
+					NearestIndex = Node.NodeIndex;
+				}
 			}
 		}
-	});
-
-	return bOverlaps;
+	}
+	return NearestIndex;
 }
 
 // ---------------------------------------------------------------------------
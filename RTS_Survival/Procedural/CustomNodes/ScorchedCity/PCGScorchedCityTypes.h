@@ -432,6 +432,17 @@ struct FScorchedFootprint
 	bool Overlaps(const FScorchedFootprint& Other) const;
 };
 
+/**
+ * @brief De-duplication scratch for FScorchedSpatialHashGrid queries: entries spanning several
+ * cells are SAT-tested once per query by comparing their stamp with the query epoch, so no
+ * set is allocated per query. Each thread querying the grid concurrently owns one.
+ */
+struct FScorchedSpatialQueryScratch
+{
+	TArray<uint32> TestedEpochByEntry;
+	uint32 Epoch = 0;
+};
+
 /**
  * @brief Spatial hash grid over occupancy footprints so overlap queries stay O(local) even for
  * very large cities. Cells map to entry indices; queries SAT-test only nearby footprints.
@@ -448,9 +459,17 @@ public:
 	 * @param Footprint Candidate, already inflated by whatever spacing the caller requires.
 	 * @param TypeMask Bitmask built from ScorchedOccupancyMask().
 	 * @return True if any masked footprint overlaps the candidate.
+	 * @note Uses the grid's own scratch; not safe to call from several threads at once.
 	 */
 	bool OverlapsAny(const FScorchedFootprint& Footprint, uint8 TypeMask) const;
 
+	/**
+	 * @brief Same test with caller-owned scratch, for read-only queries from parallel workers.
+	 * The grid must not be modified while any such query runs.
+	 */
+	bool OverlapsAny(const FScorchedFootprint& Footprint, uint8 TypeMask,
+		FScorchedSpatialQueryScratch& Scratch) const;
+
 	struct FEntry
 	{
 		FScorchedFootprint Footprint;
@@ -463,11 +482,42 @@ private:
 	double M_CellSize = 1000.0;
 	TArray<FEntry> M_Entries;
 	TMap<FIntPoint, TArray<int32>> M_Cells;
+	mutable FScorchedSpatialQueryScratch M_QueryScratch;
 
 	FIntPoint CellOf(const FVector2D& Position) const;
 	void ForEachCellOf(const FBox2D& AABB, TFunctionRef<void(const FIntPoint&)> Visitor) const;
 };
 
+/**
+ * @brief Spatial hash over road node positions so nearest-node and snap queries of the road
+ * walkers only visit nearby nodes. Results match a linear scan over the node array.
+ */
+class FScorchedNodeHashGrid
+{
+public:
+	explicit FScorchedNodeHashGrid(double InCellSize);
+
+	void Add(int32 NodeIndex, const FVector2D& Position);
+
+	/** @return Lowest node index within Radius (the first hit of a linear scan); INDEX_NONE if none. */
+	int32 FindLowestIndexWithin(const FVector2D& Position, double Radius) const;
+
+	/** @return Closest node within Radius, ties resolving to the higher index; INDEX_NONE if none. */
+	int32 FindNearest(const FVector2D& Position, double Radius) const;
+
+private:
+	struct FNodeEntry
+	{
+		int32 NodeIndex = INDEX_NONE;
+		FVector2D Position = FVector2D::ZeroVector;
+	};
+
+	double M_CellSize = 1000.0;
+	TMap<FIntPoint, TArray<FNodeEntry>> M_Cells;
+
+	FIntPoint CellOf(const FVector2D& Position) const;
+};
+
 // ---------------------------------------------------------------------------
 // Road network / lot / result types.
 // ---------------------------------------------------------------------------
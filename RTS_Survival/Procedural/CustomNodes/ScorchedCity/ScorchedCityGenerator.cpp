@@ -2,6 +2,7 @@
 #include "ScorchedCityGenerator.h"
 
 #include "Algo/Reverse.h"
+#include "Async/ParallelFor.h"
 
 namespace ScorchedCityGenConstants
 {
@@ -78,6 +79,38 @@ namespace ScorchedCityGenConstants
 	// Both endings must roughly face each other for the connection to look natural.
 	constexpr double OrphanConnectMinFacingDot = 0.15;
 	constexpr int32 OrphanCurveMaxPoints = 16;
+
+	// Salts for the streams derived per parallel work item (building blocks, scatter per building).
+	constexpr int32 BuildingBlockStreamSalt = 303;
+	constexpr int32 ScatterStreamSalt = 404;
+	// Lot AABBs grow by this fraction of the building spacing reach when grouping independent
+	// blocks; covers the AABB of a rotated inflation on both lots (>= sqrt(2) / 2).
+	constexpr double LotBlockReachFraction = 0.75;
+}
+
+namespace
+{
+	bool OverlapsAnyFootprint(const FScorchedFootprint& Candidate, TConstArrayView<FScorchedFootprint> Footprints)
+	{
+		for (const FScorchedFootprint& Footprint : Footprints)
+		{
+			if (Footprint.Overlaps(Candidate))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	int32 FindLotBlockRoot(TArray<int32>& Parents, int32 LotIndex)
+	{
+		while (Parents[LotIndex] != LotIndex)
+		{
+			Parents[LotIndex] = Parents[Parents[LotIndex]];
+			LotIndex = Parents[LotIndex];
+		}
+		return LotIndex;
+	}
 }
 
 FScorchedCityGenerator::FScorchedCityGenerator(const FScorchedCityGenParams& InParams)
@@ -85,6 +118,7 @@ FScorchedCityGenerator::FScorchedCityGenerator(const FScorchedCityGenParams& InP
 	, M_Random(InParams.RandomSeed)
 	, M_Occupancy(FMath::Clamp(InParams.GridBlockSize * 0.5, 800.0, 3000.0))
 	, M_DecalOccupancy(FMath::Clamp(InParams.GridBlockSize * 0.25, 400.0, 1500.0))
+	, M_NodeGrid(FMath::Clamp(InParams.GridBlockSize * 0.5, 400.0, 3000.0))
 {
 }
 
@@ -157,6 +191,12 @@ double FScorchedCityGenerator::CellNoise(const int32 Salt, const FIntPoint& Cell
 	return FRandomStream(static_cast<int32>(Hash)).FRand();
 }
 
+FRandomStream FScorchedCityGenerator::MakeDerivedStream(const int32 Salt, const int32 WorkIndex) const
+{
+	const uint32 Hash = HashCombine(GetTypeHash(M_Params.RandomSeed + Salt), GetTypeHash(WorkIndex));
+	return FRandomStream(static_cast<int32>(Hash));
+}
+
 bool FScorchedCityGenerator::SamplePolyline(
 	const TArray<FVector2D>& Points,
 	const double Distance,
@@ -248,37 +288,31 @@ bool FScorchedCityGenerator::IsDenseAt(const FVector2D& Position) const
 // Road network core
 // ---------------------------------------------------------------------------
 
+int32 FScorchedCityGenerator::AddNode(const FScorchedRoadNode& Node)
+{
+	// Node positions never move after creation, so the node grid only ever needs inserts.
+	const int32 NodeIndex = M_Nodes.Add(Node);
+	M_NodeGrid.Add(NodeIndex, Node.Position);
+	return NodeIndex;
+}
+
 int32 FScorchedCityGenerator::FindOrAddNode(const FVector2D& Position, const double SnapRadius, const bool bGridNode)
 {
-	for (int32 NodeIndex = 0; NodeIndex < M_Nodes.Num(); ++NodeIndex)
+	const int32 ExistingNode = M_NodeGrid.FindLowestIndexWithin(Position, SnapRadius);
+	if (ExistingNode != INDEX_NONE)
 	{
-		if (FVector2D::DistSquared(M_Nodes[NodeIndex].Position, Position) <= SnapRadius * SnapRadius)
-		{
-			return NodeIndex;
-		}
+		return ExistingNode;
 	}
 
 	FScorchedRoadNode Node;
 	Node.Position = Position;
 	Node.bGridNode = bGridNode;
-	return M_Nodes.Add(Node);
+	return AddNode(Node);
 }
 
 int32 FScorchedCityGenerator::FindNearestNode(const FVector2D& Position, const double SearchRadius) const
 {
-	int32 NearestNode = INDEX_NONE;
-	double NearestDistanceSquared = SearchRadius * SearchRadius;
-
-	for (int32 NodeIndex = 0; NodeIndex < M_Nodes.Num(); ++NodeIndex)
-	{
-		const double DistanceSquared = FVector2D::DistSquared(M_Nodes[NodeIndex].Position, Position);
-		if (DistanceSquared <= NearestDistanceSquared)
-		{
-			NearestDistanceSquared = DistanceSquared;
-			NearestNode = NodeIndex;
-		}
-	}
-	return NearestNode;
+	return M_NodeGrid.FindNearest(Position, SearchRadius);
 }
 
 int32 FScorchedCityGenerator::CommitEdge(
@@ -407,7 +441,7 @@ void FScorchedCityGenerator::BuildGridRoads()
 				FScorchedRoadNode Node;
 				Node.Position = Position;
 				Node.bGridNode = true;
-				CrossingToNode.Add(FIntPoint(LatticeX, LatticeY), M_Nodes.Add(Node));
+				CrossingToNode.Add(FIntPoint(LatticeX, LatticeY), AddNode(Node));
 			}
 		}
 	}
@@ -837,12 +871,12 @@ void FScorchedCityGenerator::SmoothCornerNodes()
 		// Pull both streets back and bridge them with the curved fillet edge.
 		FScorchedRoadNode NewNodeA;
 		NewNodeA.Position = CornerStart;
-		const int32 NewNodeAIndex = M_Nodes.Add(NewNodeA);
+		const int32 NewNodeAIndex = AddNode(NewNodeA);
 		RetargetEdgeEndpoint(EdgeAIndex, NodeIndex, NewNodeAIndex, CornerStart);
 
 		FScorchedRoadNode NewNodeB;
 		NewNodeB.Position = CornerEnd;
-		const int32 NewNodeBIndex = M_Nodes.Add(NewNodeB);
+		const int32 NewNodeBIndex = AddNode(NewNodeB);
 		RetargetEdgeEndpoint(EdgeBIndex, NodeIndex, NewNodeBIndex, CornerEnd);
 
 		M_Nodes[NodeIndex].Edges.Reset();
@@ -1096,13 +1130,28 @@ void FScorchedCityGenerator::ExportOpenIntersectionArms(FScorchedCityGenResult&
 
 void FScorchedCityGenerator::BuildLots()
 {
-	for (int32 EdgeIndex = 0; EdgeIndex < M_Edges.Num(); ++EdgeIndex)
+	// Lot creation only reads road occupancy, so edges are independent; concatenating per-edge
+	// results in edge order keeps the lot array identical to a serial pass.
+	TArray<TArray<FScorchedLot>> LotsByEdge;
+	LotsByEdge.SetNum(M_Edges.Num());
+	TArray<FScorchedSpatialQueryScratch> ScratchPerTask;
+	ParallelForWithTaskContext(ScratchPerTask, M_Edges.Num(),
+		[this, &LotsByEdge](FScorchedSpatialQueryScratch& Scratch, const int32 EdgeIndex)
+		{
+			BuildLotsAlongEdge(EdgeIndex, Scratch, LotsByEdge[EdgeIndex]);
+		},
+		EParallelForFlags::Unbalanced);
+
+	for (TArray<FScorchedLot>& EdgeLots : LotsByEdge)
 	{
-		BuildLotsAlongEdge(EdgeIndex);
+		M_Lots.Append(MoveTemp(EdgeLots));
 	}
 }
 
-void FScorchedCityGenerator::BuildLotsAlongEdge(const int32 EdgeIndex)
+void FScorchedCityGenerator::BuildLotsAlongEdge(
+	const int32 EdgeIndex,
+	FScorchedSpatialQueryScratch& Scratch,
+	TArray<FScorchedLot>& OutLots) const
 {
 	using namespace ScorchedCityGenConstants;
 
@@ -1129,8 +1178,8 @@ void FScorchedCityGenerator::BuildLotsAlongEdge(const int32 EdgeIndex)
 			FVector2D RoadDirection;
 			if (SamplePolyline(Edge.Points, StartClearance + UsableSpan * 0.5, RoadPoint, RoadDirection))
 			{
-				TryCreateLot(EdgeIndex, RoadPoint, RoadDirection, 1.0, UsableSpan);
-				TryCreateLot(EdgeIndex, RoadPoint, RoadDirection, -1.0, UsableSpan);
+				TryCreateLot(EdgeIndex, RoadPoint, RoadDirection, 1.0, UsableSpan, Scratch, OutLots);
+				TryCreateLot(EdgeIndex, RoadPoint, RoadDirection, -1.0, UsableSpan, Scratch, OutLots);
 			}
 		}
 		return;
@@ -1146,8 +1195,8 @@ void FScorchedCityGenerator::BuildLotsAlongEdge(const int32 EdgeIndex)
 			break;
 		}
 
-		TryCreateLot(EdgeIndex, RoadPoint, RoadDirection, 1.0, FullLotWidth);
-		TryCreateLot(EdgeIndex, RoadPoint, RoadDirection, -1.0, FullLotWidth);
+		TryCreateLot(EdgeIndex, RoadPoint, RoadDirection, 1.0, FullLotWidth, Scratch, OutLots);
+		TryCreateLot(EdgeIndex, RoadPoint, RoadDirection, -1.0, FullLotWidth, Scratch, OutLots);
 
 		ArcDistance += FullLotWidth * (1.0 + LotGapFraction);
 	}
@@ -1158,7 +1207,9 @@ void FScorchedCityGenerator::TryCreateLot(
 	const FVector2D& RoadPoint,
 	const FVector2D& RoadDirection,
 	const double Side,
-	const double LotWidth)
+	const double LotWidth,
+	FScorchedSpatialQueryScratch& Scratch,
+	TArray<FScorchedLot>& OutLots) const
 {
 	using namespace ScorchedCityGenConstants;
 
@@ -1199,12 +1250,12 @@ void FScorchedCityGenerator::TryCreateLot(
 	// Reject lots that clip other roads (e.g. the far side of a block or a curved road).
 	const uint8 RoadMask = ScorchedOccupancyMask(EScorchedOccupancy::Road)
 		| ScorchedOccupancyMask(EScorchedOccupancy::Intersection);
-	if (M_Occupancy.OverlapsAny(LotFootprint.Inflated(-M_Params.RoadWidth * 0.25), RoadMask))
+	if (M_Occupancy.OverlapsAny(LotFootprint.Inflated(-M_Params.RoadWidth * 0.25), RoadMask, Scratch))
 	{
 		return;
 	}
 
-	M_Lots.Add(Lot);
+	OutLots.Add(Lot);
 }
 
 // ---------------------------------------------------------------------------
@@ -1247,7 +1298,7 @@ double FScorchedCityGenerator::ComputeBuildingWeightForLot(
 	return static_cast<double>(Building.Weight) * ZoneMultiplier * SizeMultiplier;
 }
 
-int32 FScorchedCityGenerator::PickWeightedBuildingForLot(const FScorchedLot& Lot)
+int32 FScorchedCityGenerator::PickWeightedBuildingForLot(const FScorchedLot& Lot, FRandomStream& Random) const
 {
 	double TotalWeight = 0.0;
 	TArray<double, TInlineAllocator<32>> Weights;
@@ -1265,7 +1316,7 @@ int32 FScorchedCityGenerator::PickWeightedBuildingForLot(const FScorchedLot& Lot
 		return INDEX_NONE;
 	}
 
-	double Pick = M_Random.FRand() * TotalWeight;
+	double Pick = Random.FRand() * TotalWeight;
 	for (int32 BuildingIndex = 0; BuildingIndex < Weights.Num(); ++BuildingIndex)
 	{
 		Pick -= Weights[BuildingIndex];
@@ -1280,7 +1331,10 @@ int32 FScorchedCityGenerator::PickWeightedBuildingForLot(const FScorchedLot& Lot
 bool FScorchedCityGenerator::TryPlaceBuildingOnLot(
 	const FScorchedLot& Lot,
 	const FScorchedResolvedBuilding& Building,
-	FScorchedBuildingSpawn& OutSpawn)
+	FRandomStream& Random,
+	FScorchedSpatialQueryScratch& Scratch,
+	TConstArrayView<FScorchedFootprint> PendingBuildings,
+	FScorchedBuildingSpawn& OutSpawn) const
 {
 	using namespace ScorchedCityGenConstants;
 
@@ -1295,7 +1349,7 @@ bool FScorchedCityGenerator::TryPlaceBuildingOnLot(
 			for (int32 StepIndex = 0; StepIndex < 8; ++StepIndex) { YawOffsets.Add(StepIndex * PI * 0.25); }
 			break;
 		case EScorchedBuildingRotationMode::RandomYaw:
-			for (int32 RandomIndex = 0; RandomIndex < 3; ++RandomIndex) { YawOffsets.Add(M_Random.FRand() * 2.0 * PI); }
+			for (int32 RandomIndex = 0; RandomIndex < 3; ++RandomIndex) { YawOffsets.Add(Random.FRand() * 2.0 * PI); }
 			break;
 		default:
 			YawOffsets.Add(0.0);
@@ -1304,7 +1358,7 @@ bool FScorchedCityGenerator::TryPlaceBuildingOnLot(
 	// Deterministic shuffle so variety does not always prefer the first offset.
 	for (int32 ShuffleIndex = YawOffsets.Num() - 1; ShuffleIndex > 0; --ShuffleIndex)
 	{
-		YawOffsets.Swap(ShuffleIndex, M_Random.RandRange(0, ShuffleIndex));
+		YawOffsets.Swap(ShuffleIndex, Random.RandRange(0, ShuffleIndex));
 	}
 
 	const FVector2D FacingDirection(FMath::Cos(Lot.FacingYawRadians), FMath::Sin(Lot.FacingYawRadians));
@@ -1331,7 +1385,7 @@ bool FScorchedCityGenerator::TryPlaceBuildingOnLot(
 		}
 
 		const double Spacing = M_Params.BuildingSpacingExtra
-			+ M_Random.FRandRange(Building.MinSpacing, Building.MaxSpacing);
+			+ Random.FRandRange(Building.MinSpacing, Building.MaxSpacing);
 		const double MaxLateralJitter = (Lot.HalfExtents.X - SideExtent) * 0.8;
 
 		for (int32 Attempt = 0; Attempt < JitterAttemptsPerPick; ++Attempt)
@@ -1339,7 +1393,7 @@ bool FScorchedCityGenerator::TryPlaceBuildingOnLot(
 			// Push the building to the road-facing front of the lot, jitter sideways.
 			const double LateralJitter = (Attempt == 0)
 				? 0.0
-				: M_Random.FRandRange(-MaxLateralJitter, MaxLateralJitter);
+				: Random.FRandRange(-MaxLateralJitter, MaxLateralJitter);
 			Footprint.Center = Lot.Center
 				+ FacingDirection * (Lot.HalfExtents.Y - FrontExtent)
 				+ LateralDirection * LateralJitter;
@@ -1348,11 +1402,13 @@ bool FScorchedCityGenerator::TryPlaceBuildingOnLot(
 			{
 				continue;
 			}
-			if (M_Occupancy.OverlapsAny(Footprint, RoadMask))
+			if (M_Occupancy.OverlapsAny(Footprint, RoadMask, Scratch))
 			{
 				continue;
 			}
-			if (M_Occupancy.OverlapsAny(Footprint.Inflated(Spacing), SpacingMask))
+			const FScorchedFootprint SpacedFootprint = Footprint.Inflated(Spacing);
+			if (M_Occupancy.OverlapsAny(SpacedFootprint, SpacingMask, Scratch)
+				|| OverlapsAnyFootprint(SpacedFootprint, PendingBuildings))
 			{
 				continue;
 			}
@@ -1402,34 +1458,64 @@ void FScorchedCityGenerator::PlaceBuildings(FScorchedCityGenResult& OutResult)
 		return LotA.bCorner && not LotB.bCorner;
 	});
 
+	// Blocks cannot see each other's buildings, so each only tests its own pending footprints;
+	// spawns are committed afterwards in LotOrder so the output does not depend on scheduling.
+	const TArray<TArray<int32>> LotBlocks = BuildIndependentLotBlocks(LotOrder);
+	TArray<FScorchedBuildingSpawn> SpawnByLot;
+	SpawnByLot.SetNum(M_Lots.Num());
+	TArray<FScorchedSpatialQueryScratch> ScratchPerTask;
+	ParallelForWithTaskContext(ScratchPerTask, LotBlocks.Num(),
+		[this, &LotBlocks, &SpawnByLot](FScorchedSpatialQueryScratch& Scratch, const int32 BlockIndex)
+		{
+			const TArray<int32>& BlockLots = LotBlocks[BlockIndex];
+			FRandomStream BlockRandom = MakeDerivedStream(BuildingBlockStreamSalt, BlockLots[0]);
+			TArray<FScorchedFootprint, TInlineAllocator<32>> BlockBuildings;
+			for (const int32 LotIndex : BlockLots)
+			{
+				FScorchedLot& Lot = M_Lots[LotIndex];
+
+				// Density gate: dense zones fill most lots, sparse zones leave gaps.
+				const double UseChance = FMath::Clamp(
+					M_Params.OverallDensity
+					* (Lot.bDense ? DenseZoneLotChanceMultiplier : SparseZoneLotChanceMultiplier),
+					0.0, 1.0);
+				if (BlockRandom.FRand() > UseChance)
+				{
+					continue;
+				}
+
+				FScorchedBuildingSpawn& Spawn = SpawnByLot[LotIndex];
+				if (TryFillLotWithAnyBuilding(Lot, BlockRandom, Scratch, BlockBuildings, Spawn))
+				{
+					BlockBuildings.Add(Spawn.Footprint);
+					Lot.bUsed = true;
+				}
+			}
+		},
+		EParallelForFlags::Unbalanced);
+
 	TSet<int32> EdgesWithBuilding;
 	for (const int32 LotIndex : LotOrder)
 	{
-		FScorchedLot& Lot = M_Lots[LotIndex];
-
-		// Density gate: dense zones fill most lots, sparse zones leave gaps.
-		const double UseChance = FMath::Clamp(
-			M_Params.OverallDensity
-			* (Lot.bDense ? DenseZoneLotChanceMultiplier : SparseZoneLotChanceMultiplier),
-			0.0, 1.0);
-		if (M_Random.FRand() > UseChance)
+		if (not M_Lots[LotIndex].bUsed)
 		{
 			continue;
 		}
 
-		if (TryFillLotWithAnyBuilding(Lot, OutResult))
-		{
-			EdgesWithBuilding.Add(Lot.EdgeIndex);
-		}
+		M_Occupancy.Add(SpawnByLot[LotIndex].Footprint, EScorchedOccupancy::Building);
+		OutResult.Buildings.Add(SpawnByLot[LotIndex]);
+		EdgesWithBuilding.Add(M_Lots[LotIndex].EdgeIndex);
 	}
 
 	// Guarantee pass: the density gate can randomly skip every lot of a block, leaving whole
 	// squares empty. At moderate densities, force at least one building per street that has
 	// lots, so identical blocks never differ between "filled" and "completely empty".
+	// Streets span two blocks (one per side), so this pass stays serial on the main stream.
 	if (M_Params.OverallDensity < MinDensityForEdgeFill)
 	{
 		return;
 	}
+	FScorchedSpatialQueryScratch Scratch;
 	for (const int32 LotIndex : LotOrder)
 	{
 		FScorchedLot& Lot = M_Lots[LotIndex];
@@ -1438,35 +1524,110 @@ void FScorchedCityGenerator::PlaceBuildings(FScorchedCityGenResult& OutResult)
 			continue;
 		}
 
-		if (TryFillLotWithAnyBuilding(Lot, OutResult))
+		FScorchedBuildingSpawn Spawn;
+		if (TryFillLotWithAnyBuilding(Lot, M_Random, Scratch, {}, Spawn))
 		{
+			M_Occupancy.Add(Spawn.Footprint, EScorchedOccupancy::Building);
+			OutResult.Buildings.Add(Spawn);
+			Lot.bUsed = true;
 			EdgesWithBuilding.Add(Lot.EdgeIndex);
 		}
 	}
 }
 
-bool FScorchedCityGenerator::TryFillLotWithAnyBuilding(FScorchedLot& Lot, FScorchedCityGenResult& OutResult)
+TArray<TArray<int32>> FScorchedCityGenerator::BuildIndependentLotBlocks(const TArray<int32>& LotOrder) const
+{
+	using namespace ScorchedCityGenConstants;
+
+	// Buildings stay inside their lot, and the widest spacing test inflates a candidate by
+	// BuildingSpacingExtra + MaxSpacing, so lots farther apart than that can never interact.
+	double MaxSpacing = 0.0;
+	for (const FScorchedResolvedBuilding& Building : M_Params.Buildings)
+	{
+		MaxSpacing = FMath::Max3(MaxSpacing, static_cast<double>(Building.MinSpacing),
+			static_cast<double>(Building.MaxSpacing));
+	}
+	const double AABBGrowth = FMath::Max(0.0, M_Params.BuildingSpacingExtra + MaxSpacing) * LotBlockReachFraction;
+	const double CellSize = FMath::Max(100.0, M_Params.GridBlockSize * 0.5);
+
+	TArray<FBox2D> LotBounds;
+	LotBounds.Reserve(M_Lots.Num());
+	TArray<int32> Parents;
+	Parents.Reserve(M_Lots.Num());
+	TMap<FIntPoint, TArray<int32>> LotsByCell;
+	for (int32 LotIndex = 0; LotIndex < M_Lots.Num(); ++LotIndex)
+	{
+		const FScorchedLot& Lot = M_Lots[LotIndex];
+		FScorchedFootprint LotFootprint;
+		LotFootprint.Center = Lot.Center;
+		LotFootprint.HalfExtents = Lot.HalfExtents;
+		LotFootprint.YawRadians = Lot.YawRadians;
+		const FBox2D Bounds = LotFootprint.GetAABB().ExpandBy(AABBGrowth);
+		LotBounds.Add(Bounds);
+		Parents.Add(LotIndex);
+
+		const FIntPoint MinCell(
+			FMath::FloorToInt32(Bounds.Min.X / CellSize),
+			FMath::FloorToInt32(Bounds.Min.Y / CellSize));
+		const FIntPoint MaxCell(
+			FMath::FloorToInt32(Bounds.Max.X / CellSize),
+			FMath::FloorToInt32(Bounds.Max.Y / CellSize));
+		for (int32 CellX = MinCell.X; CellX <= MaxCell.X; ++CellX)
+		{
+			for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; ++CellY)
+			{
+				TArray<int32>& CellLots = LotsByCell.FindOrAdd(FIntPoint(CellX, CellY));
+				for (const int32 OtherLotIndex : CellLots)
+				{
+					if (LotBounds[OtherLotIndex].Intersect(Bounds))
+					{
+						Parents[FindLotBlockRoot(Parents, OtherLotIndex)] = FindLotBlockRoot(Parents, LotIndex);
+					}
+				}
+				CellLots.Add(LotIndex);
+			}
+		}
+	}
+
+	// Blocks are ordered by their first lot in LotOrder, lots inside a block keep LotOrder.
+	TArray<TArray<int32>> Blocks;
+	TMap<int32, int32> BlockByRoot;
+	for (const int32 LotIndex : LotOrder)
+	{
+		const int32 Root = FindLotBlockRoot(Parents, LotIndex);
+		const int32* ExistingBlock = BlockByRoot.Find(Root);
+		const int32 BlockIndex = ExistingBlock != nullptr
+			? *ExistingBlock
+			: BlockByRoot.Add(Root, Blocks.AddDefaulted());
+		Blocks[BlockIndex].Add(LotIndex);
+	}
+	return Blocks;
+}
+
+bool FScorchedCityGenerator::TryFillLotWithAnyBuilding(
+	const FScorchedLot& Lot,
+	FRandomStream& Random,
+	FScorchedSpatialQueryScratch& Scratch,
+	TConstArrayView<FScorchedFootprint> PendingBuildings,
+	FScorchedBuildingSpawn& OutSpawn) const
 {
 	using namespace ScorchedCityGenConstants;
 
 	for (int32 PickIndex = 0; PickIndex < BuildingPicksPerLot; ++PickIndex)
 	{
-		const int32 BuildingIndex = PickWeightedBuildingForLot(Lot);
+		const int32 BuildingIndex = PickWeightedBuildingForLot(Lot, Random);
 		if (BuildingIndex == INDEX_NONE)
 		{
 			break;
 		}
 
-		FScorchedBuildingSpawn Spawn;
-		if (not TryPlaceBuildingOnLot(Lot, M_Params.Buildings[BuildingIndex], Spawn))
+		if (not TryPlaceBuildingOnLot(Lot, M_Params.Buildings[BuildingIndex], Random, Scratch, PendingBuildings,
+			OutSpawn))
 		{
 			continue;
 		}
 
-		Spawn.AssetIndex = BuildingIndex;
-		M_Occupancy.Add(Spawn.Footprint, EScorchedOccupancy::Building);
-		OutResult.Buildings.Add(Spawn);
-		Lot.bUsed = true;
+		OutSpawn.AssetIndex = BuildingIndex;
 		return true;
 	}
 	return false;
@@ -1971,26 +2132,44 @@ void FScorchedCityGenerator::BuildScatter(
 	const FScorchedCityGenResult& ResultSoFar,
 	FScorchedCityGenResult& OutResult)
 {
+	using namespace ScorchedCityGenConstants;
+
+	// Scatter only reads occupancy, so buildings are independent; appending per-building results
+	// in building order keeps the output independent of scheduling.
 	const int32 NumBuildings = ResultSoFar.Buildings.Num();
-	for (int32 BuildingIndex = 0; BuildingIndex < NumBuildings; ++BuildingIndex)
+	TArray<TArray<FScorchedScatterCandidate>> ScatterByBuilding;
+	ScatterByBuilding.SetNum(NumBuildings);
+	TArray<FScorchedSpatialQueryScratch> ScratchPerTask;
+	ParallelForWithTaskContext(ScratchPerTask, NumBuildings,
+		[this, &ResultSoFar, &ScatterByBuilding](FScorchedSpatialQueryScratch& Scratch, const int32 BuildingIndex)
+		{
+			FRandomStream BuildingRandom = MakeDerivedStream(ScatterStreamSalt, BuildingIndex);
+			for (int32 ProfileIndex = 0; ProfileIndex < M_Params.ScatterProfiles.Num(); ++ProfileIndex)
+			{
+				BuildScatterForBuilding(ResultSoFar.Buildings[BuildingIndex], ProfileIndex, BuildingRandom, Scratch,
+					ScatterByBuilding[BuildingIndex]);
+			}
+		},
+		EParallelForFlags::Unbalanced);
+
+	for (TArray<FScorchedScatterCandidate>& BuildingScatter : ScatterByBuilding)
 	{
-		for (int32 ProfileIndex = 0; ProfileIndex < M_Params.ScatterProfiles.Num(); ++ProfileIndex)
-		{
-			BuildScatterForBuilding(ResultSoFar.Buildings[BuildingIndex], ProfileIndex, OutResult);
-		}
+		OutResult.Scatter.Append(MoveTemp(BuildingScatter));
 	}
 }
 
 void FScorchedCityGenerator::BuildScatterForBuilding(
 	const FScorchedBuildingSpawn& Building,
 	const int32 ProfileIndex,
-	FScorchedCityGenResult& OutResult)
+	FRandomStream& Random,
+	FScorchedSpatialQueryScratch& Scratch,
+	TArray<FScorchedScatterCandidate>& OutScatter) const
 {
 	using namespace ScorchedCityGenConstants;
 
 	const FScorchedScatterProfile& Profile = M_Params.ScatterProfiles[ProfileIndex];
 	const TArray<double>& MeshRadii = M_Params.ScatterMeshRadii[ProfileIndex];
-	if (Profile.Meshes.IsEmpty() || M_Random.FRand() > Profile.ChancePerBuilding)
+	if (Profile.Meshes.IsEmpty() || Random.FRand() > Profile.ChancePerBuilding)
 	{
 		return;
 	}
@@ -1999,20 +2178,20 @@ void FScorchedCityGenerator::BuildScatterForBuilding(
 		? DenseZoneScatterMultiplier
 		: SparseZoneScatterMultiplier;
 	const int32 Count = FMath::RoundToInt32(
-		Profile.MeshesPerBuilding * ZoneMultiplier * M_Random.FRandRange(0.7, 1.3));
+		Profile.MeshesPerBuilding * ZoneMultiplier * Random.FRandRange(0.7, 1.3));
 
 	// Optional clustering: group samples around a few ring positions instead of a uniform ring.
-	const bool bClustered = M_Random.FRand() < Profile.ClusterAmount;
+	const bool bClustered = Random.FRand() < Profile.ClusterAmount;
 	TArray<FVector2D, TInlineAllocator<4>> ClusterCenters;
 	if (bClustered)
 	{
 		const int32 NumClusters = FMath::Clamp(1 + Count / 5, 1, 4);
 		for (int32 ClusterIndex = 0; ClusterIndex < NumClusters; ++ClusterIndex)
 		{
-			const double Angle = M_Random.FRand() * 2.0 * PI;
+			const double Angle = Random.FRand() * 2.0 * PI;
 			const FVector2D RingDirection(FMath::Cos(Angle), FMath::Sin(Angle));
 			const double EdgeDistance = Building.Footprint.SupportRadius(RingDirection)
-				+ M_Random.FRandRange(Profile.MinDistanceFromBuildingBounds, Profile.MaxDistanceFromBuildingBounds);
+				+ Random.FRandRange(Profile.MinDistanceFromBuildingBounds, Profile.MaxDistanceFromBuildingBounds);
 			ClusterCenters.Add(Building.Footprint.Center + RingDirection * EdgeDistance);
 		}
 	}
@@ -2044,21 +2223,21 @@ void FScorchedCityGenerator::BuildScatterForBuilding(
 		if (bClustered)
 		{
 			const FVector2D& ClusterCenter = ClusterCenters[SampleIndex % ClusterCenters.Num()];
-			const double Angle = M_Random.FRand() * 2.0 * PI;
+			const double Angle = Random.FRand() * 2.0 * PI;
 			SamplePosition = ClusterCenter
-				+ FVector2D(FMath::Cos(Angle), FMath::Sin(Angle)) * (M_Random.FRand() * Profile.ClusterRadius);
+				+ FVector2D(FMath::Cos(Angle), FMath::Sin(Angle)) * (Random.FRand() * Profile.ClusterRadius);
 		}
 		else
 		{
-			const double Angle = M_Random.FRand() * 2.0 * PI;
+			const double Angle = Random.FRand() * 2.0 * PI;
 			const FVector2D RingDirection(FMath::Cos(Angle), FMath::Sin(Angle));
 			const double EdgeDistance = Building.Footprint.SupportRadius(RingDirection)
-				+ M_Random.FRandRange(Profile.MinDistanceFromBuildingBounds, Profile.MaxDistanceFromBuildingBounds);
+				+ Random.FRandRange(Profile.MinDistanceFromBuildingBounds, Profile.MaxDistanceFromBuildingBounds);
 			SamplePosition = Building.Footprint.Center + RingDirection * EdgeDistance;
 		}
 
 		// Weighted mesh pick.
-		double MeshPick = M_Random.FRand() * TotalMeshWeight;
+		double MeshPick = Random.FRand() * TotalMeshWeight;
 		int32 MeshIndex = 0;
 		for (int32 EntryIndex = 0; EntryIndex < Profile.Meshes.Num(); ++EntryIndex)
 		{
@@ -2070,7 +2249,7 @@ void FScorchedCityGenerator::BuildScatterForBuilding(
 			}
 		}
 
-		const double Scale = M_Random.FRandRange(Profile.MinScale, Profile.MaxScale);
+		const double Scale = Random.FRandRange(Profile.MinScale, Profile.MaxScale);
 
 		if (not IsInsideCity(SamplePosition, 0.0) || IsExcludedAt(SamplePosition))
 		{
@@ -2083,7 +2262,7 @@ void FScorchedCityGenerator::BuildScatterForBuilding(
 			Candidate.Center = SamplePosition;
 			const double CandidateHalf = FMath::Max(10.0, MeshRadii[MeshIndex] * Scale * ScatterFootprintFraction);
 			Candidate.HalfExtents = FVector2D(CandidateHalf, CandidateHalf);
-			if (M_Occupancy.OverlapsAny(Candidate, BlockMask))
+			if (M_Occupancy.OverlapsAny(Candidate, BlockMask, Scratch))
 			{
 				continue;
 			}
@@ -2093,10 +2272,10 @@ void FScorchedCityGenerator::BuildScatterForBuilding(
 		Candidate.ProfileIndex = ProfileIndex;
 		Candidate.MeshIndex = MeshIndex;
 		Candidate.Position = SamplePosition;
-		Candidate.YawRadians = Profile.bRandomYaw ? M_Random.FRand() * 2.0 * PI : Building.YawRadians;
+		Candidate.YawRadians = Profile.bRandomYaw ? Random.FRand() * 2.0 * PI : Building.YawRadians;
 		Candidate.UniformScale = Scale;
 		Candidate.bAlignToGround = Profile.bAlignToGround;
-		OutResult.Scatter.Add(Candidate);
+		OutScatter.Add(Candidate);
 	}
 }
 
@@ -160,6 +160,7 @@ private:
 	FRandomStream M_Random;
 	FScorchedSpatialHashGrid M_Occupancy;
 	FScorchedSpatialHashGrid M_DecalOccupancy;
+	FScorchedNodeHashGrid M_NodeGrid;
 
 	// Zone flags per macro cell (key = cell coordinates on the GridBlockSize lattice).
 	TMap<FIntPoint, uint8> M_ZoneFlags;
@@ -180,6 +181,7 @@ private:
 	void BuildGridRoads();
 	void BuildCurvedRoads();
 	void GrowCurvedRoad(int32 StartNodeIndex, double StartHeading, int32 Depth, int32& WalkerBudget);
+	int32 AddNode(const FScorchedRoadNode& Node);
 	int32 FindOrAddNode(const FVector2D& Position, double SnapRadius, bool bGridNode);
 	int32 FindNearestNode(const FVector2D& Position, double SearchRadius) const;
 	int32 CommitEdge(int32 NodeAIndex, int32 NodeBIndex, TArray<FVector2D>&& Points, bool bCurved, bool bMajor);
@@ -234,18 +236,36 @@ private:
 	bool IsPolylineBlockedByRoads(const TArray<FVector2D>& Points, double EndpointIgnoreDistance) const;
 
 	// --- Lots & buildings ---
+
+	/** @brief Creates lots along every edge in parallel; only reads road occupancy. */
 	void BuildLots();
-	void BuildLotsAlongEdge(int32 EdgeIndex);
+	void BuildLotsAlongEdge(int32 EdgeIndex, FScorchedSpatialQueryScratch& Scratch,
+		TArray<FScorchedLot>& OutLots) const;
 	void TryCreateLot(int32 EdgeIndex, const FVector2D& RoadPoint, const FVector2D& RoadDirection,
-		double Side, double LotWidth);
+		double Side, double LotWidth, FScorchedSpatialQueryScratch& Scratch, TArray<FScorchedLot>& OutLots) const;
+
+	/**
+	 * @brief Fills lots block by block in parallel, then runs the serial per-street guarantee pass.
+	 * A block is a group of lots whose buildings could reach each other's spacing; blocks never
+	 * interact, so each is filled with its own stream derived from the seed and its first lot.
+	 */
 	void PlaceBuildings(FScorchedCityGenResult& OutResult);
 
-	/** @return True when any building entry was successfully placed on the lot. */
-	bool TryFillLotWithAnyBuilding(FScorchedLot& Lot, FScorchedCityGenResult& OutResult);
+	/** @return Lot groups whose possible buildings cannot touch other groups, each in LotOrder order. */
+	TArray<TArray<int32>> BuildIndependentLotBlocks(const TArray<int32>& LotOrder) const;
+
+	/**
+	 * @param PendingBuildings Buildings of the same block not yet in the occupancy grid.
+	 * @return True when any building entry was successfully placed on the lot.
+	 */
+	bool TryFillLotWithAnyBuilding(const FScorchedLot& Lot, FRandomStream& Random,
+		FScorchedSpatialQueryScratch& Scratch, TConstArrayView<FScorchedFootprint> PendingBuildings,
+		FScorchedBuildingSpawn& OutSpawn) const;
 	bool TryPlaceBuildingOnLot(const FScorchedLot& Lot, const FScorchedResolvedBuilding& Building,
-		FScorchedBuildingSpawn& OutSpawn);
+		FRandomStream& Random, FScorchedSpatialQueryScratch& Scratch,
+		TConstArrayView<FScorchedFootprint> PendingBuildings, FScorchedBuildingSpawn& OutSpawn) const;
 	double ComputeBuildingWeightForLot(const FScorchedResolvedBuilding& Building, const FScorchedLot& Lot) const;
-	int32 PickWeightedBuildingForLot(const FScorchedLot& Lot);
+	int32 PickWeightedBuildingForLot(const FScorchedLot& Lot, FRandomStream& Random) const;
 
 	// --- Road-side objects ---
 
@@ -278,9 +298,11 @@ private:
 	// --- Power lines & scatter ---
 	void PlacePowerLines(FScorchedCityGenResult& OutResult);
 	void PlacePowerLinesAlongEdge(const FScorchedRoadEdge& Edge, FScorchedCityGenResult& OutResult);
+	/** @brief Scatters around every building in parallel, one derived stream per building. */
 	void BuildScatter(const FScorchedCityGenResult& ResultSoFar, FScorchedCityGenResult& OutResult);
 	void BuildScatterForBuilding(const FScorchedBuildingSpawn& Building, int32 ProfileIndex,
-		FScorchedCityGenResult& OutResult);
+		FRandomStream& Random, FScorchedSpatialQueryScratch& Scratch,
+		TArray<FScorchedScatterCandidate>& OutScatter) const;
 	void BuildDecals(FScorchedCityGenResult& OutResult);
 	void BuildLotDecals(FScorchedCityGenResult& OutResult);
 	void BuildBuildingFootprintDecals(FScorchedCityGenResult& OutResult);
@@ -323,6 +345,9 @@ private:
 	/** @return Deterministic 0..1 value from the seed and integer cell coordinates. */
 	double CellNoise(int32 Salt, const FIntPoint& Cell) const;
 
+	/** @return Stream derived from the seed, so parallel work items stay deterministic. */
+	FRandomStream MakeDerivedStream(int32 Salt, int32 WorkIndex) const;
+
 	/**
 	 * @brief Walks a polyline by arc length.
 	 * @return False when Distance is beyond the end of the polyline.
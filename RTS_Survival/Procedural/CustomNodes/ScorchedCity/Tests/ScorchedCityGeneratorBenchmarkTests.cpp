@@ -0,0 +1,193 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+#include "RTS_Survival/Procedural/CustomNodes/ScorchedCity/ScorchedCityGenerator.h"
+
+namespace ScorchedCityGeneratorTestConstants
+{
+	constexpr int32 RandomSeed = 1337;
+	constexpr double BenchmarkCityLengths[] = {20000.0, 60000.0, 120000.0};
+	constexpr int32 NodeGridPointCount = 4000;
+	constexpr int32 NodeGridQueryCount = 2000;
+	constexpr double NodeGridHalfExtent = 50000.0;
+	constexpr double NodeGridMaxQueryRadius = 3000.0;
+}
+
+namespace
+{
+	FScorchedResolvedBuilding MakeBuilding(const int32 SettingsIndex, const FVector2D& HalfExtents,
+		const EScorchedBuildingSize SizeCategory)
+	{
+		FScorchedResolvedBuilding Building;
+		Building.SettingsIndex = SettingsIndex;
+		Building.FootprintHalfExtents = HalfExtents;
+		Building.SizeCategory = SizeCategory;
+		Building.RotationMode = EScorchedBuildingRotationMode::FaceRoad90Steps;
+		return Building;
+	}
+
+	/** Parameter set in the shape the PCG element builds, without any UObject assets. */
+	FScorchedCityGenParams MakeBenchmarkParams(const double CityLength)
+	{
+		using namespace ScorchedCityGeneratorTestConstants;
+
+		FScorchedCityGenParams Params;
+		Params.CityLengthX = CityLength;
+		Params.CityLengthY = CityLength;
+		Params.RandomSeed = RandomSeed;
+		Params.Buildings.Add(MakeBuilding(0, FVector2D(300.0, 300.0), EScorchedBuildingSize::Small));
+		Params.Buildings.Add(MakeBuilding(1, FVector2D(450.0, 500.0), EScorchedBuildingSize::Medium));
+		Params.Buildings.Add(MakeBuilding(2, FVector2D(650.0, 700.0), EScorchedBuildingSize::Large));
+
+		FScorchedScatterProfile& Profile = Params.ScatterProfiles.AddDefaulted_GetRef();
+		Profile.Meshes.AddDefaulted(2);
+		Profile.MeshesPerBuilding = 8.0f;
+		Profile.ClusterAmount = 0.5f;
+		Params.ScatterMeshRadii.Add({60.0, 120.0});
+		return Params;
+	}
+
+	bool AreResultsEqual(const FScorchedCityGenResult& A, const FScorchedCityGenResult& B)
+	{
+		if (A.Lots.Num() != B.Lots.Num() || A.Buildings.Num() != B.Buildings.Num()
+			|| A.Scatter.Num() != B.Scatter.Num() || A.RoadSplines.Num() != B.RoadSplines.Num())
+		{
+			return false;
+		}
+
+		for (int32 BuildingIndex = 0; BuildingIndex < A.Buildings.Num(); ++BuildingIndex)
+		{
+			if (A.Buildings[BuildingIndex].AssetIndex != B.Buildings[BuildingIndex].AssetIndex
+				|| not A.Buildings[BuildingIndex].ActorPosition.Equals(B.Buildings[BuildingIndex].ActorPosition))
+			{
+				return false;
+			}
+		}
+
+		for (int32 ScatterIndex = 0; ScatterIndex < A.Scatter.Num(); ++ScatterIndex)
+		{
+			if (not A.Scatter[ScatterIndex].Position.Equals(B.Scatter[ScatterIndex].Position))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	bool DoBuildingsOverlap(const FScorchedCityGenResult& Result)
+	{
+		for (int32 BuildingIndex = 0; BuildingIndex < Result.Buildings.Num(); ++BuildingIndex)
+		{
+			for (int32 OtherIndex = BuildingIndex + 1; OtherIndex < Result.Buildings.Num(); ++OtherIndex)
+			{
+				if (Result.Buildings[BuildingIndex].Footprint.Overlaps(Result.Buildings[OtherIndex].Footprint))
+				{
+					return true;
+				}
+			}
+		}
+		return false;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FScorchedCityGeneratorBenchmarkTest,
+	"RTS.Procedural.ScorchedCity.GeneratorBenchmark",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FScorchedCityGeneratorBenchmarkTest::RunTest(const FString& Parameters)
+{
+	using namespace ScorchedCityGeneratorTestConstants;
+
+	for (const double CityLength : BenchmarkCityLengths)
+	{
+		const FScorchedCityGenParams Params = MakeBenchmarkParams(CityLength);
+
+		FScorchedCityGenResult FirstResult;
+		const double GenerateStart = FPlatformTime::Seconds();
+		FScorchedCityGenerator(Params).Generate(FirstResult);
+		const double GenerateSeconds = FPlatformTime::Seconds() - GenerateStart;
+
+		FScorchedCityGenResult SecondResult;
+		FScorchedCityGenerator(Params).Generate(SecondResult);
+
+		// Parallel lot filling and scatter must not depend on how work was scheduled.
+		TestTrue(FString::Printf(TEXT("Generation is deterministic for a %.0f city"), CityLength),
+			AreResultsEqual(FirstResult, SecondResult));
+		TestTrue(FString::Printf(TEXT("Buildings are placed in a %.0f city"), CityLength),
+			FirstResult.Buildings.Num() > 0);
+		if (CityLength <= BenchmarkCityLengths[0])
+		{
+			TestFalse(TEXT("Buildings of independent blocks never overlap"), DoBuildingsOverlap(FirstResult));
+		}
+
+		AddInfo(FString::Printf(TEXT("%.0f city: %d roads, %d lots, %d buildings, %d scatter in %.3f ms"),
+			CityLength, FirstResult.RoadSplines.Num(), FirstResult.Lots.Num(), FirstResult.Buildings.Num(),
+			FirstResult.Scatter.Num(), GenerateSeconds * 1000.0));
+	}
+
+	return not HasAnyErrors();
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FScorchedNodeHashGridTest,
+	"RTS.Procedural.ScorchedCity.NodeHashGrid",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FScorchedNodeHashGridTest::RunTest(const FString& Parameters)
+{
+	using namespace ScorchedCityGeneratorTestConstants;
+
+	FRandomStream Stream(RandomSeed);
+	FScorchedNodeHashGrid Grid(1500.0);
+	TArray<FVector2D> Positions;
+	for (int32 NodeIndex = 0; NodeIndex < NodeGridPointCount; ++NodeIndex)
+	{
+		// Snap to a coarse lattice so equal-distance ties actually occur.
+		const FVector2D Position(
+			FMath::GridSnap(Stream.FRandRange(-NodeGridHalfExtent, NodeGridHalfExtent), 500.0),
+			FMath::GridSnap(Stream.FRandRange(-NodeGridHalfExtent, NodeGridHalfExtent), 500.0));
+		Positions.Add(Position);
+		Grid.Add(NodeIndex, Position);
+	}
+
+	int32 Mismatches = 0;
+	for (int32 QueryIndex = 0; QueryIndex < NodeGridQueryCount; ++QueryIndex)
+	{
+		const FVector2D Query(
+			FMath::GridSnap(Stream.FRandRange(-NodeGridHalfExtent, NodeGridHalfExtent), 250.0),
+			FMath::GridSnap(Stream.FRandRange(-NodeGridHalfExtent, NodeGridHalfExtent), 250.0));
+		const double Radius = Stream.FRandRange(1.0, NodeGridMaxQueryRadius);
+
+		// Reference: the linear scans the generator used before the grid.
+		int32 ExpectedLowest = INDEX_NONE;
+		int32 ExpectedNearest = INDEX_NONE;
+		double NearestDistanceSquared = Radius * Radius;
+		for (int32 NodeIndex = 0; NodeIndex < Positions.Num(); ++NodeIndex)
+		{
+			const double DistanceSquared = FVector2D::DistSquared(Positions[NodeIndex], Query);
+			if (ExpectedLowest == INDEX_NONE && DistanceSquared <= Radius * Radius)
+			{
+				ExpectedLowest = NodeIndex;
+			}
+			if (DistanceSquared <= NearestDistanceSquared)
+			{
+				NearestDistanceSquared = DistanceSquared;
+				ExpectedNearest = NodeIndex;
+			}
+		}
+
+		if (Grid.FindLowestIndexWithin(Query, Radius) != ExpectedLowest
+			|| Grid.FindNearest(Query, Radius) != ExpectedNearest)
+		{
+			++Mismatches;
+		}
+	}
+
+	TestEqual(TEXT("Node grid queries match the linear scan"), Mismatches, 0);
+	return not HasAnyErrors();
+}
+
+#endif
@@ -8,6 +8,7 @@
 #include "RTS_Survival/Behaviours/BehaviourComp.h"
 #include "RTS_Survival/RTSComponents/RTSComponent.h"
 #include "RTS_Survival/RTSCollisionTraceChannels.h"
+#include "RTS_Survival/Subsystems/AuraSubsystem/RTSAuraSubsystem.h"
 #include "RTS_Survival/Utils/RTS_Statics/RTS_Statics.h"
 #include "RTS_Survival/GameUI/Pooled_AnimatedVerticalText/Pooling/AnimatedTextWidgetPoolManager/AnimatedTextWidgetPoolManager.h"
 
@@ -27,13 +28,13 @@ void UAOEBehaviourComponent::SetAOEEnabled(const bool bEnabled)
 
 	if (not bM_AOEEnabled)
 	{
-		UWorld* World = GetWorld();
-		if (not IsValid(World))
-		{
-			return;
-		}
+		StopAoe();
+		return;
+	}
 
-		World->GetTimerManager().ClearTimer(M_AOEIntervalTimerHandle);
+	// Before begin play the owner's player is not known yet; BeginPlay starts the AOE.
+	if (not HasBegunPlay())
+	{
 		return;
 	}
 
@@ -70,15 +71,7 @@ void UAOEBehaviourComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 	}
 
 	M_TrackedBehaviourComponents.Empty();
-
-	UWorld* World = GetWorld();
-	if (not IsValid(World))
-	{
-		Super::EndPlay(EndPlayReason);
-		return;
-	}
-
-	World->GetTimerManager().ClearTimer(M_AOEIntervalTimerHandle);
+	StopAoe();
 
 	Super::EndPlay(EndPlayReason);
 }
@@ -152,6 +145,12 @@ void UAOEBehaviourComponent::BeginPlay_StartAoeTimer()
 		return;
 	}
 
+	if (GetUsesAuraSubsystem())
+	{
+		RegisterAuraSource();
+		return;
+	}
+
 	UWorld* World = GetWorld();
 	if (not IsValid(World))
 	{
@@ -166,6 +165,23 @@ void UAOEBehaviourComponent::BeginPlay_StartAoeTimer()
 		true);
 }
 
+void UAOEBehaviourComponent::StopAoe()
+{
+	if (M_AuraSourceId != INDEX_NONE && M_AuraSubsystem.IsValid())
+	{
+		M_AuraSubsystem->UnregisterAuraSource(M_AuraSourceId);
+	}
+	M_AuraSourceId = INDEX_NONE;
+
+	UWorld* World = GetWorld();
+	if (not IsValid(World))
+	{
+		return;
+	}
+
+	World->GetTimerManager().ClearTimer(M_AOEIntervalTimerHandle);
+}
+
 void UAOEBehaviourComponent::HandleApplyTick()
 {
 	if (not GetIsValidSettings())
@@ -242,6 +258,63 @@ void UAOEBehaviourComponent::StartAsyncSphereSweep(
 		/*UserData*/ 0u);
 }
 
+bool UAOEBehaviourComponent::GetUsesAuraSubsystem() const
+{
+	return not AOEBehaviourSettings.bAddDestructiblesToOverlap;
+}
+
+void UAOEBehaviourComponent::RegisterAuraSource()
+{
+	if (M_AuraSourceId != INDEX_NONE)
+	{
+		return;
+	}
+
+	if (not M_AuraSubsystem.IsValid())
+	{
+		if (UWorld* World = GetWorld())
+		{
+			M_AuraSubsystem = World->GetSubsystem<URTSAuraSubsystem>();
+		}
+	}
+	if (not GetIsValidAuraSubsystem())
+	{
+		return;
+	}
+
+	FRTSAuraSourceSettings SourceSettings;
+	SourceSettings.SourceActor = GetOwner();
+	SourceSettings.Radius = AOEBehaviourSettings.Radius;
+	SourceSettings.IntervalSeconds = AOEBehaviourSettings.IntervalSeconds;
+	// Same first check as the interval timer this replaces.
+	SourceSettings.FirstResolveDelaySeconds = AOEBehaviourSettings.IntervalSeconds;
+	SourceSettings.OverlapLogic = GetOverlapLogicForOwner();
+
+	const TWeakObjectPtr<UAOEBehaviourComponent> WeakThis(this);
+	M_AuraSourceId = M_AuraSubsystem->RegisterAuraSource(
+		SourceSettings,
+		[WeakThis](const TArray<AActor*>& UnitsInRadius)
+		{
+			if (not WeakThis.IsValid())
+			{
+				return;
+			}
+
+			WeakThis->OnAuraSourceResolved(UnitsInRadius);
+		});
+}
+
+void UAOEBehaviourComponent::OnAuraSourceResolved(const TArray<AActor*>& UnitsInRadius)
+{
+	HandleActorsInRadius(UnitsInRadius);
+
+	// The owner may have changed player; the next resolve queries the matching team.
+	if (M_AuraSourceId != INDEX_NONE && M_AuraSubsystem.IsValid())
+	{
+		M_AuraSubsystem->SetAuraSourceOverlapLogic(M_AuraSourceId, GetOverlapLogicForOwner());
+	}
+}
+
 FCollisionObjectQueryParams UAOEBehaviourComponent::BuildObjectQueryParams(
 	const ETriggerOverlapLogic OverlapLogic)
 {
@@ -296,15 +369,26 @@ void UAOEBehaviourComponent::HandleSweepComplete(TArray<FHitResult>&& HitResults
 {
 	FilterUniqueActorsInPlace(HitResults);
 
+	TArray<AActor*> ActorsInRadius;
+	ActorsInRadius.Reserve(HitResults.Num());
+	for (const FHitResult& Hit : HitResults)
+	{
+		ActorsInRadius.Add(Hit.GetActor());
+	}
+
+	HandleActorsInRadius(ActorsInRadius);
+}
+
+void UAOEBehaviourComponent::HandleActorsInRadius(const TArray<AActor*>& ActorsInRadius)
+{
 	TSet<TWeakObjectPtr<UBehaviourComp>> CurrentTargets;
-	CurrentTargets.Reserve(HitResults.Num());
+	CurrentTargets.Reserve(ActorsInRadius.Num());
 
 	TArray<UBehaviourComp*> BehaviourComponentsInRange;
-	BehaviourComponentsInRange.Reserve(HitResults.Num());
+	BehaviourComponentsInRange.Reserve(ActorsInRadius.Num());
 
-	for (const FHitResult& Hit : HitResults)
+	for (AActor* const HitActor : ActorsInRadius)
 	{
-		AActor* const HitActor = Hit.GetActor();
 		if (not IsValid(HitActor))
 		{
 			continue;
@@ -468,6 +552,21 @@ bool UAOEBehaviourComponent::GetIsValidAnimatedTextWidgetPoolManager() const
 	return true;
 }
 
+bool UAOEBehaviourComponent::GetIsValidAuraSubsystem() const
+{
+	if (not M_AuraSubsystem.IsValid())
+	{
+		RTSFunctionLibrary::ReportErrorVariableNotInitialised(
+			this,
+			"M_AuraSubsystem",
+			"GetIsValidAuraSubsystem",
+			GetOwner());
+		return false;
+	}
+
+	return true;
+}
+
 bool UAOEBehaviourComponent::GetIsValidSettings() const
 {
 	if (AOEBehaviourSettings.IntervalSeconds <= 0.f)
@@ -13,6 +13,7 @@ class UBehaviour;
 class UBehaviourComp;
 class UAnimatedTextWidgetPoolManager;
 class URTSComponent;
+class URTSAuraSubsystem;
 
 
 UENUM(BlueprintType)
@@ -31,11 +32,11 @@ struct RTS_SURVIVAL_API FAOEBehaviourSettings
 {
 	GENERATED_BODY()
 
-	/** Interval in seconds between async AOE checks. Must be > 0. */
+	/** Interval in seconds between AOE checks; rounded up to the aura subsystem's resolve step. Must be > 0. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="AOE Behaviour")
 	float IntervalSeconds = AOEBehaviourComponentConstants::DefaultIntervalSeconds;
 
-	/** Radius in centimeters used for the async sphere sweep. */
+	/** Radius in centimeters of the AOE check. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="AOE Behaviour")
 	float Radius = AOEBehaviourComponentConstants::DefaultRadius;
 
@@ -52,7 +53,8 @@ struct RTS_SURVIVAL_API FAOEBehaviourSettings
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="AOE Behaviour")
 	FBehaviourTextSettings TextSettings;
 
-	/** Whether the component searches for distructables. */
+	/** Whether the component searches for distructables. Destructibles are not indexed by the aura subsystem, so
+	 * enabling this makes the component run its own async sphere sweep each interval. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="AOE Behaviour")
 	bool bAddDestructiblesToOverlap = false;
 
@@ -72,7 +74,8 @@ struct RTS_SURVIVAL_API FAOEBehaviourSettings
 };
 
 /**
- * @brief Component that periodically applies behaviours to nearby units using async AOE sweeps.
+ * @brief Component that periodically applies behaviours to nearby units; the units in range are resolved by the aura
+ * subsystem together with all other aura sources.
  * It tracks which units are currently affected and removes behaviours when they leave the radius.
  */
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent), BlueprintType)
@@ -134,15 +137,29 @@ private:
 	UPROPERTY()
 	TSet<TWeakObjectPtr<UBehaviourComp>> M_TrackedBehaviourComponents;
 
+	UPROPERTY()
+	TWeakObjectPtr<URTSAuraSubsystem> M_AuraSubsystem;
+
+	// Id of this component's source in the aura subsystem, INDEX_NONE while not registered.
+	int32 M_AuraSourceId = INDEX_NONE;
+
+	// Only used when the component sweeps for destructibles itself.
 	FTimerHandle M_AOEIntervalTimerHandle;
 
 	bool bM_AOEEnabled = true;
 
 	// ---- Timer flow ----
 	void BeginPlay_SetupAnimatedTextWidgetPoolManager();
+	/** @brief Registers with the aura subsystem, or starts the sweep timer if destructibles are searched for. */
 	void BeginPlay_StartAoeTimer();
+	void StopAoe();
 	void HandleApplyTick();
 
+	// ---- Aura subsystem ----
+	bool GetUsesAuraSubsystem() const;
+	void RegisterAuraSource();
+	void OnAuraSourceResolved(const TArray<AActor*>& UnitsInRadius);
+
 	// ---- Async sweep helpers ----
 	/**
 	 * @brief Run an async sphere sweep from the epicenter using owner overlap logic.
@@ -154,6 +171,9 @@ private:
 	FCollisionObjectQueryParams BuildObjectQueryParams(const ETriggerOverlapLogic OverlapLogic);
 	void HandleSweepComplete(TArray<FHitResult>&& HitResults);
 
+	/** @brief Updates the tracked components with the actors now in range and applies or removes behaviours. */
+	void HandleActorsInRadius(const TArray<AActor*>& ActorsInRadius);
+
 	// ---- Behaviour tracking ----
 	void ApplyBehavioursToTarget(UBehaviourComp& BehaviourComponent) const;
 	void RemoveBehavioursFromTarget(UBehaviourComp& BehaviourComponent) const;
@@ -172,6 +192,7 @@ private:
 	// ---- Validation ----
 	bool GetIsValidRTSComponent() const;
 	bool GetIsValidAnimatedTextWidgetPoolManager() const;
+	bool GetIsValidAuraSubsystem() const;
 	bool GetIsValidSettings() const;
 
 	ETriggerOverlapLogic GetOverlapLogicForOwner() const;
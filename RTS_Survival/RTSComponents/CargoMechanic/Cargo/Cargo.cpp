@@ -102,7 +102,7 @@ void UCargo::OnSquadCompletelyDiedInside(ASquadController* SquadController)
 
 			// bIsOccupied = false, SeatsDelta = 0 -> do not subtract seats again;
 			// OnUnitDiedWhileInside already kept the seats text in sync per death.
-			M_GarrisonHpBarWidget->UpdateGarrisonSlot(SlotIndex, /*bIsOccupied=*/false, UnitID, /*SeatsDelta=*/0);
+			Garrison_UpdateSlot(SlotIndex, /*bIsOccupied=*/false, UnitID, /*SeatsDelta=*/0);
 		}
 
 		ReleaseSlotForSquad(SquadController);
@@ -172,17 +172,14 @@ void UCargo::AdjustSeatsForSquad(ASquadController* Squad, const int32 SeatsDelta
 		RTSFunctionLibrary::ReportNullErrorComponent(Squad, "RTSComponent", "UCargo::AdjustSeatsForSquad");
 	}
 
-	M_GarrisonHpBarWidget->UpdateGarrisonSlot(SlotIndex, /*bIsOccupied=*/true, UnitID, SeatsDelta);
+	Garrison_UpdateSlot(SlotIndex, /*bIsOccupied=*/true, UnitID, SeatsDelta);
 }
 
 void UCargo::SetIsEnabled(const bool bEnable)
 {
 	bM_IsEnabled = bEnable;
 	// do not ensure, if the widget is not loaded we propagate the bool later.
-	if (M_GarrisonHpBarWidget.IsValid())
-	{
-		M_GarrisonHpBarWidget->OnGarrisonEnabled(bM_IsEnabled);
-	}
+	Garrison_OnEnabled();
 	if (not bEnable)
 	{
 		MoveOutGarrisonedInfantryOnDisabled();
@@ -490,7 +487,21 @@ void UCargo::ClearSeatOccupancyForSquad(ASquadController* Squad)
 
 void UCargo::OnHealthBarWidgetInit(UHealthComponent* InitializedComponent)
 {
-	if (not IsValid(InitializedComponent) || not InitializedComponent->GetHealthBarWidgetComp())
+	if (not IsValid(InitializedComponent))
+	{
+		return;
+	}
+	if (InitializedComponent->GetHasBatchedHealthBar())
+	{
+		if (not bUseCargoWidget)
+		{
+			return;
+		}
+		M_BatchedGarrisonHealthComp = InitializedComponent;
+		InitGarrisonWidget();
+		return;
+	}
+	if (not InitializedComponent->GetHealthBarWidgetComp())
 	{
 		return;
 	}
@@ -602,7 +613,7 @@ void UCargo::OnHealthBarWidgetInit_NoValidWidget() const
 
 bool UCargo::EnsureIsValidGarrisonWidget() const
 {
-	if (not M_GarrisonHpBarWidget.IsValid())
+	if (not M_GarrisonHpBarWidget.IsValid() && not M_BatchedGarrisonHealthComp.IsValid())
 	{
 		// RTSFunctionLibrary::ReportError("No valid garrison widget in cargo component on owner: " +
 		// 	(GetOwner() ? GetOwner()->GetName() : "NoOwner"));
@@ -631,13 +642,48 @@ void UCargo::InitGarrisonWidget()
 
 	const int32 MaxSquadsForDisplay = M_VacancyState.M_MaxSquadsSupported;
 
-	M_GarrisonHpBarWidget->SetupGarrison(
-		SlotsForWidget,
-		TotalSeats,
-		MaxSquadsForDisplay,
-		M_SeatTextType);
+	if (M_BatchedGarrisonHealthComp.IsValid())
+	{
+		M_BatchedGarrisonHealthComp->SetupGarrison(SlotsForWidget, TotalSeats, MaxSquadsForDisplay, M_SeatTextType);
+	}
+	else
+	{
+		M_GarrisonHpBarWidget->SetupGarrison(
+			SlotsForWidget,
+			TotalSeats,
+			MaxSquadsForDisplay,
+			M_SeatTextType);
+	}
 	// update in case the flag was changed while the widget UI was still async loading.
-	M_GarrisonHpBarWidget->OnGarrisonEnabled(bM_IsEnabled);
+	Garrison_OnEnabled();
+}
+
+void UCargo::Garrison_UpdateSlot(const int32 SlotIndex, const bool bIsOccupied, const FTrainingOption& UnitID,
+                                 const int32 SeatsTakenOrBecameVacant) const
+{
+	if (M_BatchedGarrisonHealthComp.IsValid())
+	{
+		// The batched bar draws occupied slots without the unit icon of the widget.
+		M_BatchedGarrisonHealthComp->UpdateGarrisonSlot(SlotIndex, bIsOccupied, SeatsTakenOrBecameVacant);
+		return;
+	}
+	if (M_GarrisonHpBarWidget.IsValid())
+	{
+		M_GarrisonHpBarWidget->UpdateGarrisonSlot(SlotIndex, bIsOccupied, UnitID, SeatsTakenOrBecameVacant);
+	}
+}
+
+void UCargo::Garrison_OnEnabled() const
+{
+	if (M_BatchedGarrisonHealthComp.IsValid())
+	{
+		M_BatchedGarrisonHealthComp->OnGarrisonEnabled(bM_IsEnabled);
+		return;
+	}
+	if (M_GarrisonHpBarWidget.IsValid())
+	{
+		M_GarrisonHpBarWidget->OnGarrisonEnabled(bM_IsEnabled);
+	}
 }
 
 int32 UCargo::AssignSlotForSquad(ASquadController* Squad)
@@ -1063,7 +1109,7 @@ void UCargo::UpdateGarrisonWidgetForSquad(ASquadController* Squad, const int32 S
 	// Finally, push to the widget.
 	// - bIsOccupied = bIsEntering (true => add seats; false => subtract seats)
 	// - SeatsTakenOrBecameVacant = SeatsDelta
-	M_GarrisonHpBarWidget->UpdateGarrisonSlot(SlotIndex, bIsEntering, UnitID, SeatsDelta);
+	Garrison_UpdateSlot(SlotIndex, bIsEntering, UnitID, SeatsDelta);
 }
 
 bool UCargo::GetIsValidCargoOwner() const
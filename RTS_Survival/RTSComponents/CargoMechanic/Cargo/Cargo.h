@@ -11,6 +11,7 @@
 
 class UW_GarrisonHealthBar;
 class UHealthComponent;
+struct FTrainingOption;
 class UPrimitiveComponent;
 class UCargo;
 class ASquadUnit;
@@ -306,8 +307,14 @@ private:
 	void OnHealthBarWidgetInit_NoValidWidget() const;
 	UPROPERTY()
 	TWeakObjectPtr<UW_GarrisonHealthBar> M_GarrisonHpBarWidget = nullptr;
+	// Set instead of the widget when the owner's health bar is batched; the bar then draws the garrison seats.
+	TWeakObjectPtr<UHealthComponent> M_BatchedGarrisonHealthComp = nullptr;
+	/** @return Whether there is a garrison widget or a batched health bar to show the garrison on. */
 	bool EnsureIsValidGarrisonWidget() const;
 	void InitGarrisonWidget();
+	void Garrison_UpdateSlot(const int32 SlotIndex, const bool bIsOccupied, const FTrainingOption& UnitID,
+	                         const int32 SeatsTakenOrBecameVacant) const;
+	void Garrison_OnEnabled() const;
 
 
 	// Squad -> UI slot (0..MaxSquads-1). Only for widget; seat sockets are tracked elsewhere.
@@ -18,8 +18,8 @@ void FHealthBarWidgetCallbacks::CallbackOnHealthBarReady(
         return;
     }
 
-    // If the widget already exists, invoke immediately with the component ref.
-    if (IsValid(HealthComp->GetHealthBarWidgetComp()))
+    // If the widget or batched bar already exists, invoke immediately with the component ref.
+    if (IsValid(HealthComp->GetHealthBarWidgetComp()) || HealthComp->GetHasBatchedHealthBar())
     {
         Callback(HealthComp);
         return;
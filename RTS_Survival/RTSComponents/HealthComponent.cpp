@@ -9,7 +9,9 @@
 #include "RTS_Survival/Utils/RTS_Statics/RTS_Statics.h"
 #include "RTS_Survival/GameUI/ActionUI/ActionUIManager/ActionUIManager.h"
 #include "RTS_Survival/GameUI/Healthbar/W_HealthBar.h"
+#include "RTS_Survival/Subsystems/HealthBarRenderSubsystem/RTSHealthBarRenderSubsystem.h"
 #include "RTS_Survival/UnitData/ArmorAndResistanceData.h"
+#include "RTS_Survival/Weapons/BombComponent/BombComponent.h"
 #include "RTS_Survival/Weapons/WeaponData/WeaponData.h"
 #include "RTS_Survival/Weapons/WeaponData/FRTSWeaponHelpers/FRTSWeaponHelpers.h"
 
@@ -27,9 +29,20 @@ UHealthComponent::UHealthComponent()
 	InitializeHealthLevelMap();
 }
 
-void UHealthComponent::UpdateRankIcon(const int32 NewRankLevel, const EVeterancyIconSet VeterancyIconSet) const
+void UHealthComponent::UpdateRankIcon(const int32 NewRankLevel, const EVeterancyIconSet VeterancyIconSet)
 {
-	
+	if (GetUsesBatchedHealthBar())
+	{
+		// Kept so the rank is pushed again if the bar registers later.
+		M_RankLevel = NewRankLevel;
+		M_RankIconSet = VeterancyIconSet;
+		if (FRTSBatchedHealthBar* BatchedHealthBar = Batched_GetHealthBar())
+		{
+			BatchedHealthBar->RankLevel = NewRankLevel;
+			BatchedHealthBar->RankIconSet = VeterancyIconSet;
+		}
+		return;
+	}
 	if (not Widget_GetIsValidHealthBarWidget())
 	{
 		return;	
@@ -39,9 +52,9 @@ void UHealthComponent::UpdateRankIcon(const int32 NewRankLevel, const EVeterancy
 
 void UHealthComponent::MakeHealthBarInvisible() const
 {
-	if (Widget_GetIsValidHealthBarWidget())
+	if (GetIsValidHealthBar())
 	{
-		M_HealthBarWidget->SetVisibility(ESlateVisibility::Hidden);
+		SetHealthBarVisible(false);
 	}
 }
 
@@ -51,14 +64,14 @@ void UHealthComponent::OnHideAllGameUI(const bool bHide)
 	// Always record the global state, even if the widget isn't created yet.
 	bWasHiddenByAllGameUI = bHide;
 
-	if (!M_HealthBarWidget.IsValid())
+	if (not GetHasHealthBar())
 	{
 		return;
 	}
 
 	if (bHide)
 	{
-		M_HealthBarWidget->SetVisibility(ESlateVisibility::Hidden);
+		SetHealthBarVisible(false);
 		return;
 	}
 
@@ -69,9 +82,9 @@ void UHealthComponent::OnHideAllGameUI(const bool bHide)
 
 void UHealthComponent::HideHealthBar()
 {
-	if (Widget_GetIsValidWidgetComponent())
+	if (GetUsesBatchedHealthBar() || Widget_GetIsValidWidgetComponent())
 	{
-		M_HealthBarWidget->SetVisibility(ESlateVisibility::Hidden);
+		SetHealthBarVisible(false);
 	}
 }
 
@@ -107,6 +120,10 @@ void UHealthComponent::SetHealthBarSelected(const bool bSetSelected, TObjectPtr<
 
 FVector UHealthComponent::GetLocalLocation() const
 {
+	if (const FRTSBatchedHealthBar* BatchedHealthBar = Batched_GetHealthBar())
+	{
+		return BatchedHealthBar->RelativeOffset;
+	}
 	if (not Widget_GetIsValidWidgetComponent())
 	{
 		return FVector::ZeroVector;
@@ -116,6 +133,11 @@ FVector UHealthComponent::GetLocalLocation() const
 
 void UHealthComponent::SetLocalLocation(const FVector& NewLocation) const
 {
+	if (FRTSBatchedHealthBar* BatchedHealthBar = Batched_GetHealthBar())
+	{
+		BatchedHealthBar->RelativeOffset = NewLocation;
+		return;
+	}
 	if (not Widget_GetIsValidHealthBarWidget())
 	{
 		return;
@@ -134,6 +156,16 @@ UWidgetComponent* UHealthComponent::GetHealthBarWidgetComp() const
 
 void UHealthComponent::ChangeTargetIconType(const ETargetTypeIcon NewIconType)
 {
+	if (GetUsesBatchedHealthBar())
+	{
+		// Kept so the icon is pushed again if the bar registers later.
+		M_TargetTypeIcon = NewIconType;
+		if (FRTSBatchedHealthBar* BatchedHealthBar = Batched_GetHealthBar())
+		{
+			BatchedHealthBar->Icon = NewIconType;
+		}
+		return;
+	}
 	if (not Widget_GetIsValidHealthBarWidget())
 	{
 		return;
@@ -203,6 +235,10 @@ void UHealthComponent::SetMaxHealth(const float NewMaxHealth)
 	{
 		M_HealthBarWidget->UpdateMaxHealth(MaxHealth);
 	}
+	if (FRTSBatchedHealthBar* BatchedHealthBar = Batched_GetHealthBar())
+	{
+		BatchedHealthBar->SetMaxHealth(MaxHealth);
+	}
 
 	UpdateHealthBar();
 }
@@ -267,7 +303,7 @@ void UHealthComponent::ChangeCustomizationSettings(const FHealthBarCustomization
 {
 	CustomizationSettings = NewSettings;
 
-	if (not Widget_GetIsValidHealthBarWidget())
+	if (not GetIsValidHealthBar())
 	{
 		return;
 	}
@@ -278,7 +314,14 @@ void UHealthComponent::ChangeCustomizationSettings(const FHealthBarCustomization
 		OwningPlayer = M_RTSComponent->GetOwningPlayer();
 	}
 
-	M_HealthBarWidget->SetSettingsFromHealthComponent(this, CustomizationSettings, OwningPlayer);
+	if (FRTSBatchedHealthBar* BatchedHealthBar = Batched_GetHealthBar())
+	{
+		BatchedHealthBar->SetCustomization(CustomizationSettings, OwningPlayer);
+	}
+	else
+	{
+		M_HealthBarWidget->SetSettingsFromHealthComponent(this, CustomizationSettings, OwningPlayer);
+	}
 	UpdateHealthBar();
 }
 
@@ -392,13 +435,17 @@ void UHealthComponent::InitFireThresholdData(const float NewMaxFireThreshold, co
 		M_FireThresholdState.CurrentFireThreshold = 0.f;
 	}
 
-	if (Widget_GetIsValidHealthBarWidget())
+	const float Ratio = (M_FireThresholdState.MaxFireThreshold > 0.f)
+		                    ? (M_FireThresholdState.CurrentFireThreshold / M_FireThresholdState.MaxFireThreshold)
+		                    : 0.f;
+	if (GetUsesBatchedHealthBar())
+	{
+		Batched_UpdateFireThreshold(Ratio);
+	}
+	else if (Widget_GetIsValidHealthBarWidget())
 	{
 		M_HealthBarWidget->UpdateMaxFireThreshold(M_FireThresholdState.MaxFireThreshold);
 		// Also push the current % to keep visuals in sync
-		const float Ratio = (M_FireThresholdState.MaxFireThreshold > 0.f)
-			                    ? (M_FireThresholdState.CurrentFireThreshold / M_FireThresholdState.MaxFireThreshold)
-			                    : 0.f;
 		M_HealthBarWidget->OnFireDamage(Ratio);
 	}
 }
@@ -441,11 +488,43 @@ void UHealthComponent::BeginPlay()
 	// error handling.
 	(void)GetIsValidHeathBarOwner();
 	// Fail silently as some actors may not use a health widget.
-	if (HealthBarWidgetClass)
+	if (not HealthBarWidgetClass)
+	{
+		return;
+	}
+	if (GetUsesBatchedHealthBar())
+	{
+		BeginPlay_RegisterBatchedHealthBar();
+	}
+	else
 	{
 		Widget_CreateHealthBar();
-		OnWidgetInitialized();
 	}
+	OnWidgetInitialized();
+}
+
+void UHealthComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UnbindAmmoTrackedWeapon();
+	UnbindTrackedBombComponent();
+	if (bM_UsesBatchedHealthBar)
+	{
+		if (UWorld* World = GetWorld())
+		{
+			if (URTSHealthBarRenderSubsystem* HealthBarRenderSubsystem =
+				World->GetSubsystem<URTSHealthBarRenderSubsystem>())
+			{
+				HealthBarRenderSubsystem->UnregisterHealthBar(this);
+			}
+		}
+		bM_UsesBatchedHealthBar = false;
+	}
+	Super::EndPlay(EndPlayReason);
+}
+
+bool UHealthComponent::GetUsesBatchedHealthBar() const
+{
+	return HealthBarWidgetClass && HealthBarRenderMode == EHealthBarRenderMode::Batched;
 }
 
 void UHealthComponent::BeginPlay_ApplyUserSettingsHealthBarVisibility()
@@ -503,6 +582,254 @@ void UHealthComponent::Widget_CreateHealthBar()
 	M_HealthBarWidgetCallbacks.OnHealthBarWidgetReady.Broadcast(this);
 }
 
+void UHealthComponent::BeginPlay_RegisterBatchedHealthBar()
+{
+	UWorld* World = GetWorld();
+	URTSHealthBarRenderSubsystem* HealthBarRenderSubsystem = World
+		                                                        ? World->GetSubsystem<URTSHealthBarRenderSubsystem>()
+		                                                        : nullptr;
+	if (not IsValid(HealthBarRenderSubsystem) || not GetOwner())
+	{
+		RTSFunctionLibrary::ReportNullErrorInitialisation(
+			this,
+			"HealthBarRenderSubsystem",
+			"UHealthComponent::BeginPlay_RegisterBatchedHealthBar");
+		return;
+	}
+	FRTSBatchedHealthBar* BatchedHealthBar = HealthBarRenderSubsystem->RegisterHealthBar(
+		this, RelativeWidgetOffset, WidgetXYScales);
+	if (not BatchedHealthBar)
+	{
+		return;
+	}
+	bM_UsesBatchedHealthBar = true;
+	bM_IsHealthBarWidgetInitialized = true;
+
+	int8 OwningPlayer = 0;
+	if (M_RTSComponent.IsValid())
+	{
+		OwningPlayer = M_RTSComponent->GetOwningPlayer();
+	}
+	BatchedHealthBar->SetCustomization(CustomizationSettings, OwningPlayer);
+	BatchedHealthBar->SetMaxHealth(MaxHealth);
+	BatchedHealthBar->HealthRatio = FMath::Clamp(GetHealthPercentage(), 0.f, 1.f);
+	BatchedHealthBar->DamagedFromRatio = BatchedHealthBar->HealthRatio;
+	BatchedHealthBar->Icon = M_TargetTypeIcon;
+	BatchedHealthBar->FireThresholdRatio = M_FireThresholdState.MaxFireThreshold > 0.f
+		                                       ? M_FireThresholdState.CurrentFireThreshold / M_FireThresholdState.
+		                                       MaxFireThreshold
+		                                       : 0.f;
+	if (M_AmmoTrackedWeapon.IsValid())
+	{
+		Batched_UpdateAmmo(M_AmmoTrackedWeapon->GetCurrentMagCapacity());
+	}
+	if (M_BombsLeft != INDEX_NONE)
+	{
+		Batched_UpdateBombs(M_BombsLeft);
+	}
+	BatchedHealthBar->RankLevel = M_RankLevel;
+	BatchedHealthBar->RankIconSet = M_RankIconSet;
+	if (M_RTSComponent.IsValid())
+	{
+		RegisterCallBackForUnitName(M_RTSComponent.Get());
+	}
+
+	// Respect global hide at init time, otherwise fall back to policy.
+	ApplyHealthBarVisibilityPolicy(GetHealthPercentage());
+
+	if (bM_ShouldApplyVisibilitySettingsOnWidgetInit)
+	{
+		bM_ShouldApplyVisibilitySettingsOnWidgetInit = false;
+		UpdateVisibilityAfterSettingsChange();
+	}
+	// Same notification as for a created widget; listeners that need the widget itself check for it.
+	M_HealthBarWidgetCallbacks.OnHealthBarWidgetReady.Broadcast(this);
+}
+
+FRTSBatchedHealthBar* UHealthComponent::Batched_GetHealthBar() const
+{
+	if (not bM_UsesBatchedHealthBar)
+	{
+		return nullptr;
+	}
+	const UWorld* World = GetWorld();
+	URTSHealthBarRenderSubsystem* HealthBarRenderSubsystem = World
+		                                                        ? World->GetSubsystem<URTSHealthBarRenderSubsystem>()
+		                                                        : nullptr;
+	if (not HealthBarRenderSubsystem)
+	{
+		return nullptr;
+	}
+	return HealthBarRenderSubsystem->GetHealthBar(this);
+}
+
+void UHealthComponent::Batched_UpdateFireThreshold(const float Ratio) const
+{
+	if (FRTSBatchedHealthBar* BatchedHealthBar = Batched_GetHealthBar())
+	{
+		BatchedHealthBar->FireThresholdRatio = Ratio;
+	}
+}
+
+void UHealthComponent::Batched_UpdateAmmo(const int32 BulletsLeft) const
+{
+	FRTSBatchedHealthBar* BatchedHealthBar = Batched_GetHealthBar();
+	if (not BatchedHealthBar || not M_AmmoTrackedWeapon.IsValid())
+	{
+		return;
+	}
+	const int32 MagCapacity = M_AmmoTrackedWeapon->GetRawWeaponData().MagCapacity;
+	BatchedHealthBar->AmmoRatio = MagCapacity > 0
+		                              ? FMath::Clamp(static_cast<float>(BulletsLeft) / MagCapacity, 0.f, 1.f)
+		                              : 0.f;
+}
+
+void UHealthComponent::TrackAmmoOfWeapon(UWeaponState* Weapon)
+{
+	UnbindAmmoTrackedWeapon();
+	if (not IsValid(Weapon))
+	{
+		RTSFunctionLibrary::ReportNullErrorInitialisation(this, "Weapon", "UHealthComponent::TrackAmmoOfWeapon");
+		return;
+	}
+	M_AmmoTrackedWeapon = Weapon;
+	TWeakObjectPtr<UHealthComponent> WeakThis(this);
+	M_AmmoMagConsumedHandle = Weapon->OnMagConsumed.AddLambda([WeakThis](const int32 BulletsLeft)-> void
+	{
+		if (WeakThis.IsValid())
+		{
+			WeakThis->Batched_UpdateAmmo(BulletsLeft);
+		}
+	});
+	Batched_UpdateAmmo(Weapon->GetCurrentMagCapacity());
+}
+
+void UHealthComponent::TrackBombsOf(UBombComponent* BombComponent)
+{
+	UnbindTrackedBombComponent();
+	if (not IsValid(BombComponent))
+	{
+		RTSFunctionLibrary::ReportNullErrorInitialisation(this, "BombComponent", "UHealthComponent::TrackBombsOf");
+		return;
+	}
+	M_TrackedBombComponent = BombComponent;
+	TWeakObjectPtr<UHealthComponent> WeakThis(this);
+	M_BombMagConsumedHandle = BombComponent->OnMagConsumed.AddLambda([WeakThis](const int32 BombsLeft)-> void
+	{
+		if (WeakThis.IsValid())
+		{
+			WeakThis->Batched_UpdateBombs(BombsLeft);
+		}
+	});
+}
+
+void UHealthComponent::Batched_UpdateBombs(const int32 BombsLeft)
+{
+	// Same lazy capacity as UW_BombHealthBar: the bomb bay broadcasts its full count on init and reload.
+	M_BombsLeft = FMath::Max(0, BombsLeft);
+	M_MaxBombsSeen = FMath::Max(M_MaxBombsSeen, M_BombsLeft);
+	FRTSBatchedHealthBar* BatchedHealthBar = Batched_GetHealthBar();
+	if (not BatchedHealthBar)
+	{
+		return;
+	}
+	BatchedHealthBar->AmmoRatio = M_MaxBombsSeen > 0 ? static_cast<float>(M_BombsLeft) / M_MaxBombsSeen : 0.f;
+	BatchedHealthBar->AmmoSegments = M_MaxBombsSeen;
+}
+
+void UHealthComponent::UnbindTrackedBombComponent()
+{
+	if (M_TrackedBombComponent.IsValid() && M_BombMagConsumedHandle.IsValid())
+	{
+		M_TrackedBombComponent->OnMagConsumed.Remove(M_BombMagConsumedHandle);
+	}
+	M_BombMagConsumedHandle.Reset();
+	M_TrackedBombComponent.Reset();
+}
+
+void UHealthComponent::SetupGarrison(const int32 Slots, const int32 Seats, const int32 MaxSquads,
+                                     const EGarrisonSeatsTextType TypeText) const
+{
+	if (FRTSBatchedHealthBar* BatchedHealthBar = Batched_GetHealthBar())
+	{
+		BatchedHealthBar->Garrison.Setup(Slots, Seats, MaxSquads, TypeText);
+	}
+}
+
+void UHealthComponent::UpdateGarrisonSlot(const int32 SlotIndex, const bool bIsOccupied,
+                                          const int32 SeatsTakenOrBecameVacant) const
+{
+	if (FRTSBatchedHealthBar* BatchedHealthBar = Batched_GetHealthBar())
+	{
+		BatchedHealthBar->Garrison.UpdateSlot(SlotIndex, bIsOccupied, SeatsTakenOrBecameVacant);
+	}
+}
+
+void UHealthComponent::OnGarrisonEnabled(const bool bEnabled) const
+{
+	if (FRTSBatchedHealthBar* BatchedHealthBar = Batched_GetHealthBar())
+	{
+		BatchedHealthBar->Garrison.bIsEnabled = bEnabled;
+	}
+}
+
+bool UHealthComponent::SetBatchedWeaponIcon(const FSquadWeaponIconDisplaySettings& WeaponIconSettings) const
+{
+	FRTSBatchedHealthBar* BatchedHealthBar = Batched_GetHealthBar();
+	if (not BatchedHealthBar)
+	{
+		return false;
+	}
+	BatchedHealthBar->SetWeaponIcon(WeaponIconSettings);
+	return true;
+}
+
+void UHealthComponent::UnbindAmmoTrackedWeapon()
+{
+	if (M_AmmoTrackedWeapon.IsValid() && M_AmmoMagConsumedHandle.IsValid())
+	{
+		M_AmmoTrackedWeapon->OnMagConsumed.Remove(M_AmmoMagConsumedHandle);
+	}
+	M_AmmoMagConsumedHandle.Reset();
+	M_AmmoTrackedWeapon.Reset();
+}
+
+bool UHealthComponent::GetHasBatchedHealthBar() const
+{
+	return Batched_GetHealthBar() != nullptr;
+}
+
+bool UHealthComponent::GetHasHealthBar() const
+{
+	if (GetUsesBatchedHealthBar())
+	{
+		return Batched_GetHealthBar() != nullptr;
+	}
+	return M_HealthBarWidget.IsValid();
+}
+
+bool UHealthComponent::GetIsValidHealthBar() const
+{
+	if (GetUsesBatchedHealthBar())
+	{
+		return Batched_GetHealthBar() != nullptr;
+	}
+	return Widget_GetIsValidHealthBarWidget();
+}
+
+void UHealthComponent::SetHealthBarVisible(const bool bVisible) const
+{
+	if (FRTSBatchedHealthBar* BatchedHealthBar = Batched_GetHealthBar())
+	{
+		BatchedHealthBar->bIsVisible = bVisible;
+		return;
+	}
+	if (M_HealthBarWidget.IsValid())
+	{
+		M_HealthBarWidget->SetVisibility(bVisible ? ESlateVisibility::Visible : ESlateVisibility::Hidden);
+	}
+}
+
 void UHealthComponent::OnWidgetInitialized()
 {
 	if (not Widget_GetIsValidHealthBarWidget() || not Widget_GetIsValidWidgetComponent())
@@ -548,13 +875,14 @@ bool UHealthComponent::CanTolerateFireDamage(const float Damage)
 	}
 
 	// Drive the UI: fill 0..1 as threshold accumulates
+	const float Ratio = (M_FireThresholdState.MaxFireThreshold > 0.f)
+		                    ? (M_FireThresholdState.CurrentFireThreshold / M_FireThresholdState.MaxFireThreshold)
+		                    : 0.f;
 	if (M_HealthBarWidget.IsValid())
 	{
-		const float Ratio = (M_FireThresholdState.MaxFireThreshold > 0.f)
-			                    ? (M_FireThresholdState.CurrentFireThreshold / M_FireThresholdState.MaxFireThreshold)
-			                    : 0.f;
 		M_HealthBarWidget->OnFireDamage(Ratio);
 	}
+	Batched_UpdateFireThreshold(Ratio);
 
 	// If we reached (or exceeded by clamp) the cap, caller should apply REAL damage as well.
 	const bool bCanStillTolerate = (M_FireThresholdState.CurrentFireThreshold < M_FireThresholdState.MaxFireThreshold);
@@ -575,6 +903,11 @@ bool UHealthComponent::Widget_GetIsValidHealthBarWidget() const
 	{
 		return true;
 	}
+	if (GetUsesBatchedHealthBar())
+	{
+		// Batched health bars have no widget; the widget-only elements are not shown.
+		return false;
+	}
 	const FString Name = GetName();
 	const FString OwnerName = IsValid(GetOwner()) ? GetOwner()->GetName() : "NullPtr";
 	RTSFunctionLibrary::ReportError("Invalid M_HealthBarWidget on component: " + Name +
@@ -626,6 +959,12 @@ void UHealthComponent::UpdateHealthBar()
 		M_ActionUIManager->UpdateHealthBar(Percentage, MaxHealth, CurrentHealth);
 	}
 
+	if (FRTSBatchedHealthBar* BatchedHealthBar = Batched_GetHealthBar())
+	{
+		BatchedHealthBar->SetHealthRatio(Percentage, GetWorld()->GetTimeSeconds());
+		UpdateVisibilityOnHealthChange(Percentage);
+		return;
+	}
 	if (Widget_GetIsValidHealthBarWidget())
 	{
 		M_HealthBarWidget->OnDamaged(Percentage);
@@ -749,23 +1088,18 @@ void UHealthComponent::Debug(const FString& Message, const FColor& Color) const
 
 void UHealthComponent::ApplyHealthBarVisibilityPolicy(const float CurrentPct) const
 {
-	if (!M_HealthBarWidget.IsValid())
+	if (not GetHasHealthBar())
 	{
 		return;
 	}
 
 	if (bWasHiddenByAllGameUI)
 	{
-		M_HealthBarWidget->SetVisibility(ESlateVisibility::Hidden);
+		SetHealthBarVisible(false);
 		return;
 	}
 
-	const ESlateVisibility Target =
-		ShouldDisplayHealthForPercentage(CurrentPct)
-			? ESlateVisibility::Visible
-			: ESlateVisibility::Hidden;
-
-	M_HealthBarWidget->SetVisibility(Target);
+	SetHealthBarVisible(ShouldDisplayHealthForPercentage(CurrentPct));
 }
 
 
@@ -799,13 +1133,14 @@ void UHealthComponent::OnFireRecoveryTick()
 	M_FireThresholdState.CurrentFireThreshold = FMath::Max(
 		0.f, M_FireThresholdState.CurrentFireThreshold - M_FireThresholdState.FireRecoveryPerSec);
 
+	const float Ratio = (M_FireThresholdState.MaxFireThreshold > 0.f)
+		                    ? (M_FireThresholdState.CurrentFireThreshold / M_FireThresholdState.MaxFireThreshold)
+		                    : 0.f;
 	if (M_HealthBarWidget.IsValid())
 	{
-		const float Ratio = (M_FireThresholdState.MaxFireThreshold > 0.f)
-			                    ? (M_FireThresholdState.CurrentFireThreshold / M_FireThresholdState.MaxFireThreshold)
-			                    : 0.f;
 		M_HealthBarWidget->OnFireRecovery(Ratio);
 	}
+	Batched_UpdateFireThreshold(Ratio);
 
 	// Stop when fully recovered
 	if (M_FireThresholdState.CurrentFireThreshold <= 0.f)
@@ -976,14 +1311,14 @@ void UHealthComponent::UpdateVisibilityAfterSettingsChange()
 		return;
 	}
 
-	if (not Widget_GetIsValidHealthBarWidget())
+	if (not GetIsValidHealthBar())
 	{
 		return;
 	}
 
 	if (bWasHiddenByAllGameUI)
 	{
-		M_HealthBarWidget->SetVisibility(ESlateVisibility::Hidden);
+		SetHealthBarVisible(false);
 		return;
 	}
 
@@ -992,7 +1327,7 @@ void UHealthComponent::UpdateVisibilityAfterSettingsChange()
 		const USelectionComponent* const SelectionComponent = M_SelectionComponent.Get();
 		if (IsValid(SelectionComponent) && SelectionComponent->GetIsSelected())
 		{
-			M_HealthBarWidget->SetVisibility(ESlateVisibility::Visible);
+			SetHealthBarVisible(true);
 			return;
 		}
 	}
@@ -1016,10 +1351,20 @@ void UHealthComponent::RegisterCallBackForUnitName(URTSComponent* RTSComponent)
 		{
 			return;
 		}
-		if (WeakThis->M_RTSComponent.IsValid() && WeakThis->Widget_GetIsValidHealthBarWidget())
+		if (not WeakThis->M_RTSComponent.IsValid())
+		{
+			return;
+		}
+		bool bIsValidString = false;
+		const FString UnitName = WeakThis->M_RTSComponent->GetDisplayName(bIsValidString);
+		if (FRTSBatchedHealthBar* BatchedHealthBar = WeakThis->Batched_GetHealthBar())
+		{
+			BatchedHealthBar->UnitName = bIsValidString ? UnitName : FString();
+			return;
+		}
+		if (WeakThis->Widget_GetIsValidHealthBarWidget())
 		{
-			bool bIsValidString = false;
-			WeakThis->M_HealthBarWidget->SetupUnitName(WeakThis->M_RTSComponent->GetDisplayName(bIsValidString));
+			WeakThis->M_HealthBarWidget->SetupUnitName(UnitName);
 		}
 	};
 	M_RTSComponent->OnSubTypeInitialized.AddLambda(OnUnitName);
@@ -1032,11 +1377,11 @@ void UHealthComponent::OnUnitHovered() const
 	{
 		return;
 	}
-	if (not Widget_GetIsValidHealthBarWidget() || bWasHiddenByAllGameUI)
+	if (not GetIsValidHealthBar() || bWasHiddenByAllGameUI)
 	{
 		return;
 	}
-	M_HealthBarWidget->SetVisibility(ESlateVisibility::Visible);
+	SetHealthBarVisible(true);
 }
 
 void UHealthComponent::OnUnitUnhovered() const
@@ -1045,7 +1390,7 @@ void UHealthComponent::OnUnitUnhovered() const
 	{
 		return;
 	}
-	if (not Widget_GetIsValidHealthBarWidget())
+	if (not GetIsValidHealthBar())
 	{
 		return;
 	}
@@ -1059,12 +1404,12 @@ void UHealthComponent::OnUnitSelected() const
 		return;
 	}
 
-	if (not Widget_GetIsValidHealthBarWidget() || bWasHiddenByAllGameUI)
+	if (not GetIsValidHealthBar() || bWasHiddenByAllGameUI)
 	{
 		return;
 	}
 
-	M_HealthBarWidget->SetVisibility(ESlateVisibility::Visible);
+	SetHealthBarVisible(true);
 }
 
 void UHealthComponent::OnUnitDeselected() const
@@ -1074,7 +1419,7 @@ void UHealthComponent::OnUnitDeselected() const
 		return;
 	}
 
-	if (not Widget_GetIsValidHealthBarWidget())
+	if (not GetIsValidHealthBar())
 	{
 		return;
 	}
@@ -11,6 +11,7 @@
 #include "HealthInterface/HealthBarIcons/HealthBarIcons.h"
 #include "RTS_Survival/Game/GameState/HideGameUI/RTSUIElement.h"
 #include "RTS_Survival/Game/UserSettings/GameplaySettings/HealthbarVisibilityStrategy/HealthBarVisibilityStrategy.h"
+#include "RTS_Survival/GameUI/Healthbar/HealthBarSettings/HealthBarRenderMode.h"
 #include "RTS_Survival/GameUI/Healthbar/HealthBarSettings/HealthBarVisibilitySettings.h"
 #include "RTS_Survival/Weapons/WeaponData/RTSDamageTypes/RTSDamageTypes.h"
 #include "RTS_Survival/Weapons/WeaponData/WeaponShellType/WeaponShellType.h"
@@ -18,6 +19,9 @@
 #include "HealthComponent.generated.h"
 
 enum class EVeterancyIconSet : uint8;
+enum class EGarrisonSeatsTextType : uint8;
+struct FSquadWeaponIconDisplaySettings;
+class UBombComponent;
 struct FResistanceAndDamageReductionData;
 class UWeaponState;
 enum class EWeaponShellType : uint8;
@@ -31,6 +35,8 @@ class IHealthBarOwner;
 enum class EHealthLevel : uint8;
 class ACameraPawn;
 class UProgressBar;
+class URTSHealthBarRenderSubsystem;
+struct FRTSBatchedHealthBar;
 
 USTRUCT()
 struct FHealthComponentSelectionDelegateHandles
@@ -66,7 +72,8 @@ public:
 	FHealthBarWidgetCallbacks M_HealthBarWidgetCallbacks;
 
 	// If the derived BP of this healthbar supports a rank icon then this will update it.
-	void UpdateRankIcon(const int32 NewRankLevel, const EVeterancyIconSet VeterancyIconSet) const;
+	// Batched bars draw the rank icon configured in the target type icon settings.
+	void UpdateRankIcon(const int32 NewRankLevel, const EVeterancyIconSet VeterancyIconSet);
 
 	UFUNCTION(BlueprintCallable, NotBlueprintable)
 	void MakeHealthBarInvisible() const;
@@ -147,18 +154,58 @@ public:
 	virtual void OnOverwiteHealthbarVisiblityEnemy(ERTSEnemyHealthBarVisibilityStrategy Strategy);
 
 	// Not null checked; may still be loading; if so overwrite OnWigetInitialized.
+	// Always null for batched health bars.
 	UW_HealthBar* GetHealthBarWidget() const;
 
+	/**
+	 * @return Whether the health bar is drawn by the batched health bar renderer instead of a widget component.
+	 * @note Derived from the defaults only, so it is valid before BeginPlay.
+	 */
+	bool GetUsesBatchedHealthBar() const;
+
+	/** @return Whether the batched health bar of this component is registered with the renderer. */
+	bool GetHasBatchedHealthBar() const;
+
+	/**
+	 * @brief Shows the ammo left in the magazine of the weapon on the batched health bar.
+	 * Used by the ammo tracker instead of binding a UW_AmmoHealthBar when the health bar is batched.
+	 */
+	void TrackAmmoOfWeapon(UWeaponState* Weapon);
+
+	/**
+	 * @brief Shows the bombs left in the bomb bay as one segment per bomb on the batched health bar.
+	 * Used by the bomb tracker instead of binding a UW_BombHealthBar when the health bar is batched.
+	 */
+	void TrackBombsOf(UBombComponent* BombComponent);
+
+	/**
+	 * @brief Garrison seats on the batched health bar; used by the cargo component instead of the
+	 * UW_GarrisonHealthBar functions of the same name.
+	 */
+	void SetupGarrison(const int32 Slots, const int32 Seats, const int32 MaxSquads,
+	                   const EGarrisonSeatsTextType TypeText) const;
+	void UpdateGarrisonSlot(const int32 SlotIndex, const bool bIsOccupied, const int32 SeatsTakenOrBecameVacant) const;
+	void OnGarrisonEnabled(const bool bEnabled) const;
+
 protected:
 	// Called when the game starts
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	virtual void BeginPlay_ApplyUserSettingsHealthBarVisibility();
 
+	/** @return Whether the icon was set; false if this component has no registered batched bar. */
+	bool SetBatchedWeaponIcon(const FSquadWeaponIconDisplaySettings& WeaponIconSettings) const;
+
 	// Leave this empty if we do not want to use a health widget on this actor.
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "HealthWidget")
 	TSubclassOf<UW_HealthBar> HealthBarWidgetClass = nullptr;
 
+	// Batched bars are drawn by the HUD in one pass with all other bars; the widget class is then only used to
+	// determine whether the unit has a health bar. Use WidgetComponent for bars with custom widget blueprint elements.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "HealthWidget|Render")
+	EHealthBarRenderMode HealthBarRenderMode = EHealthBarRenderMode::Batched;
+
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "HealthWidget|Render")
 	FVector2D WidgetXYScales = FVector2D(1.0f, 1.0f);
 
@@ -189,12 +236,52 @@ protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
 	TArray<EHealthLevel> HealthLevelsToNotifyOn;
 
+	// Also called once a batched bar is registered; the widget is then null.
 	virtual void OnWidgetInitialized();
 	
 
 private:
+	friend class URTSHealthBarRenderSubsystem;
+
 	void Widget_CreateHealthBar();
 
+	void BeginPlay_RegisterBatchedHealthBar();
+
+	// Set at BeginPlay once the bar is registered with the batched renderer.
+	bool bM_UsesBatchedHealthBar = false;
+
+	// Index into the flat arrays of the health bar render subsystem; maintained by the subsystem.
+	int32 M_BatchedHealthBarIndex = INDEX_NONE;
+
+	/** @return The render state of the batched bar, nullptr if this component does not use a batched bar. */
+	FRTSBatchedHealthBar* Batched_GetHealthBar() const;
+	void Batched_UpdateFireThreshold(const float Ratio) const;
+	void Batched_UpdateAmmo(const int32 BulletsLeft) const;
+
+	TWeakObjectPtr<UWeaponState> M_AmmoTrackedWeapon;
+	FDelegateHandle M_AmmoMagConsumedHandle;
+	void UnbindAmmoTrackedWeapon();
+
+	TWeakObjectPtr<UBombComponent> M_TrackedBombComponent;
+	FDelegateHandle M_BombMagConsumedHandle;
+	// Largest bomb count seen; reloads broadcast the full bomb bay.
+	int32 M_MaxBombsSeen = 0;
+	int32 M_BombsLeft = INDEX_NONE;
+	void Batched_UpdateBombs(const int32 BombsLeft);
+	void UnbindTrackedBombComponent();
+
+	// Pushed to the batched bar when it registers; the widget keeps its own rank icon.
+	int32 M_RankLevel = INDEX_NONE;
+	EVeterancyIconSet M_RankIconSet{};
+
+	/** @return Whether there is a widget or batched health bar to show; does not report errors. */
+	bool GetHasHealthBar() const;
+	/** @return Whether there is a widget or batched health bar to show; reports an invalid widget. */
+	bool GetIsValidHealthBar() const;
+
+	/** @brief Shows or hides the widget or the batched bar. */
+	void SetHealthBarVisible(const bool bVisible) const;
+
 	bool CanTolerateFireDamage(const float Damage);
 
 	void InitFireThresholdData(const float NewMaxFireThreshold, const float NewFireRecovery);
@@ -5,9 +5,11 @@
 
 #include "RTSOptimizationDistance.h"
 #include "RTS_Survival/RTSComponents/VehicleFireFeedbackComponent/VehicleFireFeedbackComponent.h"
-#include "RTS_Survival/Player/CPPController.h"
+#include "DrawDebugHelpers.h"
 #include "GameFramework/CharacterMovementComponent.h"
-#include "RTS_Survival/Utils/RTS_Statics/RTS_Statics.h"
+#include "RTS_Survival/DeveloperSettings.h"
+#include "RTS_Survival/Subsystems/OptimizationSubsystem/RTSOptimizationSubsystem.h"
+#include "RTS_Survival/Utils/HFunctionLibary.h"
 
 
 URTSOptimizer::URTSOptimizer()
@@ -18,29 +20,23 @@ URTSOptimizer::URTSOptimizer()
 
 void URTSOptimizer::SetOptimizationEnabled(const bool bEnable)
 {
-	if (not GetWorld())
+	URTSOptimizationSubsystem* OptimizationSubsystem = GetOptimizationSubsystem();
+	if (not OptimizationSubsystem)
 	{
 		return;
 	}
-	if (bEnable && GetWorld()->GetTimerManager().IsTimerActive(M_OptimizationTimer))
+	if (bEnable && OptimizationSubsystem->GetIsRegistered(this))
 	{
 		RTSFunctionLibrary::PrintString("Optimization already active! Will not enable again.", FColor::Red);
 		return;
 	}
 	if (bEnable)
 	{
-		const float InitialDelay = FMath::RandRange(0.01f, 0.1f);
-		M_OptimizeInterval = FMath::RandRange(0.25f, 0.5f);
-		GetWorld()->GetTimerManager().SetTimer(M_OptimizationTimer,
-		                                       this,
-		                                       &URTSOptimizer::OptimizeTick,
-		                                       M_OptimizeInterval,
-		                                       true,
-		                                       InitialDelay);
+		OptimizationSubsystem->RegisterOptimizer(this);
 	}
 	else
 	{
-		GetWorld()->GetTimerManager().ClearTimer(M_OptimizationTimer);
+		OptimizationSubsystem->UnregisterOptimizer(this);
 		// Set all components to be as if in FOV.
 		InFOVUpdateComponents();
 		// reset.
@@ -66,7 +62,6 @@ void URTSOptimizer::BeginPlay()
 	{
 		return;
 	}
-	BeginPlay_SetPlayerController();
 	BeginPlay_SetupComponentReferences();
 	SetOptimizationEnabled(true);
 }
@@ -87,15 +82,11 @@ void URTSOptimizer::BeginDestroy()
 	SetOptimizationEnabled(false);
 }
 
-void URTSOptimizer::OptimizeTick()
+void URTSOptimizer::ApplyOptimizationDistance(const ERTSOptimizationDistance NewOptimizationDistance)
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE(RTSOptimizer_Tick);
-	if (not GetOwner())
-	{
-		return;
-	}
-	const auto NewOptimizationDistance = GetOptimizationDistanceToCamera();
-	if (NewOptimizationDistance == M_PreviousOptimizationDistance)
+	TRACE_CPUPROFILER_EVENT_SCOPE(RTSOptimizer_ApplyOptimizationDistance);
+	using DeveloperSettings::Optimization::OptimizerClassificationInterval;
+	if (not GetOwner() || NewOptimizationDistance == M_PreviousOptimizationDistance)
 	{
 		return;
 	}
@@ -108,7 +99,7 @@ void URTSOptimizer::OptimizeTick()
 		if constexpr (DeveloperSettings::Debugging::GOptimComponent_Compile_DebugSymbols)
 		{
 			DrawDebugString(GetWorld(), GetOwner()->GetActorLocation() + FVector(0, 0, 300),
-			                "In FOV!", nullptr, FColor::Red, M_OptimizeInterval);
+			                "In FOV!", nullptr, FColor::Red, OptimizerClassificationInterval);
 		}
 		InFOVUpdateComponents();
 		break;
@@ -117,7 +108,7 @@ void URTSOptimizer::OptimizeTick()
 		if constexpr (DeveloperSettings::Debugging::GOptimComponent_Compile_DebugSymbols)
 		{
 			DrawDebugString(GetWorld(), GetOwner()->GetActorLocation() + FVector(0, 0, 300),
-			                "Out of FOV close!", nullptr, FColor::Orange, M_OptimizeInterval);
+			                "Out of FOV close!", nullptr, FColor::Orange, OptimizerClassificationInterval);
 		}
 		OutFovCloseUpdateComponents();
 		break;
@@ -125,7 +116,7 @@ void URTSOptimizer::OptimizeTick()
 		if constexpr (DeveloperSettings::Debugging::GOptimComponent_Compile_DebugSymbols)
 		{
 			DrawDebugString(GetWorld(), GetOwner()->GetActorLocation() + FVector(0, 0, 300),
-			                "Out of FOV far!", nullptr, FColor::Yellow, M_OptimizeInterval);
+			                "Out of FOV far!", nullptr, FColor::Yellow, OptimizerClassificationInterval);
 		}
 		OutFovFarUpdateComponents();
 		break;
@@ -298,50 +289,14 @@ void URTSOptimizer::AddPrimitiveComponentToOptimize(UPrimitiveComponent* Primiti
 }
 
 
-ERTSOptimizationDistance URTSOptimizer::GetOptimizationDistanceToCamera() const
-{
-	if (!M_PlayerController || !(M_PlayerController->PlayerCameraManager))
-	{
-		return ERTSOptimizationDistance::InFOV;
-	}
-	
-	FVector CamLoc;
-	FRotator CamRotation;
-	M_PlayerController->GetPlayerViewPoint(CamLoc, CamRotation);
-	const FVector OwnerLocation = GetOwner()->GetActorLocation();
-	const FVector ToActor = (OwnerLocation - CamLoc).GetSafeNormal();
-	const FVector Forward = CamRotation.Vector();
-	
-	// half-angle in radians
-	const float HalfFovRad = FMath::DegreesToRadians(M_PlayerController->PlayerCameraManager->GetFOVAngle() * 0.5f);
-	const float CosHalfFov = FMath::Cos(HalfFovRad);
-	
-	// if the dot-product is above cos(halfFov), actor is inside the view cone
-	const bool InFOV = FVector::DotProduct(Forward, ToActor) >= CosHalfFov;
-	
-	const float SquaredDistanceToCamera = FVector::DistSquared(OwnerLocation, CamLoc);
-	if (not InFOV)
-	{
-		if (SquaredDistanceToCamera <= DeveloperSettings::Optimization::DistanceAlwaysConsiderUnitInFOVSquared)
-		{
-			return ERTSOptimizationDistance::InFOV;
-		}
-		if (SquaredDistanceToCamera >= DeveloperSettings::Optimization::OutOfFOVConsideredFarAwayUnitSquared)
-		{
-			return ERTSOptimizationDistance::OutFOVFar;
-		}
-		return ERTSOptimizationDistance::OutFOVClose;
-	}
-	return ERTSOptimizationDistance::InFOV;
-}
-
-void URTSOptimizer::BeginPlay_SetPlayerController()
+URTSOptimizationSubsystem* URTSOptimizer::GetOptimizationSubsystem() const
 {
-	M_PlayerController = FRTS_Statics::GetRTSController(this);
-	if (not M_PlayerController)
+	const UWorld* World = GetWorld();
+	if (not World)
 	{
-		RTSFunctionLibrary::ReportError("Failed to set player controller for URTSOptimizer!");
+		return nullptr;
 	}
+	return World->GetSubsystem<URTSOptimizationSubsystem>();
 }
 
 void URTSOptimizer::BeginPlay_SetupComponentReferences()
@@ -8,7 +8,7 @@
 #include "GameFramework/CharacterMovementComponent.h"
 #include "RTSOptimizer.generated.h"
 
-class ACPPController;
+class URTSOptimizationSubsystem;
 class UVehicleFireFeedbackComponent;
 
 USTRUCT()
@@ -80,6 +80,9 @@ class RTS_SURVIVAL_API URTSOptimizer : public UActorComponent
 {
 	GENERATED_BODY()
 
+	// Classifies all optimizers against the camera and applies their bucket transitions.
+	friend class URTSOptimizationSubsystem;
+
 public:
 	URTSOptimizer();
 
@@ -119,20 +122,16 @@ private:
 	UPROPERTY()
 	TArray<FRTSVehicleFireFeedbackOptimizationSettings> M_VehicleFireFeedbackComponents = {};
 
-	FTimerHandle M_OptimizationTimer;
-
-	void OptimizeTick();
+	// Index of this optimizer in the arrays of the optimization subsystem, INDEX_NONE while not registered.
+	int32 M_OptimizationEntryIndex = INDEX_NONE;
 
-	float M_OptimizeInterval = 0.f;
+	/** @brief Called by the optimization subsystem when the FOV bucket of the owner changed. */
+	void ApplyOptimizationDistance(const ERTSOptimizationDistance NewOptimizationDistance);
 
 	ERTSOptimizationDistance M_PreviousOptimizationDistance = ERTSOptimizationDistance::None;
 
-	ERTSOptimizationDistance GetOptimizationDistanceToCamera() const;
-
-	UPROPERTY()
-	TObjectPtr<ACPPController> M_PlayerController = nullptr;
+	URTSOptimizationSubsystem* GetOptimizationSubsystem() const;
 
-	void BeginPlay_SetPlayerController();
 	void BeginPlay_SetupComponentReferences();
 
 
@@ -7,6 +7,7 @@
 #include "Components/DecalComponent.h"
 #include "GameFramework/GameState.h"
 #include "RTS_Survival/Game/GameState/CPPGameState.h"
+#include "RTS_Survival/Subsystems/ComponentRegistrySubsystem/RTSComponentRegistrySubsystem.h"
 #include "RTS_Survival/Utils/HFunctionLibary.h"
 
 // Sets default values for this component's properties
@@ -192,6 +193,12 @@ void USelectionComponent::UpdateDecalScale(const FVector NewScale)
 void USelectionComponent::BeginPlay()
 {
 	Super::BeginPlay();
+	// Registered so setting changes reach this component without scanning the world's actors.
+	if (URTSComponentRegistrySubsystem* ComponentRegistry = GetComponentRegistry())
+	{
+		ComponentRegistry->RegisterComponent(this);
+	}
+
 	AActor* Owner = GetOwner();
 	const FString OwnerName = IsValid(Owner) ? Owner->GetName() : TEXT("nullptr");
 	if (AGameStateBase* GameStateBase = GetWorld() != nullptr ? GetWorld()->GetGameState() : nullptr)
@@ -211,6 +218,25 @@ void USelectionComponent::BeginPlay()
 	}
 }
 
+void USelectionComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (URTSComponentRegistrySubsystem* ComponentRegistry = GetComponentRegistry())
+	{
+		ComponentRegistry->UnregisterComponent(this);
+	}
+	Super::EndPlay(EndPlayReason);
+}
+
+URTSComponentRegistrySubsystem* USelectionComponent::GetComponentRegistry() const
+{
+	const UWorld* World = GetWorld();
+	if (not World)
+	{
+		return nullptr;
+	}
+	return World->GetSubsystem<URTSComponentRegistrySubsystem>();
+}
+
 void USelectionComponent::BeginDestroy()
 {
 	if (GetWorld())
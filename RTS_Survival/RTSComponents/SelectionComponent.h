@@ -15,6 +15,7 @@ DECLARE_MULTICAST_DELEGATE(FOnUnitUnHovered);
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnPrimarySameTypeChanged, bool /*bIsInPrimarySameType*/);
 
 class UBoxComponent;
+class URTSComponentRegistrySubsystem;
 /**
  * @brief Container for SelectionArea and selection decals and associated parameters.
  * Allows for deselected decal to be null.
@@ -104,6 +105,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void BeginDestroy() override;
 
 	/**
@@ -142,6 +144,8 @@ private:
 	 */
 	void SetDecalDeselected() const;
 
+	URTSComponentRegistrySubsystem* GetComponentRegistry() const;
+
 	bool bM_UseDeselectDecal = false;
 
 	// Set with init function; area in which the unit can be selected.
@@ -0,0 +1,331 @@
+#include "RTSAuraSubsystem.h"
+
+#include "RTS_Survival/DeveloperSettings.h"
+#include "RTS_Survival/Game/GameState/GameUnitManager/GameUnitManager.h"
+#include "RTS_Survival/Utils/HFunctionLibary.h"
+#include "RTS_Survival/Utils/RTS_Statics/RTS_Statics.h"
+
+namespace RTSAuraSubsystemConstants
+{
+	constexpr uint8 PlayerTeam = 1;
+	constexpr uint8 EnemyTeam = 2;
+	constexpr float StatsWindowSeconds = 1.f;
+	// Epicenters are snapped to cells of this size before keying a query; small against any aura radius.
+	constexpr float EpicenterCellSize = 50.f;
+}
+
+bool URTSAuraSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	const UWorld* OuterWorld = Cast<UWorld>(Outer);
+	if (not IsValid(OuterWorld))
+	{
+		return false;
+	}
+
+	return OuterWorld->IsGameWorld();
+}
+
+void URTSAuraSubsystem::Deinitialize()
+{
+	M_SourceIds.Reset();
+	M_Settings.Reset();
+	M_Callbacks.Reset();
+	M_TimeUntilResolve.Reset();
+	M_EntryIndexBySourceId.Reset();
+	M_UnitRadii.Reset();
+	M_QueryIndexByKey.Reset();
+	M_QueryResults.Reset();
+	M_Deliveries.Reset();
+	M_DeliveryUnits.Reset();
+	ResetTeamIndices();
+	M_PlayerTeamIndex.Units.Reset();
+	M_EnemyTeamIndex.Units.Reset();
+	Super::Deinitialize();
+}
+
+void URTSAuraSubsystem::Tick(const float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+	TRACE_CPUPROFILER_EVENT_SCOPE(RTSAuraSubsystem_Tick);
+
+	UpdateStats(DeltaTime);
+
+	M_TimeSinceResolve += DeltaTime;
+	if (M_TimeSinceResolve < DeveloperSettings::Optimization::AuraResolveInterval)
+	{
+		return;
+	}
+	const float ElapsedSeconds = M_TimeSinceResolve;
+	M_TimeSinceResolve = 0.f;
+
+	Resolve_RemoveInvalidSources();
+	Resolve_QueryDueSources(ElapsedSeconds);
+	Resolve_DeliverResults();
+}
+
+TStatId URTSAuraSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(URTSAuraSubsystem, STATGROUP_Tickables);
+}
+
+int32 URTSAuraSubsystem::RegisterAuraSource(const FRTSAuraSourceSettings& Settings,
+                                            FRTSAuraSourceResolved&& OnResolved)
+{
+	if (not Settings.SourceActor.IsValid() || Settings.Radius <= 0.f || Settings.IntervalSeconds <= 0.f
+		|| not OnResolved)
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 SourceId = M_NextSourceId++;
+	const int32 EntryIndex = M_SourceIds.Add(SourceId);
+	M_Settings.Add(Settings);
+	M_Callbacks.Add(MakeShared<FRTSAuraSourceResolved>(MoveTemp(OnResolved)));
+	M_TimeUntilResolve.Add(FMath::Max(0.f, Settings.FirstResolveDelaySeconds));
+	M_EntryIndexBySourceId.Add(SourceId, EntryIndex);
+	return SourceId;
+}
+
+void URTSAuraSubsystem::UnregisterAuraSource(const int32 SourceId)
+{
+	const int32* EntryIndex = M_EntryIndexBySourceId.Find(SourceId);
+	if (not EntryIndex)
+	{
+		return;
+	}
+
+	RemoveEntryAtSwap(*EntryIndex);
+}
+
+void URTSAuraSubsystem::SetAuraSourceOverlapLogic(const int32 SourceId, const ETriggerOverlapLogic OverlapLogic)
+{
+	const int32* EntryIndex = M_EntryIndexBySourceId.Find(SourceId);
+	if (not EntryIndex)
+	{
+		return;
+	}
+
+	M_Settings[*EntryIndex].OverlapLogic = OverlapLogic;
+}
+
+bool URTSAuraSubsystem::GetIsRegistered(const int32 SourceId) const
+{
+	return M_EntryIndexBySourceId.Contains(SourceId);
+}
+
+void URTSAuraSubsystem::Resolve_RemoveInvalidSources()
+{
+	// Sources whose actor was destroyed without unregistering.
+	for (int32 EntryIndex = M_SourceIds.Num() - 1; EntryIndex >= 0; --EntryIndex)
+	{
+		if (not M_Settings[EntryIndex].SourceActor.IsValid())
+		{
+			RemoveEntryAtSwap(EntryIndex);
+		}
+	}
+}
+
+void URTSAuraSubsystem::Resolve_QueryDueSources(const float ElapsedSeconds)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(RTSAuraSubsystem_Query);
+	M_QueryIndexByKey.Reset();
+	M_Deliveries.Reset();
+	ResetTeamIndices();
+
+	for (int32 EntryIndex = 0; EntryIndex < M_SourceIds.Num(); ++EntryIndex)
+	{
+		float& TimeUntilResolve = M_TimeUntilResolve[EntryIndex];
+		TimeUntilResolve -= ElapsedSeconds;
+		if (TimeUntilResolve > 0.f)
+		{
+			continue;
+		}
+
+		// Keeps the phase of the source, so sources registered in the same pass with the same interval stay together.
+		TimeUntilResolve = FMath::Max(0.f, TimeUntilResolve + M_Settings[EntryIndex].IntervalSeconds);
+		const int32 QueryIndex = GetOrRunQuery(M_Settings[EntryIndex]);
+		M_Deliveries.Add({M_SourceIds[EntryIndex], QueryIndex});
+	}
+
+	M_SourcesEvaluatedInWindow += M_Deliveries.Num();
+	M_QueriesPerformedInWindow += M_QueryIndexByKey.Num();
+}
+
+void URTSAuraSubsystem::Resolve_DeliverResults()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(RTSAuraSubsystem_Deliver);
+	for (const FAuraDelivery& Delivery : M_Deliveries)
+	{
+		const int32* EntryIndex = M_EntryIndexBySourceId.Find(Delivery.SourceId);
+		if (not EntryIndex)
+		{
+			continue;
+		}
+
+		// Earlier callbacks of this pass may have destroyed units, e.g. with damage behaviours.
+		TArray<AActor*>& UnitsInRadius = M_QueryResults[Delivery.QueryIndex];
+		UnitsInRadius.RemoveAllSwap([](const AActor* Unit) { return not IsValid(Unit); }, EAllowShrinking::No);
+
+		const TSharedRef<FRTSAuraSourceResolved> OnResolved = M_Callbacks[*EntryIndex];
+		// The query is shared with sources on other actors, so it may hold this source's actor.
+		const int32 SourceUnitIndex = UnitsInRadius.Find(M_Settings[*EntryIndex].SourceActor.Get());
+		if (SourceUnitIndex == INDEX_NONE)
+		{
+			(*OnResolved)(UnitsInRadius);
+			continue;
+		}
+		M_DeliveryUnits = UnitsInRadius;
+		M_DeliveryUnits.RemoveAtSwap(SourceUnitIndex, 1, EAllowShrinking::No);
+		(*OnResolved)(M_DeliveryUnits);
+	}
+	M_Deliveries.Reset();
+}
+
+int32 URTSAuraSubsystem::GetOrRunQuery(const FRTSAuraSourceSettings& Settings)
+{
+	const AActor* SourceActor = Settings.SourceActor.Get();
+	const FVector Epicenter = SourceActor->GetActorLocation() + Settings.EpicenterOffset;
+	FAuraQueryKey Key;
+	Key.EpicenterCell = FIntVector(
+		FMath::RoundToInt32(Epicenter.X / RTSAuraSubsystemConstants::EpicenterCellSize),
+		FMath::RoundToInt32(Epicenter.Y / RTSAuraSubsystemConstants::EpicenterCellSize),
+		FMath::RoundToInt32(Epicenter.Z / RTSAuraSubsystemConstants::EpicenterCellSize));
+	Key.Radius = Settings.Radius;
+	Key.OverlapLogic = Settings.OverlapLogic;
+	if (const int32* ExistingQueryIndex = M_QueryIndexByKey.Find(Key))
+	{
+		return *ExistingQueryIndex;
+	}
+
+	const int32 QueryIndex = M_QueryIndexByKey.Num();
+	if (not M_QueryResults.IsValidIndex(QueryIndex))
+	{
+		M_QueryResults.AddDefaulted();
+	}
+	TArray<AActor*>& UnitsInRadius = M_QueryResults[QueryIndex];
+	UnitsInRadius.Reset();
+	const FVector CellCenter = FVector(Key.EpicenterCell) * RTSAuraSubsystemConstants::EpicenterCellSize;
+
+	if (Key.OverlapLogic == ETriggerOverlapLogic::OverlapEnemy
+		|| Key.OverlapLogic == ETriggerOverlapLogic::OverlapBoth)
+	{
+		QueryTeam(M_EnemyTeamIndex, RTSAuraSubsystemConstants::EnemyTeam, CellCenter, Key.Radius, UnitsInRadius);
+	}
+	if (Key.OverlapLogic == ETriggerOverlapLogic::OverlapPlayer
+		|| Key.OverlapLogic == ETriggerOverlapLogic::OverlapBoth)
+	{
+		QueryTeam(M_PlayerTeamIndex, RTSAuraSubsystemConstants::PlayerTeam, CellCenter, Key.Radius, UnitsInRadius);
+	}
+
+	M_QueryIndexByKey.Add(Key, QueryIndex);
+	return QueryIndex;
+}
+
+void URTSAuraSubsystem::QueryTeam(FAuraTeamIndex& TeamIndex, const uint8 Player, const FVector& Epicenter,
+                                  const float Radius, TArray<AActor*>& OutUnits)
+{
+	BuildTeamIndex(TeamIndex, Player);
+
+	M_QueryEntryIds.Reset();
+	TeamIndex.Grid.QuerySphere(Epicenter, Radius, M_QueryEntryIds);
+	for (const int32 EntryId : M_QueryEntryIds)
+	{
+		OutUnits.Add(TeamIndex.Units[EntryId]);
+	}
+}
+
+void URTSAuraSubsystem::BuildTeamIndex(FAuraTeamIndex& TeamIndex, const uint8 Player)
+{
+	if (TeamIndex.bIsBuilt)
+	{
+		return;
+	}
+	TRACE_CPUPROFILER_EVENT_SCOPE(RTSAuraSubsystem_BuildTeamIndex);
+	TeamIndex.bIsBuilt = true;
+	TeamIndex.Units.Reset();
+	TeamIndex.Locations.Reset();
+	TeamIndex.Radii.Reset();
+
+	const UGameUnitManager* GameUnitManager = FRTS_Statics::GetGameUnitManager(this);
+	if (not IsValid(GameUnitManager))
+	{
+		TeamIndex.Grid.Reset();
+		return;
+	}
+
+	GameUnitManager->GetAliveUnitsOfTeam(Player, TeamIndex.Units);
+	TeamIndex.Units.RemoveAllSwap([](const AActor* Unit) { return not IsValid(Unit); }, EAllowShrinking::No);
+	TeamIndex.Locations.Reserve(TeamIndex.Units.Num());
+	TeamIndex.Radii.Reserve(TeamIndex.Units.Num());
+	for (const AActor* Unit : TeamIndex.Units)
+	{
+		TeamIndex.Locations.Add(Unit->GetActorLocation());
+		TeamIndex.Radii.Add(GetUnitRadius(*Unit));
+	}
+	TeamIndex.Grid.Rebuild(TeamIndex.Locations, TeamIndex.Radii);
+}
+
+float URTSAuraSubsystem::GetUnitRadius(const AActor& Unit)
+{
+	const TObjectKey<AActor> UnitKey(&Unit);
+	if (const float* CachedRadius = M_UnitRadii.Find(UnitKey))
+	{
+		return *CachedRadius;
+	}
+
+	// Pads the unit the way its collision would have extended into a sphere sweep.
+	const float Radius = Unit.GetSimpleCollisionRadius();
+	M_UnitRadii.Add(UnitKey, Radius);
+	return Radius;
+}
+
+void URTSAuraSubsystem::ResetTeamIndices()
+{
+	M_PlayerTeamIndex.bIsBuilt = false;
+	M_EnemyTeamIndex.bIsBuilt = false;
+}
+
+void URTSAuraSubsystem::UpdateStats(const float DeltaTime)
+{
+	M_StatsWindowSeconds += DeltaTime;
+	if (M_StatsWindowSeconds < RTSAuraSubsystemConstants::StatsWindowSeconds)
+	{
+		return;
+	}
+
+	M_SourcesEvaluatedPerSecond = FMath::RoundToInt32(M_SourcesEvaluatedInWindow / M_StatsWindowSeconds);
+	M_QueriesPerformedPerSecond = FMath::RoundToInt32(M_QueriesPerformedInWindow / M_StatsWindowSeconds);
+	M_SourcesEvaluatedInWindow = 0;
+	M_QueriesPerformedInWindow = 0;
+	M_StatsWindowSeconds = 0.f;
+
+	for (auto It = M_UnitRadii.CreateIterator(); It; ++It)
+	{
+		if (not It.Key().ResolveObjectPtr())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	if constexpr (DeveloperSettings::Debugging::GAuraSubsystem_Compile_DebugSymbols)
+	{
+		RTSFunctionLibrary::PrintString(
+			FString::Printf(TEXT("Aura sources: %d registered, %d evaluated/s, %d queries/s"),
+			                M_SourceIds.Num(), M_SourcesEvaluatedPerSecond, M_QueriesPerformedPerSecond),
+			FColor::Cyan, RTSAuraSubsystemConstants::StatsWindowSeconds);
+	}
+}
+
+void URTSAuraSubsystem::RemoveEntryAtSwap(const int32 EntryIndex)
+{
+	M_EntryIndexBySourceId.Remove(M_SourceIds[EntryIndex]);
+
+	M_SourceIds.RemoveAtSwap(EntryIndex, 1, EAllowShrinking::No);
+	M_Settings.RemoveAtSwap(EntryIndex, 1, EAllowShrinking::No);
+	M_Callbacks.RemoveAtSwap(EntryIndex, 1, EAllowShrinking::No);
+	M_TimeUntilResolve.RemoveAtSwap(EntryIndex, 1, EAllowShrinking::No);
+	if (M_SourceIds.IsValidIndex(EntryIndex))
+	{
+		M_EntryIndexBySourceId.Add(M_SourceIds[EntryIndex], EntryIndex);
+	}
+}
@@ -0,0 +1,171 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RTSAuraUnitGrid.h"
+#include "RTS_Survival/Utils/CollisionSetup/TriggerOverlapLogic.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "RTSAuraSubsystem.generated.h"
+
+/** @brief Receives the units inside the radius of an aura source each time the source is resolved. */
+using FRTSAuraSourceResolved = TFunction<void(const TArray<AActor*>& UnitsInRadius)>;
+
+/** @brief Where, how often and for which team an aura source queries units. */
+struct FRTSAuraSourceSettings
+{
+	// The query is centered on this actor, which is never part of its own result.
+	TWeakObjectPtr<AActor> SourceActor;
+	FVector EpicenterOffset = FVector::ZeroVector;
+	float Radius = 0.f;
+	float IntervalSeconds = 1.f;
+	// Time until the first resolve; zero resolves the source in the next pass.
+	float FirstResolveDelaySeconds = 0.f;
+	ETriggerOverlapLogic OverlapLogic = ETriggerOverlapLogic::OverlapEnemy;
+};
+
+/**
+ * @brief World subsystem that resolves every registered AOE and aura source in one batched pass instead of an async
+ * sphere sweep per source and pulse. Each resolve interval the units of both teams are fetched from the game unit
+ * manager and bucketed in a grid per team, all sources that are due query those grids and only then are the results
+ * handed to the sources, so effects are applied in one pass after all queries ran. Due sources whose epicenters fall
+ * in the same small cell and that have the same radius and team share one query, even when they sit on different
+ * actors; each source's own actor is
+ * left out of the result it is handed.
+ * @note Only units registered with the game unit manager are found; sources that also need destructibles keep
+ * sweeping the physics scene.
+ */
+UCLASS()
+class RTS_SURVIVAL_API URTSAuraSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual bool IsTickableInEditor() const override { return false; }
+
+	/**
+	 * @brief Adds an aura source that is resolved every IntervalSeconds until it is unregistered.
+	 * @param Settings Source actor, radius, interval and team to query.
+	 * @param OnResolved Called with the units in the radius; capture the source weakly.
+	 * @return Id of the new source, INDEX_NONE if the settings are invalid.
+	 */
+	int32 RegisterAuraSource(const FRTSAuraSourceSettings& Settings, FRTSAuraSourceResolved&& OnResolved);
+
+	/** @brief Removes the source; safe to call from its own callback. Unknown ids are ignored. */
+	void UnregisterAuraSource(const int32 SourceId);
+
+	/** @brief Changes which team the source queries from its next resolve on, e.g. after its owner changed player. */
+	void SetAuraSourceOverlapLogic(const int32 SourceId, const ETriggerOverlapLogic OverlapLogic);
+
+	bool GetIsRegistered(const int32 SourceId) const;
+
+	/** @return Sources resolved during the last full second. */
+	int32 GetSourcesEvaluatedPerSecond() const { return M_SourcesEvaluatedPerSecond; }
+
+	/** @return Grid queries run during the last full second; fewer than the sources when queries are shared. */
+	int32 GetQueriesPerformedPerSecond() const { return M_QueriesPerformedPerSecond; }
+
+private:
+	/**
+	 * @brief A query shared by every due source with the same key in one pass; its result includes the sources.
+	 * The epicenter is snapped to a cell so sources that stand close together, such as a moving group, share it.
+	 */
+	struct FAuraQueryKey
+	{
+		FIntVector EpicenterCell = FIntVector::ZeroValue;
+		float Radius = 0.f;
+		ETriggerOverlapLogic OverlapLogic = ETriggerOverlapLogic::OverlapEnemy;
+
+		bool operator==(const FAuraQueryKey& Other) const
+		{
+			return EpicenterCell == Other.EpicenterCell && Radius == Other.Radius
+				&& OverlapLogic == Other.OverlapLogic;
+		}
+
+		friend uint32 GetTypeHash(const FAuraQueryKey& Key)
+		{
+			uint32 Hash = HashCombine(GetTypeHash(Key.EpicenterCell), GetTypeHash(Key.Radius));
+			return HashCombine(Hash, GetTypeHash(Key.OverlapLogic));
+		}
+	};
+
+	/** @brief Units of one team and the grid over their locations; entry i of the grid is Units[i]. */
+	struct FAuraTeamIndex
+	{
+		TArray<AActor*> Units;
+		TArray<FVector> Locations;
+		TArray<float> Radii;
+		FRTSAuraUnitGrid Grid;
+		bool bIsBuilt = false;
+	};
+
+	/** @brief Result of a due source in the current pass. */
+	struct FAuraDelivery
+	{
+		int32 SourceId = INDEX_NONE;
+		int32 QueryIndex = INDEX_NONE;
+	};
+
+	// Registered sources; entry i of every array below belongs to M_SourceIds[i].
+	TArray<int32> M_SourceIds;
+	TArray<FRTSAuraSourceSettings> M_Settings;
+	// Shared so a callback that registers or unregisters sources does not free itself while it runs.
+	TArray<TSharedRef<FRTSAuraSourceResolved>> M_Callbacks;
+	TArray<float> M_TimeUntilResolve;
+
+	TMap<int32, int32> M_EntryIndexBySourceId;
+	int32 M_NextSourceId = 0;
+
+	float M_TimeSinceResolve = 0.f;
+
+	// Rebuilt lazily per pass, only for the teams a due source queries.
+	FAuraTeamIndex M_PlayerTeamIndex;
+	FAuraTeamIndex M_EnemyTeamIndex;
+
+	// Collision radius per unit; computing it walks the unit's components, so it is only done once per unit.
+	TMap<TObjectKey<AActor>, float> M_UnitRadii;
+
+	// Scratch of the current pass.
+	TMap<FAuraQueryKey, int32> M_QueryIndexByKey;
+	TArray<TArray<AActor*>> M_QueryResults;
+	TArray<FAuraDelivery> M_Deliveries;
+	TArray<int32> M_QueryEntryIds;
+	// Result of a shared query without the delivered source's own actor.
+	TArray<AActor*> M_DeliveryUnits;
+
+	// Per second reporting.
+	float M_StatsWindowSeconds = 0.f;
+	int32 M_SourcesEvaluatedInWindow = 0;
+	int32 M_QueriesPerformedInWindow = 0;
+	int32 M_SourcesEvaluatedPerSecond = 0;
+	int32 M_QueriesPerformedPerSecond = 0;
+
+	void Resolve_RemoveInvalidSources();
+	/** @brief Runs one query per distinct key among the due sources and records which result each source receives. */
+	void Resolve_QueryDueSources(const float ElapsedSeconds);
+	/**
+	 * @brief Hands every due source its result without its own actor; sources unregistered by an earlier callback
+	 * are skipped.
+	 */
+	void Resolve_DeliverResults();
+
+	/**
+	 * @return Index in M_QueryResults of the query with the settings' key, run now if no due source ran it yet.
+	 * The query is centered on the epicenter cell, so it is off the exact epicenter by at most half a cell diagonal.
+	 */
+	int32 GetOrRunQuery(const FRTSAuraSourceSettings& Settings);
+	void QueryTeam(FAuraTeamIndex& TeamIndex, const uint8 Player, const FVector& Epicenter, const float Radius,
+	               TArray<AActor*>& OutUnits);
+	void BuildTeamIndex(FAuraTeamIndex& TeamIndex, const uint8 Player);
+	float GetUnitRadius(const AActor& Unit);
+	void ResetTeamIndices();
+
+	/** @brief Publishes the per second counters once a full second passed and drops radii of destroyed units. */
+	void UpdateStats(const float DeltaTime);
+
+	void RemoveEntryAtSwap(const int32 EntryIndex);
+};
@@ -0,0 +1,142 @@
+#include "RTSAuraUnitGrid.h"
+
+namespace RTSAuraUnitGridConstants
+{
+	// Around the size of a typical aura radius so most queries touch a 3x3 block of cells.
+	constexpr double PreferredCellSize = 1500.0;
+	// Caps the offset table; very spread out armies get larger cells instead.
+	constexpr int32 MaxCellsPerAxis = 128;
+}
+
+FRTSAuraUnitGrid::FRTSAuraUnitGrid()
+	: M_Origin(FVector2D::ZeroVector)
+	  , M_CellSize(RTSAuraUnitGridConstants::PreferredCellSize)
+	  , M_CellsX(0)
+	  , M_CellsY(0)
+	  , M_MaxEntryRadius(0.f)
+{
+}
+
+void FRTSAuraUnitGrid::Rebuild(const TArray<FVector>& Locations, const TArray<float>& Radii)
+{
+	Reset();
+	const int32 NumEntries = Locations.Num();
+	if (NumEntries == 0 || Radii.Num() != NumEntries)
+	{
+		return;
+	}
+
+	FBox2D Bounds(ForceInit);
+	for (int32 EntryIndex = 0; EntryIndex < NumEntries; ++EntryIndex)
+	{
+		Bounds += FVector2D(Locations[EntryIndex]);
+		M_MaxEntryRadius = FMath::Max(M_MaxEntryRadius, Radii[EntryIndex]);
+	}
+
+	const FVector2D Extent = Bounds.Max - Bounds.Min;
+	const double LargestAxis = FMath::Max(Extent.X, Extent.Y);
+	M_CellSize = FMath::Max(
+		RTSAuraUnitGridConstants::PreferredCellSize,
+		LargestAxis / RTSAuraUnitGridConstants::MaxCellsPerAxis);
+	M_Origin = Bounds.Min;
+	M_CellsX = FMath::Clamp(FMath::FloorToInt32(Extent.X / M_CellSize) + 1, 1,
+	                        RTSAuraUnitGridConstants::MaxCellsPerAxis);
+	M_CellsY = FMath::Clamp(FMath::FloorToInt32(Extent.Y / M_CellSize) + 1, 1,
+	                        RTSAuraUnitGridConstants::MaxCellsPerAxis);
+	const int32 NumCells = M_CellsX * M_CellsY;
+
+	// Counting sort: count entries per cell, prefix-sum into offsets, then scatter.
+	M_CellStarts.SetNumZeroed(NumCells + 1);
+	for (const FVector& Location : Locations)
+	{
+		++M_CellStarts[GetCellIndex(Location) + 1];
+	}
+	for (int32 CellIndex = 1; CellIndex <= NumCells; ++CellIndex)
+	{
+		M_CellStarts[CellIndex] += M_CellStarts[CellIndex - 1];
+	}
+
+	M_Locations.SetNumUninitialized(NumEntries);
+	M_Radii.SetNumUninitialized(NumEntries);
+	M_EntryIds.SetNumUninitialized(NumEntries);
+	M_WriteCursors = M_CellStarts;
+	for (int32 EntryIndex = 0; EntryIndex < NumEntries; ++EntryIndex)
+	{
+		const FVector& Location = Locations[EntryIndex];
+		const int32 WriteIndex = M_WriteCursors[GetCellIndex(Location)]++;
+		M_Locations[WriteIndex] = Location;
+		M_Radii[WriteIndex] = Radii[EntryIndex];
+		M_EntryIds[WriteIndex] = EntryIndex;
+	}
+}
+
+void FRTSAuraUnitGrid::Reset()
+{
+	M_CellStarts.Reset();
+	M_Locations.Reset();
+	M_Radii.Reset();
+	M_EntryIds.Reset();
+	M_CellsX = 0;
+	M_CellsY = 0;
+	M_MaxEntryRadius = 0.f;
+}
+
+void FRTSAuraUnitGrid::QuerySphere(const FVector& Center, const float Radius, TArray<int32>& OutEntryIds) const
+{
+	FIntPoint MinCell;
+	FIntPoint MaxCell;
+	if (not GetCellRange(Center, Radius, MinCell, MaxCell))
+	{
+		return;
+	}
+
+	for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; ++CellY)
+	{
+		const int32 RowStart = CellY * M_CellsX;
+		// Cells of one row are contiguous, so walk the row as a single span.
+		const int32 SpanStart = M_CellStarts[RowStart + MinCell.X];
+		const int32 SpanEnd = M_CellStarts[RowStart + MaxCell.X + 1];
+		for (int32 SortedIndex = SpanStart; SortedIndex < SpanEnd; ++SortedIndex)
+		{
+			const float ReachSquared = FMath::Square(Radius + M_Radii[SortedIndex]);
+			if (FVector::DistSquared(Center, M_Locations[SortedIndex]) > ReachSquared)
+			{
+				continue;
+			}
+			OutEntryIds.Add(M_EntryIds[SortedIndex]);
+		}
+	}
+}
+
+int32 FRTSAuraUnitGrid::GetCellIndex(const FVector& Location) const
+{
+	const int32 CellX = FMath::Clamp(FMath::FloorToInt32((Location.X - M_Origin.X) / M_CellSize), 0, M_CellsX - 1);
+	const int32 CellY = FMath::Clamp(FMath::FloorToInt32((Location.Y - M_Origin.Y) / M_CellSize), 0, M_CellsY - 1);
+	return CellY * M_CellsX + CellX;
+}
+
+bool FRTSAuraUnitGrid::GetCellRange(
+	const FVector& Center,
+	const float Radius,
+	FIntPoint& OutMinCell,
+	FIntPoint& OutMaxCell) const
+{
+	if (M_EntryIds.IsEmpty() || Radius < 0.f)
+	{
+		return false;
+	}
+
+	const double Reach = Radius + M_MaxEntryRadius;
+	const int32 MinX = FMath::FloorToInt32((Center.X - Reach - M_Origin.X) / M_CellSize);
+	const int32 MinY = FMath::FloorToInt32((Center.Y - Reach - M_Origin.Y) / M_CellSize);
+	const int32 MaxX = FMath::FloorToInt32((Center.X + Reach - M_Origin.X) / M_CellSize);
+	const int32 MaxY = FMath::FloorToInt32((Center.Y + Reach - M_Origin.Y) / M_CellSize);
+	if (MaxX < 0 || MaxY < 0 || MinX >= M_CellsX || MinY >= M_CellsY)
+	{
+		return false;
+	}
+
+	OutMinCell = FIntPoint(FMath::Max(0, MinX), FMath::Max(0, MinY));
+	OutMaxCell = FIntPoint(FMath::Min(M_CellsX - 1, MaxX), FMath::Min(M_CellsY - 1, MaxY));
+	return true;
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * @brief Flat uniform grid over the unit positions of one team, rebuilt once per aura resolve pass so every aura query
+ * only visits the cells its radius overlaps instead of sweeping the physics scene.
+ * Each entry is a sphere: the unit location padded by the unit's collision radius, so a query finds the units a sphere
+ * sweep of the same radius would have overlapped.
+ */
+class RTS_SURVIVAL_API FRTSAuraUnitGrid
+{
+public:
+	FRTSAuraUnitGrid();
+
+	/**
+	 * @brief Rebuilds the grid, previous contents are discarded.
+	 * @param Locations Unit locations; the index of a location is the entry id returned by queries.
+	 * @param Radii Collision radius per location.
+	 */
+	void Rebuild(const TArray<FVector>& Locations, const TArray<float>& Radii);
+
+	void Reset();
+
+	/**
+	 * @brief Appends the id of every entry whose sphere overlaps the query sphere.
+	 * @param Center Center of the query sphere.
+	 * @param Radius Radius of the query sphere.
+	 * @param OutEntryIds Not reset; each matching entry is appended once.
+	 */
+	void QuerySphere(const FVector& Center, const float Radius, TArray<int32>& OutEntryIds) const;
+
+	int32 Num() const { return M_EntryIds.Num(); }
+
+private:
+	// Entries sorted by cell; entries of cell C are [M_CellStarts[C], M_CellStarts[C + 1]).
+	TArray<int32> M_CellStarts;
+	TArray<FVector> M_Locations;
+	TArray<float> M_Radii;
+	TArray<int32> M_EntryIds;
+
+	FVector2D M_Origin;
+	double M_CellSize;
+	int32 M_CellsX;
+	int32 M_CellsY;
+	// Entries are bucketed by location only; queries widen their cell range by this much to find padded entries.
+	float M_MaxEntryRadius;
+
+	// Reused between rebuilds to avoid allocating per pass.
+	TArray<int32> M_WriteCursors;
+
+	int32 GetCellIndex(const FVector& Location) const;
+
+	/** @return False if the widened query circle does not overlap the grid at all. */
+	bool GetCellRange(const FVector& Center, const float Radius, FIntPoint& OutMinCell, FIntPoint& OutMaxCell) const;
+};
@@ -0,0 +1,101 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+#include "RTS_Survival/Subsystems/AuraSubsystem/RTSAuraUnitGrid.h"
+
+namespace RTSAuraUnitGridTestConstants
+{
+	constexpr int32 RandomSeed = 2025;
+	constexpr int32 UnitCount = 600;
+	constexpr float MapHalfExtent = 30000.f;
+	constexpr float MaxUnitHeight = 400.f;
+	constexpr float MinUnitRadius = 40.f;
+	constexpr float MaxUnitRadius = 600.f;
+	constexpr int32 QueryCount = 400;
+	constexpr float MinQueryRadius = 85.f;
+	constexpr float MaxQueryRadius = 3000.f;
+}
+
+namespace
+{
+	void GetOverlappingEntriesBruteForce(const TArray<FVector>& Locations, const TArray<float>& Radii,
+	                                     const FVector& Center, const float Radius, TArray<int32>& OutEntryIds)
+	{
+		for (int32 EntryIndex = 0; EntryIndex < Locations.Num(); ++EntryIndex)
+		{
+			if (FVector::DistSquared(Center, Locations[EntryIndex]) <= FMath::Square(Radius + Radii[EntryIndex]))
+			{
+				OutEntryIds.Add(EntryIndex);
+			}
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FRTSAuraUnitGridTest,
+	"RTS.Subsystems.Aura.UnitGrid.MatchesBruteForce",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRTSAuraUnitGridTest::RunTest(const FString& Parameters)
+{
+	using namespace RTSAuraUnitGridTestConstants;
+
+	FRandomStream Stream(RandomSeed);
+	TArray<FVector> Locations;
+	TArray<float> Radii;
+	for (int32 UnitIndex = 0; UnitIndex < UnitCount; ++UnitIndex)
+	{
+		Locations.Add(FVector(Stream.FRandRange(-MapHalfExtent, MapHalfExtent),
+		                      Stream.FRandRange(-MapHalfExtent, MapHalfExtent),
+		                      Stream.FRandRange(0.f, MaxUnitHeight)));
+		Radii.Add(Stream.FRandRange(MinUnitRadius, MaxUnitRadius));
+	}
+
+	FRTSAuraUnitGrid Grid;
+	Grid.Rebuild(Locations, Radii);
+	TestEqual(TEXT("Every unit is indexed"), Grid.Num(), UnitCount);
+
+	int32 NumMismatches = 0;
+	int32 NumFound = 0;
+	TArray<int32> GridEntryIds;
+	TArray<int32> ExpectedEntryIds;
+	for (int32 QueryIndex = 0; QueryIndex < QueryCount; ++QueryIndex)
+	{
+		// Some queries start outside the indexed area to cover the clamped cell ranges.
+		const FVector Center(Stream.FRandRange(-1.2f * MapHalfExtent, 1.2f * MapHalfExtent),
+		                     Stream.FRandRange(-1.2f * MapHalfExtent, 1.2f * MapHalfExtent),
+		                     Stream.FRandRange(0.f, MaxUnitHeight));
+		const float Radius = Stream.FRandRange(MinQueryRadius, MaxQueryRadius);
+
+		GridEntryIds.Reset();
+		ExpectedEntryIds.Reset();
+		Grid.QuerySphere(Center, Radius, GridEntryIds);
+		GetOverlappingEntriesBruteForce(Locations, Radii, Center, Radius, ExpectedEntryIds);
+		GridEntryIds.Sort();
+		if (GridEntryIds != ExpectedEntryIds)
+		{
+			++NumMismatches;
+		}
+		NumFound += ExpectedEntryIds.Num();
+	}
+	TestEqual(TEXT("Grid queries find exactly the overlapping units"), NumMismatches, 0);
+	TestTrue(TEXT("Queries overlap units"), NumFound > 0);
+
+	// A large unit is found by a query whose radius alone does not reach its location.
+	FRTSAuraUnitGrid PaddedGrid;
+	PaddedGrid.Rebuild({FVector(5000.f, 0.f, 0.f), FVector(-20000.f, 0.f, 0.f)}, {800.f, 50.f});
+	TArray<int32> PaddedEntryIds;
+	PaddedGrid.QuerySphere(FVector(3000.f, 0.f, 0.f), 1500.f, PaddedEntryIds);
+	TestTrue(TEXT("Collision radius pads the unit location"),
+	         PaddedEntryIds.Num() == 1 && PaddedEntryIds[0] == 0);
+
+	Grid.Reset();
+	GridEntryIds.Reset();
+	Grid.QuerySphere(FVector::ZeroVector, MaxQueryRadius, GridEntryIds);
+	TestTrue(TEXT("An empty grid finds nothing"), GridEntryIds.IsEmpty());
+
+	return not HasAnyErrors();
+}
+
+#endif
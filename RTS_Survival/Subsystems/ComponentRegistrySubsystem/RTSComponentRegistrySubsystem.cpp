@@ -0,0 +1,126 @@
+#include "RTSComponentRegistrySubsystem.h"
+
+#include "RTS_Survival/DeveloperSettings.h"
+
+bool URTSComponentRegistrySubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	const UWorld* OuterWorld = Cast<UWorld>(Outer);
+	if (not IsValid(OuterWorld))
+	{
+		return false;
+	}
+
+	return OuterWorld->IsGameWorld();
+}
+
+void URTSComponentRegistrySubsystem::Deinitialize()
+{
+	M_BucketsByClass.Reset();
+	M_PendingDispatches.Reset();
+	Super::Deinitialize();
+}
+
+void URTSComponentRegistrySubsystem::Tick(const float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+	if (M_PendingDispatches.IsEmpty())
+	{
+		return;
+	}
+	TRACE_CPUPROFILER_EVENT_SCOPE(RTSComponentRegistrySubsystem_Dispatch);
+
+	// Always apply at least one component per frame so a dispatch finishes even on a slow frame.
+	const double DeadlineSeconds =
+		FPlatformTime::Seconds() + DeveloperSettings::Optimization::SettingsDispatchBudgetPerFrame;
+	bool bAppliedAny = false;
+	while (not M_PendingDispatches.IsEmpty())
+	{
+		FRTSPendingSettingDispatch& Dispatch = M_PendingDispatches[0];
+		while (Dispatch.NextComponentIndex < Dispatch.Components.Num())
+		{
+			if (bAppliedAny && FPlatformTime::Seconds() >= DeadlineSeconds)
+			{
+				return;
+			}
+
+			UActorComponent* Component = Dispatch.Components[Dispatch.NextComponentIndex++].Get();
+			if (IsValid(Component))
+			{
+				Dispatch.ApplySetting(*Component);
+				bAppliedAny = true;
+			}
+		}
+		M_PendingDispatches.RemoveAt(0, 1, EAllowShrinking::No);
+	}
+}
+
+TStatId URTSComponentRegistrySubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(URTSComponentRegistrySubsystem, STATGROUP_Tickables);
+}
+
+bool URTSComponentRegistrySubsystem::RegisterComponentOfClass(const UClass* RegistryClass,
+                                                              UActorComponent* Component)
+{
+	if (not IsValid(Component))
+	{
+		return false;
+	}
+
+	FRTSRegisteredComponentBucket& Bucket = M_BucketsByClass.FindOrAdd(RegistryClass);
+	const TObjectKey<UActorComponent> ComponentKey(Component);
+	if (Bucket.IndexByComponent.Contains(ComponentKey))
+	{
+		return false;
+	}
+
+	Bucket.IndexByComponent.Add(ComponentKey, Bucket.Components.Add(Component));
+	Bucket.ComponentKeys.Add(ComponentKey);
+	return true;
+}
+
+void URTSComponentRegistrySubsystem::UnregisterComponentOfClass(const UClass* RegistryClass,
+                                                                const UActorComponent* Component)
+{
+	FRTSRegisteredComponentBucket* Bucket = M_BucketsByClass.Find(RegistryClass);
+	int32 RemovedIndex = INDEX_NONE;
+	if (not Bucket || not Bucket->IndexByComponent.RemoveAndCopyValue(TObjectKey<UActorComponent>(Component),
+	                                                                  RemovedIndex))
+	{
+		return;
+	}
+
+	Bucket->Components.RemoveAtSwap(RemovedIndex, 1, EAllowShrinking::No);
+	Bucket->ComponentKeys.RemoveAtSwap(RemovedIndex, 1, EAllowShrinking::No);
+	if (Bucket->ComponentKeys.IsValidIndex(RemovedIndex))
+	{
+		Bucket->IndexByComponent.Add(Bucket->ComponentKeys[RemovedIndex], RemovedIndex);
+	}
+}
+
+void URTSComponentRegistrySubsystem::DispatchSettingToClass(const UClass* RegistryClass,
+                                                            const ERTSGameSetting Setting,
+                                                            TFunction<void(UActorComponent&)> ApplySetting)
+{
+	const FRTSRegisteredComponentBucket* Bucket = M_BucketsByClass.Find(RegistryClass);
+	if (not Bucket || Bucket->Components.IsEmpty())
+	{
+		return;
+	}
+
+	FRTSPendingSettingDispatch* Dispatch = M_PendingDispatches.FindByPredicate(
+		[RegistryClass, Setting](const FRTSPendingSettingDispatch& Pending)
+		{
+			return Pending.ComponentClass == RegistryClass && Pending.Setting == Setting;
+		});
+	if (not Dispatch)
+	{
+		Dispatch = &M_PendingDispatches.AddDefaulted_GetRef();
+		Dispatch->ComponentClass = RegistryClass;
+		Dispatch->Setting = Setting;
+	}
+
+	Dispatch->ApplySetting = MoveTemp(ApplySetting);
+	Dispatch->Components = Bucket->Components;
+	Dispatch->NextComponentIndex = 0;
+}
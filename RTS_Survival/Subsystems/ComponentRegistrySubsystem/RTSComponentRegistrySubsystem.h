@@ -0,0 +1,97 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "RTS_Survival/Game/GameSettings/RTSGameSettings.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "RTSComponentRegistrySubsystem.generated.h"
+
+/**
+ * @brief World subsystem that keeps a bucket of live components per component class, so a game setting change only
+ * visits the components it affects instead of scanning every actor in the world.
+ * Components register on BeginPlay and unregister on EndPlay. A dispatched setting snapshots its bucket and is applied
+ * on the game thread in time-sliced batches of at most SettingsDispatchBudgetPerFrame per frame; dispatching the same
+ * setting again before it finished restarts it with the newest value.
+ * @note Components registering while a dispatch runs are not part of it; they read the current setting themselves.
+ */
+UCLASS()
+class RTS_SURVIVAL_API URTSComponentRegistrySubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual bool IsTickableInEditor() const override { return false; }
+
+	/**
+	 * @brief Adds the component to the bucket of its registry class.
+	 * @return False if the component was invalid or already registered.
+	 */
+	template <typename ComponentType>
+	bool RegisterComponent(ComponentType* Component)
+	{
+		return RegisterComponentOfClass(ComponentType::StaticClass(), Component);
+	}
+
+	template <typename ComponentType>
+	void UnregisterComponent(ComponentType* Component)
+	{
+		UnregisterComponentOfClass(ComponentType::StaticClass(), Component);
+	}
+
+	template <typename ComponentType>
+	int32 GetNumRegisteredComponents() const
+	{
+		const FRTSRegisteredComponentBucket* Bucket = M_BucketsByClass.Find(ComponentType::StaticClass());
+		return Bucket ? Bucket->Components.Num() : 0;
+	}
+
+	/**
+	 * @brief Applies a setting change to every registered component of the type over the next frames.
+	 * @param Setting Identifies the dispatch; a pending dispatch of the same setting and type is replaced.
+	 * @param ApplySetting Called on the game thread once per still valid component.
+	 */
+	template <typename ComponentType>
+	void DispatchSettingToComponents(const ERTSGameSetting Setting, TFunction<void(ComponentType&)> ApplySetting)
+	{
+		DispatchSettingToClass(ComponentType::StaticClass(), Setting,
+		                       [ApplySetting = MoveTemp(ApplySetting)](UActorComponent& Component)
+		                       {
+			                       ApplySetting(*CastChecked<ComponentType>(&Component));
+		                       });
+	}
+
+private:
+	struct FRTSRegisteredComponentBucket
+	{
+		TArray<TWeakObjectPtr<UActorComponent>> Components;
+		// Entry i belongs to Components[i]; kept so a slot can be re-keyed after its component was destroyed.
+		TArray<TObjectKey<UActorComponent>> ComponentKeys;
+		// Slot of each registered component in Components, for constant-time removal.
+		TMap<TObjectKey<UActorComponent>, int32> IndexByComponent;
+	};
+
+	struct FRTSPendingSettingDispatch
+	{
+		const UClass* ComponentClass = nullptr;
+		ERTSGameSetting Setting = ERTSGameSetting::None;
+		TFunction<void(UActorComponent&)> ApplySetting;
+		// Bucket copied at dispatch time so registrations and removals cannot shift unvisited components.
+		TArray<TWeakObjectPtr<UActorComponent>> Components;
+		int32 NextComponentIndex = 0;
+	};
+
+	TMap<const UClass*, FRTSRegisteredComponentBucket> M_BucketsByClass;
+
+	// Applied in order; the front dispatch continues where the previous frame stopped.
+	TArray<FRTSPendingSettingDispatch> M_PendingDispatches;
+
+	bool RegisterComponentOfClass(const UClass* RegistryClass, UActorComponent* Component);
+	void UnregisterComponentOfClass(const UClass* RegistryClass, const UActorComponent* Component);
+	void DispatchSettingToClass(const UClass* RegistryClass, ERTSGameSetting Setting,
+	                            TFunction<void(UActorComponent&)> ApplySetting);
+};
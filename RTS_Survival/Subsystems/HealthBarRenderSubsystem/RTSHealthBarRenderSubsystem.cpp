@@ -0,0 +1,643 @@
+#include "RTSHealthBarRenderSubsystem.h"
+
+#include "CanvasItem.h"
+#include "RenderUtils.h"
+#include "SceneView.h"
+#include "Engine/Canvas.h"
+#include "Engine/Engine.h"
+#include "Engine/Font.h"
+#include "Engine/Texture2D.h"
+#include "Slate/SlateBrushAsset.h"
+#include "RTS_Survival/DeveloperSettings.h"
+#include "RTS_Survival/GameUI/Healthbar/HealthBarSettings/HealthBarVisibilitySettings.h"
+#include "RTS_Survival/GameUI/Healthbar/Healthbar_TargetTypeIconState/ProjectSettings/TargetTypeIconSettings.h"
+#include "RTS_Survival/RTSComponents/HealthComponent.h"
+#include "RTS_Survival/Units/Squads/SquadControllerHpComp/SquadWeaponIcons/SquadWeaponIconSettings/SquadWeaponIconSettings.h"
+
+namespace BatchedHealthBarConstants
+{
+	// Size in screen pixels of a bar with a scale of one.
+	constexpr float BarWidth = 80.f;
+	constexpr float BarHeight = 8.f;
+	// Fire threshold and ammo bars are drawn as thin strips below the health bar.
+	constexpr float StripHeight = 3.f;
+	constexpr float StripSpacing = 1.f;
+	constexpr float IconSize = 16.f;
+	constexpr float IconSpacing = 2.f;
+	// Garrison slot boxes and seats text are drawn in a row above the bar, the unit name above that.
+	constexpr float GarrisonRowHeight = 8.f;
+	constexpr float GarrisonBoxSpacing = 2.f;
+	constexpr float RowSpacing = 2.f;
+	constexpr int32 MaxGarrisonBoxes = 3;
+	// Bars whose center projects further than this many pixels outside the canvas are culled.
+	constexpr float CullMargin = 64.f;
+	// Time in seconds over which the chunk of health lost by the latest damage fades out.
+	constexpr double DamageFadeSeconds = 0.6;
+	// Slice ticks are skipped once they would be closer together than this many pixels.
+	constexpr float MinPixelsPerSlice = 4.f;
+	constexpr int32 MaxSlices = 32;
+	constexpr float SliceTickWidth = 1.f;
+	const FLinearColor FireThresholdColor = FLinearColor(1.f, 0.45f, 0.f, 1.f);
+	const FLinearColor AmmoColor = FLinearColor(0.95f, 0.85f, 0.3f, 1.f);
+	const FLinearColor GarrisonVacantColor = FLinearColor(0.15f, 0.15f, 0.15f, 0.8f);
+	const FLinearColor GarrisonOccupiedColor = FLinearColor(0.85f, 0.85f, 0.85f, 1.f);
+	const FLinearColor SeatsTextColor = FLinearColor(0.9f, 0.9f, 0.9f, 1.f);
+}
+
+namespace
+{
+	/** @brief Same gradient as UW_HealthBar: red to green over the health range [0.2, 1]. */
+	FLinearColor GetColorGradientForHealth(const float Percentage)
+	{
+		const float Normalized = FMath::GetMappedRangeValueClamped(
+			FVector2f(0.2f, 1.0f),
+			FVector2f(0.0f, 1.0f),
+			Percentage);
+		return FLinearColor::LerpUsingHSV(FLinearColor::Red, FLinearColor::Green, Normalized);
+	}
+
+	void DrawTile(UCanvas& Canvas, FCanvasTileItem& TileItem, const float X, const float Y, const float Width,
+	              const float Height, const FLinearColor& Color)
+	{
+		TileItem.Position = FVector2D(X, Y);
+		TileItem.Size = FVector2D(Width, Height);
+		TileItem.SetColor(Color);
+		Canvas.DrawItem(TileItem);
+	}
+
+	float GetBarTop(const FRTSBatchedHealthBar& HealthBar, const FVector2D& Center)
+	{
+		return Center.Y - BatchedHealthBarConstants::BarHeight * HealthBar.Scale.Y * 0.5f;
+	}
+
+	float GetBarLeft(const FRTSBatchedHealthBar& HealthBar, const FVector2D& Center)
+	{
+		return Center.X - BatchedHealthBarConstants::BarWidth * HealthBar.Scale.X * 0.5f;
+	}
+
+	/** @return Top of the garrison row, or of the bar if the garrison is not shown. */
+	float GetGarrisonRowTop(const FRTSBatchedHealthBar& HealthBar, const FVector2D& Center)
+	{
+		using namespace BatchedHealthBarConstants;
+		const float BarTop = GetBarTop(HealthBar, Center);
+		if (not HealthBar.Garrison.GetIsShown())
+		{
+			return BarTop;
+		}
+		return BarTop - RowSpacing - GarrisonRowHeight * HealthBar.Scale.Y;
+	}
+}
+
+void FRTSBatchedGarrisonState::Setup(const int32 InSlots, const int32 Seats, const int32 InMaxSquads,
+                                     const EGarrisonSeatsTextType InTextType)
+{
+	Slots = FMath::Max(0, InSlots);
+	MaxSeats = FMath::Max(0, Seats);
+	MaxSquads = FMath::Max(0, InMaxSquads);
+	SeatsTaken = 0;
+	Squads = 0;
+	OccupiedSlotsMask = 0;
+	TextType = InTextType;
+	bIsSetup = true;
+	UpdateSeatsText();
+}
+
+void FRTSBatchedGarrisonState::UpdateSlot(const int32 SlotIndex, const bool bIsOccupied,
+                                          const int32 SeatsTakenOrBecameVacant)
+{
+	// Slots beyond the boxes still count squads; with zero slots the seats drive the text only.
+	const uint32 SlotBit = SlotIndex >= 0 && SlotIndex < 32 ? 1u << SlotIndex : 0u;
+	if (bIsOccupied)
+	{
+		SeatsTaken += SeatsTakenOrBecameVacant;
+		if (SlotBit != 0 && (OccupiedSlotsMask & SlotBit) == 0)
+		{
+			OccupiedSlotsMask |= SlotBit;
+			Squads = FMath::Clamp(Squads + 1, 0, MaxSquads);
+		}
+	}
+	else
+	{
+		SeatsTaken = FMath::Clamp(SeatsTaken - SeatsTakenOrBecameVacant, 0, MaxSeats);
+		if ((OccupiedSlotsMask & SlotBit) != 0)
+		{
+			OccupiedSlotsMask &= ~SlotBit;
+			Squads = FMath::Clamp(Squads - 1, 0, MaxSquads);
+		}
+	}
+	UpdateSeatsText();
+}
+
+void FRTSBatchedGarrisonState::UpdateSeatsText()
+{
+	switch (TextType)
+	{
+	case EGarrisonSeatsTextType::Units:
+		SeatsText = FString::Printf(TEXT("Units: %d/%d"), SeatsTaken, MaxSeats);
+		break;
+	case EGarrisonSeatsTextType::DisplayFullSquads:
+		SeatsText = FString::Printf(TEXT("Squads: %d/%d"), Squads, MaxSquads);
+		break;
+	case EGarrisonSeatsTextType::Seats:
+	default:
+		SeatsText = FString::Printf(TEXT("Seats: %d/%d"), SeatsTaken, MaxSeats);
+		break;
+	}
+}
+
+void FRTSBatchedHealthBar::SetHealthRatio(const float NewRatio, const double TimeSeconds)
+{
+	if (NewRatio < HealthRatio)
+	{
+		// Keep the start of a chunk that is still fading so consecutive hits show as one chunk.
+		const bool bIsChunkFading = DamageTimeSeconds >= 0.0
+			&& TimeSeconds - DamageTimeSeconds < BatchedHealthBarConstants::DamageFadeSeconds;
+		DamagedFromRatio = bIsChunkFading ? FMath::Max(DamagedFromRatio, HealthRatio) : HealthRatio;
+		DamageTimeSeconds = TimeSeconds;
+	}
+	else
+	{
+		DamagedFromRatio = NewRatio;
+	}
+	HealthRatio = FMath::Clamp(NewRatio, 0.f, 1.f);
+}
+
+void FRTSBatchedHealthBar::SetMaxHealth(const float MaxHealth)
+{
+	AmountSlices = FMath::FloorToInt32(
+		MaxHealth / DeveloperSettings::GamePlay::HealthCompAndHealthBar::HPBarSliceRatio);
+}
+
+void FRTSBatchedHealthBar::SetCustomization(const FHealthBarCustomization& Customization, const uint8 InOwningPlayer)
+{
+	OwningPlayer = InOwningPlayer;
+	BackgroundColor = Customization.BackgroundColor;
+	UnitNameColor = FLinearColor::White;
+	if (OwningPlayer != 1 && Customization.bUseEnemyColorIfEnemy)
+	{
+		bUseGreenRedGradient = false;
+		UnitNameColor = Customization.EnemyColor;
+		FillColor = Customization.EnemyColor;
+		DamageColor = Customization.EnemyDamageColor;
+		return;
+	}
+	bUseGreenRedGradient = Customization.bUseGreenRedGradient;
+	if (bUseGreenRedGradient)
+	{
+		DamageColor = Customization.DamageBarColor;
+		return;
+	}
+	FillColor = Customization.OverWriteGradientColor;
+	DamageColor = Customization.EnemyDamageColor;
+}
+
+void FRTSBatchedHealthBar::SetWeaponIcon(const FSquadWeaponIconDisplaySettings& WeaponIconSettings)
+{
+	WeaponIcon = WeaponIconSettings.WeaponIconBrush
+		             ? Cast<UTexture2D>(WeaponIconSettings.WeaponIconBrush->Brush.GetResourceObject())
+		             : nullptr;
+	const FVector2D& Size = WeaponIconSettings.ImageWidgetSize;
+	WeaponIconAspectRatio = Size.Y > KINDA_SMALL_NUMBER ? static_cast<float>(Size.X / Size.Y) : 1.f;
+}
+
+bool URTSHealthBarRenderSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	const UWorld* OuterWorld = Cast<UWorld>(Outer);
+	if (not IsValid(OuterWorld))
+	{
+		return false;
+	}
+
+	return OuterWorld->IsGameWorld();
+}
+
+void URTSHealthBarRenderSubsystem::Deinitialize()
+{
+	for (UHealthComponent* HealthComponent : M_HealthComponents)
+	{
+		if (IsValid(HealthComponent))
+		{
+			HealthComponent->M_BatchedHealthBarIndex = INDEX_NONE;
+		}
+	}
+	M_HealthComponents.Reset();
+	M_HealthBars.Reset();
+	M_DrawEntries.Reset();
+	M_DrawPositions.Reset();
+	M_IconTextures.Reset();
+	M_RankIconTextures.Reset();
+	bM_HasResolvedIconTextures = false;
+	Super::Deinitialize();
+}
+
+FRTSBatchedHealthBar* URTSHealthBarRenderSubsystem::RegisterHealthBar(UHealthComponent* HealthComponent,
+                                                                      const FVector& RelativeOffset,
+                                                                      const FVector2D& Scale)
+{
+	if (not IsValid(HealthComponent) || GetIsRegistered(HealthComponent))
+	{
+		return nullptr;
+	}
+
+	HealthComponent->M_BatchedHealthBarIndex = M_HealthComponents.Add(HealthComponent);
+	FRTSBatchedHealthBar& HealthBar = M_HealthBars.AddDefaulted_GetRef();
+	HealthBar.RelativeOffset = RelativeOffset;
+	HealthBar.Scale = Scale;
+	return &HealthBar;
+}
+
+void URTSHealthBarRenderSubsystem::UnregisterHealthBar(UHealthComponent* HealthComponent)
+{
+	if (not GetIsRegistered(HealthComponent))
+	{
+		return;
+	}
+
+	RemoveEntryAtSwap(HealthComponent->M_BatchedHealthBarIndex);
+}
+
+bool URTSHealthBarRenderSubsystem::GetIsRegistered(const UHealthComponent* HealthComponent) const
+{
+	if (not HealthComponent)
+	{
+		return false;
+	}
+
+	const int32 EntryIndex = HealthComponent->M_BatchedHealthBarIndex;
+	return M_HealthComponents.IsValidIndex(EntryIndex) && M_HealthComponents[EntryIndex] == HealthComponent;
+}
+
+FRTSBatchedHealthBar* URTSHealthBarRenderSubsystem::GetHealthBar(const UHealthComponent* HealthComponent)
+{
+	if (not GetIsRegistered(HealthComponent))
+	{
+		return nullptr;
+	}
+
+	return &M_HealthBars[HealthComponent->M_BatchedHealthBarIndex];
+}
+
+void URTSHealthBarRenderSubsystem::DrawHealthBars(UCanvas* Canvas)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(RTSHealthBarRenderSubsystem_DrawHealthBars);
+	if (not IsValid(Canvas) || not Canvas->SceneView || M_HealthComponents.IsEmpty())
+	{
+		return;
+	}
+
+	Draw_RemoveInvalidEntries();
+	Draw_CullAndProject(*Canvas);
+	if (M_DrawEntries.IsEmpty())
+	{
+		return;
+	}
+
+	Draw_Bars(*Canvas, GetWorld()->GetTimeSeconds());
+	Draw_Icons(*Canvas);
+	Draw_Texts(*Canvas);
+}
+
+void URTSHealthBarRenderSubsystem::Draw_RemoveInvalidEntries()
+{
+	// Drop components that were destroyed without unregistering.
+	for (int32 EntryIndex = M_HealthComponents.Num() - 1; EntryIndex >= 0; --EntryIndex)
+	{
+		const UHealthComponent* HealthComponent = M_HealthComponents[EntryIndex];
+		if (not IsValid(HealthComponent) || not IsValid(HealthComponent->GetOwner()))
+		{
+			RemoveEntryAtSwap(EntryIndex);
+		}
+	}
+}
+
+void URTSHealthBarRenderSubsystem::Draw_CullAndProject(const UCanvas& Canvas)
+{
+	using namespace BatchedHealthBarConstants;
+	M_DrawEntries.Reset();
+	M_DrawPositions.Reset();
+
+	const FMatrix ViewProjectionMatrix = Canvas.SceneView->ViewMatrices.GetViewProjectionMatrix();
+	const double HalfClipX = Canvas.ClipX * 0.5;
+	const double HalfClipY = Canvas.ClipY * 0.5;
+	const int32 NumEntries = M_HealthBars.Num();
+	for (int32 EntryIndex = 0; EntryIndex < NumEntries; ++EntryIndex)
+	{
+		const FRTSBatchedHealthBar& HealthBar = M_HealthBars[EntryIndex];
+		if (not HealthBar.bIsVisible)
+		{
+			continue;
+		}
+		const USceneComponent* RootComponent = M_HealthComponents[EntryIndex]->GetOwner()->GetRootComponent();
+		if (not RootComponent)
+		{
+			continue;
+		}
+
+		const FVector WorldLocation = RootComponent->GetComponentTransform().TransformPosition(HealthBar.RelativeOffset);
+		const FVector4 ClipLocation = ViewProjectionMatrix.TransformFVector4(FVector4(WorldLocation, 1.0));
+		if (ClipLocation.W <= KINDA_SMALL_NUMBER)
+		{
+			// Behind the camera.
+			continue;
+		}
+		const double InvW = 1.0 / ClipLocation.W;
+		const double ScreenX = HalfClipX * (1.0 + ClipLocation.X * InvW);
+		const double ScreenY = HalfClipY * (1.0 - ClipLocation.Y * InvW);
+		if (ScreenX < -CullMargin || ScreenX > Canvas.ClipX + CullMargin
+			|| ScreenY < -CullMargin || ScreenY > Canvas.ClipY + CullMargin)
+		{
+			continue;
+		}
+		M_DrawEntries.Add(EntryIndex);
+		M_DrawPositions.Add(FVector2D(ScreenX, ScreenY));
+	}
+}
+
+void URTSHealthBarRenderSubsystem::Draw_Bars(UCanvas& Canvas, const double TimeSeconds) const
+{
+	using namespace BatchedHealthBarConstants;
+	// Every tile uses the white texture with translucent blending so the canvas merges consecutive tiles into one
+	// batched element; drawing layer by layer over all bars keeps the number of batches independent of the unit count.
+	FCanvasTileItem TileItem(FVector2D::ZeroVector, GWhiteTexture, FVector2D::ZeroVector, FLinearColor::White);
+	TileItem.BlendMode = SE_BLEND_Translucent;
+	const int32 NumDraws = M_DrawEntries.Num();
+
+	// Backgrounds.
+	for (int32 DrawIndex = 0; DrawIndex < NumDraws; ++DrawIndex)
+	{
+		const FRTSBatchedHealthBar& HealthBar = M_HealthBars[M_DrawEntries[DrawIndex]];
+		const float Width = BarWidth * HealthBar.Scale.X;
+		const float Height = BarHeight * HealthBar.Scale.Y;
+		const FVector2D& Center = M_DrawPositions[DrawIndex];
+		DrawTile(Canvas, TileItem, Center.X - Width * 0.5f, Center.Y - Height * 0.5f, Width, Height,
+		         HealthBar.BackgroundColor);
+	}
+
+	// Chunk of health lost by the latest damage, fading out.
+	for (int32 DrawIndex = 0; DrawIndex < NumDraws; ++DrawIndex)
+	{
+		const FRTSBatchedHealthBar& HealthBar = M_HealthBars[M_DrawEntries[DrawIndex]];
+		const double TimeSinceDamage = TimeSeconds - HealthBar.DamageTimeSeconds;
+		if (HealthBar.DamageTimeSeconds < 0.0 || TimeSinceDamage >= DamageFadeSeconds
+			|| HealthBar.DamagedFromRatio <= HealthBar.HealthRatio)
+		{
+			continue;
+		}
+		const float Width = BarWidth * HealthBar.Scale.X;
+		const float Height = BarHeight * HealthBar.Scale.Y;
+		const FVector2D& Center = M_DrawPositions[DrawIndex];
+		FLinearColor DamageColor = HealthBar.DamageColor;
+		DamageColor.A *= 1.f - static_cast<float>(TimeSinceDamage / DamageFadeSeconds);
+		DrawTile(Canvas, TileItem, Center.X - Width * 0.5f + Width * HealthBar.HealthRatio, Center.Y - Height * 0.5f,
+		         Width * (HealthBar.DamagedFromRatio - HealthBar.HealthRatio), Height, DamageColor);
+	}
+
+	// Health fills.
+	for (int32 DrawIndex = 0; DrawIndex < NumDraws; ++DrawIndex)
+	{
+		const FRTSBatchedHealthBar& HealthBar = M_HealthBars[M_DrawEntries[DrawIndex]];
+		if (HealthBar.HealthRatio <= 0.f)
+		{
+			continue;
+		}
+		const float Width = BarWidth * HealthBar.Scale.X;
+		const float Height = BarHeight * HealthBar.Scale.Y;
+		const FVector2D& Center = M_DrawPositions[DrawIndex];
+		const FLinearColor FillColor = HealthBar.bUseGreenRedGradient
+			                               ? GetColorGradientForHealth(HealthBar.HealthRatio)
+			                               : HealthBar.FillColor;
+		DrawTile(Canvas, TileItem, Center.X - Width * 0.5f, Center.Y - Height * 0.5f,
+		         Width * HealthBar.HealthRatio, Height, FillColor);
+	}
+
+	// Slice ticks that show how much health the bar holds.
+	for (int32 DrawIndex = 0; DrawIndex < NumDraws; ++DrawIndex)
+	{
+		const FRTSBatchedHealthBar& HealthBar = M_HealthBars[M_DrawEntries[DrawIndex]];
+		const float Width = BarWidth * HealthBar.Scale.X;
+		if (HealthBar.AmountSlices < 2 || HealthBar.AmountSlices > MaxSlices
+			|| Width / HealthBar.AmountSlices < MinPixelsPerSlice)
+		{
+			continue;
+		}
+		const float Height = BarHeight * HealthBar.Scale.Y;
+		const FVector2D& Center = M_DrawPositions[DrawIndex];
+		const float SliceWidth = Width / HealthBar.AmountSlices;
+		const float Left = Center.X - Width * 0.5f;
+		for (int32 SliceIndex = 1; SliceIndex < HealthBar.AmountSlices; ++SliceIndex)
+		{
+			DrawTile(Canvas, TileItem, Left + SliceWidth * SliceIndex, Center.Y - Height * 0.5f, SliceTickWidth,
+			         Height, HealthBar.BackgroundColor);
+		}
+	}
+
+	// Fire threshold and ammo strips below the bar.
+	for (int32 DrawIndex = 0; DrawIndex < NumDraws; ++DrawIndex)
+	{
+		const FRTSBatchedHealthBar& HealthBar = M_HealthBars[M_DrawEntries[DrawIndex]];
+		const bool bHasFire = HealthBar.FireThresholdRatio > KINDA_SMALL_NUMBER;
+		const bool bHasAmmo = HealthBar.AmmoRatio >= 0.f;
+		if (not bHasFire && not bHasAmmo)
+		{
+			continue;
+		}
+		const float Width = BarWidth * HealthBar.Scale.X;
+		const float StripScaledHeight = StripHeight * HealthBar.Scale.Y;
+		const FVector2D& Center = M_DrawPositions[DrawIndex];
+		const float Left = Center.X - Width * 0.5f;
+		float Top = Center.Y + BarHeight * HealthBar.Scale.Y * 0.5f + StripSpacing;
+		if (bHasFire)
+		{
+			DrawTile(Canvas, TileItem, Left, Top, Width * FMath::Min(HealthBar.FireThresholdRatio, 1.f),
+			         StripScaledHeight, FireThresholdColor);
+			Top += StripScaledHeight + StripSpacing;
+		}
+		if (bHasAmmo)
+		{
+			DrawTile(Canvas, TileItem, Left, Top, Width, StripScaledHeight, HealthBar.BackgroundColor);
+			DrawTile(Canvas, TileItem, Left, Top, Width * FMath::Min(HealthBar.AmmoRatio, 1.f), StripScaledHeight,
+			         AmmoColor);
+			// Bombs: split the strip into one segment per bomb.
+			if (HealthBar.AmmoSegments > 1 && HealthBar.AmmoSegments <= MaxSlices)
+			{
+				const float SegmentWidth = Width / HealthBar.AmmoSegments;
+				for (int32 SegmentIndex = 1; SegmentIndex < HealthBar.AmmoSegments; ++SegmentIndex)
+				{
+					DrawTile(Canvas, TileItem, Left + SegmentWidth * SegmentIndex, Top, SliceTickWidth,
+					         StripScaledHeight, HealthBar.BackgroundColor);
+				}
+			}
+		}
+	}
+
+	// Garrison slot boxes above the bar.
+	for (int32 DrawIndex = 0; DrawIndex < NumDraws; ++DrawIndex)
+	{
+		const FRTSBatchedHealthBar& HealthBar = M_HealthBars[M_DrawEntries[DrawIndex]];
+		const FRTSBatchedGarrisonState& Garrison = HealthBar.Garrison;
+		if (not Garrison.GetIsShown() || not Garrison.GetHasSlotBoxes())
+		{
+			continue;
+		}
+		const FVector2D& Center = M_DrawPositions[DrawIndex];
+		const float BoxSize = GarrisonRowHeight * HealthBar.Scale.Y;
+		const float Top = GetGarrisonRowTop(HealthBar, Center);
+		float Left = GetBarLeft(HealthBar, Center);
+		for (int32 SlotIndex = 0; SlotIndex < FMath::Min(Garrison.Slots, MaxGarrisonBoxes); ++SlotIndex)
+		{
+			const bool bIsOccupied = (Garrison.OccupiedSlotsMask & (1u << SlotIndex)) != 0;
+			DrawTile(Canvas, TileItem, Left, Top, BoxSize, BoxSize,
+			         bIsOccupied ? GarrisonOccupiedColor : GarrisonVacantColor);
+			Left += BoxSize + GarrisonBoxSpacing;
+		}
+	}
+}
+
+void URTSHealthBarRenderSubsystem::Draw_Icons(UCanvas& Canvas)
+{
+	using namespace BatchedHealthBarConstants;
+	ResolveIconTextures();
+
+	// Sort the drawn icons by texture so each texture becomes one batched element.
+	struct FIconDraw
+	{
+		UTexture2D* Texture;
+		FVector2D Position;
+		FVector2D Size;
+	};
+	TArray<FIconDraw, TInlineAllocator<64>> IconDraws;
+	const auto AddIconDraw = [&IconDraws](UTexture2D* Texture, const FVector2D& Position, const FVector2D& Size)
+	{
+		if (Texture && Texture->GetResource())
+		{
+			IconDraws.Add({Texture, Position, Size});
+		}
+	};
+	const int32 NumDraws = M_DrawEntries.Num();
+	for (int32 DrawIndex = 0; DrawIndex < NumDraws; ++DrawIndex)
+	{
+		const FRTSBatchedHealthBar& HealthBar = M_HealthBars[M_DrawEntries[DrawIndex]];
+		const float Size = IconSize * HealthBar.Scale.Y;
+		const FVector2D& Center = M_DrawPositions[DrawIndex];
+		const float Top = Center.Y - Size * 0.5f;
+
+		// Target type icon left of the bar.
+		if (HealthBar.Icon != ETargetTypeIcon::None)
+		{
+			AddIconDraw(GetIconTexture(HealthBar.Icon, HealthBar.OwningPlayer),
+			            FVector2D(GetBarLeft(HealthBar, Center) - IconSpacing - Size, Top), FVector2D(Size));
+		}
+
+		// Rank icon and then the squad weapon icon right of the bar.
+		float Left = Center.X + BarWidth * HealthBar.Scale.X * 0.5f + IconSpacing;
+		if (HealthBar.RankLevel != INDEX_NONE)
+		{
+			if (UTexture2D* RankTexture = GetRankIconTexture(HealthBar.RankIconSet, HealthBar.RankLevel))
+			{
+				AddIconDraw(RankTexture, FVector2D(Left, Top), FVector2D(Size));
+				Left += Size + IconSpacing;
+			}
+		}
+		if (UTexture2D* WeaponTexture = HealthBar.WeaponIcon.Get())
+		{
+			AddIconDraw(WeaponTexture, FVector2D(Left, Top), FVector2D(Size * HealthBar.WeaponIconAspectRatio, Size));
+		}
+	}
+	IconDraws.Sort([](const FIconDraw& A, const FIconDraw& B)
+	{
+		return A.Texture < B.Texture;
+	});
+
+	for (const FIconDraw& IconDraw : IconDraws)
+	{
+		FCanvasTileItem TileItem(IconDraw.Position, IconDraw.Texture->GetResource(), IconDraw.Size,
+		                         FLinearColor::White);
+		TileItem.BlendMode = SE_BLEND_Translucent;
+		Canvas.DrawItem(TileItem);
+	}
+}
+
+void URTSHealthBarRenderSubsystem::Draw_Texts(UCanvas& Canvas) const
+{
+	using namespace BatchedHealthBarConstants;
+	UFont* Font = GEngine ? GEngine->GetSmallFont() : nullptr;
+	if (not Font)
+	{
+		return;
+	}
+
+	// Text is drawn last; all glyphs of the font share its texture and batch like the tiles.
+	const float FontHeight = Font->GetMaxCharHeight();
+	const int32 NumDraws = M_DrawEntries.Num();
+	for (int32 DrawIndex = 0; DrawIndex < NumDraws; ++DrawIndex)
+	{
+		const FRTSBatchedHealthBar& HealthBar = M_HealthBars[M_DrawEntries[DrawIndex]];
+		const FVector2D& Center = M_DrawPositions[DrawIndex];
+		const FRTSBatchedGarrisonState& Garrison = HealthBar.Garrison;
+		const float RowTop = GetGarrisonRowTop(HealthBar, Center);
+		if (Garrison.GetIsShown())
+		{
+			const int32 NumBoxes = Garrison.GetHasSlotBoxes() ? FMath::Min(Garrison.Slots, MaxGarrisonBoxes) : 0;
+			const float BoxSize = GarrisonRowHeight * HealthBar.Scale.Y;
+			const float TextLeft = GetBarLeft(HealthBar, Center) + NumBoxes * (BoxSize + GarrisonBoxSpacing);
+			Canvas.SetDrawColor(SeatsTextColor.ToFColor(true));
+			Canvas.DrawText(Font, Garrison.SeatsText, TextLeft, RowTop + (BoxSize - FontHeight) * 0.5f);
+		}
+		if (not HealthBar.UnitName.IsEmpty())
+		{
+			const float NameWidth = Font->GetStringSize(*HealthBar.UnitName);
+			Canvas.SetDrawColor(HealthBar.UnitNameColor.ToFColor(true));
+			Canvas.DrawText(Font, HealthBar.UnitName, Center.X - NameWidth * 0.5f, RowTop - RowSpacing - FontHeight);
+		}
+	}
+}
+
+void URTSHealthBarRenderSubsystem::ResolveIconTextures()
+{
+	if (bM_HasResolvedIconTextures)
+	{
+		return;
+	}
+	bM_HasResolvedIconTextures = true;
+	if (const UTargetTypeIconSettings* Settings = UTargetTypeIconSettings::Get())
+	{
+		Settings->ResolveTypeToBrushMap(M_IconTextures);
+		Settings->ResolveRankIconMap(M_RankIconTextures);
+	}
+}
+
+UTexture2D* URTSHealthBarRenderSubsystem::GetIconTexture(const ETargetTypeIcon Icon, const uint8 OwningPlayer) const
+{
+	const FTargetTypeIconBrushes* Brushes = M_IconTextures.Find(Icon);
+	if (not Brushes)
+	{
+		return nullptr;
+	}
+	return OwningPlayer == 1 ? Brushes->PlayerBrush : Brushes->EnemyBrush;
+}
+
+UTexture2D* URTSHealthBarRenderSubsystem::GetRankIconTexture(const EVeterancyIconSet IconSet,
+                                                            const int32 RankLevel) const
+{
+	const FVeterancyRankIcons* RankIcons = M_RankIconTextures.Find(IconSet);
+	if (not RankIcons || not RankIcons->RankTextures.IsValidIndex(RankLevel))
+	{
+		return nullptr;
+	}
+	return RankIcons->RankTextures[RankLevel];
+}
+
+void URTSHealthBarRenderSubsystem::RemoveEntryAtSwap(const int32 EntryIndex)
+{
+	if (UHealthComponent* RemovedComponent = M_HealthComponents[EntryIndex])
+	{
+		RemovedComponent->M_BatchedHealthBarIndex = INDEX_NONE;
+	}
+
+	M_HealthComponents.RemoveAtSwap(EntryIndex, 1, EAllowShrinking::No);
+	M_HealthBars.RemoveAtSwap(EntryIndex, 1, EAllowShrinking::No);
+	if (M_HealthComponents.IsValidIndex(EntryIndex) && M_HealthComponents[EntryIndex])
+	{
+		M_HealthComponents[EntryIndex]->M_BatchedHealthBarIndex = EntryIndex;
+	}
+}
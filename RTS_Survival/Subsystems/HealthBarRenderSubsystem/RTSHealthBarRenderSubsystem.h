@@ -0,0 +1,163 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RTS_Survival/GameUI/Healthbar/GarrisonHealthBar/GarrisonSeatsTextType.h"
+#include "RTS_Survival/GameUI/Healthbar/Healthbar_TargetTypeIconState/TargetTypeIconState.h"
+#include "RTS_Survival/GameUI/Healthbar/Healthbar_TargetTypeIconState/ProjectSettings/TargetTypeIconSettings.h"
+#include "RTS_Survival/RTSComponents/ExperienceComponent/RTSExperienceLevels.h"
+#include "RTS_Survival/RTSComponents/HealthInterface/HealthBarIcons/HealthBarIcons.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "RTSHealthBarRenderSubsystem.generated.h"
+
+class UCanvas;
+class UHealthComponent;
+class UTexture2D;
+struct FHealthBarCustomization;
+struct FSquadWeaponIconDisplaySettings;
+
+/** @brief Garrison seats of a batched health bar; same bookkeeping as UW_GarrisonHealthBar. */
+struct FRTSBatchedGarrisonState
+{
+	// Slot boxes drawn above the bar; zero or more than three draws the seats text only.
+	int32 Slots = 0;
+	int32 MaxSeats = 0;
+	int32 MaxSquads = 0;
+	int32 SeatsTaken = 0;
+	int32 Squads = 0;
+	// Bit per garrison slot index that holds a squad.
+	uint32 OccupiedSlotsMask = 0;
+	EGarrisonSeatsTextType TextType = EGarrisonSeatsTextType::Seats;
+	bool bIsSetup = false;
+	bool bIsEnabled = true;
+	// Cached so the paint pass does not format text.
+	FString SeatsText;
+
+	void Setup(const int32 InSlots, const int32 Seats, const int32 InMaxSquads, const EGarrisonSeatsTextType InTextType);
+	void UpdateSlot(const int32 SlotIndex, const bool bIsOccupied, const int32 SeatsTakenOrBecameVacant);
+
+	bool GetIsShown() const { return bIsSetup && bIsEnabled; }
+	bool GetHasSlotBoxes() const { return Slots > 0 && Slots <= 3; }
+
+private:
+	void UpdateSeatsText();
+};
+
+/** @brief Render state of one batched health bar; its health component pushes every change. */
+struct FRTSBatchedHealthBar
+{
+	// Offset from the owner's root component, as used for the widget component.
+	FVector RelativeOffset = FVector::ZeroVector;
+	FVector2D Scale = FVector2D(1.0, 1.0);
+
+	float HealthRatio = 1.f;
+	// Health ratio before the latest damage; the chunk between it and HealthRatio fades out after the damage.
+	float DamagedFromRatio = 1.f;
+	double DamageTimeSeconds = -1.0;
+	float FireThresholdRatio = 0.f;
+	// Negative if the bar does not track the ammo of a weapon or the bombs of an aircraft.
+	float AmmoRatio = -1.f;
+	// Bombs are shown as one segment per bomb; zero for weapon ammo.
+	int32 AmmoSegments = 0;
+	int32 AmountSlices = 0;
+
+	ETargetTypeIcon Icon = ETargetTypeIcon::None;
+	uint8 OwningPlayer = 0;
+
+	// No rank icon is drawn until the unit reports its rank.
+	int32 RankLevel = INDEX_NONE;
+	EVeterancyIconSet RankIconSet = EVeterancyIconSet::EVI_None;
+
+	// Empty until the owner's sub type is initialized.
+	FString UnitName;
+	FLinearColor UnitNameColor = FLinearColor::White;
+
+	// Weapon icon of squads, drawn right of the bar; width over height of the icon.
+	TWeakObjectPtr<UTexture2D> WeaponIcon;
+	float WeaponIconAspectRatio = 1.f;
+
+	FRTSBatchedGarrisonState Garrison;
+
+	bool bUseGreenRedGradient = true;
+	FLinearColor FillColor = FLinearColor::Green;
+	FLinearColor DamageColor = FLinearColor::Red;
+	FLinearColor BackgroundColor = FLinearColor::Black;
+
+	// Result of the health component's visibility policy, including hiding all game UI.
+	bool bIsVisible = false;
+
+	void SetHealthRatio(const float NewRatio, const double TimeSeconds);
+	void SetMaxHealth(const float MaxHealth);
+
+	/** @brief Same colors as UW_HealthBar: enemies use the enemy colors if the customization asks for it. */
+	void SetCustomization(const FHealthBarCustomization& Customization, const uint8 InOwningPlayer);
+
+	/** @brief Takes the texture and layout size of the brush; a settings without brush clears the icon. */
+	void SetWeaponIcon(const FSquadWeaponIconDisplaySettings& WeaponIconSettings);
+};
+
+/**
+ * @brief World subsystem that owns the render state of every batched health bar and draws all visible bars from the
+ * HUD in one paint pass. Replaces a UW_HealthBar in a screen space widget component per unit: bars are culled against
+ * the view with one view projection matrix and painted as canvas tiles grouped by texture, so the backgrounds and
+ * fills of all bars share one batch and the target type icons one batch per icon texture.
+ * Draws the same states as the widgets: rank icon, unit name, squad weapon icon, garrison seats, weapon ammo and bombs.
+ * @note Only health components set to EHealthBarRenderMode::Batched register.
+ */
+UCLASS()
+class RTS_SURVIVAL_API URTSHealthBarRenderSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+
+	/**
+	 * @brief Adds a bar for the health component; it stays hidden until the component applies its visibility.
+	 * @return The render state of the new bar, nullptr if the component was invalid or already registered.
+	 * Only valid until the next registration; do not store it.
+	 */
+	FRTSBatchedHealthBar* RegisterHealthBar(UHealthComponent* HealthComponent, const FVector& RelativeOffset,
+	                                        const FVector2D& Scale);
+
+	void UnregisterHealthBar(UHealthComponent* HealthComponent);
+
+	bool GetIsRegistered(const UHealthComponent* HealthComponent) const;
+
+	/** @return The render state of the component's bar, nullptr if it is not registered. */
+	FRTSBatchedHealthBar* GetHealthBar(const UHealthComponent* HealthComponent);
+
+	/** @brief Called by the HUD each frame; draws every visible bar in front of the camera. */
+	void DrawHealthBars(UCanvas* Canvas);
+
+private:
+	// Registered health components; entry i of M_HealthBars belongs to M_HealthComponents[i].
+	UPROPERTY()
+	TArray<TObjectPtr<UHealthComponent>> M_HealthComponents;
+
+	TArray<FRTSBatchedHealthBar> M_HealthBars;
+
+	// Scratch of the current paint pass: the entries that survived culling and where their bar is centered.
+	TArray<int32> M_DrawEntries;
+	TArray<FVector2D> M_DrawPositions;
+
+	UPROPERTY()
+	TMap<ETargetTypeIcon, FTargetTypeIconBrushes> M_IconTextures;
+
+	UPROPERTY()
+	TMap<EVeterancyIconSet, FVeterancyRankIcons> M_RankIconTextures;
+
+	bool bM_HasResolvedIconTextures = false;
+
+	void Draw_RemoveInvalidEntries();
+	void Draw_CullAndProject(const UCanvas& Canvas);
+	void Draw_Bars(UCanvas& Canvas, const double TimeSeconds) const;
+	void Draw_Icons(UCanvas& Canvas);
+	void Draw_Texts(UCanvas& Canvas) const;
+
+	void ResolveIconTextures();
+	UTexture2D* GetIconTexture(const ETargetTypeIcon Icon, const uint8 OwningPlayer) const;
+	UTexture2D* GetRankIconTexture(const EVeterancyIconSet IconSet, const int32 RankLevel) const;
+
+	void RemoveEntryAtSwap(const int32 EntryIndex);
+};
@@ -0,0 +1,240 @@
+#include "RTSOptimizationSubsystem.h"
+
+#include "RTS_Survival/DeveloperSettings.h"
+#include "RTS_Survival/Player/CPPController.h"
+#include "RTS_Survival/RTSComponents/RTSOptimizer/RTSOptimizer.h"
+#include "RTS_Survival/Utils/RTS_Statics/RTS_Statics.h"
+
+bool URTSOptimizationSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	const UWorld* OuterWorld = Cast<UWorld>(Outer);
+	if (not IsValid(OuterWorld))
+	{
+		return false;
+	}
+
+	return OuterWorld->IsGameWorld();
+}
+
+void URTSOptimizationSubsystem::Deinitialize()
+{
+	for (URTSOptimizer* Optimizer : M_Optimizers)
+	{
+		if (IsValid(Optimizer))
+		{
+			Optimizer->M_OptimizationEntryIndex = INDEX_NONE;
+		}
+	}
+	M_Optimizers.Reset();
+	M_AppliedDistances.Reset();
+	M_TargetDistances.Reset();
+	M_LocationsX.Reset();
+	M_LocationsY.Reset();
+	M_LocationsZ.Reset();
+	M_TransitionCursor = 0;
+	M_NumPendingTransitions = 0;
+	Super::Deinitialize();
+}
+
+void URTSOptimizationSubsystem::Tick(const float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+	TRACE_CPUPROFILER_EVENT_SCOPE(RTSOptimizationSubsystem_Tick);
+
+	M_TimeUntilClassification -= DeltaTime;
+	if (M_TimeUntilClassification <= 0.f)
+	{
+		M_TimeUntilClassification = DeveloperSettings::Optimization::OptimizerClassificationInterval;
+		Tick_ClassifyOptimizers();
+	}
+	Tick_ApplyPendingTransitions();
+}
+
+TStatId URTSOptimizationSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(URTSOptimizationSubsystem, STATGROUP_Tickables);
+}
+
+bool URTSOptimizationSubsystem::RegisterOptimizer(URTSOptimizer* Optimizer)
+{
+	if (not IsValid(Optimizer) || GetIsRegistered(Optimizer))
+	{
+		return false;
+	}
+
+	Optimizer->M_OptimizationEntryIndex = M_Optimizers.Add(Optimizer);
+	M_AppliedDistances.Add(ERTSOptimizationDistance::None);
+	M_TargetDistances.Add(ERTSOptimizationDistance::None);
+	return true;
+}
+
+void URTSOptimizationSubsystem::UnregisterOptimizer(URTSOptimizer* Optimizer)
+{
+	if (not GetIsRegistered(Optimizer))
+	{
+		return;
+	}
+
+	RemoveEntryAtSwap(Optimizer->M_OptimizationEntryIndex);
+}
+
+bool URTSOptimizationSubsystem::GetIsRegistered(const URTSOptimizer* Optimizer) const
+{
+	if (not Optimizer)
+	{
+		return false;
+	}
+
+	const int32 EntryIndex = Optimizer->M_OptimizationEntryIndex;
+	return M_Optimizers.IsValidIndex(EntryIndex) && M_Optimizers[EntryIndex] == Optimizer;
+}
+
+void URTSOptimizationSubsystem::Tick_ClassifyOptimizers()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(RTSOptimizationSubsystem_Classify);
+	using DeveloperSettings::Optimization::DistanceAlwaysConsiderUnitInFOVSquared;
+	using DeveloperSettings::Optimization::OutOfFOVConsideredFarAwayUnitSquared;
+
+	// Gather pass: drop optimizers that were destroyed without unregistering and copy the owner locations.
+	for (int32 EntryIndex = M_Optimizers.Num() - 1; EntryIndex >= 0; --EntryIndex)
+	{
+		const URTSOptimizer* Optimizer = M_Optimizers[EntryIndex];
+		if (not IsValid(Optimizer) || not IsValid(Optimizer->GetOwner()))
+		{
+			RemoveEntryAtSwap(EntryIndex);
+		}
+	}
+	const int32 NumEntries = M_Optimizers.Num();
+	M_LocationsX.SetNumUninitialized(NumEntries, EAllowShrinking::No);
+	M_LocationsY.SetNumUninitialized(NumEntries, EAllowShrinking::No);
+	M_LocationsZ.SetNumUninitialized(NumEntries, EAllowShrinking::No);
+	for (int32 EntryIndex = 0; EntryIndex < NumEntries; ++EntryIndex)
+	{
+		const FVector OwnerLocation = M_Optimizers[EntryIndex]->GetOwner()->GetActorLocation();
+		M_LocationsX[EntryIndex] = OwnerLocation.X;
+		M_LocationsY[EntryIndex] = OwnerLocation.Y;
+		M_LocationsZ[EntryIndex] = OwnerLocation.Z;
+	}
+
+	FVector CameraLocation;
+	FVector CameraForward;
+	float CosHalfFov = 0.f;
+	if (not GetCameraClassificationData(CameraLocation, CameraForward, CosHalfFov))
+	{
+		for (ERTSOptimizationDistance& TargetDistance : M_TargetDistances)
+		{
+			TargetDistance = ERTSOptimizationDistance::InFOV;
+		}
+	}
+	else
+	{
+		// Same rules as the per-unit check this replaces: in the view cone, or out of it but closer than the
+		// always-in-FOV distance, counts as in FOV. Comparing Dot >= Cos * Length avoids normalizing per unit.
+		const float CamX = CameraLocation.X;
+		const float CamY = CameraLocation.Y;
+		const float CamZ = CameraLocation.Z;
+		const float ForwardX = CameraForward.X;
+		const float ForwardY = CameraForward.Y;
+		const float ForwardZ = CameraForward.Z;
+		for (int32 EntryIndex = 0; EntryIndex < NumEntries; ++EntryIndex)
+		{
+			const float DeltaX = M_LocationsX[EntryIndex] - CamX;
+			const float DeltaY = M_LocationsY[EntryIndex] - CamY;
+			const float DeltaZ = M_LocationsZ[EntryIndex] - CamZ;
+			const float DistanceSquared = DeltaX * DeltaX + DeltaY * DeltaY + DeltaZ * DeltaZ;
+			const float Dot = DeltaX * ForwardX + DeltaY * ForwardY + DeltaZ * ForwardZ;
+			const bool bInViewCone = Dot >= CosHalfFov * FMath::Sqrt(DistanceSquared);
+			if (bInViewCone || DistanceSquared <= DistanceAlwaysConsiderUnitInFOVSquared)
+			{
+				M_TargetDistances[EntryIndex] = ERTSOptimizationDistance::InFOV;
+				continue;
+			}
+			M_TargetDistances[EntryIndex] = DistanceSquared >= OutOfFOVConsideredFarAwayUnitSquared
+				                                ? ERTSOptimizationDistance::OutFOVFar
+				                                : ERTSOptimizationDistance::OutFOVClose;
+		}
+	}
+
+	M_NumPendingTransitions = 0;
+	for (int32 EntryIndex = 0; EntryIndex < NumEntries; ++EntryIndex)
+	{
+		M_NumPendingTransitions += M_TargetDistances[EntryIndex] != M_AppliedDistances[EntryIndex] ? 1 : 0;
+	}
+}
+
+void URTSOptimizationSubsystem::Tick_ApplyPendingTransitions()
+{
+	const int32 NumEntries = M_Optimizers.Num();
+	if (M_NumPendingTransitions <= 0 || NumEntries == 0)
+	{
+		return;
+	}
+
+	// Continue where the previous frame stopped so every unit is served within a few frames.
+	int32 NumApplied = 0;
+	int32 NumVisited = 0;
+	while (NumVisited < NumEntries && NumApplied < DeveloperSettings::Optimization::MaxOptimizerTransitionsPerFrame)
+	{
+		const int32 EntryIndex = M_TransitionCursor % NumEntries;
+		M_TransitionCursor = EntryIndex + 1;
+		++NumVisited;
+
+		const ERTSOptimizationDistance TargetDistance = M_TargetDistances[EntryIndex];
+		if (TargetDistance == M_AppliedDistances[EntryIndex])
+		{
+			continue;
+		}
+
+		M_AppliedDistances[EntryIndex] = TargetDistance;
+		++NumApplied;
+		URTSOptimizer* Optimizer = M_Optimizers[EntryIndex];
+		if (IsValid(Optimizer) && IsValid(Optimizer->GetOwner()))
+		{
+			Optimizer->ApplyOptimizationDistance(TargetDistance);
+		}
+	}
+
+	if (NumApplied < DeveloperSettings::Optimization::MaxOptimizerTransitionsPerFrame)
+	{
+		// Swept every entry within budget, so nothing is left; the count may be stale from entries removed while
+		// their transition was pending.
+		M_NumPendingTransitions = 0;
+		return;
+	}
+	M_NumPendingTransitions = FMath::Max(0, M_NumPendingTransitions - NumApplied);
+}
+
+bool URTSOptimizationSubsystem::GetCameraClassificationData(
+	FVector& OutCameraLocation,
+	FVector& OutCameraForward,
+	float& OutCosHalfFov) const
+{
+	const ACPPController* PlayerController = FRTS_Statics::GetRTSController(this);
+	if (not IsValid(PlayerController) || not IsValid(PlayerController->PlayerCameraManager))
+	{
+		return false;
+	}
+
+	FRotator CameraRotation;
+	PlayerController->GetPlayerViewPoint(OutCameraLocation, CameraRotation);
+	OutCameraForward = CameraRotation.Vector();
+	const float HalfFovRad = FMath::DegreesToRadians(PlayerController->PlayerCameraManager->GetFOVAngle() * 0.5f);
+	OutCosHalfFov = FMath::Cos(HalfFovRad);
+	return true;
+}
+
+void URTSOptimizationSubsystem::RemoveEntryAtSwap(const int32 EntryIndex)
+{
+	if (URTSOptimizer* RemovedOptimizer = M_Optimizers[EntryIndex])
+	{
+		RemovedOptimizer->M_OptimizationEntryIndex = INDEX_NONE;
+	}
+
+	M_Optimizers.RemoveAtSwap(EntryIndex, 1, EAllowShrinking::No);
+	M_AppliedDistances.RemoveAtSwap(EntryIndex, 1, EAllowShrinking::No);
+	M_TargetDistances.RemoveAtSwap(EntryIndex, 1, EAllowShrinking::No);
+	if (M_Optimizers.IsValidIndex(EntryIndex) && M_Optimizers[EntryIndex])
+	{
+		M_Optimizers[EntryIndex]->M_OptimizationEntryIndex = EntryIndex;
+	}
+}
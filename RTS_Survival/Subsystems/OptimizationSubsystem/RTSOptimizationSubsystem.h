@@ -0,0 +1,74 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RTS_Survival/RTSComponents/RTSOptimizer/RTSOptimizationDistance.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "RTSOptimizationSubsystem.generated.h"
+
+class URTSOptimizer;
+
+/**
+ * @brief World subsystem that classifies every registered URTSOptimizer against the player camera in one batched pass.
+ * Replaces a timer per unit: owner locations are gathered into flat arrays each classification interval, classified
+ * in a single loop and only the optimizers whose FOV bucket changed are updated, at most
+ * MaxOptimizerTransitionsPerFrame per frame.
+ */
+UCLASS()
+class RTS_SURVIVAL_API URTSOptimizationSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual bool IsTickableInEditor() const override { return false; }
+
+	/**
+	 * @brief Adds the optimizer to the next classification pass.
+	 * @param Optimizer Optimizer of a unit that begins play; ignored if already registered.
+	 * @return False if the optimizer was invalid or already registered.
+	 */
+	bool RegisterOptimizer(URTSOptimizer* Optimizer);
+
+	/** @brief Removes the optimizer; any transition still pending for it is dropped. */
+	void UnregisterOptimizer(URTSOptimizer* Optimizer);
+
+	bool GetIsRegistered(const URTSOptimizer* Optimizer) const;
+
+private:
+	// Registered optimizers; entry i of every array below belongs to M_Optimizers[i].
+	UPROPERTY()
+	TArray<TObjectPtr<URTSOptimizer>> M_Optimizers;
+
+	// Bucket the optimizer components are currently set up for.
+	TArray<ERTSOptimizationDistance> M_AppliedDistances;
+	// Bucket determined by the latest classification pass.
+	TArray<ERTSOptimizationDistance> M_TargetDistances;
+
+	// Owner locations gathered per pass as separate components so the classification loop stays branch-light.
+	TArray<float> M_LocationsX;
+	TArray<float> M_LocationsY;
+	TArray<float> M_LocationsZ;
+
+	float M_TimeUntilClassification = 0.f;
+
+	// Where the next frame continues looking for pending transitions.
+	int32 M_TransitionCursor = 0;
+	// Upper bound of the entries whose target bucket differs from the applied one.
+	int32 M_NumPendingTransitions = 0;
+
+	void Tick_ClassifyOptimizers();
+	void Tick_ApplyPendingTransitions();
+
+	/**
+	 * @brief Camera data shared by the whole classification pass.
+	 * @return False if there is no RTS player camera; every unit is then considered in FOV.
+	 */
+	bool GetCameraClassificationData(FVector& OutCameraLocation, FVector& OutCameraForward,
+	                                 float& OutCosHalfFov) const;
+
+	void RemoveEntryAtSwap(const int32 EntryIndex);
+};
@@ -0,0 +1,1118 @@
+// Copyright (C) Bas Blokzijl - All rights reserved.
+
+#include "CoreMinimal.h"
+
+#if defined(RTS_WITH_PERF_BENCHMARK_SHIPPING_TESTS) && RTS_WITH_PERF_BENCHMARK_SHIPPING_TESTS
+
+#include "Dom/JsonObject.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformMisc.h"
+#include "HAL/PlatformTime.h"
+#include "Kismet/GameplayStatics.h"
+#include "Misc/CommandLine.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "RenderCore.h"
+#include "RTS_Survival/Game/GameState/CPPGameState.h"
+#include "RTS_Survival/Game/GameState/GameResourceManager/GameResourceManager.h"
+#include "RTS_Survival/Game/GameState/GameUnitManager/GameUnitManager.h"
+#include "RTS_Survival/GameUI/TrainingUI/TrainingOptions/TrainingOptions.h"
+#include "RTS_Survival/Interfaces/Commands.h"
+#include "RTS_Survival/Player/CPPController.h"
+#include "RTS_Survival/Player/AsyncRTSAssetsSpawner/RTSAsyncSpawner.h"
+#include "RTS_Survival/Player/PauseGame/PauseGameOptions.h"
+#include "RTS_Survival/RTSComponents/RTSComponent.h"
+#include "RTS_Survival/Units/Enums/Enum_UnitType.h"
+#include "RTS_Survival/Utils/RTS_Statics/RTS_Statics.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Tickable.h"
+#include "TimerManager.h"
+#include "UObject/UObjectGlobals.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogRTSPerfBenchmarks, Display, All);
+
+namespace RTS::UnitTests::PerfBenchmarkShipping
+{
+	constexpr int32 ScenarioUnitCounts[] = {200, 500, 1000};
+	// Mix of every scenario; the remainder after tanks and squads are aircraft.
+	constexpr float TankShare = 0.5f;
+	constexpr float SquadShare = 0.35f;
+	constexpr uint8 PlayerId = 1;
+	constexpr uint8 EnemyId = 2;
+	constexpr int32 SpawnRequestsPerTick = 20;
+	constexpr int32 UnitsPerArmyRow = 25;
+	constexpr float ArmyRowSpacing = 600.f;
+	constexpr float ArmyColumnSpacing = 500.f;
+	// Distance of each army's front row to the center of the battlefield.
+	constexpr float ArmyFrontOffset = 6000.f;
+	constexpr float AircraftSpawnHeight = 3000.f;
+	constexpr float RuntimeReadyTimeoutSeconds = 30.f;
+	constexpr float SpawnTimeoutSeconds = 90.f;
+	constexpr float DefaultWarmupSeconds = 10.f;
+	constexpr float DefaultMeasureSeconds = 30.f;
+	constexpr float CleanupSettleSeconds = 3.f;
+	constexpr float DefaultRegressionTolerance = 0.1f;
+	// Absolute slack on top of the relative tolerance so noise on small values is not reported as a regression.
+	constexpr double RegressionSlackMs = 0.5;
+	constexpr double RegressionSlackMemoryMB = 64.0;
+	constexpr int32 MaxTestMapTravelAttempts = 3;
+	const TCHAR* TestMapPackageName = TEXT("/Game/RTS_Survival/Maps/UnitTests/UT_PerfBenchmark");
+
+	const TArray<FTrainingOption>& GetRosterForSide(const uint8 OwningPlayer, const EAllUnitType UnitType)
+	{
+		static const TArray<FTrainingOption> PlayerTanks = {
+			{EAllUnitType::UNType_Tank, static_cast<uint8>(ETankSubtype::Tank_PanzerIv)},
+			{EAllUnitType::UNType_Tank, static_cast<uint8>(ETankSubtype::Tank_Puma)},
+		};
+		static const TArray<FTrainingOption> EnemyTanks = {
+			{EAllUnitType::UNType_Tank, static_cast<uint8>(ETankSubtype::Tank_T34_85)},
+			{EAllUnitType::UNType_Tank, static_cast<uint8>(ETankSubtype::Tank_BT7)},
+		};
+		static const TArray<FTrainingOption> PlayerSquads = {
+			{EAllUnitType::UNType_Squad, static_cast<uint8>(ESquadSubtype::Squad_Ger_JagerTruppKar98k)},
+			{EAllUnitType::UNType_Squad, static_cast<uint8>(ESquadSubtype::Squad_Ger_LMGSquad)},
+		};
+		static const TArray<FTrainingOption> EnemySquads = {
+			{EAllUnitType::UNType_Squad, static_cast<uint8>(ESquadSubtype::Squad_Rus_Maxim)},
+			{EAllUnitType::UNType_Squad, static_cast<uint8>(ESquadSubtype::Squad_Rus_DShK)},
+		};
+		static const TArray<FTrainingOption> PlayerAircraft = {
+			{EAllUnitType::UNType_Aircraft, static_cast<uint8>(EAircraftSubtype::Aircraft_Bf109)},
+		};
+		static const TArray<FTrainingOption> EnemyAircraft = {
+			{EAllUnitType::UNType_Aircraft, static_cast<uint8>(EAircraftSubtype::Aircraft_Yak)},
+		};
+
+		const bool bIsPlayer = OwningPlayer == PlayerId;
+		switch (UnitType)
+		{
+		case EAllUnitType::UNType_Tank:
+			return bIsPlayer ? PlayerTanks : EnemyTanks;
+		case EAllUnitType::UNType_Squad:
+			return bIsPlayer ? PlayerSquads : EnemySquads;
+		default:
+			return bIsPlayer ? PlayerAircraft : EnemyAircraft;
+		}
+	}
+
+	struct FPerfSpawnRequest
+	{
+		FTrainingOption TrainingOption;
+		FVector Location = FVector::ZeroVector;
+		FRotator Rotation = FRotator::ZeroRotator;
+		FVector MoveTarget = FVector::ZeroVector;
+		uint8 OwningPlayer = PlayerId;
+	};
+
+	/** Shared with the spawn callbacks so a callback arriving after the runner is gone does nothing. */
+	struct FPerfScenarioSpawnState
+	{
+		TArray<TWeakObjectPtr<AActor>> SpawnedActors;
+		int32 CompletedSpawnCount = 0;
+		int32 FailedSpawnCount = 0;
+	};
+
+	struct FPerfFrameSample
+	{
+		float FrameMs = 0.f;
+		float GameThreadMs = 0.f;
+		float GcMs = 0.f;
+		float UsedPhysicalMB = 0.f;
+		float AsyncTargetLatencyP50Ms = 0.f;
+		float AsyncTargetLatencyP99Ms = 0.f;
+		float AsyncResourceLatencyP50Ms = 0.f;
+		float AsyncResourceLatencyP99Ms = 0.f;
+		int32 AliveUnits = 0;
+	};
+
+	struct FPerfScenarioSummary
+	{
+		FString Name;
+		int32 RequestedUnits = 0;
+		int32 SpawnedUnits = 0;
+		int32 FailedSpawns = 0;
+		int32 Frames = 0;
+		double FrameMsAverage = 0.0;
+		double FrameMsP50 = 0.0;
+		double FrameMsP95 = 0.0;
+		double FrameMsP99 = 0.0;
+		double FrameMsMax = 0.0;
+		double GameThreadMsP50 = 0.0;
+		double GameThreadMsP99 = 0.0;
+		double GcMsTotal = 0.0;
+		double GcMsMax = 0.0;
+		double PeakUsedPhysicalMB = 0.0;
+		double AsyncTargetLatencyP99MsMax = 0.0;
+		double AsyncResourceLatencyP99MsMax = 0.0;
+	};
+
+	/** A metric compared against the baseline, with the slack that still counts as unchanged. */
+	struct FPerfRegressionMetric
+	{
+		const TCHAR* FieldName;
+		double FPerfScenarioSummary::* Value;
+		double AbsoluteSlack;
+	};
+
+	const FPerfRegressionMetric RegressionMetrics[] = {
+		{TEXT("frame_ms_p95"), &FPerfScenarioSummary::FrameMsP95, RegressionSlackMs},
+		{TEXT("frame_ms_p99"), &FPerfScenarioSummary::FrameMsP99, RegressionSlackMs},
+		{TEXT("game_thread_ms_p99"), &FPerfScenarioSummary::GameThreadMsP99, RegressionSlackMs},
+		{TEXT("gc_ms_max"), &FPerfScenarioSummary::GcMsMax, RegressionSlackMs},
+		{TEXT("peak_used_physical_mb"), &FPerfScenarioSummary::PeakUsedPhysicalMB, RegressionSlackMemoryMB},
+		{TEXT("async_target_latency_p99_ms_max"), &FPerfScenarioSummary::AsyncTargetLatencyP99MsMax,
+		 RegressionSlackMs},
+		{TEXT("async_resource_latency_p99_ms_max"), &FPerfScenarioSummary::AsyncResourceLatencyP99MsMax,
+		 RegressionSlackMs},
+	};
+
+	enum class EPerfBenchmarkPhase : uint8
+	{
+		WaitForRuntime,
+		SpawnScenario,
+		Warmup,
+		Measure,
+		Cleanup,
+		Complete,
+	};
+
+	bool GetIsCurrentMapSupported(const UWorld& World)
+	{
+		return World.GetMapName().Contains(TEXT("UT_PerfBenchmark"));
+	}
+
+	bool GetWasRequestedOnCommandLine()
+	{
+		FString RequestedMapTest;
+		const bool bHasNamedRun = FParse::Value(FCommandLine::Get(), TEXT("RTSRunMapTest="), RequestedMapTest);
+		return FParse::Param(FCommandLine::Get(), TEXT("RTSRunPerfBenchmarks"))
+			|| (bHasNamedRun && (RequestedMapTest == TEXT("PerfBenchmarks") || RequestedMapTest == TEXT("All")));
+	}
+
+	double GetPercentile(TArray<float> Values, const float Percentile)
+	{
+		if (Values.IsEmpty())
+		{
+			return 0.0;
+		}
+		Values.Sort();
+		const int32 Index = FMath::Clamp(FMath::FloorToInt32(Percentile * (Values.Num() - 1)), 0, Values.Num() - 1);
+		return Values[Index];
+	}
+
+	class FPerfBenchmarkShippingTestRunner final : public FTickableGameObject
+	{
+	public:
+		explicit FPerfBenchmarkShippingTestRunner(UWorld& InWorld);
+		virtual ~FPerfBenchmarkShippingTestRunner() override;
+
+		virtual void Tick(float DeltaTime) override;
+		virtual TStatId GetStatId() const override;
+		virtual bool IsTickable() const override;
+		virtual bool IsTickableWhenPaused() const override;
+
+		void StartRun(const FString& Reason);
+		bool GetIsForWorld(const UWorld* World) const;
+
+	private:
+		void AdvanceWaitForRuntime();
+		void AdvanceSpawnScenario();
+		void AdvanceWarmup();
+		void AdvanceMeasure();
+		void AdvanceCleanup();
+		void SetPhase(EPerfBenchmarkPhase NewPhase);
+
+		void BeginScenario();
+		void BuildSpawnRequests(int32 UnitCount);
+		void AddArmySpawnRequests(uint8 OwningPlayer, int32 NumTanks, int32 NumSquads, int32 NumAircraft);
+		void IssueSpawnRequests();
+		void RecordFrameSample();
+		void FinishScenario();
+		void DestroyScenarioUnits();
+		int32 GetAliveScenarioUnitCount() const;
+
+		void OnPreGarbageCollect();
+		void OnPostGarbageCollect();
+
+		void FinishRun();
+		void WriteReport();
+		TSharedRef<FJsonObject> BuildScenarioJson(const FPerfScenarioSummary& Summary) const;
+		void CompareAgainstBaseline(const FString& BaselinePath, TArray<TSharedPtr<FJsonValue>>& OutRegressions);
+		void ResetRunState();
+		void ResumeTestWorldIfPaused() const;
+
+		double GetRealTimeSeconds() const;
+		double GetPhaseElapsedSeconds() const;
+
+		TWeakObjectPtr<UWorld> M_World;
+		TSharedPtr<FPerfScenarioSpawnState> M_SpawnState;
+		TArray<FPerfSpawnRequest> M_PendingSpawnRequests;
+		TArray<FPerfFrameSample> M_ScenarioSamples;
+		TArray<FPerfScenarioSummary> M_ScenarioSummaries;
+		// One line per measured frame of every scenario, written as the CSV report.
+		TArray<FString> M_FrameCsvLines;
+		FString M_RunReason;
+		FString M_ReportBaseName;
+		FDelegateHandle M_PreGarbageCollectHandle;
+		FDelegateHandle M_PostGarbageCollectHandle;
+		double M_RunStartedSeconds = 0.0;
+		double M_PhaseStartedSeconds = 0.0;
+		double M_LastFrameSeconds = 0.0;
+		double M_GarbageCollectStartedSeconds = 0.0;
+		// GC time since the last sample, in ms.
+		double M_PendingGcMs = 0.0;
+		float M_WarmupSeconds = DefaultWarmupSeconds;
+		float M_MeasureSeconds = DefaultMeasureSeconds;
+		int32 M_ScenarioIndex = 0;
+		int32 M_NextSpawnId = 0;
+		int32 M_RegressionCount = 0;
+		EPerfBenchmarkPhase M_Phase = EPerfBenchmarkPhase::WaitForRuntime;
+		bool bM_IsRunning = false;
+		bool bM_ExitOnComplete = false;
+		bool bM_HasReportError = false;
+	};
+
+	TArray<TUniquePtr<FPerfBenchmarkShippingTestRunner>> GActiveRunners;
+	int32 GTestMapTravelAttempts = 0;
+
+	FPerfBenchmarkShippingTestRunner* FindRunnerForWorld(const UWorld* World)
+	{
+		for (const TUniquePtr<FPerfBenchmarkShippingTestRunner>& Runner : GActiveRunners)
+		{
+			if (Runner.IsValid() && Runner->GetIsForWorld(World))
+			{
+				return Runner.Get();
+			}
+		}
+
+		return nullptr;
+	}
+
+	void StartRunnerForWorld(UWorld& World, const FString& Reason)
+	{
+		if (not World.IsGameWorld())
+		{
+			return;
+		}
+
+		FPerfBenchmarkShippingTestRunner* ExistingRunner = FindRunnerForWorld(&World);
+		if (ExistingRunner != nullptr)
+		{
+			ExistingRunner->StartRun(Reason);
+			return;
+		}
+
+		TUniquePtr<FPerfBenchmarkShippingTestRunner> NewRunner = MakeUnique<FPerfBenchmarkShippingTestRunner>(World);
+		NewRunner->StartRun(Reason);
+		GActiveRunners.Add(MoveTemp(NewRunner));
+	}
+
+	void RemoveRunnerForWorld(const UWorld* World)
+	{
+		for (int32 RunnerIndex = GActiveRunners.Num() - 1; RunnerIndex >= 0; --RunnerIndex)
+		{
+			if (GActiveRunners[RunnerIndex].IsValid() && GActiveRunners[RunnerIndex]->GetIsForWorld(World))
+			{
+				GActiveRunners.RemoveAtSwap(RunnerIndex);
+			}
+		}
+	}
+
+	void QueueTravelToTestMap(UWorld& World)
+	{
+		if (GTestMapTravelAttempts >= MaxTestMapTravelAttempts)
+		{
+			UE_LOG(LogRTSPerfBenchmarks, Error,
+			       TEXT("RTS_PERF_BENCHMARK_RESULT FAIL could not travel to %s after %d attempts."),
+			       TestMapPackageName,
+			       GTestMapTravelAttempts);
+			if (FParse::Param(FCommandLine::Get(), TEXT("RTSTestExitOnComplete")))
+			{
+				FPlatformMisc::RequestExitWithStatus(false, 1, TEXT("RTS Perf Benchmarks"));
+			}
+			return;
+		}
+
+		GTestMapTravelAttempts++;
+		TWeakObjectPtr<UWorld> WeakWorld = &World;
+		World.GetTimerManager().SetTimerForNextTick(FTimerDelegate::CreateLambda([WeakWorld]()
+		{
+			UWorld* TravelWorld = WeakWorld.Get();
+			if (not IsValid(TravelWorld))
+			{
+				return;
+			}
+
+			UE_LOG(LogRTSPerfBenchmarks, Display,
+			       TEXT("RTS_PERF_BENCHMARK_TRAVEL map=%s attempt=%d"),
+			       TestMapPackageName,
+			       GTestMapTravelAttempts);
+			UGameplayStatics::OpenLevel(TravelWorld, FName(TestMapPackageName));
+		}));
+	}
+
+	void HandlePostWorldInitialization(UWorld* World, const UWorld::InitializationValues)
+	{
+		if (not IsValid(World) || not World->IsGameWorld() || not GetWasRequestedOnCommandLine())
+		{
+			return;
+		}
+
+		if (not GetIsCurrentMapSupported(*World))
+		{
+			QueueTravelToTestMap(*World);
+			return;
+		}
+
+		GTestMapTravelAttempts = 0;
+		StartRunnerForWorld(*World, TEXT("command-line"));
+	}
+
+	void HandleWorldCleanup(UWorld* World, bool, bool)
+	{
+		RemoveRunnerForWorld(World);
+	}
+
+	void RunPerfBenchmarksCommand(const TArray<FString>&, UWorld* World)
+	{
+		if (not IsValid(World))
+		{
+			UE_LOG(LogRTSPerfBenchmarks, Error, TEXT("RTS.UnitTests.PerfBenchmarks.Run failed: world is invalid."));
+			return;
+		}
+
+		StartRunnerForWorld(*World, TEXT("console-command"));
+	}
+
+	FAutoConsoleCommandWithWorldAndArgs GRunPerfBenchmarksCommand(
+		TEXT("RTS.UnitTests.PerfBenchmarks.Run"),
+		TEXT("Runs the scripted mass battle performance benchmarks on UT_PerfBenchmark."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&RunPerfBenchmarksCommand));
+
+	struct FPerfBenchmarkShippingTestRegistration
+	{
+		FDelegateHandle PostWorldInitializationHandle;
+		FDelegateHandle WorldCleanupHandle;
+
+		FPerfBenchmarkShippingTestRegistration()
+		{
+			PostWorldInitializationHandle =
+				FWorldDelegates::OnPostWorldInitialization.AddStatic(&HandlePostWorldInitialization);
+			WorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddStatic(&HandleWorldCleanup);
+		}
+
+		~FPerfBenchmarkShippingTestRegistration()
+		{
+			FWorldDelegates::OnPostWorldInitialization.Remove(PostWorldInitializationHandle);
+			FWorldDelegates::OnWorldCleanup.Remove(WorldCleanupHandle);
+		}
+	};
+
+	FPerfBenchmarkShippingTestRegistration GRegistration;
+
+	FPerfBenchmarkShippingTestRunner::FPerfBenchmarkShippingTestRunner(UWorld& InWorld)
+		: M_World(&InWorld)
+	{
+		M_PreGarbageCollectHandle = FCoreUObjectDelegates::GetPreGarbageCollectDelegate().AddRaw(
+			this, &FPerfBenchmarkShippingTestRunner::OnPreGarbageCollect);
+		M_PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddRaw(
+			this, &FPerfBenchmarkShippingTestRunner::OnPostGarbageCollect);
+	}
+
+	FPerfBenchmarkShippingTestRunner::~FPerfBenchmarkShippingTestRunner()
+	{
+		FCoreUObjectDelegates::GetPreGarbageCollectDelegate().Remove(M_PreGarbageCollectHandle);
+		FCoreUObjectDelegates::GetPostGarbageCollect().Remove(M_PostGarbageCollectHandle);
+	}
+
+	void FPerfBenchmarkShippingTestRunner::Tick(const float DeltaTime)
+	{
+		(void)DeltaTime;
+		ResumeTestWorldIfPaused();
+
+		switch (M_Phase)
+		{
+		case EPerfBenchmarkPhase::WaitForRuntime:
+			AdvanceWaitForRuntime();
+			break;
+		case EPerfBenchmarkPhase::SpawnScenario:
+			AdvanceSpawnScenario();
+			break;
+		case EPerfBenchmarkPhase::Warmup:
+			AdvanceWarmup();
+			break;
+		case EPerfBenchmarkPhase::Measure:
+			AdvanceMeasure();
+			break;
+		case EPerfBenchmarkPhase::Cleanup:
+			AdvanceCleanup();
+			break;
+		case EPerfBenchmarkPhase::Complete:
+			break;
+		}
+	}
+
+	TStatId FPerfBenchmarkShippingTestRunner::GetStatId() const
+	{
+		RETURN_QUICK_DECLARE_CYCLE_STAT(FPerfBenchmarkShippingTestRunner, STATGROUP_Tickables);
+	}
+
+	bool FPerfBenchmarkShippingTestRunner::IsTickable() const
+	{
+		return bM_IsRunning && M_World.IsValid();
+	}
+
+	bool FPerfBenchmarkShippingTestRunner::IsTickableWhenPaused() const
+	{
+		return true;
+	}
+
+	void FPerfBenchmarkShippingTestRunner::StartRun(const FString& Reason)
+	{
+		if (bM_IsRunning)
+		{
+			UE_LOG(LogRTSPerfBenchmarks, Warning, TEXT("Perf benchmarks are already running."));
+			return;
+		}
+
+		UWorld* World = M_World.Get();
+		if (not IsValid(World) || not GetIsCurrentMapSupported(*World))
+		{
+			UE_LOG(LogRTSPerfBenchmarks, Error, TEXT("Perf benchmarks require UT_PerfBenchmark."));
+			return;
+		}
+
+		ResetRunState();
+		FParse::Value(FCommandLine::Get(), TEXT("RTSPerfWarmupSeconds="), M_WarmupSeconds);
+		FParse::Value(FCommandLine::Get(), TEXT("RTSPerfMeasureSeconds="), M_MeasureSeconds);
+		M_WarmupSeconds = FMath::Max(0.f, M_WarmupSeconds);
+		M_MeasureSeconds = FMath::Max(1.f, M_MeasureSeconds);
+		bM_ExitOnComplete = FParse::Param(FCommandLine::Get(), TEXT("RTSTestExitOnComplete"));
+		M_RunReason = Reason;
+		M_ReportBaseName = FString::Printf(TEXT("Run_%s"), *FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S")));
+		ResumeTestWorldIfPaused();
+		M_RunStartedSeconds = GetRealTimeSeconds();
+		M_PhaseStartedSeconds = M_RunStartedSeconds;
+		M_Phase = EPerfBenchmarkPhase::WaitForRuntime;
+		bM_IsRunning = true;
+
+		UE_LOG(LogRTSPerfBenchmarks, Display,
+		       TEXT("RTS_PERF_BENCHMARK_BEGIN reason=%s map=%s warmup=%.1f measure=%.1f"),
+		       *M_RunReason,
+		       *World->GetMapName(),
+		       M_WarmupSeconds,
+		       M_MeasureSeconds);
+	}
+
+	bool FPerfBenchmarkShippingTestRunner::GetIsForWorld(const UWorld* World) const
+	{
+		return M_World.Get() == World;
+	}
+
+	void FPerfBenchmarkShippingTestRunner::AdvanceWaitForRuntime()
+	{
+		const UWorld* World = M_World.Get();
+		if (IsValid(FRTS_Statics::GetAsyncSpawner(World)) && IsValid(FRTS_Statics::GetGameUnitManager(World)))
+		{
+			BeginScenario();
+			return;
+		}
+
+		if (GetPhaseElapsedSeconds() < RuntimeReadyTimeoutSeconds)
+		{
+			return;
+		}
+
+		UE_LOG(LogRTSPerfBenchmarks, Error,
+		       TEXT("RTS_PERF_BENCHMARK_FAIL name=Runtime.Ready details=async spawner or game unit manager missing"));
+		bM_HasReportError = true;
+		FinishRun();
+	}
+
+	void FPerfBenchmarkShippingTestRunner::AdvanceSpawnScenario()
+	{
+		IssueSpawnRequests();
+		const int32 RequestedUnits = ScenarioUnitCounts[M_ScenarioIndex];
+		const bool bAllSpawnsCompleted = M_PendingSpawnRequests.IsEmpty()
+			&& M_SpawnState->CompletedSpawnCount + M_SpawnState->FailedSpawnCount >= RequestedUnits;
+		if (bAllSpawnsCompleted)
+		{
+			SetPhase(EPerfBenchmarkPhase::Warmup);
+			return;
+		}
+
+		if (GetPhaseElapsedSeconds() < SpawnTimeoutSeconds)
+		{
+			return;
+		}
+
+		// Benchmark what did spawn; the report shows the shortfall.
+		const int32 NumTimedOut = RequestedUnits - M_SpawnState->CompletedSpawnCount - M_SpawnState->FailedSpawnCount;
+		M_SpawnState->FailedSpawnCount += FMath::Max(0, NumTimedOut);
+		M_PendingSpawnRequests.Reset();
+		UE_LOG(LogRTSPerfBenchmarks, Warning,
+		       TEXT("RTS_PERF_BENCHMARK_SPAWN_TIMEOUT scenario=%d spawned=%d failed=%d"),
+		       RequestedUnits,
+		       M_SpawnState->SpawnedActors.Num(),
+		       M_SpawnState->FailedSpawnCount);
+		SetPhase(EPerfBenchmarkPhase::Warmup);
+	}
+
+	void FPerfBenchmarkShippingTestRunner::AdvanceWarmup()
+	{
+		if (GetPhaseElapsedSeconds() < M_WarmupSeconds)
+		{
+			return;
+		}
+
+		M_ScenarioSamples.Reset();
+		M_PendingGcMs = 0.0;
+		M_LastFrameSeconds = GetRealTimeSeconds();
+		SetPhase(EPerfBenchmarkPhase::Measure);
+	}
+
+	void FPerfBenchmarkShippingTestRunner::AdvanceMeasure()
+	{
+		RecordFrameSample();
+		if (GetPhaseElapsedSeconds() < M_MeasureSeconds)
+		{
+			return;
+		}
+
+		FinishScenario();
+		DestroyScenarioUnits();
+		if (GEngine != nullptr)
+		{
+			GEngine->ForceGarbageCollection(true);
+		}
+		SetPhase(EPerfBenchmarkPhase::Cleanup);
+	}
+
+	void FPerfBenchmarkShippingTestRunner::AdvanceCleanup()
+	{
+		if (GetPhaseElapsedSeconds() < CleanupSettleSeconds)
+		{
+			return;
+		}
+
+		M_ScenarioIndex++;
+		if (M_ScenarioIndex >= UE_ARRAY_COUNT(ScenarioUnitCounts))
+		{
+			FinishRun();
+			return;
+		}
+		BeginScenario();
+	}
+
+	void FPerfBenchmarkShippingTestRunner::SetPhase(const EPerfBenchmarkPhase NewPhase)
+	{
+		M_Phase = NewPhase;
+		M_PhaseStartedSeconds = GetRealTimeSeconds();
+	}
+
+	void FPerfBenchmarkShippingTestRunner::BeginScenario()
+	{
+		const int32 UnitCount = ScenarioUnitCounts[M_ScenarioIndex];
+		M_SpawnState = MakeShared<FPerfScenarioSpawnState>();
+		M_SpawnState->SpawnedActors.Reserve(UnitCount);
+		BuildSpawnRequests(UnitCount);
+		UE_LOG(LogRTSPerfBenchmarks, Display,
+		       TEXT("RTS_PERF_BENCHMARK_SCENARIO_BEGIN units=%d requests=%d"),
+		       UnitCount,
+		       M_PendingSpawnRequests.Num());
+		SetPhase(EPerfBenchmarkPhase::SpawnScenario);
+	}
+
+	void FPerfBenchmarkShippingTestRunner::BuildSpawnRequests(const int32 UnitCount)
+	{
+		M_PendingSpawnRequests.Reset();
+		const int32 UnitsPerSide = UnitCount / 2;
+		const int32 NumTanks = FMath::RoundToInt32(UnitsPerSide * TankShare);
+		const int32 NumSquads = FMath::RoundToInt32(UnitsPerSide * SquadShare);
+		const int32 NumAircraft = FMath::Max(0, UnitsPerSide - NumTanks - NumSquads);
+		AddArmySpawnRequests(PlayerId, NumTanks, NumSquads, NumAircraft);
+		AddArmySpawnRequests(EnemyId, NumTanks, NumSquads, NumAircraft);
+	}
+
+	void FPerfBenchmarkShippingTestRunner::AddArmySpawnRequests(
+		const uint8 OwningPlayer,
+		const int32 NumTanks,
+		const int32 NumSquads,
+		const int32 NumAircraft)
+	{
+		// The player army forms up on -X facing +X, the enemy army mirrored; both advance to the center.
+		const float Direction = OwningPlayer == PlayerId ? -1.f : 1.f;
+		const FRotator FacingRotation(0.f, OwningPlayer == PlayerId ? 0.f : 180.f, 0.f);
+		const TPair<EAllUnitType, int32> UnitTypeCounts[] = {
+			{EAllUnitType::UNType_Tank, NumTanks},
+			{EAllUnitType::UNType_Squad, NumSquads},
+			{EAllUnitType::UNType_Aircraft, NumAircraft},
+		};
+
+		int32 SlotIndex = 0;
+		for (const TPair<EAllUnitType, int32>& UnitTypeCount : UnitTypeCounts)
+		{
+			const TArray<FTrainingOption>& Roster = GetRosterForSide(OwningPlayer, UnitTypeCount.Key);
+			for (int32 UnitIndex = 0; UnitIndex < UnitTypeCount.Value; ++UnitIndex, ++SlotIndex)
+			{
+				const int32 Row = SlotIndex / UnitsPerArmyRow;
+				const int32 Column = SlotIndex % UnitsPerArmyRow;
+				const float LateralOffset = (Column - (UnitsPerArmyRow - 1) * 0.5f) * ArmyColumnSpacing;
+
+				FPerfSpawnRequest Request;
+				Request.TrainingOption = Roster[UnitIndex % Roster.Num()];
+				Request.OwningPlayer = OwningPlayer;
+				Request.Rotation = FacingRotation;
+				Request.Location = FVector(Direction * (ArmyFrontOffset + Row * ArmyRowSpacing), LateralOffset, 0.f);
+				if (UnitTypeCount.Key == EAllUnitType::UNType_Aircraft)
+				{
+					Request.Location.Z = AircraftSpawnHeight;
+				}
+				Request.MoveTarget = FVector(0.f, LateralOffset, 0.f);
+				M_PendingSpawnRequests.Add(Request);
+			}
+		}
+	}
+
+	void FPerfBenchmarkShippingTestRunner::IssueSpawnRequests()
+	{
+		UWorld* World = M_World.Get();
+		ARTSAsyncSpawner* AsyncSpawner = FRTS_Statics::GetAsyncSpawner(World);
+		if (not IsValid(AsyncSpawner))
+		{
+			return;
+		}
+
+		const int32 NumToIssue = FMath::Min(SpawnRequestsPerTick, M_PendingSpawnRequests.Num());
+		for (int32 RequestIndex = 0; RequestIndex < NumToIssue; ++RequestIndex)
+		{
+			const FPerfSpawnRequest Request = M_PendingSpawnRequests[RequestIndex];
+			TWeakPtr<FPerfScenarioSpawnState> WeakSpawnState = M_SpawnState;
+			auto OnSpawned = [WeakSpawnState, Request](const FTrainingOption& TrainingOption, AActor* SpawnedActor,
+			                                           const int32 SpawnId)
+			{
+				static_cast<void>(TrainingOption);
+				static_cast<void>(SpawnId);
+
+				const TSharedPtr<FPerfScenarioSpawnState> SpawnState = WeakSpawnState.Pin();
+				if (not SpawnState.IsValid())
+				{
+					return;
+				}
+				if (not IsValid(SpawnedActor))
+				{
+					SpawnState->FailedSpawnCount++;
+					return;
+				}
+
+				SpawnState->CompletedSpawnCount++;
+				SpawnState->SpawnedActors.Add(SpawnedActor);
+				if (URTSComponent* RTSComponent = SpawnedActor->FindComponentByClass<URTSComponent>())
+				{
+					RTSComponent->SetOwningPlayerRuntime(Request.OwningPlayer);
+				}
+				if (ICommands* Commands = Cast<ICommands>(SpawnedActor))
+				{
+					Commands->MoveToLocation(Request.MoveTarget, true, Request.Rotation);
+				}
+			};
+
+			if (not AsyncSpawner->AsyncSpawnOptionAtLocation(
+				Request.TrainingOption,
+				Request.Location,
+				World,
+				M_NextSpawnId++,
+				OnSpawned,
+				Request.Rotation))
+			{
+				M_SpawnState->FailedSpawnCount++;
+				UE_LOG(LogRTSPerfBenchmarks, Warning,
+				       TEXT("RTS_PERF_BENCHMARK_SPAWN_FAIL option=%s"),
+				       *Request.TrainingOption.GetTrainingName());
+			}
+		}
+		M_PendingSpawnRequests.RemoveAt(0, NumToIssue, EAllowShrinking::No);
+	}
+
+	void FPerfBenchmarkShippingTestRunner::RecordFrameSample()
+	{
+		const double NowSeconds = GetRealTimeSeconds();
+		FPerfFrameSample Sample;
+		Sample.FrameMs = static_cast<float>((NowSeconds - M_LastFrameSeconds) * 1000.0);
+		Sample.GameThreadMs = FPlatformTime::ToMilliseconds(GGameThreadTime);
+		Sample.GcMs = static_cast<float>(M_PendingGcMs);
+		Sample.UsedPhysicalMB = static_cast<float>(FPlatformMemory::GetStats().UsedPhysical / (1024.0 * 1024.0));
+		Sample.AliveUnits = GetAliveScenarioUnitCount();
+		if (const UGameUnitManager* GameUnitManager = FRTS_Statics::GetGameUnitManager(M_World.Get()))
+		{
+			GameUnitManager->PerfBenchmark_GetAsyncTargetLatency(
+				Sample.AsyncTargetLatencyP50Ms, Sample.AsyncTargetLatencyP99Ms);
+		}
+		const ACPPGameState* GameState = FRTS_Statics::GetGameState(M_World.Get());
+		if (const UGameResourceManager* GameResourceManager = GameState ? GameState->GetGameResourceManager() : nullptr)
+		{
+			GameResourceManager->PerfBenchmark_GetAsyncResourceLatency(
+				Sample.AsyncResourceLatencyP50Ms, Sample.AsyncResourceLatencyP99Ms);
+		}
+		M_LastFrameSeconds = NowSeconds;
+		M_PendingGcMs = 0.0;
+
+		M_FrameCsvLines.Add(FString::Printf(
+			TEXT("%d,%d,%.3f,%.3f,%.3f,%.1f,%.3f,%.3f,%.3f,%.3f,%d"),
+			ScenarioUnitCounts[M_ScenarioIndex],
+			M_ScenarioSamples.Num(),
+			Sample.FrameMs,
+			Sample.GameThreadMs,
+			Sample.GcMs,
+			Sample.UsedPhysicalMB,
+			Sample.AsyncTargetLatencyP50Ms,
+			Sample.AsyncTargetLatencyP99Ms,
+			Sample.AsyncResourceLatencyP50Ms,
+			Sample.AsyncResourceLatencyP99Ms,
+			Sample.AliveUnits));
+		M_ScenarioSamples.Add(Sample);
+	}
+
+	void FPerfBenchmarkShippingTestRunner::FinishScenario()
+	{
+		FPerfScenarioSummary Summary;
+		Summary.RequestedUnits = ScenarioUnitCounts[M_ScenarioIndex];
+		Summary.Name = FString::Printf(TEXT("MassBattle_%d"), Summary.RequestedUnits);
+		Summary.SpawnedUnits = M_SpawnState->CompletedSpawnCount;
+		Summary.FailedSpawns = M_SpawnState->FailedSpawnCount;
+		Summary.Frames = M_ScenarioSamples.Num();
+
+		TArray<float> FrameMs;
+		TArray<float> GameThreadMs;
+		FrameMs.Reserve(M_ScenarioSamples.Num());
+		GameThreadMs.Reserve(M_ScenarioSamples.Num());
+		for (const FPerfFrameSample& Sample : M_ScenarioSamples)
+		{
+			FrameMs.Add(Sample.FrameMs);
+			GameThreadMs.Add(Sample.GameThreadMs);
+			Summary.FrameMsAverage += Sample.FrameMs;
+			Summary.FrameMsMax = FMath::Max<double>(Summary.FrameMsMax, Sample.FrameMs);
+			Summary.GcMsTotal += Sample.GcMs;
+			Summary.GcMsMax = FMath::Max<double>(Summary.GcMsMax, Sample.GcMs);
+			Summary.PeakUsedPhysicalMB = FMath::Max<double>(Summary.PeakUsedPhysicalMB, Sample.UsedPhysicalMB);
+			Summary.AsyncTargetLatencyP99MsMax = FMath::Max<double>(
+				Summary.AsyncTargetLatencyP99MsMax, Sample.AsyncTargetLatencyP99Ms);
+			Summary.AsyncResourceLatencyP99MsMax = FMath::Max<double>(
+				Summary.AsyncResourceLatencyP99MsMax, Sample.AsyncResourceLatencyP99Ms);
+		}
+		Summary.FrameMsAverage /= FMath::Max(1, M_ScenarioSamples.Num());
+		Summary.FrameMsP50 = GetPercentile(FrameMs, 0.5f);
+		Summary.FrameMsP95 = GetPercentile(FrameMs, 0.95f);
+		Summary.FrameMsP99 = GetPercentile(FrameMs, 0.99f);
+		Summary.GameThreadMsP50 = GetPercentile(GameThreadMs, 0.5f);
+		Summary.GameThreadMsP99 = GetPercentile(GameThreadMs, 0.99f);
+
+		UE_LOG(LogRTSPerfBenchmarks, Display,
+		       TEXT("RTS_PERF_BENCHMARK_SCENARIO name=%s spawned=%d failed=%d frames=%d frame_ms_avg=%.2f "
+			       "frame_ms_p95=%.2f game_thread_ms_p99=%.2f gc_ms_max=%.2f peak_mb=%.0f async_p99_ms=%.2f "
+			       "resource_p99_ms=%.2f"),
+		       *Summary.Name,
+		       Summary.SpawnedUnits,
+		       Summary.FailedSpawns,
+		       Summary.Frames,
+		       Summary.FrameMsAverage,
+		       Summary.FrameMsP95,
+		       Summary.GameThreadMsP99,
+		       Summary.GcMsMax,
+		       Summary.PeakUsedPhysicalMB,
+		       Summary.AsyncTargetLatencyP99MsMax,
+		       Summary.AsyncResourceLatencyP99MsMax);
+		M_ScenarioSummaries.Add(MoveTemp(Summary));
+	}
+
+	void FPerfBenchmarkShippingTestRunner::DestroyScenarioUnits()
+	{
+		if (not M_SpawnState.IsValid())
+		{
+			return;
+		}
+		for (const TWeakObjectPtr<AActor>& SpawnedActor : M_SpawnState->SpawnedActors)
+		{
+			if (SpawnedActor.IsValid())
+			{
+				SpawnedActor->Destroy();
+			}
+		}
+		// Late spawn callbacks of this scenario are dropped with the state.
+		M_SpawnState.Reset();
+	}
+
+	int32 FPerfBenchmarkShippingTestRunner::GetAliveScenarioUnitCount() const
+	{
+		if (not M_SpawnState.IsValid())
+		{
+			return 0;
+		}
+		int32 AliveCount = 0;
+		for (const TWeakObjectPtr<AActor>& SpawnedActor : M_SpawnState->SpawnedActors)
+		{
+			AliveCount += SpawnedActor.IsValid() ? 1 : 0;
+		}
+		return AliveCount;
+	}
+
+	void FPerfBenchmarkShippingTestRunner::OnPreGarbageCollect()
+	{
+		M_GarbageCollectStartedSeconds = GetRealTimeSeconds();
+	}
+
+	void FPerfBenchmarkShippingTestRunner::OnPostGarbageCollect()
+	{
+		if (M_GarbageCollectStartedSeconds <= 0.0)
+		{
+			return;
+		}
+		M_PendingGcMs += (GetRealTimeSeconds() - M_GarbageCollectStartedSeconds) * 1000.0;
+		M_GarbageCollectStartedSeconds = 0.0;
+	}
+
+	void FPerfBenchmarkShippingTestRunner::FinishRun()
+	{
+		if (not bM_IsRunning)
+		{
+			return;
+		}
+
+		SetPhase(EPerfBenchmarkPhase::Complete);
+		bM_IsRunning = false;
+		DestroyScenarioUnits();
+		WriteReport();
+		const bool bPassed = not bM_HasReportError && M_RegressionCount == 0;
+		UE_LOG(LogRTSPerfBenchmarks, Display,
+		       TEXT("RTS_PERF_BENCHMARK_RESULT %s scenarios=%d regressions=%d elapsed=%.2f"),
+		       bPassed ? TEXT("PASS") : TEXT("FAIL"),
+		       M_ScenarioSummaries.Num(),
+		       M_RegressionCount,
+		       GetRealTimeSeconds() - M_RunStartedSeconds);
+		if (bM_ExitOnComplete)
+		{
+			FPlatformMisc::RequestExitWithStatus(false, bPassed ? 0 : 1, TEXT("RTS Perf Benchmarks"));
+		}
+	}
+
+	void FPerfBenchmarkShippingTestRunner::WriteReport()
+	{
+		const FString ReportDirectory = FPaths::ProjectSavedDir() / TEXT("PerfBenchmarks");
+		IFileManager::Get().MakeDirectory(*ReportDirectory, true);
+
+		TArray<TSharedPtr<FJsonValue>> ScenarioValues;
+		for (const FPerfScenarioSummary& Summary : M_ScenarioSummaries)
+		{
+			ScenarioValues.Add(MakeShared<FJsonValueObject>(BuildScenarioJson(Summary)));
+		}
+
+		TArray<TSharedPtr<FJsonValue>> Regressions;
+		FString BaselinePath;
+		if (FParse::Value(FCommandLine::Get(), TEXT("RTSPerfBaseline="), BaselinePath))
+		{
+			CompareAgainstBaseline(BaselinePath, Regressions);
+		}
+
+		const TSharedRef<FJsonObject> Report = MakeShared<FJsonObject>();
+		Report->SetStringField(TEXT("run"), M_ReportBaseName);
+		Report->SetStringField(TEXT("reason"), M_RunReason);
+		Report->SetStringField(TEXT("platform"), FPlatformProperties::IniPlatformName());
+		Report->SetNumberField(TEXT("warmup_seconds"), M_WarmupSeconds);
+		Report->SetNumberField(TEXT("measure_seconds"), M_MeasureSeconds);
+		Report->SetArrayField(TEXT("scenarios"), ScenarioValues);
+		Report->SetStringField(TEXT("baseline"), BaselinePath);
+		Report->SetArrayField(TEXT("regressions"), Regressions);
+
+		FString ReportJson;
+		const TSharedRef<TJsonWriter<>> JsonWriter = TJsonWriterFactory<>::Create(&ReportJson);
+		FJsonSerializer::Serialize(Report, JsonWriter);
+		const FString JsonPath = ReportDirectory / (M_ReportBaseName + TEXT(".json"));
+		if (not FFileHelper::SaveStringToFile(ReportJson, *JsonPath))
+		{
+			UE_LOG(LogRTSPerfBenchmarks, Error, TEXT("Failed to write perf benchmark report: %s"), *JsonPath);
+			bM_HasReportError = true;
+		}
+
+		FString FrameCsv = TEXT("scenario_units,frame,frame_ms,game_thread_ms,gc_ms,used_physical_mb,"
+			"async_target_latency_p50_ms,async_target_latency_p99_ms,async_resource_latency_p50_ms,"
+			"async_resource_latency_p99_ms,alive_units") LINE_TERMINATOR;
+		for (const FString& CsvLine : M_FrameCsvLines)
+		{
+			FrameCsv += CsvLine + LINE_TERMINATOR;
+		}
+		const FString CsvPath = ReportDirectory / (M_ReportBaseName + TEXT("_Frames.csv"));
+		if (not FFileHelper::SaveStringToFile(FrameCsv, *CsvPath))
+		{
+			UE_LOG(LogRTSPerfBenchmarks, Error, TEXT("Failed to write perf benchmark frames: %s"), *CsvPath);
+			bM_HasReportError = true;
+		}
+
+		UE_LOG(LogRTSPerfBenchmarks, Display, TEXT("RTS_PERF_BENCHMARK_REPORT json=%s csv=%s"), *JsonPath, *CsvPath);
+	}
+
+	TSharedRef<FJsonObject> FPerfBenchmarkShippingTestRunner::BuildScenarioJson(
+		const FPerfScenarioSummary& Summary) const
+	{
+		const TSharedRef<FJsonObject> ScenarioJson = MakeShared<FJsonObject>();
+		ScenarioJson->SetStringField(TEXT("name"), Summary.Name);
+		ScenarioJson->SetNumberField(TEXT("requested_units"), Summary.RequestedUnits);
+		ScenarioJson->SetNumberField(TEXT("spawned_units"), Summary.SpawnedUnits);
+		ScenarioJson->SetNumberField(TEXT("failed_spawns"), Summary.FailedSpawns);
+		ScenarioJson->SetNumberField(TEXT("frames"), Summary.Frames);
+		ScenarioJson->SetNumberField(TEXT("frame_ms_avg"), Summary.FrameMsAverage);
+		ScenarioJson->SetNumberField(TEXT("frame_ms_p50"), Summary.FrameMsP50);
+		ScenarioJson->SetNumberField(TEXT("frame_ms_max"), Summary.FrameMsMax);
+		ScenarioJson->SetNumberField(TEXT("game_thread_ms_p50"), Summary.GameThreadMsP50);
+		ScenarioJson->SetNumberField(TEXT("gc_ms_total"), Summary.GcMsTotal);
+		for (const FPerfRegressionMetric& Metric : RegressionMetrics)
+		{
+			ScenarioJson->SetNumberField(Metric.FieldName, Summary.*Metric.Value);
+		}
+		return ScenarioJson;
+	}
+
+	void FPerfBenchmarkShippingTestRunner::CompareAgainstBaseline(
+		const FString& BaselinePath,
+		TArray<TSharedPtr<FJsonValue>>& OutRegressions)
+	{
+		FString BaselineJson;
+		TSharedPtr<FJsonObject> Baseline;
+		if (not FFileHelper::LoadFileToString(BaselineJson, *BaselinePath)
+			|| not FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(BaselineJson), Baseline)
+			|| not Baseline.IsValid())
+		{
+			UE_LOG(LogRTSPerfBenchmarks, Error, TEXT("RTS_PERF_BENCHMARK_FAIL name=Baseline.Load details=%s"),
+			       *BaselinePath);
+			bM_HasReportError = true;
+			return;
+		}
+
+		float Tolerance = DefaultRegressionTolerance;
+		FParse::Value(FCommandLine::Get(), TEXT("RTSPerfTolerance="), Tolerance);
+		const TArray<TSharedPtr<FJsonValue>>* BaselineScenarios = nullptr;
+		if (not Baseline->TryGetArrayField(TEXT("scenarios"), BaselineScenarios))
+		{
+			return;
+		}
+
+		for (const FPerfScenarioSummary& Summary : M_ScenarioSummaries)
+		{
+			const TSharedPtr<FJsonObject>* BaselineScenario = nullptr;
+			for (const TSharedPtr<FJsonValue>& ScenarioValue : *BaselineScenarios)
+			{
+				const TSharedPtr<FJsonObject>* ScenarioObject = nullptr;
+				FString ScenarioName;
+				if (ScenarioValue->TryGetObject(ScenarioObject)
+					&& (*ScenarioObject)->TryGetStringField(TEXT("name"), ScenarioName)
+					&& ScenarioName == Summary.Name)
+				{
+					BaselineScenario = ScenarioObject;
+					break;
+				}
+			}
+			if (BaselineScenario == nullptr)
+			{
+				UE_LOG(LogRTSPerfBenchmarks, Warning, TEXT("RTS_PERF_BENCHMARK_NO_BASELINE scenario=%s"),
+				       *Summary.Name);
+				continue;
+			}
+
+			for (const FPerfRegressionMetric& Metric : RegressionMetrics)
+			{
+				double BaselineValue = 0.0;
+				if (not (*BaselineScenario)->TryGetNumberField(Metric.FieldName, BaselineValue))
+				{
+					continue;
+				}
+				const double CurrentValue = Summary.*Metric.Value;
+				const double AllowedValue = BaselineValue * (1.0 + Tolerance) + Metric.AbsoluteSlack;
+				if (CurrentValue <= AllowedValue)
+				{
+					continue;
+				}
+
+				M_RegressionCount++;
+				UE_LOG(LogRTSPerfBenchmarks, Error,
+				       TEXT("RTS_PERF_REGRESSION scenario=%s metric=%s baseline=%.3f current=%.3f allowed=%.3f"),
+				       *Summary.Name,
+				       Metric.FieldName,
+				       BaselineValue,
+				       CurrentValue,
+				       AllowedValue);
+				const TSharedRef<FJsonObject> Regression = MakeShared<FJsonObject>();
+				Regression->SetStringField(TEXT("scenario"), Summary.Name);
+				Regression->SetStringField(TEXT("metric"), Metric.FieldName);
+				Regression->SetNumberField(TEXT("baseline"), BaselineValue);
+				Regression->SetNumberField(TEXT("current"), CurrentValue);
+				Regression->SetNumberField(TEXT("allowed"), AllowedValue);
+				OutRegressions.Add(MakeShared<FJsonValueObject>(Regression));
+			}
+		}
+	}
+
+	void FPerfBenchmarkShippingTestRunner::ResetRunState()
+	{
+		DestroyScenarioUnits();
+		M_PendingSpawnRequests.Reset();
+		M_ScenarioSamples.Reset();
+		M_ScenarioSummaries.Reset();
+		M_FrameCsvLines.Reset();
+		M_RunReason.Reset();
+		M_ReportBaseName.Reset();
+		M_RunStartedSeconds = 0.0;
+		M_PhaseStartedSeconds = 0.0;
+		M_LastFrameSeconds = 0.0;
+		M_GarbageCollectStartedSeconds = 0.0;
+		M_PendingGcMs = 0.0;
+		M_WarmupSeconds = DefaultWarmupSeconds;
+		M_MeasureSeconds = DefaultMeasureSeconds;
+		M_ScenarioIndex = 0;
+		M_RegressionCount = 0;
+		M_Phase = EPerfBenchmarkPhase::WaitForRuntime;
+		bM_IsRunning = false;
+		bM_ExitOnComplete = false;
+		bM_HasReportError = false;
+	}
+
+	void FPerfBenchmarkShippingTestRunner::ResumeTestWorldIfPaused() const
+	{
+		UWorld* World = M_World.Get();
+		if (not IsValid(World))
+		{
+			return;
+		}
+
+		// The RTS boots paused behind a "click to start" widget; drive the real start-game path so the
+		// controller's pause state is cleared, see the Enemy AI shipping tests.
+		ACPPController* PlayerController = FRTS_Statics::GetRTSController(World);
+		if (IsValid(PlayerController) && PlayerController->GetIsGameOnPause())
+		{
+			PlayerController->PauseGame(ERTSPauseGameOptions::ForceUnpause);
+		}
+
+		if (UGameplayStatics::IsGamePaused(World))
+		{
+			UGameplayStatics::SetGamePaused(World, false);
+		}
+	}
+
+	double FPerfBenchmarkShippingTestRunner::GetRealTimeSeconds() const
+	{
+		return FPlatformTime::Seconds();
+	}
+
+	double FPerfBenchmarkShippingTestRunner::GetPhaseElapsedSeconds() const
+	{
+		return GetRealTimeSeconds() - M_PhaseStartedSeconds;
+	}
+}
+
+#endif // defined(RTS_WITH_PERF_BENCHMARK_SHIPPING_TESTS) && RTS_WITH_PERF_BENCHMARK_SHIPPING_TESTS
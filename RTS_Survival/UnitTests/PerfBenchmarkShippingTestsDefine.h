@@ -0,0 +1,6 @@
+#pragma once
+
+// Only the RTS_SurvivalShippingPerfBenchmarks target defines this; every other target compiles the benchmark hooks out.
+#ifndef RTS_WITH_PERF_BENCHMARK_SHIPPING_TESTS
+#define RTS_WITH_PERF_BENCHMARK_SHIPPING_TESTS 0
+#endif
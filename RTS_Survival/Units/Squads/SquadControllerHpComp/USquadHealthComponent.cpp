@@ -61,15 +61,13 @@ void USquadHealthComponent::OnWidgetInitialized()
                 return;
         }
 
-        UW_HealthBar* HealthBarWidget = GetHealthBarWidget();
-        if (not IsValid(HealthBarWidget))
+        if (not ApplySquadWeaponIcon(M_SquadWeaponIconSettingsToSet))
         {
-                RTSFunctionLibrary::ReportError("Squad waited for health bar widget to initialize, but it is invalid. "
+                RTSFunctionLibrary::ReportError("Squad waited for health bar to initialize, but it is invalid. "
                                                                   "Cannot set squad weapon icon.");
                 return;
         }
 
-        HealthBarWidget->UpdateSquadWeaponIcon(M_SquadWeaponIconSettingsToSet);
         bM_OnWidgetInitLoadWeaponIcon = false;
         M_SquadWeaponIconSettingsToSet = FSquadWeaponIconDisplaySettings();
 }
@@ -147,19 +145,32 @@ void USquadHealthComponent::SquadHeal(const float HealAmount)
 
 void USquadHealthComponent::UpdateSquadWeaponIcon(const FSquadWeaponIconDisplaySettings& NewWeaponIconSettings)
 {
-        UW_HealthBar* HealthBarWidget = GetHealthBarWidget();
-        if (not IsValid(HealthBarWidget))
+        if (not ApplySquadWeaponIcon(NewWeaponIconSettings))
         {
                 bM_OnWidgetInitLoadWeaponIcon = true;
                 M_SquadWeaponIconSettingsToSet = NewWeaponIconSettings;
                 return;
         }
 
-        HealthBarWidget->UpdateSquadWeaponIcon(NewWeaponIconSettings);
         bM_OnWidgetInitLoadWeaponIcon = false;
         M_SquadWeaponIconSettingsToSet = FSquadWeaponIconDisplaySettings();
 }
 
+bool USquadHealthComponent::ApplySquadWeaponIcon(const FSquadWeaponIconDisplaySettings& WeaponIconSettings) const
+{
+        if (GetUsesBatchedHealthBar())
+        {
+                return SetBatchedWeaponIcon(WeaponIconSettings);
+        }
+        UW_HealthBar* HealthBarWidget = GetHealthBarWidget();
+        if (not IsValid(HealthBarWidget))
+        {
+                return false;
+        }
+        HealthBarWidget->UpdateSquadWeaponIcon(WeaponIconSettings);
+        return true;
+}
+
 void USquadHealthComponent::OnUnitStateChanged(USquadUnitHealthComponent* UnitHealth,
                                                const float NewUnitMax,
                                                const float NewUnitCurrent,
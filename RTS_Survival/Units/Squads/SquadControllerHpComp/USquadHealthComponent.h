@@ -89,6 +89,9 @@ private:
         UPROPERTY()
         FSquadWeaponIconDisplaySettings M_SquadWeaponIconSettingsToSet;
 
+	/** @return Whether the widget or batched bar existed to show the icon on. */
+	bool ApplySquadWeaponIcon(const FSquadWeaponIconDisplaySettings& WeaponIconSettings) const;
+
 	UPROPERTY()
 	bool bM_HasFullMaxInitialized = false;
 
@@ -1052,6 +1052,11 @@ void ANomadicVehicle::HideCargoUI()
 			return;
 		}
 
+		if (HealthComp->GetHasBatchedHealthBar())
+		{
+			HealthComp->OnGarrisonEnabled(false);
+			return;
+		}
 		UWidgetComponent* WidgetComp = HealthComp->GetHealthBarWidgetComp();
 		if (not IsValid(WidgetComp))
 		{
@@ -1382,6 +1387,10 @@ void ANomadicVehicle::SetRadiusComponentActive(const bool bIsActive) const
 	if (IsValid(M_RadiusComp))
 	{
 		M_RadiusComp->SetEnabled(bIsActive);
+		if (UPlayerBuildRadiusManager* PlayerBuildRadiusManager = FRTS_Statics::GetPlayerBuildRadiusManager(this))
+		{
+			PlayerBuildRadiusManager->OnBuildRadiusEnabledChanged(M_RadiusComp);
+		}
 	}
 }
 
@@ -0,0 +1,62 @@
+// Copyright (C) Bas Blokzijl - All rights reserved.
+
+#include "FRTSTextureRegionUpload.h"
+
+#include "Engine/Texture2D.h"
+
+void FRTSTextureRegionUpload::UploadPixelRects(
+	UTexture2D& Texture,
+	const int32 MipIndex,
+	const TArray<FColor>& MipPixels,
+	const int32 MipWidth,
+	const TArray<FIntRect>& PixelRects)
+{
+	if (PixelRects.IsEmpty())
+	{
+		return;
+	}
+
+	// Regions are stacked vertically in one buffer.
+	int32 PackedWidth = 0;
+	int32 PackedHeight = 0;
+	for (const FIntRect& PixelRect : PixelRects)
+	{
+		PackedWidth = FMath::Max(PackedWidth, PixelRect.Width());
+		PackedHeight += PixelRect.Height();
+	}
+	FColor* PackedPixels = new FColor[PackedWidth * PackedHeight];
+	FUpdateTextureRegion2D* Regions = new FUpdateTextureRegion2D[PixelRects.Num()];
+	int32 PackedY = 0;
+	for (int32 RectIndex = 0; RectIndex < PixelRects.Num(); ++RectIndex)
+	{
+		const FIntRect& PixelRect = PixelRects[RectIndex];
+		Regions[RectIndex] = FUpdateTextureRegion2D(
+			PixelRect.Min.X,
+			PixelRect.Min.Y,
+			0,
+			PackedY,
+			PixelRect.Width(),
+			PixelRect.Height());
+		for (int32 PixelY = PixelRect.Min.Y; PixelY < PixelRect.Max.Y; ++PixelY)
+		{
+			FMemory::Memcpy(
+				PackedPixels + (PackedY + PixelY - PixelRect.Min.Y) * PackedWidth,
+				MipPixels.GetData() + PixelY * MipWidth + PixelRect.Min.X,
+				PixelRect.Width() * sizeof(FColor));
+		}
+		PackedY += PixelRect.Height();
+	}
+
+	Texture.UpdateTextureRegions(
+		MipIndex,
+		PixelRects.Num(),
+		Regions,
+		PackedWidth * sizeof(FColor),
+		sizeof(FColor),
+		reinterpret_cast<uint8*>(PackedPixels),
+		[](uint8* SourceData, const FUpdateTextureRegion2D* UploadedRegions)
+		{
+			delete[] reinterpret_cast<FColor*>(SourceData);
+			delete[] UploadedRegions;
+		});
+}
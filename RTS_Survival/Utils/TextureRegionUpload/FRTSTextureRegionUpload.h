@@ -0,0 +1,29 @@
+// Copyright (C) Bas Blokzijl - All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UTexture2D;
+
+/**
+ * @brief Uploads rectangles of a CPU pixel copy into one mip of a texture without reuploading the whole mip.
+ */
+struct RTS_SURVIVAL_API FRTSTextureRegionUpload
+{
+	/**
+	 * @brief Copies the rects into one packed buffer that the render thread owns and frees once the upload ran, so the
+	 * CPU pixels may be written again right after this call.
+	 * @param Texture Texture whose resource receives the regions.
+	 * @param MipIndex Texture mip receiving the regions.
+	 * @param MipPixels CPU copy of that mip, row major.
+	 * @param MipWidth Width in pixels of MipPixels.
+	 * @param PixelRects Regions to upload, in pixels of this mip.
+	 */
+	static void UploadPixelRects(
+		UTexture2D& Texture,
+		int32 MipIndex,
+		const TArray<FColor>& MipPixels,
+		int32 MipWidth,
+		const TArray<FIntRect>& PixelRects);
+};
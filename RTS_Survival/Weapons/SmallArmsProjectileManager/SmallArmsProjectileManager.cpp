@@ -15,7 +15,7 @@ ASmallArmsProjectileManager::ASmallArmsProjectileManager()
 	PrimaryActorTick.TickInterval = 0.25;
 	PrimaryActorTick.bCanEverTick = true;
 	PrimaryActorTick.bStartWithTickEnabled = false;
-	M_LastActivatedProjectileIndex = -1;
+	bM_IsNiagaraDataDirty = false;
 	M_NiagaraComponent = CreateDefaultSubobject<UNiagaraComponent>(TEXT("NiagaraComponent"));
 }
 
@@ -29,24 +29,14 @@ void ASmallArmsProjectileManager::FireProjectile(
 	{
 		return;
 	}
-	bool bIsPoolSaturated;
-	const int32 Index = FindDormantProjectileIndex(bIsPoolSaturated);
-	if (bIsPoolSaturated)
+	const float LifeTime = FVector::Dist(Position, EndPosition) /
+		DeveloperSettings::GamePlay::Projectile::SmallArmsProjectileSpeed;
+	if (not M_SmallArmsProjectilePool.AddProjectile(Position, EndPosition, Type, StartTime, LifeTime))
 	{
 		OnPoolSaturated();
 		return;
 	}
-	const double LifeTime = FVector::Dist(Position, EndPosition) /
-		DeveloperSettings::GamePlay::Projectile::SmallArmsProjectileSpeed;
-	// Index is valid.
-	M_LastActivatedProjectileIndex = Index;
-	SetProjectileValues(
-		Position,
-		EndPosition,
-		Type,
-		StartTime,
-		LifeTime,
-		Index);
+	bM_IsNiagaraDataDirty = true;
 }
 
 AProjectile* ASmallArmsProjectileManager::GetDormantTankProjectile()
@@ -136,54 +126,21 @@ void ASmallArmsProjectileManager::OnPoolSaturated()
 	RTSFunctionLibrary::ReportError("Projectile pool is saturated! No projectiles left.");
 }
 
-int32 ASmallArmsProjectileManager::FindDormantProjectileIndex(bool& bOutIsPoolSaturated) const
-{
-	// Start looking from the last activated projectile.
-	const int32 StartIndex = (M_LastActivatedProjectileIndex + 1) % FSoA_SmallArmsProjectilesPool::PoolSize;
-	constexpr int32 MaxSteps = FSoA_SmallArmsProjectilesPool::PoolSize;
-	for (int32 i = 0; i < MaxSteps; ++i)
-	{
-		const int32 Index = (StartIndex + i) % FSoA_SmallArmsProjectilesPool::PoolSize;
-		if (not M_SmallArmsProjectilePool.bIsActive[Index])
-		{
-			bOutIsPoolSaturated = false;
-			return Index;
-		}
-	}
-	bOutIsPoolSaturated = true;
-	return -1;
-}
-
-void ASmallArmsProjectileManager::SetProjectileValues(const FVector& Position, const FVector& EndPosition,
-                                                      const int32 Type, const float StartTime, const double LifeTime,
-                                                      const int32 ProjectileIndex)
-{
-	M_SmallArmsProjectilePool.bIsActive[ProjectileIndex] = true;
-	M_SmallArmsProjectilePool.Positions[ProjectileIndex] = Position;
-	M_SmallArmsProjectilePool.EndPositions[ProjectileIndex] = EndPosition;
-	const FVector TypeAndTime = FVector(Type, StartTime, LifeTime);
-	M_SmallArmsProjectilePool.ProjectileTypesStartTimeLifeTime[ProjectileIndex] = TypeAndTime;
-}
-
 void ASmallArmsProjectileManager::UpdateProjectiles()
 {
 	if (not EnsureWorldIsValid())
 	{
 		return;
 	}
-	const double CurrentTime = M_World->GetTimeSeconds();
-	for (int32 i = 0; i < FSoA_SmallArmsProjectilesPool::PoolSize; ++i)
+	const int32 NumExpired = M_SmallArmsProjectilePool.RemoveExpiredProjectiles(M_World->GetTimeSeconds());
+	if (NumExpired > 0)
 	{
-		if (not M_SmallArmsProjectilePool.bIsActive[i])
-		{
-			continue;
-		}
-		if (CurrentTime - M_SmallArmsProjectilePool.ProjectileTypesStartTimeLifeTime[i].Y > M_SmallArmsProjectilePool.
-			ProjectileTypesStartTimeLifeTime[i].Z)
-		{
-			Debug_ProjectilePooling("Projectile at index: " + FString::FromInt(i) + " has expired.");
-			M_SmallArmsProjectilePool.bIsActive[i] = false;
-		}
+		Debug_ProjectilePooling(FString::FromInt(NumExpired) + " projectiles have expired.");
+		bM_IsNiagaraDataDirty = true;
+	}
+	if (not bM_IsNiagaraDataDirty)
+	{
+		return;
 	}
 	UpdateNiagaraWithData();
 }
@@ -194,6 +151,7 @@ void ASmallArmsProjectileManager::UpdateNiagaraWithData()
 	{
 		return;
 	}
+	bM_IsNiagaraDataDirty = false;
 	UNiagaraDataInterfaceArrayFunctionLibrary::SetNiagaraArrayVector(
 		M_NiagaraComponent, FName(*NiagaraPositionArrayName), M_SmallArmsProjectilePool.Positions);
 	UNiagaraDataInterfaceArrayFunctionLibrary::SetNiagaraArrayVector(
@@ -214,15 +172,8 @@ void ASmallArmsProjectileManager::Debug_AmountProjectilesActive() const
 {
 	if constexpr (DeveloperSettings::Debugging::GProjectilePooling_Compile_DebugSymbols)
 	{
-		int32 ActiveProjectiles = 0;
-		for (int32 i = 0; i < FSoA_SmallArmsProjectilesPool::PoolSize; ++i)
-		{
-			if (M_SmallArmsProjectilePool.bIsActive[i])
-			{
-				++ActiveProjectiles;
-			}
-		}
-		RTSFunctionLibrary::PrintString("Amount of active projectiles: " + FString::FromInt(ActiveProjectiles),
+		RTSFunctionLibrary::PrintString("Amount of active projectiles: " + FString::FromInt(
+			                                M_SmallArmsProjectilePool.Num()),
 		                                FColor::Red);
 	}
 }
@@ -67,8 +67,8 @@ private:
 	// Contains all the projectile data in a DOP style.
 	FSoA_SmallArmsProjectilesPool M_SmallArmsProjectilePool;
 
-	// The index of the last activated projectile.
-	int32 M_LastActivatedProjectileIndex;
+	// Set when projectiles were fired or expired since the last niagara upload.
+	bool bM_IsNiagaraDataDirty;
 
 	// Cached World pointer.
 	TWeakObjectPtr<UWorld> M_World;
@@ -81,23 +81,13 @@ private:
 	bool GetIsValidNiagaraComponent();
 	void OnPoolSaturated();
 
-	/** @return The first available projectile index.
-	 * @param bOutIsPoolSaturated if true then no projectiles are left!*/
-	int32 FindDormantProjectileIndex(bool& bOutIsPoolSaturated) const;
-
-	void SetProjectileValues(const FVector& Position,
-	                         const FVector& EndPosition,
-	                         const int32 Type,
-	                         const float StartTime,
-	                         const double LifeTime,
-	                         const int32 ProjectileIndex);
-
-	/** @brief Update the LifeTime calculations of projectiles and updates niagara with the data
+	/** @brief Removes the expired projectiles and updates niagara with the data if anything changed.
 	 * @see UpdateNiagaraWithData */
 	void UpdateProjectiles();
 
 	/**
 	 * @brief Propagates the data needed for bullet simulation to the Niagara system.
+	 * Only the active projectiles are uploaded, the pool keeps them at the front of its arrays.
 	 * @post Set the Position and EndPosition arrays to keep track between where the bullets travel.
 	 * @post Set the combined array of {Type, StartTime, LifeTime} to keep track of the type of bullet,
 	 * when it was fired and how long it will live.
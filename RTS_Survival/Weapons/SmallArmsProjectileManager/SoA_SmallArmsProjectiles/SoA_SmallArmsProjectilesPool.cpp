@@ -0,0 +1,71 @@
+﻿#include "SoA_SmallArmsProjectilesPool.h"
+
+
+FSoA_SmallArmsProjectilesPool::FSoA_SmallArmsProjectilesPool()
+{
+	Positions.Reserve(PoolSize);
+	EndPositions.Reserve(PoolSize);
+	ProjectileTypesStartTimeLifeTime.Reserve(PoolSize);
+	ExpiryTimes.Reserve(PoolSize);
+}
+
+bool FSoA_SmallArmsProjectilesPool::AddProjectile(const FVector& Position, const FVector& EndPosition,
+                                                  const int32 Type, const float StartTime, const float LifeTime)
+{
+	if (Num() >= MaxPoolSize)
+	{
+		return false;
+	}
+	Positions.Add(Position);
+	EndPositions.Add(EndPosition);
+	ProjectileTypesStartTimeLifeTime.Add(FVector(Type, StartTime, LifeTime));
+	ExpiryTimes.Add(StartTime + LifeTime);
+	return true;
+}
+
+int32 FSoA_SmallArmsProjectilesPool::RemoveExpiredProjectiles(const float CurrentTime)
+{
+	// Most ticks nothing expires; the branch-free count over the packed floats avoids touching the vectors then.
+	const int32 NumExpired = CountExpired(CurrentTime);
+	if (NumExpired == 0)
+	{
+		return 0;
+	}
+
+	const int32 NumProjectiles = Num();
+	float* const Expiry = ExpiryTimes.GetData();
+	int32 NumSurvivors = 0;
+	for (int32 Index = 0; Index < NumProjectiles; ++Index)
+	{
+		if (Expiry[Index] < CurrentTime)
+		{
+			continue;
+		}
+		if (NumSurvivors != Index)
+		{
+			Expiry[NumSurvivors] = Expiry[Index];
+			Positions[NumSurvivors] = Positions[Index];
+			EndPositions[NumSurvivors] = EndPositions[Index];
+			ProjectileTypesStartTimeLifeTime[NumSurvivors] = ProjectileTypesStartTimeLifeTime[Index];
+		}
+		++NumSurvivors;
+	}
+
+	ExpiryTimes.SetNum(NumSurvivors, EAllowShrinking::No);
+	Positions.SetNum(NumSurvivors, EAllowShrinking::No);
+	EndPositions.SetNum(NumSurvivors, EAllowShrinking::No);
+	ProjectileTypesStartTimeLifeTime.SetNum(NumSurvivors, EAllowShrinking::No);
+	return NumExpired;
+}
+
+int32 FSoA_SmallArmsProjectilesPool::CountExpired(const float CurrentTime) const
+{
+	const float* const Expiry = ExpiryTimes.GetData();
+	const int32 NumProjectiles = Num();
+	int32 NumExpired = 0;
+	for (int32 Index = 0; Index < NumProjectiles; ++Index)
+	{
+		NumExpired += Expiry[Index] < CurrentTime ? 1 : 0;
+	}
+	return NumExpired;
+}
@@ -3,12 +3,15 @@
 #include "CoreMinimal.h"
 #include "RTS_Survival/DeveloperSettings.h"
 
+/**
+ * Dense pool of in-flight small arms projectiles: the active projectiles are always the first Num() entries of every
+ * array, so the arrays can be handed to niagara as is and firing is an append.
+ * The reserved capacity behind Num() serves as the free list; expiry compacts the survivors to the front.
+ */
 struct FSoA_SmallArmsProjectilesPool
 {
 	static constexpr int32 PoolSize = DeveloperSettings::GamePlay::Projectile::SmallArmsProjectilePoolSize;
-
-	// Array that keeps track of whether each projectile is active/used.
-	TArray<bool> bIsActive;
+	static constexpr int32 MaxPoolSize = DeveloperSettings::GamePlay::Projectile::SmallArmsProjectilePoolMaxSize;
 
 	// Array that keeps track of the positions of projectiles.
 	TArray<FVector> Positions;
@@ -19,15 +22,27 @@ struct FSoA_SmallArmsProjectilesPool
 	// Array that keeps track of the type of the projectile on X, the start time on Y and the lifetime on Z.
 	TArray<FVector> ProjectileTypesStartTimeLifeTime;
 
-	FSoA_SmallArmsProjectilesPool()
-	{
-		
-		for (int32 i = 0; i < PoolSize; ++i)
-		{
-			bIsActive.Add(false);
-			Positions.Add(FVector::ZeroVector);
-			EndPositions.Add(FVector::ZeroVector);
-			ProjectileTypesStartTimeLifeTime.Add(FVector::ZeroVector);
-		}
-	}
+	// World time at which each projectile expires (start time + lifetime); the only array the expiry kernel reads.
+	TArray<float, TAlignedHeapAllocator<16>> ExpiryTimes;
+
+	FSoA_SmallArmsProjectilesPool();
+
+	int32 Num() const { return ExpiryTimes.Num(); }
+
+	/**
+	 * @brief Appends a projectile to the active range.
+	 * @return False if the pool reached MaxPoolSize; the projectile is not added.
+	 */
+	bool AddProjectile(const FVector& Position, const FVector& EndPosition, const int32 Type, const float StartTime,
+	                   const float LifeTime);
+
+	/**
+	 * @brief Removes every projectile that expired at CurrentTime, survivors keep their relative order.
+	 * @return The amount of removed projectiles.
+	 */
+	int32 RemoveExpiredProjectiles(const float CurrentTime);
+
+private:
+	/** @return The amount of projectiles with an expiry time before CurrentTime. */
+	int32 CountExpired(const float CurrentTime) const;
 };
@@ -0,0 +1,87 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "RTS_Survival/WorldCampaign/CampaignGeneration/GenerationHelpers/WorldCampaignAnchorGraph.h"
+
+namespace WorldCampaignAnchorGraphTestConstants
+{
+	// Path 0-1-2-3 with a shortcut 0-4-3, an isolated anchor 5 and an invalid anchor 6 that 5 points at.
+	constexpr int32 NumAnchors = 7;
+	constexpr int32 IsolatedAnchor = 5;
+	constexpr int32 InvalidAnchor = 6;
+}
+
+namespace
+{
+	TArray<TArray<int32>> BuildTestNeighbors()
+	{
+		using namespace WorldCampaignAnchorGraphTestConstants;
+
+		TArray<TArray<int32>> NeighborsByAnchor;
+		NeighborsByAnchor.SetNum(NumAnchors);
+		NeighborsByAnchor[0] = {1, 4};
+		NeighborsByAnchor[1] = {0, 2};
+		NeighborsByAnchor[2] = {1, 3};
+		NeighborsByAnchor[3] = {2, 4};
+		NeighborsByAnchor[4] = {0, 3};
+		// Out of range and invalid neighbors are dropped.
+		NeighborsByAnchor[IsolatedAnchor] = {InvalidAnchor, NumAnchors};
+		NeighborsByAnchor[InvalidAnchor] = {0};
+		return NeighborsByAnchor;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FWorldCampaignAnchorGraphTest,
+	"RTS.WorldCampaign.Generation.AnchorGraph.HopsAndDegrees",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FWorldCampaignAnchorGraphTest::RunTest(const FString& Parameters)
+{
+	using namespace WorldCampaignAnchorGraphTestConstants;
+
+	const TArray<TArray<int32>> NeighborsByAnchor = BuildTestNeighbors();
+	FWorldCampaignAnchorGraph Graph;
+	Graph.Build(NumAnchors,
+	            [](const int32 AnchorIndex) { return AnchorIndex != InvalidAnchor; },
+	            [&NeighborsByAnchor](const int32 AnchorIndex) -> const TArray<int32>&
+	            {
+		            return NeighborsByAnchor[AnchorIndex];
+	            });
+
+	TestEqual(TEXT("Degree of a path anchor"), Graph.GetNeighbors(1).Num(), 2);
+	TestEqual(TEXT("Degree of the shortcut anchor"), Graph.GetNeighbors(4).Num(), 2);
+	TestEqual(TEXT("Edges to invalid or out of range anchors are dropped"), Graph.GetNeighbors(IsolatedAnchor).Num(),
+	          0);
+	TestEqual(TEXT("An invalid anchor has no edges"), Graph.GetNeighbors(InvalidAnchor).Num(), 0);
+	TestTrue(TEXT("Neighbors keep the supplied order"),
+	         Graph.GetNeighbors(0).Num() == 2 && Graph.GetNeighbors(0)[0] == 1 && Graph.GetNeighbors(0)[1] == 4);
+
+	TestEqual(TEXT("Same anchor"), Graph.GetHopDistance(2, 2), 0);
+	TestEqual(TEXT("Direct neighbor"), Graph.GetHopDistance(0, 1), 1);
+	TestEqual(TEXT("Shortcut is preferred"), Graph.GetHopDistance(0, 3), 2);
+	TestEqual(TEXT("Longest shortest path"), Graph.GetHopDistance(1, 4), 2);
+	TestEqual(TEXT("Hops are symmetric"), Graph.GetHopDistance(3, 0), Graph.GetHopDistance(0, 3));
+	TestEqual(TEXT("Unreachable anchor"), Graph.GetHopDistance(0, IsolatedAnchor), static_cast<int32>(INDEX_NONE));
+	TestEqual(TEXT("Invalid target"), Graph.GetHopDistance(0, InvalidAnchor), static_cast<int32>(INDEX_NONE));
+	TestEqual(TEXT("Out of range start"), Graph.GetHopDistance(NumAnchors, 0), static_cast<int32>(INDEX_NONE));
+
+	// A row must stay readable while rows of other sources are computed.
+	const TConstArrayView<int32> RowFromOne = Graph.GetHopDistanceRow(1);
+	for (int32 AnchorIndex = 0; AnchorIndex < NumAnchors; ++AnchorIndex)
+	{
+		Graph.GetHopDistanceRow(AnchorIndex);
+	}
+	const TArray<int32> ExpectedRowFromOne = {1, 0, 1, 2, 2, INDEX_NONE, INDEX_NONE};
+	TestTrue(TEXT("Cached row survives later queries"), TArray<int32>(RowFromOne) == ExpectedRowFromOne);
+	TestTrue(TEXT("Invalid start gives an empty row"), Graph.GetHopDistanceRow(InvalidAnchor).IsEmpty());
+
+	TArray<int32> Path;
+	TestTrue(TEXT("Path through the shortcut"), Graph.BuildShortestPath(1, 4, Path));
+	TestTrue(TEXT("Shortest path expands neighbors in adjacency order"), Path == TArray<int32>({1, 0, 4}));
+	TestFalse(TEXT("No path to an isolated anchor"), Graph.BuildShortestPath(0, IsolatedAnchor, Path));
+
+	return not HasAnyErrors();
+}
+
+#endif
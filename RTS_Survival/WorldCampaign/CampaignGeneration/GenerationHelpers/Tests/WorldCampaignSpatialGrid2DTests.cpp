@@ -0,0 +1,128 @@
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+#include "RTS_Survival/WorldCampaign/CampaignGeneration/GenerationHelpers/WorldCampaignSpatialGrid2D.h"
+#include "RTS_Survival/WorldCampaign/CampaignGeneration/GeneratorWorldCampaign/GeneratorWorldCampaign.h"
+#include "RTS_Survival/WorldCampaign/WorldMapObjects/AnchorPoint/AnchorPoint.h"
+
+namespace WorldCampaignSpatialGrid2DTestConstants
+{
+	constexpr int32 RandomSeed = 1337;
+	constexpr int32 BenchmarkAnchorCounts[] = {100, 500};
+	// Map area grows with the anchor count so the anchor density matches a generated campaign.
+	constexpr double AreaPerAnchor = 2500.0 * 2500.0;
+}
+
+namespace
+{
+	/** @brief Neighbors of every anchor as indices into the anchor array, in the order the generator sorted them. */
+	TArray<TArray<int32>> GetConnectionSet(const TArray<TObjectPtr<AAnchorPoint>>& Anchors)
+	{
+		TArray<TArray<int32>> NeighborIndicesByAnchor;
+		NeighborIndicesByAnchor.SetNum(Anchors.Num());
+		for (int32 AnchorIndex = 0; AnchorIndex < Anchors.Num(); ++AnchorIndex)
+		{
+			for (const TObjectPtr<AAnchorPoint>& NeighborAnchor : Anchors[AnchorIndex]->GetNeighborAnchors())
+			{
+				NeighborIndicesByAnchor[AnchorIndex].Add(Anchors.IndexOfByKey(NeighborAnchor));
+			}
+		}
+		return NeighborIndicesByAnchor;
+	}
+
+	int32 GetNumConnections(const TArray<TArray<int32>>& ConnectionSet)
+	{
+		int32 NumNeighborEntries = 0;
+		for (const TArray<int32>& NeighborIndices : ConnectionSet)
+		{
+			NumNeighborEntries += NeighborIndices.Num();
+		}
+		return NumNeighborEntries / 2;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FWorldCampaignSpatialGrid2DConnectionBenchmarkTest,
+	"RTS.WorldCampaign.SpatialGrid2D.ConnectionBenchmark",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FWorldCampaignSpatialGrid2DConnectionBenchmarkTest::RunTest(const FString& Parameters)
+{
+	using namespace WorldCampaignSpatialGrid2DTestConstants;
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+
+	AGeneratorWorldCampaign* Generator = World->SpawnActor<AGeneratorWorldCampaign>();
+	TestNotNull(TEXT("Generator spawned"), Generator);
+	for (const int32 AnchorCount : BenchmarkAnchorCounts)
+	{
+		if (not Generator)
+		{
+			break;
+		}
+
+		FRandomStream Stream(RandomSeed + AnchorCount);
+		const double MapHalfExtent = 0.5 * FMath::Sqrt(AreaPerAnchor * AnchorCount);
+		TArray<TObjectPtr<AAnchorPoint>> Anchors;
+		for (int32 AnchorIndex = 0; AnchorIndex < AnchorCount; ++AnchorIndex)
+		{
+			const FVector Location(Stream.FRandRange(-MapHalfExtent, MapHalfExtent),
+			                       Stream.FRandRange(-MapHalfExtent, MapHalfExtent), 0.0);
+			AAnchorPoint* Anchor = World->SpawnActor<AAnchorPoint>(Location, FRotator::ZeroRotator);
+			if (Anchor)
+			{
+				Anchor->SetAnchorKey(FGuid(0, 0, AnchorCount, AnchorIndex + 1), true);
+				Anchors.Add(Anchor);
+			}
+		}
+		TestEqual(FString::Printf(TEXT("Anchors spawned for %d anchors"), AnchorCount), Anchors.Num(), AnchorCount);
+
+		const double GridStart = FPlatformTime::Seconds();
+		Generator->AutomationTest_GenerateConnectionsForAnchors(Anchors, RandomSeed, true);
+		const double GridSeconds = FPlatformTime::Seconds() - GridStart;
+		const TArray<TArray<int32>> GridConnections = GetConnectionSet(Anchors);
+
+		const double BruteForceStart = FPlatformTime::Seconds();
+		Generator->AutomationTest_GenerateConnectionsForAnchors(Anchors, RandomSeed, false);
+		const double BruteForceSeconds = FPlatformTime::Seconds() - BruteForceStart;
+		const TArray<TArray<int32>> BruteForceConnections = GetConnectionSet(Anchors);
+
+		// The grids may only narrow the scans; the generated graph must be identical.
+		TestTrue(FString::Printf(TEXT("Grid connections match brute force for %d anchors"), AnchorCount),
+		         GridConnections == BruteForceConnections);
+		const int32 NumConnections = GetNumConnections(GridConnections);
+		TestTrue(FString::Printf(TEXT("Connections are generated for %d anchors"), AnchorCount),
+		         NumConnections >= AnchorCount / 2);
+
+		AddInfo(FString::Printf(TEXT("%d anchors, %d connections: grid %.3f ms, brute force %.3f ms"),
+		                        AnchorCount, NumConnections, GridSeconds * 1000.0, BruteForceSeconds * 1000.0));
+
+		Generator->AutomationTest_GenerateConnectionsForAnchors({}, RandomSeed, true);
+		for (const TObjectPtr<AAnchorPoint>& Anchor : Anchors)
+		{
+			Anchor->Destroy();
+		}
+	}
+
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+
+	FWorldCampaignSpatialGrid2D OutOfBoundsGrid;
+	OutOfBoundsGrid.Init(FBox2D(FVector2D(0.0), FVector2D(1000.0)), 100.0);
+	OutOfBoundsGrid.Insert(0, FBox2D(FVector2D(-5000.0), FVector2D(-4000.0)));
+	OutOfBoundsGrid.Insert(1, FBox2D(FVector2D(500.0), FVector2D(600.0)));
+	TArray<int32> QueryResult;
+	OutOfBoundsGrid.Query(FBox2D(FVector2D(-4500.0), FVector2D(-4400.0)), QueryResult);
+	TestTrue(TEXT("Items outside the grid bounds are still found"), QueryResult.Contains(0));
+	TestFalse(TEXT("Far items are not returned"), QueryResult.Contains(1));
+
+	return not HasAnyErrors();
+}
+
+#endif
@@ -0,0 +1,173 @@
+// Copyright (C) Bas Blokzijl - All rights reserved.
+
+#include "RTS_Survival/WorldCampaign/CampaignGeneration/GenerationHelpers/WorldCampaignAnchorGraph.h"
+
+#include "Algo/Reverse.h"
+
+void FWorldCampaignAnchorGraph::Build(const int32 NumAnchors,
+                                      TFunctionRef<bool(int32 AnchorIndex)> IsAnchorValid,
+                                      TFunctionRef<const TArray<int32>&(int32 AnchorIndex)> GetNeighborIndices)
+{
+	Reset();
+	M_NumAnchors = FMath::Max(0, NumAnchors);
+	M_ValidAnchors.Init(false, M_NumAnchors);
+	for (int32 AnchorIndex = 0; AnchorIndex < M_NumAnchors; ++AnchorIndex)
+	{
+		M_ValidAnchors[AnchorIndex] = IsAnchorValid(AnchorIndex);
+	}
+
+	M_NeighborOffsets.Reserve(M_NumAnchors + 1);
+	for (int32 AnchorIndex = 0; AnchorIndex < M_NumAnchors; ++AnchorIndex)
+	{
+		M_NeighborOffsets.Add(M_NeighborIndices.Num());
+		if (not M_ValidAnchors[AnchorIndex])
+		{
+			continue;
+		}
+
+		for (const int32 NeighborIndex : GetNeighborIndices(AnchorIndex))
+		{
+			if (GetIsValidAnchor(NeighborIndex))
+			{
+				M_NeighborIndices.Add(NeighborIndex);
+			}
+		}
+	}
+	M_NeighborOffsets.Add(M_NeighborIndices.Num());
+	M_HopRowsBySource.SetNum(M_NumAnchors);
+}
+
+void FWorldCampaignAnchorGraph::Reset()
+{
+	M_NumAnchors = 0;
+	M_NeighborOffsets.Reset();
+	M_NeighborIndices.Reset();
+	M_ValidAnchors.Reset();
+	M_HopRowsBySource.Reset();
+}
+
+TConstArrayView<int32> FWorldCampaignAnchorGraph::GetNeighbors(const int32 AnchorIndex) const
+{
+	if (not GetIsValidAnchor(AnchorIndex))
+	{
+		return TConstArrayView<int32>();
+	}
+
+	const int32 FirstNeighbor = M_NeighborOffsets[AnchorIndex];
+	return TConstArrayView<int32>(M_NeighborIndices.GetData() + FirstNeighbor,
+	                              M_NeighborOffsets[AnchorIndex + 1] - FirstNeighbor);
+}
+
+int32 FWorldCampaignAnchorGraph::GetHopDistance(const int32 StartAnchorIndex, const int32 TargetAnchorIndex) const
+{
+	if (not GetIsValidAnchor(StartAnchorIndex) || not GetIsValidAnchor(TargetAnchorIndex))
+	{
+		return INDEX_NONE;
+	}
+
+	if (StartAnchorIndex == TargetAnchorIndex)
+	{
+		return 0;
+	}
+
+	return GetHopDistanceRow(StartAnchorIndex)[TargetAnchorIndex];
+}
+
+TConstArrayView<int32> FWorldCampaignAnchorGraph::GetHopDistanceRow(const int32 StartAnchorIndex) const
+{
+	if (not GetIsValidAnchor(StartAnchorIndex))
+	{
+		return TConstArrayView<int32>();
+	}
+
+	TArray<int32>& HopRow = M_HopRowsBySource[StartAnchorIndex];
+	if (HopRow.IsEmpty())
+	{
+		HopRow.SetNumUninitialized(M_NumAnchors);
+		BuildHopRow(StartAnchorIndex, HopRow.GetData());
+	}
+
+	return HopRow;
+}
+
+bool FWorldCampaignAnchorGraph::BuildShortestPath(const int32 StartAnchorIndex, const int32 TargetAnchorIndex,
+                                                  TArray<int32>& OutPathIndices) const
+{
+	OutPathIndices.Reset();
+	if (not GetIsValidAnchor(StartAnchorIndex) || not GetIsValidAnchor(TargetAnchorIndex))
+	{
+		return false;
+	}
+
+	if (StartAnchorIndex == TargetAnchorIndex)
+	{
+		OutPathIndices.Add(StartAnchorIndex);
+		return true;
+	}
+
+	// The start is its own predecessor so it doubles as the visited marker.
+	M_BfsPredecessors.Init(INDEX_NONE, M_NumAnchors);
+	M_BfsQueue.Reset();
+	M_BfsQueue.Add(StartAnchorIndex);
+	M_BfsPredecessors[StartAnchorIndex] = StartAnchorIndex;
+	for (int32 QueueIndex = 0; QueueIndex < M_BfsQueue.Num(); ++QueueIndex)
+	{
+		const int32 CurrentIndex = M_BfsQueue[QueueIndex];
+		if (CurrentIndex == TargetAnchorIndex)
+		{
+			break;
+		}
+
+		for (const int32 NeighborIndex : GetNeighbors(CurrentIndex))
+		{
+			if (M_BfsPredecessors[NeighborIndex] != INDEX_NONE)
+			{
+				continue;
+			}
+
+			M_BfsPredecessors[NeighborIndex] = CurrentIndex;
+			M_BfsQueue.Add(NeighborIndex);
+		}
+	}
+
+	if (M_BfsPredecessors[TargetAnchorIndex] == INDEX_NONE)
+	{
+		return false;
+	}
+
+	for (int32 CurrentIndex = TargetAnchorIndex; CurrentIndex != StartAnchorIndex;
+	     CurrentIndex = M_BfsPredecessors[CurrentIndex])
+	{
+		OutPathIndices.Add(CurrentIndex);
+	}
+	OutPathIndices.Add(StartAnchorIndex);
+	Algo::Reverse(OutPathIndices);
+	return true;
+}
+
+void FWorldCampaignAnchorGraph::BuildHopRow(const int32 StartAnchorIndex, int32* OutHopRow) const
+{
+	for (int32 AnchorIndex = 0; AnchorIndex < M_NumAnchors; ++AnchorIndex)
+	{
+		OutHopRow[AnchorIndex] = INDEX_NONE;
+	}
+
+	M_BfsQueue.Reset();
+	M_BfsQueue.Add(StartAnchorIndex);
+	OutHopRow[StartAnchorIndex] = 0;
+	for (int32 QueueIndex = 0; QueueIndex < M_BfsQueue.Num(); ++QueueIndex)
+	{
+		const int32 CurrentIndex = M_BfsQueue[QueueIndex];
+		const int32 NextHops = OutHopRow[CurrentIndex] + 1;
+		for (const int32 NeighborIndex : GetNeighbors(CurrentIndex))
+		{
+			if (OutHopRow[NeighborIndex] != INDEX_NONE)
+			{
+				continue;
+			}
+
+			OutHopRow[NeighborIndex] = NextHops;
+			M_BfsQueue.Add(NeighborIndex);
+		}
+	}
+}
@@ -0,0 +1,72 @@
+// Copyright (C) Bas Blokzijl - All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * @brief Compact adjacency of the campaign anchor graph with dense int32 anchor indices.
+ *
+ * Neighbors are stored in compressed sparse row form: the neighbors of anchor i are
+ * NeighborIndices[NeighborOffsets[i] .. NeighborOffsets[i + 1]), in the order they were supplied so BFS tie-breaks
+ * match the FGuid based traversal. Hop distances are computed per source with a flat BFS and cached in a row per
+ * source, so hop queries during placement and backtracking never hash an FGuid.
+ * @note Not thread-safe; every solver owns its own graph.
+ */
+class FWorldCampaignAnchorGraph
+{
+public:
+	/**
+	 * @brief Rebuilds the adjacency and drops all cached hop rows.
+	 * @param NumAnchors Amount of dense anchor indices.
+	 * @param IsAnchorValid Anchors for which this returns false get no edges and are never reached.
+	 * @param GetNeighborIndices Neighbor indices of a valid anchor; indices out of range or invalid are skipped.
+	 */
+	void Build(const int32 NumAnchors,
+	           TFunctionRef<bool(int32 AnchorIndex)> IsAnchorValid,
+	           TFunctionRef<const TArray<int32>&(int32 AnchorIndex)> GetNeighborIndices);
+
+	void Reset();
+
+	int32 GetNumAnchors() const { return M_NumAnchors; }
+
+	bool GetIsValidAnchor(const int32 AnchorIndex) const
+	{
+		return AnchorIndex >= 0 && AnchorIndex < M_NumAnchors && M_ValidAnchors[AnchorIndex];
+	}
+
+	TConstArrayView<int32> GetNeighbors(const int32 AnchorIndex) const;
+
+	/** @return Hops between the anchors, 0 for the same anchor, INDEX_NONE if either is invalid or unreachable. */
+	int32 GetHopDistance(const int32 StartAnchorIndex, const int32 TargetAnchorIndex) const;
+
+	/**
+	 * @return Hop distance from the start to every anchor (INDEX_NONE if unreachable), empty for an invalid start.
+	 * @note Rows are never moved once computed, so the view stays valid until the next Build or Reset, also while
+	 * other sources are queried.
+	 */
+	TConstArrayView<int32> GetHopDistanceRow(const int32 StartAnchorIndex) const;
+
+	/**
+	 * @brief Finds a shortest path with a BFS that expands neighbors in adjacency order.
+	 * @param OutPathIndices Anchor indices from start to target, both included.
+	 * @return False if either anchor is invalid or the target is unreachable.
+	 */
+	bool BuildShortestPath(const int32 StartAnchorIndex, const int32 TargetAnchorIndex,
+	                       TArray<int32>& OutPathIndices) const;
+
+private:
+	int32 M_NumAnchors = 0;
+	// NumAnchors + 1 entries; the neighbors of anchor i start at M_NeighborOffsets[i].
+	TArray<int32> M_NeighborOffsets;
+	TArray<int32> M_NeighborIndices;
+	TBitArray<> M_ValidAnchors;
+
+	// Hop row of each source, empty while not computed; each row has its own allocation so it never moves.
+	mutable TArray<TArray<int32>> M_HopRowsBySource;
+	// Reused BFS scratch so queries do not allocate.
+	mutable TArray<int32> M_BfsQueue;
+	mutable TArray<int32> M_BfsPredecessors;
+
+	void BuildHopRow(const int32 StartAnchorIndex, int32* OutHopRow) const;
+};
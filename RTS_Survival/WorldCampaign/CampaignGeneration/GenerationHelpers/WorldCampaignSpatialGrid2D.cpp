@@ -0,0 +1,102 @@
+// Copyright (C) Bas Blokzijl - All rights reserved.
+
+#include "RTS_Survival/WorldCampaign/CampaignGeneration/GenerationHelpers/WorldCampaignSpatialGrid2D.h"
+
+void FWorldCampaignSpatialGrid2D::Init(const FBox2D& Bounds, const double DesiredCellSize)
+{
+	Reset();
+	if (not Bounds.bIsValid)
+	{
+		M_NumCellsX = 1;
+		M_NumCellsY = 1;
+		M_ItemsByCell.SetNum(1);
+		return;
+	}
+
+	const FVector2D Size = Bounds.GetSize();
+	const double LargestExtent = FMath::Max(Size.X, Size.Y);
+	M_CellSize = FMath::Max3(DesiredCellSize, LargestExtent / MaxCellsPerAxis, 1.0);
+	M_Origin = Bounds.Min;
+	M_NumCellsX = FMath::Clamp(FMath::CeilToInt32(Size.X / M_CellSize), 1, MaxCellsPerAxis);
+	M_NumCellsY = FMath::Clamp(FMath::CeilToInt32(Size.Y / M_CellSize), 1, MaxCellsPerAxis);
+	M_ItemsByCell.SetNum(M_NumCellsX * M_NumCellsY);
+}
+
+void FWorldCampaignSpatialGrid2D::Reset()
+{
+	M_Origin = FVector2D::ZeroVector;
+	M_CellSize = 1.0;
+	M_NumCellsX = 0;
+	M_NumCellsY = 0;
+	M_ItemsByCell.Reset();
+	M_LastQueryByItem.Reset();
+	M_QueryStamp = 0;
+}
+
+void FWorldCampaignSpatialGrid2D::Insert(const int32 ItemIndex, const FBox2D& ItemBounds)
+{
+	if (ItemIndex < 0 || M_ItemsByCell.IsEmpty())
+	{
+		return;
+	}
+
+	if (ItemIndex >= M_LastQueryByItem.Num())
+	{
+		M_LastQueryByItem.SetNumZeroed(ItemIndex + 1);
+	}
+
+	const FIntPoint MinCell = GetClampedCell(ItemBounds.Min);
+	const FIntPoint MaxCell = GetClampedCell(ItemBounds.Max);
+	for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; ++CellY)
+	{
+		for (int32 CellX = MinCell.X; CellX <= MaxCell.X; ++CellX)
+		{
+			M_ItemsByCell[CellY * M_NumCellsX + CellX].Add(ItemIndex);
+		}
+	}
+}
+
+void FWorldCampaignSpatialGrid2D::Query(const FBox2D& QueryBounds, TArray<int32>& OutItemIndices) const
+{
+	OutItemIndices.Reset();
+	if (M_ItemsByCell.IsEmpty())
+	{
+		return;
+	}
+
+	++M_QueryStamp;
+	if (M_QueryStamp == 0)
+	{
+		// Stamp wrapped around; clear so stale stamps cannot hide items.
+		FMemory::Memzero(M_LastQueryByItem.GetData(), M_LastQueryByItem.Num() * sizeof(uint32));
+		M_QueryStamp = 1;
+	}
+
+	const FIntPoint MinCell = GetClampedCell(QueryBounds.Min);
+	const FIntPoint MaxCell = GetClampedCell(QueryBounds.Max);
+	for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; ++CellY)
+	{
+		for (int32 CellX = MinCell.X; CellX <= MaxCell.X; ++CellX)
+		{
+			for (const int32 ItemIndex : M_ItemsByCell[CellY * M_NumCellsX + CellX])
+			{
+				if (M_LastQueryByItem[ItemIndex] == M_QueryStamp)
+				{
+					continue;
+				}
+
+				M_LastQueryByItem[ItemIndex] = M_QueryStamp;
+				OutItemIndices.Add(ItemIndex);
+			}
+		}
+	}
+
+	OutItemIndices.Sort();
+}
+
+FIntPoint FWorldCampaignSpatialGrid2D::GetClampedCell(const FVector2D& Location) const
+{
+	const int32 CellX = FMath::FloorToInt32((Location.X - M_Origin.X) / M_CellSize);
+	const int32 CellY = FMath::FloorToInt32((Location.Y - M_Origin.Y) / M_CellSize);
+	return FIntPoint(FMath::Clamp(CellX, 0, M_NumCellsX - 1), FMath::Clamp(CellY, 0, M_NumCellsY - 1));
+}
@@ -0,0 +1,51 @@
+// Copyright (C) Bas Blokzijl - All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * @brief Uniform 2D bucket grid over item bounds used to limit campaign generation queries to nearby items.
+ *
+ * Items are inserted by dense index into every cell their bounds overlap. Cells are clamped to the grid, so items or
+ * queries outside the initial bounds land in the border cells and are still found; the grid only narrows candidates,
+ * callers always run their exact test on the result.
+ * @note Not thread-safe; queries reuse mutable de-duplication scratch.
+ */
+class FWorldCampaignSpatialGrid2D
+{
+public:
+	/**
+	 * @brief Clears all items and lays out cells over the bounds.
+	 * @param Bounds Area that is expected to contain the items; an invalid box gives a single cell.
+	 * @param DesiredCellSize Cell edge length, raised when needed to stay within MaxCellsPerAxis.
+	 */
+	void Init(const FBox2D& Bounds, const double DesiredCellSize);
+
+	void Reset();
+
+	void Insert(const int32 ItemIndex, const FBox2D& ItemBounds);
+
+	/**
+	 * @brief Collects every item whose cells overlap the query bounds.
+	 * @param OutItemIndices Unique item indices in ascending order, so callers iterate in insertion index order.
+	 */
+	void Query(const FBox2D& QueryBounds, TArray<int32>& OutItemIndices) const;
+
+	int32 GetNumItems() const { return M_LastQueryByItem.Num(); }
+
+private:
+	static constexpr int32 MaxCellsPerAxis = 256;
+
+	FVector2D M_Origin = FVector2D::ZeroVector;
+	double M_CellSize = 1.0;
+	int32 M_NumCellsX = 0;
+	int32 M_NumCellsY = 0;
+	TArray<TArray<int32>> M_ItemsByCell;
+
+	// Query stamp per item so an item spanning several cells is only reported once.
+	mutable TArray<uint32> M_LastQueryByItem;
+	mutable uint32 M_QueryStamp = 0;
+
+	FIntPoint GetClampedCell(const FVector2D& Location) const;
+};
@@ -574,9 +574,17 @@ namespace
 		int32 NeutralRejectedNoHopCount = 0;
 		int32 NeutralRejectedHopBandCount = 0;
 		int32 NeutralRejectedSpacingCount = 0;
+		int32 PortfolioSize = 1;
+		int32 PortfolioFinishedCount = 0;
+		int32 PortfolioAcceptedInstance = INDEX_NONE;
+		int32 PortfolioAcceptedAttemptCount = 0;
 	};
 
 	constexpr float SegmentIntersectionTolerance = 0.01f;
+	// Padding of the grid bounds of segments and anchor queries; well above the intersection tolerance and the float
+	// rounding of the distance checks so the grids never drop a candidate the exact tests would accept.
+	constexpr double ConnectionGridPadding = 1.0;
+	constexpr double MinConnectionGridCellSize = 100.0;
 	constexpr int32 NoRequiredItems = 0;
 
 	uint64 Mix64(uint64 Value)
@@ -1052,6 +1060,10 @@ namespace
 		OutState.NeutralRejectedNoHopCount = Progress.NeutralRejectedNoHopCount;
 		OutState.NeutralRejectedHopBandCount = Progress.NeutralRejectedHopBandCount;
 		OutState.NeutralRejectedSpacingCount = Progress.NeutralRejectedSpacingCount;
+		OutState.PortfolioSize = Progress.PortfolioSize;
+		OutState.PortfolioFinishedCount = Progress.PortfolioFinishedCount;
+		OutState.PortfolioAcceptedInstance = Progress.PortfolioAcceptedInstance;
+		OutState.PortfolioAcceptedAttemptCount = Progress.PortfolioAcceptedAttemptCount;
 	}
 
 	void LogAsyncPlacementProgressState(const FAsyncPlacementProgressLogState& ProgressState,
@@ -1059,7 +1071,7 @@ namespace
 	{
 		UE_LOG(LogRTS, Warning,
 		       TEXT(
-			       "Async world campaign placement still running after %.1fs. Phase='%s', Step=%s, LastFailed=%s, FailureRetries=%d, WorkerFailureRetries=%d, PlacementAttempts=%d, Backtracks=%d, MicroBacktracks=%d, MacroBacktracks=%d, SetupBacktrackRequests=%d, StepAttempts=%d, Transactions=%d, EnemyMicro=%d, MissionMicro=%d, NeutralType=%d, NeutralEvaluated=%d, NeutralCandidates=%d, NeutralRejectedOccupied=%d, NeutralRejectedNoHop=%d, NeutralRejectedHopBand=%d, NeutralRejectedSpacing=%d."
+			       "Async world campaign placement still running after %.1fs. Phase='%s', Step=%s, LastFailed=%s, FailureRetries=%d, WorkerFailureRetries=%d, PlacementAttempts=%d, Backtracks=%d, MicroBacktracks=%d, MacroBacktracks=%d, SetupBacktrackRequests=%d, StepAttempts=%d, Transactions=%d, EnemyMicro=%d, MissionMicro=%d, NeutralType=%d, NeutralEvaluated=%d, NeutralCandidates=%d, NeutralRejectedOccupied=%d, NeutralRejectedNoHop=%d, NeutralRejectedHopBand=%d, NeutralRejectedSpacing=%d, Portfolio=%d/%d finished, PortfolioAccepted=%d (%d attempts)."
 		       ),
 		       ElapsedSeconds,
 		       *ProgressState.Phase,
@@ -1082,7 +1094,11 @@ namespace
 		       ProgressState.NeutralRejectedOccupiedCount,
 		       ProgressState.NeutralRejectedNoHopCount,
 		       ProgressState.NeutralRejectedHopBandCount,
-		       ProgressState.NeutralRejectedSpacingCount);
+		       ProgressState.NeutralRejectedSpacingCount,
+		       ProgressState.PortfolioFinishedCount,
+		       ProgressState.PortfolioSize,
+		       ProgressState.PortfolioAcceptedInstance,
+		       ProgressState.PortfolioAcceptedAttemptCount);
 	}
 
 	bool IsAnchorOccupiedForMission(const FGuid& AnchorKey, const FWorldCampaignPlacementState& PlacementState,
@@ -2072,6 +2088,16 @@ namespace
 		}
 	}
 
+	/** @return The cached degree of the anchor at the CachedAnchors index, read from the actor if not cached. */
+	int32 GetCandidateConnectionDegree(const AGeneratorWorldCampaign& Generator,
+	                                   const FWorldCampaignDerivedData& DerivedData,
+	                                   const int32 CachedAnchorIndex,
+	                                   const AAnchorPoint* CandidateAnchor)
+	{
+		const int32 CachedDegree = DerivedData.GetConnectionDegreeAt(CachedAnchorIndex);
+		return CachedDegree != INDEX_NONE ? CachedDegree : Generator.GetAnchorConnectionDegree(CandidateAnchor);
+	}
+
 	bool TryBuildEnemyPlacementCandidate(AGeneratorWorldCampaign& Generator,
 	                                     const FEnemyItemPlacementRules& EffectiveRules,
 	                                     EMapEnemyItem EnemyType,
@@ -2129,8 +2155,10 @@ namespace
 			return false;
 		}
 
-		const int32 ConnectionDegree = Generator.GetAnchorConnectionDegree(CandidateAnchor);
-		const float ChokepointScore = WorkingDerivedData.ChokepointScoresByAnchorKey.FindRef(CandidateKey);
+		// Candidates come from CachedAnchors in order, so the candidate order is the cached anchor index.
+		const int32 ConnectionDegree = GetCandidateConnectionDegree(Generator, WorkingDerivedData, CandidateOrder,
+		                                                            CandidateAnchor);
+		const float ChokepointScore = WorkingDerivedData.GetChokepointScoreAt(CandidateOrder);
 		OutCandidate = FPlacementCandidate();
 		OutCandidate.AnchorPoint = CandidateAnchor;
 		OutCandidate.AnchorKey = CandidateKey;
@@ -2341,7 +2369,8 @@ namespace
 				continue;
 			}
 
-			if (not Generator.IsAnchorCached(CandidateAnchor))
+			const int32 CachedAnchorIndex = Generator.GetCachedAnchorIndex(CandidateAnchor);
+			if (CachedAnchorIndex == INDEX_NONE)
 			{
 				continue;
 			}
@@ -2352,8 +2381,9 @@ namespace
 				continue;
 			}
 
-			const int32 ConnectionDegree = Generator.GetAnchorConnectionDegree(CandidateAnchor);
-			const float ChokepointScore = DerivedData.ChokepointScoresByAnchorKey.FindRef(CandidateKey);
+			const int32 ConnectionDegree = GetCandidateConnectionDegree(Generator, DerivedData, CachedAnchorIndex,
+			                                                            CandidateAnchor);
+			const float ChokepointScore = DerivedData.GetChokepointScoreAt(CachedAnchorIndex);
 			const float PreferenceScore = GetEnemyWallPreferenceScore(PlacementRules.Preference, ConnectionDegree,
 			                                                          ChokepointScore);
 
@@ -3847,10 +3877,15 @@ namespace
 		                                     Promotions, CompanionPromotions);
 	}
 
+	/**
+	 * @param AnchorGrid Optional grid over the indices of AnchorPoints; only used when the distance is limited.
+	 * Candidates are gathered in ascending anchor index either way so the sort sees the same input order.
+	 */
 	TArray<FAnchorCandidate> BuildAndSortCandidates(AAnchorPoint* AnchorPoint,
 	                                                const TArray<TObjectPtr<AAnchorPoint>>& AnchorPoints,
 	                                                const int32 MaxConnections,
-	                                                const float MaxPreferredDistance, const bool bIgnoreDistance)
+	                                                const float MaxPreferredDistance, const bool bIgnoreDistance,
+	                                                const FWorldCampaignSpatialGrid2D* AnchorGrid = nullptr)
 	{
 		TArray<FAnchorCandidate> Candidates;
 		if (not IsValid(AnchorPoint))
@@ -3862,8 +3897,25 @@ namespace
 		const FVector2D AnchorLocation2D(AnchorLocation.X, AnchorLocation.Y);
 		const float MaxDistanceSquared = FMath::Square(MaxPreferredDistance);
 
-		for (const TObjectPtr<AAnchorPoint>& CandidateAnchor : AnchorPoints)
+		TArray<int32> NearbyAnchorIndices;
+		const bool bUseAnchorGrid = AnchorGrid && not bIgnoreDistance;
+		if (bUseAnchorGrid)
+		{
+			const FVector2D QueryExtent(MaxPreferredDistance + ConnectionGridPadding);
+			AnchorGrid->Query(FBox2D(AnchorLocation2D - QueryExtent, AnchorLocation2D + QueryExtent),
+			                  NearbyAnchorIndices);
+		}
+
+		const int32 NumCandidatesToScan = bUseAnchorGrid ? NearbyAnchorIndices.Num() : AnchorPoints.Num();
+		for (int32 ScanIndex = 0; ScanIndex < NumCandidatesToScan; ++ScanIndex)
 		{
+			const int32 AnchorIndex = bUseAnchorGrid ? NearbyAnchorIndices[ScanIndex] : ScanIndex;
+			if (not AnchorPoints.IsValidIndex(AnchorIndex))
+			{
+				continue;
+			}
+
+			const TObjectPtr<AAnchorPoint>& CandidateAnchor = AnchorPoints[AnchorIndex];
 			if (not IsValid(CandidateAnchor) || CandidateAnchor == AnchorPoint)
 			{
 				continue;
@@ -5128,6 +5180,44 @@ namespace
 	}
 }
 
+void FConnectionSegmentCache::Init(const FBox2D& AnchorBounds, const double CellSize, const bool bUseGrid)
+{
+	Segments.Reset();
+	bM_UseGrid = bUseGrid;
+	M_SegmentGrid.Init(AnchorBounds, FMath::Max(CellSize, MinConnectionGridCellSize));
+}
+
+void FConnectionSegmentCache::Add(const FConnectionSegment& Segment)
+{
+	const int32 SegmentIndex = Segments.Add(Segment);
+	if (not bM_UseGrid)
+	{
+		return;
+	}
+
+	const FVector2D Padding(ConnectionGridPadding);
+	M_SegmentGrid.Insert(SegmentIndex, FBox2D(FVector2D::Min(Segment.StartPoint, Segment.EndPoint) - Padding,
+	                                          FVector2D::Max(Segment.StartPoint, Segment.EndPoint) + Padding));
+}
+
+void FConnectionSegmentCache::QueryNearSegment(const FVector2D& StartPoint, const FVector2D& EndPoint,
+                                               TArray<int32>& OutSegmentIndices) const
+{
+	if (not bM_UseGrid)
+	{
+		OutSegmentIndices.Reset(Segments.Num());
+		for (int32 SegmentIndex = 0; SegmentIndex < Segments.Num(); ++SegmentIndex)
+		{
+			OutSegmentIndices.Add(SegmentIndex);
+		}
+		return;
+	}
+
+	const FVector2D Padding(ConnectionGridPadding);
+	M_SegmentGrid.Query(FBox2D(FVector2D::Min(StartPoint, EndPoint) - Padding,
+	                           FVector2D::Max(StartPoint, EndPoint) + Padding), OutSegmentIndices);
+}
+
 AGeneratorWorldCampaign::AGeneratorWorldCampaign()
 {
 	PrimaryActorTick.bCanEverTick = false;
@@ -6694,7 +6784,7 @@ bool AGeneratorWorldCampaign::ExecuteCreateConnections(FCampaignGenerationStepTr
 	const int32 SeedOffset = AttemptIndex * AttemptSeedMultiplier;
 	FRandomStream RandomStream(M_CountAndDifficultyTuning.Seed + SeedOffset);
 	TMap<TObjectPtr<AAnchorPoint>, int32> DesiredConnections;
-	GenerateConnectionsForAnchors(AnchorPoints, RandomStream, DesiredConnections);
+	GenerateConnectionsForAnchors(AnchorPoints, RandomStream, DesiredConnections, true);
 	CacheGeneratedState(AnchorPoints);
 	OutTransaction.SpawnedConnections = M_GeneratedConnections;
 	return true;
@@ -6743,14 +6833,42 @@ void AGeneratorWorldCampaign::NormalizeAnchorKeysForConnectionGeneration(
 void AGeneratorWorldCampaign::GenerateConnectionsForAnchors(const TArray<TObjectPtr<AAnchorPoint>>& AnchorPoints,
                                                             FRandomStream& RandomStream,
                                                             TMap<TObjectPtr<AAnchorPoint>, int32>&
-                                                            OutDesiredConnections)
+                                                            OutDesiredConnections,
+                                                            const bool bUseSpatialGrids)
 {
 	AssignDesiredConnections(AnchorPoints, RandomStream, OutDesiredConnections);
 
 	TArray<TObjectPtr<AAnchorPoint>> ShuffledAnchors = AnchorPoints;
 	CampaignGenerationHelper::DeterministicShuffle(ShuffledAnchors, RandomStream);
 
-	TArray<FConnectionSegment> ExistingSegments;
+	// Anchors do not move while connecting, so both grids share the anchor bounds; junction points lie on segments
+	// between anchors and stay inside them as well.
+	FBox2D AnchorBounds(ForceInit);
+	for (const TObjectPtr<AAnchorPoint>& AnchorPoint : AnchorPoints)
+	{
+		if (IsValid(AnchorPoint))
+		{
+			const FVector AnchorLocation = AnchorPoint->GetActorLocation();
+			AnchorBounds += FVector2D(AnchorLocation.X, AnchorLocation.Y);
+		}
+	}
+
+	const double GridCellSize = FMath::Max(static_cast<double>(ConnectionGenerationRules.MaxPreferredDistance),
+	                                       MinConnectionGridCellSize);
+	FWorldCampaignSpatialGrid2D AnchorGrid;
+	AnchorGrid.Init(AnchorBounds, GridCellSize);
+	for (int32 AnchorIndex = 0; AnchorIndex < AnchorPoints.Num(); ++AnchorIndex)
+	{
+		if (IsValid(AnchorPoints[AnchorIndex]))
+		{
+			const FVector AnchorLocation = AnchorPoints[AnchorIndex]->GetActorLocation();
+			const FVector2D AnchorLocation2D(AnchorLocation.X, AnchorLocation.Y);
+			AnchorGrid.Insert(AnchorIndex, FBox2D(AnchorLocation2D, AnchorLocation2D));
+		}
+	}
+
+	FConnectionSegmentCache ExistingSegments;
+	ExistingSegments.Init(AnchorBounds, GridCellSize, bUseSpatialGrids);
 	for (const TObjectPtr<AAnchorPoint>& AnchorPoint : ShuffledAnchors)
 	{
 		if (not IsValid(AnchorPoint))
@@ -6766,7 +6884,8 @@ void AGeneratorWorldCampaign::GenerateConnectionsForAnchors(const TArray<TObject
 			}
 		}
 
-		GeneratePhasePreferredConnections(AnchorPoint, AnchorPoints, OutDesiredConnections, ExistingSegments);
+		GeneratePhasePreferredConnections(AnchorPoint, AnchorPoints, OutDesiredConnections,
+		                                  bUseSpatialGrids ? &AnchorGrid : nullptr, ExistingSegments);
 		GeneratePhaseExtendedConnections(AnchorPoint, AnchorPoints, ExistingSegments);
 		GeneratePhaseThreeWayConnections(AnchorPoint, ExistingSegments);
 	}
@@ -6782,6 +6901,27 @@ void AGeneratorWorldCampaign::GenerateConnectionsForAnchors(const TArray<TObject
 	}
 }
 
+#if WITH_DEV_AUTOMATION_TESTS
+void AGeneratorWorldCampaign::AutomationTest_GenerateConnectionsForAnchors(
+	const TArray<TObjectPtr<AAnchorPoint>>& AnchorPoints,
+	const int32 Seed,
+	const bool bUseSpatialGrids)
+{
+	ClearExistingConnections();
+	for (const TObjectPtr<AAnchorPoint>& AnchorPoint : AnchorPoints)
+	{
+		if (IsValid(AnchorPoint))
+		{
+			AnchorPoint->ClearConnections();
+		}
+	}
+
+	FRandomStream RandomStream(Seed);
+	TMap<TObjectPtr<AAnchorPoint>, int32> DesiredConnections;
+	GenerateConnectionsForAnchors(AnchorPoints, RandomStream, DesiredConnections, bUseSpatialGrids);
+}
+#endif
+
 void AGeneratorWorldCampaign::CacheGeneratedState(const TArray<TObjectPtr<AAnchorPoint>>& AnchorPoints)
 {
 	M_PlacementState.SeedUsed = M_CountAndDifficultyTuning.Seed;
@@ -8145,9 +8285,10 @@ void AGeneratorWorldCampaign::StartAsyncPlacementBacktracking()
 	M_AsyncPlacementProgress = ProgressRef;
 	M_AsyncPlacementStartTimeSeconds = FPlatformTime::Seconds();
 	M_AsyncPlacementLastProgressLogTimeSeconds = M_AsyncPlacementStartTimeSeconds;
-	M_AsyncPlacementFuture = Async(EAsyncExecution::ThreadPool, [SnapshotRef, ProgressRef]()
+	const int32 PortfolioSize = FMath::Max(1, UWorldCampaignSettings::Get()->PlacementPortfolioSize);
+	M_AsyncPlacementFuture = Async(EAsyncExecution::ThreadPool, [SnapshotRef, ProgressRef, PortfolioSize]()
 	{
-		return WorldCampaignAsyncPlacement::SolvePlacement(*SnapshotRef, ProgressRef);
+		return WorldCampaignAsyncPlacement::SolvePlacementPortfolio(*SnapshotRef, PortfolioSize, ProgressRef);
 	});
 
 	World->GetTimerManager().SetTimer(
@@ -8233,6 +8374,15 @@ void AGeneratorWorldCampaign::HandleAsyncPlacementCompleted(FWorldCampaignPlacem
 	}
 
 	ReportPlacementDebugEvents(Result);
+	if (Result.bSucceeded && UWorldCampaignSettings::Get()->PlacementPortfolioSize > 1)
+	{
+		UE_LOG(LogRTS, Display,
+		       TEXT("Async world campaign placement accepted portfolio instance %d (seed %d) after %d worker attempts."),
+		       Result.PortfolioInstanceIndex,
+		       Result.PlacementSeedUsed,
+		       Result.WorkerTotalAttemptCount);
+	}
+
 	M_TotalAttemptCount += Result.WorkerTotalAttemptCount;
 	M_StepAttemptIndices = Result.StepAttemptIndicesAtEnd;
 	if (M_TotalAttemptCount > MaxTotalAttempts && not Result.bSucceeded)
@@ -8318,6 +8468,8 @@ bool AGeneratorWorldCampaign::ApplyPlacementResultToWorld(const FWorldCampaignPl
 	M_PlacementState.NeutralItemsByAnchorKey = Result.NeutralItemsByAnchorKey;
 	M_PlacementState.MissionsByAnchorKey = Result.MissionsByAnchorKey;
 	M_DerivedData = Result.DerivedData;
+	// The solver filled the dense caches in snapshot index order.
+	BuildDenseAnchorCaches();
 	return RealizeVirtualPlacementState();
 }
 
@@ -9945,27 +10097,40 @@ void AGeneratorWorldCampaign::BuildChokepointScoresCache(const AAnchorPoint* Opt
 {
 	M_DerivedData.ChokepointScoresByAnchorKey.Reset();
 	const TArray<TObjectPtr<AAnchorPoint>>& CachedAnchors = M_PlacementState.CachedAnchors;
-	if (CachedAnchors.Num() == 0)
+	const TMap<FGuid, TObjectPtr<AAnchorPoint>> AnchorLookup = BuildAnchorLookup(CachedAnchors);
+	if (AnchorLookup.Num() > 0)
 	{
-		return;
+		InitializeChokepointScores(CachedAnchors);
+		if (IsValid(OptionalHQAnchor))
+		{
+			AddHQChokepointPathScores(OptionalHQAnchor, CachedAnchors, AnchorLookup);
+		}
+		else
+		{
+			AddDegreeChokepointScores(CachedAnchors);
+			AddSampledChokepointPathScores(CachedAnchors, AnchorLookup);
+		}
 	}
+	BuildDenseAnchorCaches();
+}
 
-	TMap<FGuid, TObjectPtr<AAnchorPoint>> AnchorLookup = BuildAnchorLookup(CachedAnchors);
-	if (AnchorLookup.Num() == 0)
+void AGeneratorWorldCampaign::BuildDenseAnchorCaches()
+{
+	const TArray<TObjectPtr<AAnchorPoint>>& CachedAnchors = M_PlacementState.CachedAnchors;
+	M_DerivedData.AnchorConnectionDegreesByAnchorIndex.Init(0, CachedAnchors.Num());
+	M_DerivedData.ChokepointScoresByAnchorIndex.Init(0.f, CachedAnchors.Num());
+	for (int32 AnchorIndex = 0; AnchorIndex < CachedAnchors.Num(); AnchorIndex++)
 	{
-		return;
-	}
-
-	InitializeChokepointScores(CachedAnchors);
+		const AAnchorPoint* AnchorPoint = CachedAnchors[AnchorIndex];
+		if (not IsValid(AnchorPoint))
+		{
+			continue;
+		}
 
-	if (not IsValid(OptionalHQAnchor))
-	{
-		AddDegreeChokepointScores(CachedAnchors);
-		AddSampledChokepointPathScores(CachedAnchors, AnchorLookup);
-		return;
+		M_DerivedData.AnchorConnectionDegreesByAnchorIndex[AnchorIndex] = GetAnchorConnectionDegree(AnchorPoint);
+		M_DerivedData.ChokepointScoresByAnchorIndex[AnchorIndex] =
+			M_DerivedData.ChokepointScoresByAnchorKey.FindRef(AnchorPoint->GetAnchorKey());
 	}
-
-	AddHQChokepointPathScores(OptionalHQAnchor, CachedAnchors, AnchorLookup);
 }
 
 void AGeneratorWorldCampaign::InitializeChokepointScores(const TArray<TObjectPtr<AAnchorPoint>>& CachedAnchors)
@@ -10108,21 +10273,21 @@ int32 AGeneratorWorldCampaign::GetAnchorConnectionDegree(const AAnchorPoint* Anc
 }
 
 bool AGeneratorWorldCampaign::IsAnchorCached(const AAnchorPoint* AnchorPoint) const
+{
+	return GetCachedAnchorIndex(AnchorPoint) != INDEX_NONE;
+}
+
+int32 AGeneratorWorldCampaign::GetCachedAnchorIndex(const AAnchorPoint* AnchorPoint) const
 {
 	if (not IsValid(AnchorPoint))
 	{
-		return false;
+		return INDEX_NONE;
 	}
 
-	for (TWeakObjectPtr<AAnchorPoint> CachedAnchor : M_PlacementState.CachedAnchors)
+	return M_PlacementState.CachedAnchors.IndexOfByPredicate([AnchorPoint](const TObjectPtr<AAnchorPoint>& CachedAnchor)
 	{
-		if (CachedAnchor.Get() == AnchorPoint)
-		{
-			return true;
-		}
-	}
-
-	return false;
+		return CachedAnchor.Get() == AnchorPoint;
+	});
 }
 
 bool AGeneratorWorldCampaign::BuildHQAnchorCandidates(const TArray<TObjectPtr<AAnchorPoint>>& CandidateSource,
@@ -10193,11 +10358,14 @@ bool AGeneratorWorldCampaign::HasSharedEndpoint(const FConnectionSegment& Segmen
 bool AGeneratorWorldCampaign::IsSegmentIntersectingExisting(const FVector2D& StartPoint, const FVector2D& EndPoint,
                                                             const AAnchorPoint* StartAnchor,
                                                             const AAnchorPoint* EndAnchor,
-                                                            const TArray<FConnectionSegment>& ExistingSegments,
+                                                            const FConnectionSegmentCache& ExistingSegments,
                                                             const AConnection* ConnectionToIgnore) const
 {
-	for (const FConnectionSegment& Segment : ExistingSegments)
+	TArray<int32> NearbySegmentIndices;
+	ExistingSegments.QueryNearSegment(StartPoint, EndPoint, NearbySegmentIndices);
+	for (const int32 SegmentIndex : NearbySegmentIndices)
 	{
+		const FConnectionSegment& Segment = ExistingSegments.Segments[SegmentIndex];
 		if (Segment.OwningConnection.Get() == ConnectionToIgnore)
 		{
 			continue;
@@ -10302,7 +10470,8 @@ void AGeneratorWorldCampaign::GeneratePhasePreferredConnections(AAnchorPoint* An
                                                                 const TArray<TObjectPtr<AAnchorPoint>>& AnchorPoints,
                                                                 const TMap<TObjectPtr<AAnchorPoint>, int32>&
                                                                 DesiredConnections,
-                                                                TArray<FConnectionSegment>& ExistingSegments)
+                                                                const FWorldCampaignSpatialGrid2D* AnchorGrid,
+                                                                FConnectionSegmentCache& ExistingSegments)
 {
 	if (not IsValid(AnchorPoint))
 	{
@@ -10320,7 +10489,8 @@ void AGeneratorWorldCampaign::GeneratePhasePreferredConnections(AAnchorPoint* An
 
 	TArray<FAnchorCandidate> Candidates = BuildAndSortCandidates(AnchorPoint, AnchorPoints,
 	                                                             ConnectionGenerationRules.MaxConnections,
-	                                                             ConnectionGenerationRules.MaxPreferredDistance, false);
+	                                                             ConnectionGenerationRules.MaxPreferredDistance, false,
+	                                                             AnchorGrid);
 
 	const FColor RegularConnectionColor = FColor::Green;
 	for (const FAnchorCandidate& Candidate : Candidates)
@@ -10346,7 +10516,7 @@ void AGeneratorWorldCampaign::GeneratePhasePreferredConnections(AAnchorPoint* An
 
 void AGeneratorWorldCampaign::GeneratePhaseExtendedConnections(AAnchorPoint* AnchorPoint,
                                                                const TArray<TObjectPtr<AAnchorPoint>>& AnchorPoints,
-                                                               TArray<FConnectionSegment>& ExistingSegments)
+                                                               FConnectionSegmentCache& ExistingSegments)
 {
 	if (not IsValid(AnchorPoint))
 	{
@@ -10385,7 +10555,7 @@ void AGeneratorWorldCampaign::GeneratePhaseExtendedConnections(AAnchorPoint* Anc
 }
 
 void AGeneratorWorldCampaign::GeneratePhaseThreeWayConnections(AAnchorPoint* AnchorPoint,
-                                                               TArray<FConnectionSegment>& ExistingSegments)
+                                                               FConnectionSegmentCache& ExistingSegments)
 {
 	if (not IsValid(AnchorPoint))
 	{
@@ -10402,7 +10572,7 @@ void AGeneratorWorldCampaign::GeneratePhaseThreeWayConnections(AAnchorPoint* Anc
 }
 
 bool AGeneratorWorldCampaign::TryCreateConnection(AAnchorPoint* AnchorPoint, AAnchorPoint* CandidateAnchor,
-                                                  TArray<FConnectionSegment>& ExistingSegments,
+                                                  FConnectionSegmentCache& ExistingSegments,
                                                   const FColor& DebugColor)
 {
 	if (not IsValid(AnchorPoint))
@@ -10465,7 +10635,7 @@ bool AGeneratorWorldCampaign::FinalizeCreatedConnection(
 	AConnection* NewConnection,
 	AAnchorPoint* AnchorPoint,
 	AAnchorPoint* CandidateAnchor,
-	TArray<FConnectionSegment>& ExistingSegments,
+	FConnectionSegmentCache& ExistingSegments,
 	const FColor& DebugColor)
 {
 	if (not IsValid(NewConnection))
@@ -10488,7 +10658,7 @@ bool AGeneratorWorldCampaign::FinalizeCreatedConnection(
 
 bool AGeneratorWorldCampaign::IsConnectionAllowed(AAnchorPoint* AnchorPoint, AAnchorPoint* CandidateAnchor,
                                                   const FVector2D& StartPoint, const FVector2D& EndPoint,
-                                                  const TArray<FConnectionSegment>& ExistingSegments,
+                                                  const FConnectionSegmentCache& ExistingSegments,
                                                   const AConnection* ConnectionToIgnore) const
 {
 	if (AnchorPoint->GetConnectionCount() >= ConnectionGenerationRules.MaxConnections)
@@ -10506,7 +10676,7 @@ bool AGeneratorWorldCampaign::IsConnectionAllowed(AAnchorPoint* AnchorPoint, AAn
 }
 
 bool AGeneratorWorldCampaign::TryAddThreeWayConnection(AAnchorPoint* AnchorPoint,
-                                                       TArray<FConnectionSegment>& ExistingSegments)
+                                                       FConnectionSegmentCache& ExistingSegments)
 {
 	if (not IsValid(AnchorPoint))
 	{
@@ -10608,7 +10778,7 @@ void AGeneratorWorldCampaign::RegisterThirdAnchorOnConnection(AConnection* Conne
 
 void AGeneratorWorldCampaign::AddConnectionSegment(AConnection* Connection, AAnchorPoint* AnchorA,
                                                    AAnchorPoint* AnchorB,
-                                                   TArray<FConnectionSegment>& ExistingSegments) const
+                                                   FConnectionSegmentCache& ExistingSegments) const
 {
 	if (not IsValid(Connection))
 	{
@@ -10634,7 +10804,7 @@ void AGeneratorWorldCampaign::AddConnectionSegment(AConnection* Connection, AAnc
 
 void AGeneratorWorldCampaign::AddThirdConnectionSegment(AConnection* Connection, AAnchorPoint* ThirdAnchor,
                                                         const FVector& JunctionLocation,
-                                                        TArray<FConnectionSegment>& ExistingSegments) const
+                                                        FConnectionSegmentCache& ExistingSegments) const
 {
 	if (not IsValid(Connection))
 	{
@@ -10,6 +10,7 @@
 #include "RTS_Survival/WorldCampaign/CampaignGeneration/Enums/Enum_MapEnemyItem.h"
 #include "RTS_Survival/WorldCampaign/CampaignGeneration/Enums/Enum_MapMission.h"
 #include "RTS_Survival/WorldCampaign/CampaignGeneration/Enums/NeutralObjectType/Enum_MapNeutralObjectType.h"
+#include "RTS_Survival/WorldCampaign/CampaignGeneration/GenerationHelpers/WorldCampaignSpatialGrid2D.h"
 #include "RTS_Survival/WorldCampaign/CampaignGeneration/GenerationRules/EnemyHQPlacementRules.h"
 #include "RTS_Survival/WorldCampaign/CampaignGeneration/GenerationRules/EnemyWallPlacementRules.h"
 #include "RTS_Survival/WorldCampaign/CampaignGeneration/GenerationRules/EnemyPlacementRules/EnemyPlacementRules.h"
@@ -410,6 +411,33 @@ struct FConnectionSegment
 	TWeakObjectPtr<AConnection> OwningConnection;
 };
 
+/**
+ * @brief Connection segments created so far, bucketed in a grid so crossing checks only test nearby segments.
+ * @note Segments are inserted with their bounds padded past the intersection tolerance, so every segment the exact
+ * intersection test could report is found by a query with the padded bounds of the new segment.
+ */
+struct FConnectionSegmentCache
+{
+	/**
+	 * @param AnchorBounds XY bounds of all anchors; junction segments always lie within it.
+	 * @param CellSize Grid cell size, the preferred connection distance keeps most segments in a few cells.
+	 * @param bUseGrid False returns every segment from queries, the reference the grid must match.
+	 */
+	void Init(const FBox2D& AnchorBounds, const double CellSize, const bool bUseGrid);
+
+	void Add(const FConnectionSegment& Segment);
+
+	/** @param OutSegmentIndices Indices into Segments near the given segment, ascending. */
+	void QueryNearSegment(const FVector2D& StartPoint, const FVector2D& EndPoint,
+	                      TArray<int32>& OutSegmentIndices) const;
+
+	TArray<FConnectionSegment> Segments;
+
+private:
+	FWorldCampaignSpatialGrid2D M_SegmentGrid;
+	bool bM_UseGrid = true;
+};
+
 using FWorldCampaignPlayerHQPlacementRulesSnapshot =
 WorldCampaignAsyncPlacement::FPlayerHQPlacementRulesSnapshot;
 using FWorldCampaignEnemyHQPlacementRulesSnapshot =
@@ -756,6 +784,17 @@ public:
 	bool GetIsValidCampaignDebugger() const;
 	UWorldCampaignDebugger* GetCampaignDebugger() const;
 	bool IsAnchorCached(const AAnchorPoint* AnchorPoint) const;
+	/** @return Index of the anchor in the cached anchors, INDEX_NONE if it is not part of the generated graph. */
+	int32 GetCachedAnchorIndex(const AAnchorPoint* AnchorPoint) const;
+
+#if WITH_DEV_AUTOMATION_TESTS
+	/**
+	 * @brief Clears all connections and connects the anchors like the ConnectionsCreated step, without caching state.
+	 * @param bUseSpatialGrids False scans every anchor and segment, so tests can compare both scans.
+	 */
+	void AutomationTest_GenerateConnectionsForAnchors(const TArray<TObjectPtr<AAnchorPoint>>& AnchorPoints,
+	                                                  const int32 Seed, const bool bUseSpatialGrids);
+#endif
 
 	/**
 	 * @brief Builds a deterministic key so generated anchors stay stable across retries.
@@ -1438,6 +1477,8 @@ private:
 	bool GetPrunedAnchorsReachableFromPlayerHQ(FString& OutFailureReason) const;
 	void CacheAnchorConnectionDegrees();
 	void BuildChokepointScoresCache(const AAnchorPoint* OptionalHQAnchor);
+	/** @brief Fills the index addressed degree and chokepoint caches from their maps in CachedAnchors order. */
+	void BuildDenseAnchorCaches();
 
 	/**
 	 * @brief Seeds the chokepoint cache so every valid anchor has a deterministic score entry.
@@ -1483,10 +1524,12 @@ private:
 	 * @param AnchorPoints Sorted anchors to process.
 	 * @param RandomStream Stream seeded for deterministic attempts.
 	 * @param OutDesiredConnections Desired connection counts per anchor.
+	 * @param bUseSpatialGrids Narrow candidate and crossing scans with grids; the result is the same either way.
 	 */
 	void GenerateConnectionsForAnchors(const TArray<TObjectPtr<AAnchorPoint>>& AnchorPoints,
 	                                   FRandomStream& RandomStream,
-	                                   TMap<TObjectPtr<AAnchorPoint>, int32>& OutDesiredConnections);
+	                                   TMap<TObjectPtr<AAnchorPoint>, int32>& OutDesiredConnections,
+	                                   const bool bUseSpatialGrids);
 
 	/**
 	 * @brief Stores derived cached data so designers can inspect intermediate results.
@@ -1530,7 +1573,7 @@ private:
 	 */
 	bool IsSegmentIntersectingExisting(const FVector2D& StartPoint, const FVector2D& EndPoint,
 	                                   const AAnchorPoint* StartAnchor, const AAnchorPoint* EndAnchor,
-	                                   const TArray<FConnectionSegment>& ExistingSegments,
+	                                   const FConnectionSegmentCache& ExistingSegments,
 	                                   const AConnection* ConnectionToIgnore) const;
 	void ClearExistingConnections();
 	void GatherAnchorPoints(TArray<TObjectPtr<AAnchorPoint>>& OutAnchorPoints) const;
@@ -1551,12 +1594,15 @@ private:
 	 * @param AnchorPoint Anchor currently being processed.
 	 * @param AnchorPoints Sorted list of all anchors for deterministic ordering.
 	 * @param DesiredConnections Desired connection counts per anchor.
+	 * @param AnchorGrid Grid over the indices of AnchorPoints used to find anchors within the preferred distance;
+	 * null scans every anchor.
 	 * @param ExistingSegments Current list of generated connection segments for intersection checks.
 	 */
 	void GeneratePhasePreferredConnections(AAnchorPoint* AnchorPoint,
 	                                       const TArray<TObjectPtr<AAnchorPoint>>& AnchorPoints,
 	                                       const TMap<TObjectPtr<AAnchorPoint>, int32>& DesiredConnections,
-	                                       TArray<FConnectionSegment>& ExistingSegments);
+	                                       const FWorldCampaignSpatialGrid2D* AnchorGrid,
+	                                       FConnectionSegmentCache& ExistingSegments);
 
 	/**
 	 * @brief Extends the search beyond distance limits to satisfy minimum connections.
@@ -1566,14 +1612,14 @@ private:
 	 */
 	void GeneratePhaseExtendedConnections(AAnchorPoint* AnchorPoint,
 	                                      const TArray<TObjectPtr<AAnchorPoint>>& AnchorPoints,
-	                                      TArray<FConnectionSegment>& ExistingSegments);
+	                                      FConnectionSegmentCache& ExistingSegments);
 
 	/**
 	 * @brief Attempts to attach the anchor to an existing connection segment as a junction.
 	 * @param AnchorPoint Anchor currently being processed.
 	 * @param ExistingSegments Current list of generated connection segments for intersection checks.
 	 */
-	void GeneratePhaseThreeWayConnections(AAnchorPoint* AnchorPoint, TArray<FConnectionSegment>& ExistingSegments);
+	void GeneratePhaseThreeWayConnections(AAnchorPoint* AnchorPoint, FConnectionSegmentCache& ExistingSegments);
 
 	/**
 	 * @brief Spawns and registers a new connection between two anchors if allowed.
@@ -1584,7 +1630,7 @@ private:
 	 * @return true if the connection was created and registered.
 	 */
 	bool TryCreateConnection(AAnchorPoint* AnchorPoint, AAnchorPoint* CandidateAnchor,
-	                         TArray<FConnectionSegment>& ExistingSegments, const FColor& DebugColor);
+	                         FConnectionSegmentCache& ExistingSegments, const FColor& DebugColor);
 
 	/**
 	 * @brief Resolves the configured connection class with a native fallback.
@@ -1610,7 +1656,7 @@ private:
 	 * @return true when the connection was valid and fully registered.
 	 */
 	bool FinalizeCreatedConnection(AConnection* NewConnection, AAnchorPoint* AnchorPoint,
-	                               AAnchorPoint* CandidateAnchor, TArray<FConnectionSegment>& ExistingSegments,
+	                               AAnchorPoint* CandidateAnchor, FConnectionSegmentCache& ExistingSegments,
 	                               const FColor& DebugColor);
 
 	/**
@@ -1625,7 +1671,7 @@ private:
 	 */
 	bool IsConnectionAllowed(AAnchorPoint* AnchorPoint, AAnchorPoint* CandidateAnchor,
 	                         const FVector2D& StartPoint, const FVector2D& EndPoint,
-	                         const TArray<FConnectionSegment>& ExistingSegments,
+	                         const FConnectionSegmentCache& ExistingSegments,
 	                         const AConnection* ConnectionToIgnore) const;
 
 	/**
@@ -1634,7 +1680,7 @@ private:
 	 * @param ExistingSegments Current list of generated connection segments for intersection checks.
 	 * @return true if a three-way connection was created.
 	 */
-	bool TryAddThreeWayConnection(AAnchorPoint* AnchorPoint, TArray<FConnectionSegment>& ExistingSegments);
+	bool TryAddThreeWayConnection(AAnchorPoint* AnchorPoint, FConnectionSegmentCache& ExistingSegments);
 
 	/**
 	 * @brief Registers the base connection relationship on both anchors.
@@ -1659,7 +1705,7 @@ private:
 	 * @param ExistingSegments Current list of generated connection segments for intersection checks.
 	 */
 	void AddConnectionSegment(AConnection* Connection, AAnchorPoint* AnchorA, AAnchorPoint* AnchorB,
-	                          TArray<FConnectionSegment>& ExistingSegments) const;
+	                          FConnectionSegmentCache& ExistingSegments) const;
 
 	/**
 	 * @brief Adds the third-branch segment entry for intersection checks.
@@ -1669,7 +1715,7 @@ private:
 	 * @param ExistingSegments Current list of generated connection segments for intersection checks.
 	 */
 	void AddThirdConnectionSegment(AConnection* Connection, AAnchorPoint* ThirdAnchor, const FVector& JunctionLocation,
-	                               TArray<FConnectionSegment>& ExistingSegments) const;
+	                               FConnectionSegmentCache& ExistingSegments) const;
 
 	void DebugNotifyAnchorProcessing(AAnchorPoint* AnchorPoint, const FString& Label, const FColor& Color) const;
 	void DebugDrawConnection(const AConnection* Connection, const FColor& Color) const;
@@ -2,8 +2,12 @@
 
 #include "RTS_Survival/WorldCampaign/CampaignGeneration/GeneratorWorldCampaign/WorldCampaignAsyncPlacement.h"
 
+#include "Async/ParallelFor.h"
+#include "RTS_Survival/WorldCampaign/CampaignGeneration/GenerationHelpers/WorldCampaignAnchorGraph.h"
 #include "RTS_Survival/WorldCampaign/CampaignGeneration/GenerationHelpers/WorldCampaignGenerationHelper.h"
 
+#include <atomic>
+
 namespace WorldCampaignAsyncPlacement
 {
 using FWorldCampaignPlayerHQPlacementRulesSnapshot = FPlayerHQPlacementRulesSnapshot;
@@ -46,6 +50,10 @@ namespace
 	constexpr uint64 HashCombineSaltD = 0x91E10DA5C79E7B1Dull;
 	constexpr uint64 HashCombineSaltE = 0xF1357AEA2E62A9C5ull;
 	constexpr int32 NoRequiredItems = 0;
+	// Prime stride between the placement seeds of portfolio instances, far above the per-attempt seed offsets so
+	// instances do not replay each other's retries.
+	constexpr int32 PortfolioSeedStride = 104729;
+	constexpr int32 PortfolioInstanceKeyBits = 32;
 
 	using CampaignGenerationHelper::AddChokepointPathContribution;
 	using CampaignGenerationHelper::BuildCanonicalFailedEnemyDeclusterSwapPairKey;
@@ -392,12 +400,6 @@ namespace
 		SortFailSafeItemsByDistanceAndType(OutItems);
 	}
 
-	int32 GetCachedHopDistance(const TMap<FGuid, int32>& HopDistancesByAnchorKey, const FGuid& AnchorKey)
-	{
-		const int32* CachedDistance = HopDistancesByAnchorKey.Find(AnchorKey);
-		return CachedDistance ? *CachedDistance : INDEX_NONE;
-	}
-
 	FRuleRelaxationState GetRelaxationState(EPlacementFailurePolicy Policy, int32 AttemptIndex)
 	{
 		FRuleRelaxationState RelaxationState;
@@ -446,6 +448,10 @@ namespace
 		TMap<FGuid, EMapEnemyItem> EnemyItemsByAnchorKey;
 		TMap<FGuid, EMapNeutralObjectType> NeutralItemsByAnchorKey;
 		TMap<FGuid, EMapMission> MissionsByAnchorKey;
+		// Per anchor index: holds an HQ, enemy item or mission. Mirrors the maps above so occupancy checks in the
+		// candidate loops are a bit test instead of several FGuid lookups.
+		TBitArray<> BlockingAnchorBits;
+		TBitArray<> NeutralAnchorBits;
 	};
 
 	struct FWorldCampaignPlacementSolverTransaction
@@ -483,16 +489,50 @@ namespace
 		float DistanceSquared = 0.f;
 	};
 
+	/**
+	 * @brief Orders portfolio results: fewer worker attempts first, then the lower instance index.
+	 * Attempts only grow while solving, so an instance whose current key exceeds the best accepted key can never win.
+	 */
+	int64 MakePortfolioAcceptanceKey(const int32 WorkerAttemptCount, const int32 PortfolioInstanceIndex)
+	{
+		return (static_cast<int64>(WorkerAttemptCount) << PortfolioInstanceKeyBits)
+			| static_cast<int64>(static_cast<uint32>(PortfolioInstanceIndex));
+	}
+
+	/** @brief Shared by all instances of one portfolio solve; holds the best key of the successful instances. */
+	struct FPortfolioAcceptanceState
+	{
+		std::atomic<int64> BestAcceptedKey{TNumericLimits<int64>::Max()};
+
+		void AcceptSuccess(const int64 AcceptanceKey)
+		{
+			int64 CurrentBestKey = BestAcceptedKey.load(std::memory_order_relaxed);
+			while (AcceptanceKey < CurrentBestKey
+				&& not BestAcceptedKey.compare_exchange_weak(CurrentBestKey, AcceptanceKey, std::memory_order_relaxed))
+			{
+			}
+		}
+	};
+
 	class FWorldCampaignPlacementBacktrackingSolver
 	{
 	public:
+		/**
+		 * @param InPortfolioInstanceIndex Offsets the placement seed by PortfolioSeedStride per instance.
+		 * @param InPortfolioAcceptance Set when solving as part of a portfolio so this instance can stop once it is
+		 * outranked by an accepted result.
+		 */
 		FWorldCampaignPlacementResult Solve(
 			const FWorldCampaignPlacementSnapshot& InSnapshot,
-			const TSharedPtr<FWorldCampaignAsyncPlacementProgress, ESPMode::ThreadSafe>& InProgress = nullptr)
+			const TSharedPtr<FWorldCampaignAsyncPlacementProgress, ESPMode::ThreadSafe>& InProgress = nullptr,
+			const int32 InPortfolioInstanceIndex = 0,
+			const FPortfolioAcceptanceState* InPortfolioAcceptance = nullptr)
 		{
 			Snapshot = &InSnapshot;
 			Progress = InProgress;
 			ResetWorkingState();
+			PortfolioInstanceIndex = InPortfolioInstanceIndex;
+			PortfolioAcceptance = InPortfolioAcceptance;
 			InitialTotalAttemptCount = Snapshot->InitialTotalAttemptCount;
 			TotalAttemptCount = InitialTotalAttemptCount;
 			StepAttemptIndices = Snapshot->InitialStepAttemptIndices;
@@ -503,14 +543,16 @@ namespace
 				return BuildFailureResult(TEXT("Async placement failed: snapshot had no anchors."));
 			}
 
-			State.SeedUsed = Snapshot->SeedUsed;
+			State.SeedUsed = Snapshot->SeedUsed + PortfolioInstanceIndex * PortfolioSeedStride;
 			UpdateProgress(TEXT("Building derived graph caches"), ECampaignGenerationStep::ConnectionsCreated);
 			InitializeDerivedDataFromSnapshot();
 
 			UpdateProgress(TEXT("Running placement backtracking"), ECampaignGenerationStep::PlayerHQPlaced);
 			if (not ExecutePlacementBacktracking())
 			{
-				return BuildFailureResult(TEXT("Async placement failed: backtracking exhausted."));
+				return bWasOutrankedInPortfolio
+					       ? BuildFailureResult(TEXT("Async placement stopped: outranked by another portfolio instance."))
+					       : BuildFailureResult(TEXT("Async placement failed: backtracking exhausted."));
 			}
 
 			UpdateProgress(TEXT("Finished placement backtracking"), ECampaignGenerationStep::Finished);
@@ -524,7 +566,7 @@ namespace
 		TMap<FGuid, int32> AnchorIndexByKey;
 		TArray<int32> AnchorIndicesInSnapshotOrder;
 		TArray<int32> SortedAnchorIndices;
-		mutable TMap<int32, TMap<int32, int32>> HopDistanceCacheByStartAnchorIndex;
+		FWorldCampaignAnchorGraph AnchorGraph;
 		FWorldCampaignPlacementSolverState State;
 		FWorldCampaignDerivedData DerivedData;
 		TArray<FWorldCampaignPlacementSolverTransaction> Transactions;
@@ -544,6 +586,9 @@ namespace
 		ECampaignGenerationStep GameThreadBacktrackFailedStep = ECampaignGenerationStep::NotStarted;
 		int32 GameThreadTransactionsToUndo = 0;
 		ECampaignGenerationStep BacktrackedFailedStepAttemptToPreserve = ECampaignGenerationStep::NotStarted;
+		int32 PortfolioInstanceIndex = 0;
+		const FPortfolioAcceptanceState* PortfolioAcceptance = nullptr;
+		bool bWasOutrankedInPortfolio = false;
 
 		void ResetWorkingState()
 		{
@@ -551,7 +596,7 @@ namespace
 			AnchorIndexByKey.Reset();
 			AnchorIndicesInSnapshotOrder.Reset();
 			SortedAnchorIndices.Reset();
-			HopDistanceCacheByStartAnchorIndex.Reset();
+			AnchorGraph.Reset();
 			State = FWorldCampaignPlacementSolverState();
 			DerivedData = FWorldCampaignDerivedData();
 			Transactions.Reset();
@@ -571,6 +616,25 @@ namespace
 			GameThreadBacktrackFailedStep = ECampaignGenerationStep::NotStarted;
 			GameThreadTransactionsToUndo = 0;
 			BacktrackedFailedStepAttemptToPreserve = ECampaignGenerationStep::NotStarted;
+			PortfolioInstanceIndex = 0;
+			PortfolioAcceptance = nullptr;
+			bWasOutrankedInPortfolio = false;
+		}
+
+		int32 GetWorkerTotalAttemptCount() const
+		{
+			return FMath::Max(0, TotalAttemptCount - InitialTotalAttemptCount);
+		}
+
+		bool GetIsOutrankedInPortfolio() const
+		{
+			if (PortfolioAcceptance == nullptr)
+			{
+				return false;
+			}
+
+			const int64 CurrentKey = MakePortfolioAcceptanceKey(GetWorkerTotalAttemptCount(), PortfolioInstanceIndex);
+			return CurrentKey > PortfolioAcceptance->BestAcceptedKey.load(std::memory_order_relaxed);
 		}
 
 		bool BuildAnchorLookup()
@@ -613,6 +677,14 @@ namespace
 			}
 
 			SortAnchorIndices(SortedAnchorIndices);
+			AnchorGraph.Build(AnchorSnapshots.Num(),
+			                  [this](const int32 AnchorIndex) { return IsAnchorCached(AnchorIndex); },
+			                  [this](const int32 AnchorIndex) -> const TArray<int32>&
+			                  {
+				                  return AnchorSnapshots[AnchorIndex].NeighborAnchorIndices;
+			                  });
+			State.BlockingAnchorBits.Init(false, AnchorSnapshots.Num());
+			State.NeutralAnchorBits.Init(false, AnchorSnapshots.Num());
 			return SortedAnchorIndices.Num() > 0;
 		}
 
@@ -741,12 +813,18 @@ namespace
 			Result.WorkerMicroBacktrackCount = WorkerMicroBacktrackCount;
 			Result.WorkerMacroBacktrackCount = WorkerMacroBacktrackCount;
 			Result.WorkerSetupBacktrackRequestCount = WorkerSetupBacktrackRequestCount;
-			Result.WorkerTotalAttemptCount = FMath::Max(0, TotalAttemptCount - InitialTotalAttemptCount);
+			Result.WorkerTotalAttemptCount = GetWorkerTotalAttemptCount();
+			Result.PortfolioInstanceIndex = PortfolioInstanceIndex;
+			Result.PlacementSeedUsed = State.SeedUsed;
 			Result.StepAttemptIndicesAtEnd = StepAttemptIndices;
 			Result.EnemyItemsByAnchorKey = State.EnemyItemsByAnchorKey;
 			Result.NeutralItemsByAnchorKey = State.NeutralItemsByAnchorKey;
 			Result.MissionsByAnchorKey = State.MissionsByAnchorKey;
 			Result.DerivedData = DerivedData;
+			// The solver reads hop distances from the anchor graph; the keyed maps only exist for the debugger,
+			// the parity check and save data.
+			BuildHopDistanceMap(State.PlayerHQAnchorIndex, Result.DerivedData.PlayerHQHopDistancesByAnchorKey);
+			BuildHopDistanceMap(State.EnemyHQAnchorIndex, Result.DerivedData.EnemyHQHopDistancesByAnchorKey);
 			Result.DebugEvents = DebugEvents;
 			return Result;
 		}
@@ -766,6 +844,20 @@ namespace
 			}
 		}
 
+		/** @brief Fills the index addressed degree and chokepoint caches from their maps in snapshot index order. */
+		void BuildDenseAnchorCaches()
+		{
+			DerivedData.AnchorConnectionDegreesByAnchorIndex.Init(0, AnchorSnapshots.Num());
+			DerivedData.ChokepointScoresByAnchorIndex.Init(0.f, AnchorSnapshots.Num());
+			for (int32 AnchorIndex = 0; AnchorIndex < AnchorSnapshots.Num(); AnchorIndex++)
+			{
+				const FGuid& AnchorKey = AnchorSnapshots[AnchorIndex].AnchorKey;
+				DerivedData.AnchorConnectionDegreesByAnchorIndex[AnchorIndex] = GetAnchorConnectionDegree(AnchorKey);
+				DerivedData.ChokepointScoresByAnchorIndex[AnchorIndex] =
+					DerivedData.ChokepointScoresByAnchorKey.FindRef(AnchorKey);
+			}
+		}
+
 		const FWorldCampaignAnchorSnapshot* FindAnchor(const int32 AnchorIndex) const
 		{
 			return AnchorSnapshots.IsValidIndex(AnchorIndex) ? &AnchorSnapshots[AnchorIndex] : nullptr;
@@ -795,6 +887,12 @@ namespace
 			return CachedDegree ? *CachedDegree : 0;
 		}
 
+		/** @return The degree cached for the anchor while solving, read without hashing its key. */
+		int32 GetCachedConnectionDegree(const int32 AnchorIndex) const
+		{
+			return FMath::Max(0, DerivedData.GetConnectionDegreeAt(AnchorIndex));
+		}
+
 		int32 GetAnchorConnectionDegree(const int32 AnchorIndex) const
 		{
 			const FWorldCampaignAnchorSnapshot* Anchor = FindAnchor(AnchorIndex);
@@ -849,73 +947,22 @@ namespace
 			return FVector2D::Distance(FVector2D(FirstAnchor->Location), FVector2D(SecondAnchor->Location));
 		}
 
-		void BuildHopDistanceCache(const int32 StartAnchorIndex, TMap<FGuid, int32>& OutHopDistances) const
+		void BuildHopDistanceMap(const int32 StartAnchorIndex, TMap<FGuid, int32>& OutHopDistances) const
 		{
 			OutHopDistances.Reset();
-			if (not IsAnchorCached(StartAnchorIndex))
-			{
-				return;
-			}
-
-			struct FHopQueueEntry
+			const TConstArrayView<int32> HopDistances = AnchorGraph.GetHopDistanceRow(StartAnchorIndex);
+			for (int32 AnchorIndex = 0; AnchorIndex < HopDistances.Num(); AnchorIndex++)
 			{
-				int32 AnchorIndex = INDEX_NONE;
-				int32 HopCount = 0;
-			};
-
-			TArray<FHopQueueEntry> Queue;
-			Queue.Add({StartAnchorIndex, 0});
-			OutHopDistances.Add(GetAnchorKey(StartAnchorIndex), 0);
-
-			int32 QueueIndex = 0;
-			while (QueueIndex < Queue.Num())
-			{
-				const FHopQueueEntry QueueEntry = Queue[QueueIndex];
-				QueueIndex++;
-
-				const FWorldCampaignAnchorSnapshot* CurrentAnchor = FindAnchor(QueueEntry.AnchorIndex);
-				if (CurrentAnchor == nullptr)
+				if (HopDistances[AnchorIndex] != INDEX_NONE)
 				{
-					continue;
-				}
-
-				for (const int32 NeighborIndex : CurrentAnchor->NeighborAnchorIndices)
-				{
-					const FGuid NeighborKey = GetAnchorKey(NeighborIndex);
-					if (not NeighborKey.IsValid() || OutHopDistances.Contains(NeighborKey))
-					{
-						continue;
-					}
-
-					const int32 NextHops = QueueEntry.HopCount + 1;
-					OutHopDistances.Add(NeighborKey, NextHops);
-					Queue.Add({NeighborIndex, NextHops});
+					OutHopDistances.Add(GetAnchorKey(AnchorIndex), HopDistances[AnchorIndex]);
 				}
 			}
 		}
 
 		int32 GetHopDistance(const int32 StartAnchorIndex, const int32 TargetAnchorIndex) const
 		{
-			if (not IsAnchorCached(StartAnchorIndex) || not IsAnchorCached(TargetAnchorIndex))
-			{
-				return INDEX_NONE;
-			}
-
-			if (StartAnchorIndex == TargetAnchorIndex)
-			{
-				return 0;
-			}
-
-			TMap<int32, int32>* HopDistances = HopDistanceCacheByStartAnchorIndex.Find(StartAnchorIndex);
-			if (HopDistances == nullptr)
-			{
-				TMap<int32, int32>& NewHopDistances = HopDistanceCacheByStartAnchorIndex.Add(StartAnchorIndex);
-				BuildIndexHopDistanceCache(StartAnchorIndex, NewHopDistances);
-				HopDistances = &NewHopDistances;
-			}
-
-			const int32* HopDistance = HopDistances->Find(TargetAnchorIndex);
-			return HopDistance != nullptr ? *HopDistance : INDEX_NONE;
+			return AnchorGraph.GetHopDistance(StartAnchorIndex, TargetAnchorIndex);
 		}
 
 		int32 GetHopDistance(const FGuid& StartAnchorKey, const FGuid& TargetAnchorKey) const
@@ -925,120 +972,29 @@ namespace
 			return GetHopDistance(StartAnchorIndex, TargetAnchorIndex);
 		}
 
-		void BuildIndexHopDistanceCache(const int32 StartAnchorIndex, TMap<int32, int32>& OutHopDistances) const
+		int32 GetHopDistanceFromPlayerHQ(const int32 AnchorIndex) const
 		{
-			OutHopDistances.Reset();
-			if (not IsAnchorCached(StartAnchorIndex))
-			{
-				return;
-			}
-
-			TArray<int32> Queue;
-			Queue.Add(StartAnchorIndex);
-			OutHopDistances.Add(StartAnchorIndex, 0);
-
-			for (int32 QueueIndex = 0; QueueIndex < Queue.Num(); QueueIndex++)
-			{
-				const int32 CurrentIndex = Queue[QueueIndex];
-				const FWorldCampaignAnchorSnapshot* CurrentAnchor = FindAnchor(CurrentIndex);
-				if (CurrentAnchor == nullptr)
-				{
-					continue;
-				}
-
-				const int32 CurrentHops = OutHopDistances.FindRef(CurrentIndex);
-				for (const int32 NeighborIndex : CurrentAnchor->NeighborAnchorIndices)
-				{
-					if (not IsAnchorCached(NeighborIndex) || OutHopDistances.Contains(NeighborIndex))
-					{
-						continue;
-					}
-
-					OutHopDistances.Add(NeighborIndex, CurrentHops + 1);
-					Queue.Add(NeighborIndex);
-				}
-			}
+			return AnchorGraph.GetHopDistance(State.PlayerHQAnchorIndex, AnchorIndex);
 		}
 
-		bool BuildShortestPathKeys(const FGuid& StartKey, const FGuid& TargetKey, TArray<FGuid>& OutPathKeys) const
+		int32 GetHopDistanceFromEnemyHQ(const int32 AnchorIndex) const
 		{
-			if (not IsAnchorCached(StartKey) || not IsAnchorCached(TargetKey))
-			{
-				return false;
-			}
-
-			if (StartKey == TargetKey)
-			{
-				OutPathKeys.Reset();
-				OutPathKeys.Add(StartKey);
-				return true;
-			}
-
-			TArray<FGuid> Queue;
-			TSet<FGuid> Visited;
-			TMap<FGuid, FGuid> PredecessorByKey;
-			Queue.Add(StartKey);
-			Visited.Add(StartKey);
-
-			for (int32 QueueIndex = 0; QueueIndex < Queue.Num(); ++QueueIndex)
-			{
-				const FGuid CurrentKey = Queue[QueueIndex];
-				if (CurrentKey == TargetKey)
-				{
-					break;
-				}
-
-				const FWorldCampaignAnchorSnapshot* CurrentAnchor = FindAnchor(CurrentKey);
-				if (CurrentAnchor == nullptr)
-				{
-					continue;
-				}
-
-				for (const FGuid& NeighborKey : CurrentAnchor->NeighborAnchorKeys)
-				{
-					if (Visited.Contains(NeighborKey) || not IsAnchorCached(NeighborKey))
-					{
-						continue;
-					}
-
-					Visited.Add(NeighborKey);
-					PredecessorByKey.Add(NeighborKey, CurrentKey);
-					Queue.Add(NeighborKey);
-				}
-			}
-
-			return BuildShortestPathFromPredecessors(StartKey, TargetKey, Visited, PredecessorByKey, OutPathKeys);
+			return AnchorGraph.GetHopDistance(State.EnemyHQAnchorIndex, AnchorIndex);
 		}
 
-		bool BuildShortestPathFromPredecessors(const FGuid& StartKey, const FGuid& TargetKey,
-		                                       const TSet<FGuid>& Visited,
-		                                       const TMap<FGuid, FGuid>& PredecessorByKey,
-		                                       TArray<FGuid>& OutPathKeys) const
+		bool BuildShortestPathKeys(const FGuid& StartKey, const FGuid& TargetKey, TArray<FGuid>& OutPathKeys) const
 		{
-			if (not Visited.Contains(TargetKey))
+			TArray<int32> PathIndices;
+			if (not AnchorGraph.BuildShortestPath(FindAnchorIndexByKey(StartKey), FindAnchorIndexByKey(TargetKey),
+			                                      PathIndices))
 			{
 				return false;
 			}
 
-			TArray<FGuid> ReversePath;
-			ReversePath.Add(TargetKey);
-			FGuid CurrentKey = TargetKey;
-			while (CurrentKey != StartKey)
+			OutPathKeys.Reset(PathIndices.Num());
+			for (const int32 PathIndex : PathIndices)
 			{
-				const FGuid* PreviousKey = PredecessorByKey.Find(CurrentKey);
-				if (PreviousKey == nullptr)
-				{
-					return false;
-				}
-
-				CurrentKey = *PreviousKey;
-				ReversePath.Add(CurrentKey);
-			}
-
-			OutPathKeys.Reset();
-			for (int32 Index = ReversePath.Num() - 1; Index >= 0; --Index)
-			{
-				OutPathKeys.Add(ReversePath[Index]);
+				OutPathKeys.Add(GetAnchorKey(PathIndex));
 			}
 
 			return true;
@@ -1055,10 +1011,12 @@ namespace
 			if (bUseHQAnchor)
 			{
 				BuildHQChokepointScores(OptionalHQAnchorKey);
-				return;
 			}
-
-			BuildGlobalChokepointScores();
+			else
+			{
+				BuildGlobalChokepointScores();
+			}
+			BuildDenseAnchorCaches();
 		}
 
 		void BuildGlobalChokepointScores()
@@ -1144,6 +1102,12 @@ namespace
 			int32 StepIndex = 0;
 			while (StepIndex < StepOrder.Num())
 			{
+				if (GetIsOutrankedInPortfolio())
+				{
+					bWasOutrankedInPortfolio = true;
+					return false;
+				}
+
 				const ECampaignGenerationStep StepToExecute = StepOrder[StepIndex];
 				UpdateProgress(TEXT("Executing placement step"), StepToExecute);
 				if (ExecuteStepWithTransaction(StepToExecute))
@@ -1320,6 +1284,8 @@ namespace
 				|| DerivedData.ChokepointScoresByAnchorKey.Num() == 0;
 			if (not bNeedsGraphCaches)
 			{
+				// The generator filled the dense caches in its own anchor order.
+				BuildDenseAnchorCaches();
 				return;
 			}
 
@@ -1695,31 +1661,33 @@ namespace
 				ECampaignGenerationStep::MissionsPlaced);
 		}
 
-		bool IsAnchorOccupied(const FGuid& AnchorKey) const
+		bool IsAnchorOccupied(const int32 AnchorIndex) const
 		{
-			if (State.PlayerHQAnchorKey == AnchorKey || State.EnemyHQAnchorKey == AnchorKey)
-			{
-				return true;
-			}
+			return State.BlockingAnchorBits[AnchorIndex] || State.NeutralAnchorBits[AnchorIndex];
+		}
 
-			return State.EnemyItemsByAnchorKey.Contains(AnchorKey)
-				|| State.NeutralItemsByAnchorKey.Contains(AnchorKey)
-				|| State.MissionsByAnchorKey.Contains(AnchorKey);
+		bool IsAnchorOccupiedForMission(const int32 AnchorIndex, const bool bAllowNeutralStacking) const
+		{
+			return State.BlockingAnchorBits[AnchorIndex]
+				|| (not bAllowNeutralStacking && State.NeutralAnchorBits[AnchorIndex]);
 		}
 
-		bool IsAnchorOccupiedForMission(const FGuid& AnchorKey, const bool bAllowNeutralStacking) const
+		void AddEnemyItem(const FGuid& AnchorKey, const EMapEnemyItem EnemyType)
 		{
-			if (State.PlayerHQAnchorKey == AnchorKey || State.EnemyHQAnchorKey == AnchorKey)
-			{
-				return true;
-			}
+			State.EnemyItemsByAnchorKey.Add(AnchorKey, EnemyType);
+			State.BlockingAnchorBits[FindAnchorIndexByKey(AnchorKey)] = true;
+		}
 
-			if (State.EnemyItemsByAnchorKey.Contains(AnchorKey) || State.MissionsByAnchorKey.Contains(AnchorKey))
-			{
-				return true;
-			}
+		void AddNeutralItem(const FGuid& AnchorKey, const EMapNeutralObjectType NeutralType)
+		{
+			State.NeutralItemsByAnchorKey.Add(AnchorKey, NeutralType);
+			State.NeutralAnchorBits[FindAnchorIndexByKey(AnchorKey)] = true;
+		}
 
-			return not bAllowNeutralStacking && State.NeutralItemsByAnchorKey.Contains(AnchorKey);
+		void AddMission(const FGuid& AnchorKey, const EMapMission MissionType)
+		{
+			State.MissionsByAnchorKey.Add(AnchorKey, MissionType);
+			State.BlockingAnchorBits[FindAnchorIndexByKey(AnchorKey)] = true;
 		}
 
 		bool HasNeutralTypeAtAnchor(const FGuid& AnchorKey, const EMapNeutralObjectType RequiredNeutralType) const
@@ -1760,7 +1728,7 @@ namespace
 				}
 
 				SourceOrderByAnchorIndex.FindOrAdd(CandidateIndex, SourceIndex);
-				const int32 ConnectionDegree = GetAnchorConnectionDegree(CandidateKey);
+				const int32 ConnectionDegree = GetCachedConnectionDegree(CandidateIndex);
 				if (ConnectionDegree < MinDegree || ConnectionDegree > MaxDegree)
 				{
 					continue;
@@ -1833,7 +1801,7 @@ namespace
 			const FGuid SelectedAnchorKey = GetAnchorKey(SelectedAnchorIndex);
 			State.PlayerHQAnchorKey = SelectedAnchorKey;
 			State.PlayerHQAnchorIndex = SelectedAnchorIndex;
-			BuildHopDistanceCache(SelectedAnchorIndex, DerivedData.PlayerHQHopDistancesByAnchorKey);
+			State.BlockingAnchorBits[SelectedAnchorIndex] = true;
 			BuildChokepointScores(true, SelectedAnchorKey);
 			return true;
 		}
@@ -1844,12 +1812,10 @@ namespace
 			OutCandidates.Reserve(Candidates.Num());
 			for (const int32 CandidateIndex : Candidates)
 			{
-				TMap<FGuid, int32> HopDistances;
-				BuildHopDistanceCache(CandidateIndex, HopDistances);
 				int32 NearbyAnchorCount = 0;
-				for (const TPair<FGuid, int32>& Pair : HopDistances)
+				for (const int32 HopDistance : AnchorGraph.GetHopDistanceRow(CandidateIndex))
 				{
-					if (Pair.Value <= 0 || Pair.Value > Snapshot->PlayerHQPlacementRules.MinAnchorsWithinHopsRange)
+					if (HopDistance <= 0 || HopDistance > Snapshot->PlayerHQPlacementRules.MinAnchorsWithinHopsRange)
 					{
 						continue;
 					}
@@ -1917,7 +1883,7 @@ namespace
 			const FGuid SelectedAnchorKey = GetAnchorKey(SelectedAnchorIndex);
 			State.EnemyHQAnchorKey = SelectedAnchorKey;
 			State.EnemyHQAnchorIndex = SelectedAnchorIndex;
-			BuildHopDistanceCache(SelectedAnchorIndex, DerivedData.EnemyHQHopDistancesByAnchorKey);
+			State.BlockingAnchorBits[SelectedAnchorIndex] = true;
 			return true;
 		}
 
@@ -1939,8 +1905,8 @@ namespace
 
 			InOutCandidates.Sort([this, bPreferMax, &SourceOrderByAnchorIndex](const int32 Left, const int32 Right)
 			{
-				const int32 LeftDegree = GetAnchorConnectionDegree(GetAnchorKey(Left));
-				const int32 RightDegree = GetAnchorConnectionDegree(GetAnchorKey(Right));
+				const int32 LeftDegree = GetCachedConnectionDegree(Left);
+				const int32 RightDegree = GetCachedConnectionDegree(Right);
 				if (LeftDegree != RightDegree)
 				{
 					return bPreferMax ? LeftDegree > RightDegree : LeftDegree < RightDegree;
@@ -1991,7 +1957,7 @@ namespace
 				return false;
 			}
 
-			State.EnemyItemsByAnchorKey.Add(SelectedCandidate.AnchorKey, EMapEnemyItem::EnemyWall);
+			AddEnemyItem(SelectedCandidate.AnchorKey, EMapEnemyItem::EnemyWall);
 			IncrementEnemyPlacedCount(EMapEnemyItem::EnemyWall);
 			return true;
 		}
@@ -2006,7 +1972,7 @@ namespace
 			{
 				const int32 CandidateIndex = Snapshot->EnemyWallPlacementRules.AnchorCandidateIndices[SourceIndex];
 				const FGuid CandidateKey = GetAnchorKey(CandidateIndex);
-				if (not IsAnchorCached(CandidateIndex) || IsAnchorOccupied(CandidateKey))
+				if (not IsAnchorCached(CandidateIndex) || IsAnchorOccupied(CandidateIndex))
 				{
 					continue;
 				}
@@ -2017,8 +1983,8 @@ namespace
 				Candidate.CandidateOrder = SourceIndex;
 				Candidate.Score = GetEnemyWallPreferenceScore(
 					Snapshot->EnemyWallPlacementRules.Preference,
-					GetAnchorConnectionDegree(CandidateKey),
-					DerivedData.ChokepointScoresByAnchorKey.FindRef(CandidateKey));
+					GetCachedConnectionDegree(CandidateIndex),
+					DerivedData.GetChokepointScoreAt(CandidateIndex));
 				Candidates.Add(Candidate);
 			}
 
@@ -2112,8 +2078,7 @@ namespace
 		{
 			return IsAnchorCached(State.EnemyHQAnchorIndex)
 				&& IsAnchorCached(State.PlayerHQAnchorIndex)
-				&& AnchorIndicesInSnapshotOrder.Num() > 0
-				&& DerivedData.EnemyHQHopDistancesByAnchorKey.Num() > 0;
+				&& AnchorIndicesInSnapshotOrder.Num() > 0;
 		}
 
 		bool ExecutePlaceSingleEnemyObject(const EMapEnemyItem EnemyTypeToPlace, const int32 MicroIndexWithinParent,
@@ -2181,7 +2146,7 @@ namespace
 					return false;
 				}
 
-				State.EnemyItemsByAnchorKey.Add(SelectedCandidate.AnchorKey, EnemyType);
+				AddEnemyItem(SelectedCandidate.AnchorKey, EnemyType);
 				IncrementEnemyPlacedCount(EnemyType);
 				OutLastSelectedAnchorKey = SelectedCandidate.AnchorKey;
 			}
@@ -2257,17 +2222,15 @@ namespace
 					continue;
 				}
 
-				const int32 HopDistanceFromEnemyHQ = GetCachedHopDistance(
-					DerivedData.EnemyHQHopDistancesByAnchorKey,
-					CandidateKey);
+				const int32 HopDistanceFromEnemyHQ = GetHopDistanceFromEnemyHQ(CandidateIndex);
 				FWorldCampaignKeyPlacementCandidate Candidate;
 				Candidate.AnchorKey = CandidateKey;
 				Candidate.AnchorIndex = CandidateIndex;
 				Candidate.CandidateOrder = SourceIndex;
 				Candidate.Score = GetEnemyPreferenceScore(
 					EffectiveRules.EnemyHQSpacing.Preference,
-					GetAnchorConnectionDegree(CandidateKey),
-					DerivedData.ChokepointScoresByAnchorKey.FindRef(CandidateKey),
+					GetCachedConnectionDegree(CandidateIndex),
+					DerivedData.GetChokepointScoreAt(CandidateIndex),
 					HopDistanceFromEnemyHQ,
 					EffectiveRules.EnemyHQSpacing.MinHopsFromEnemyHQ,
 					EffectiveRules.EnemyHQSpacing.MaxHopsFromEnemyHQ);
@@ -2289,15 +2252,12 @@ namespace
 		bool GetCanUseEnemyCandidate(const int32 CandidateIndex, const FEnemyItemPlacementRules& EffectiveRules,
 		                             const EMapEnemyItem EnemyType, const int32 SafeZoneMaxHops) const
 		{
-			const FGuid CandidateKey = GetAnchorKey(CandidateIndex);
-			if (IsAnchorOccupied(CandidateKey))
+			if (IsAnchorOccupied(CandidateIndex))
 			{
 				return false;
 			}
 
-			const int32 HopDistanceFromEnemyHQ = GetCachedHopDistance(
-				DerivedData.EnemyHQHopDistancesByAnchorKey,
-				CandidateKey);
+			const int32 HopDistanceFromEnemyHQ = GetHopDistanceFromEnemyHQ(CandidateIndex);
 			const int32 MinHopsFromEnemyHQ = EffectiveRules.EnemyHQSpacing.MinHopsFromEnemyHQ;
 			const int32 MaxHopsFromEnemyHQ = FMath::Max(MinHopsFromEnemyHQ,
 			                                            EffectiveRules.EnemyHQSpacing.MaxHopsFromEnemyHQ);
@@ -2310,9 +2270,7 @@ namespace
 
 			if (SafeZoneMaxHops > 0)
 			{
-				const int32 HopDistanceFromPlayerHQ = GetCachedHopDistance(
-					DerivedData.PlayerHQHopDistancesByAnchorKey,
-					CandidateKey);
+				const int32 HopDistanceFromPlayerHQ = GetHopDistanceFromPlayerHQ(CandidateIndex);
 				if (HopDistanceFromPlayerHQ != INDEX_NONE && HopDistanceFromPlayerHQ <= SafeZoneMaxHops)
 				{
 					return false;
@@ -2392,8 +2350,7 @@ namespace
 		bool ValidateNeutralObjectPlacementPrerequisites() const
 		{
 			return IsAnchorCached(State.PlayerHQAnchorIndex)
-				&& AnchorIndicesInSnapshotOrder.Num() > 0
-				&& DerivedData.PlayerHQHopDistancesByAnchorKey.Num() > 0;
+				&& AnchorIndicesInSnapshotOrder.Num() > 0;
 		}
 
 		bool TryPlaceNeutralItemsForType(const EMapNeutralObjectType NeutralType, const int32 RequiredCount,
@@ -2414,7 +2371,7 @@ namespace
 					return false;
 				}
 
-				State.NeutralItemsByAnchorKey.Add(SelectedCandidate.AnchorKey, NeutralType);
+				AddNeutralItem(SelectedCandidate.AnchorKey, NeutralType);
 				IncrementNeutralPlacedCount(NeutralType);
 			}
 
@@ -2504,15 +2461,13 @@ namespace
 		                                       FWorldCampaignKeyPlacementCandidate& OutCandidate) const
 		{
 			const FGuid CandidateKey = GetAnchorKey(CandidateIndex);
-			if (IsAnchorOccupied(CandidateKey))
+			if (IsAnchorOccupied(CandidateIndex))
 			{
 				InOutRejectionStats.OccupiedRejectCount++;
 				return false;
 			}
 
-			const int32 HopDistanceFromHQ = GetCachedHopDistance(
-				DerivedData.PlayerHQHopDistancesByAnchorKey,
-				CandidateKey);
+			const int32 HopDistanceFromHQ = GetHopDistanceFromPlayerHQ(CandidateIndex);
 			if (HopDistanceFromHQ == INDEX_NONE)
 			{
 				InOutRejectionStats.NoHopRejectCount++;
@@ -2540,11 +2495,9 @@ namespace
 		}
 
 		bool PassesNeutralDistanceRules(const FNeutralItemPlacementRules& PlacementRules,
-		                                const FGuid& CandidateKey) const
+		                                const int32 CandidateIndex) const
 		{
-			const int32 HopDistanceFromHQ = GetCachedHopDistance(
-				DerivedData.PlayerHQHopDistancesByAnchorKey,
-				CandidateKey);
+			const int32 HopDistanceFromHQ = GetHopDistanceFromPlayerHQ(CandidateIndex);
 			if (HopDistanceFromHQ == INDEX_NONE)
 			{
 				return false;
@@ -2655,8 +2608,7 @@ namespace
 		bool ValidateMissionPlacementPrerequisites() const
 		{
 			return IsAnchorCached(State.PlayerHQAnchorIndex)
-				&& AnchorIndicesInSnapshotOrder.Num() > 0
-				&& DerivedData.PlayerHQHopDistancesByAnchorKey.Num() > 0;
+				&& AnchorIndicesInSnapshotOrder.Num() > 0;
 		}
 
 		bool ExecutePlaceSingleMission(const EMapMission MissionTypeToPlace, const int32 MicroIndexWithinParent,
@@ -2724,7 +2676,7 @@ namespace
 				return false;
 			}
 
-			State.MissionsByAnchorKey.Add(OutSelectedCandidate.AnchorKey, MissionType);
+			AddMission(OutSelectedCandidate.AnchorKey, MissionType);
 			IncrementMissionPlacedCount(MissionType);
 			ApplyMissionCompanionNeutral(OutSelectedCandidate);
 			return true;
@@ -2887,7 +2839,7 @@ namespace
 
 			const FGuid CandidateKey = GetAnchorKey(CandidateIndex);
 			const bool bAllowNeutralStacking = EffectiveRules.bNeutralItemRequired;
-			if (IsAnchorOccupiedForMission(CandidateKey, bAllowNeutralStacking))
+			if (IsAnchorOccupiedForMission(CandidateIndex, bAllowNeutralStacking))
 			{
 				return false;
 			}
@@ -2904,7 +2856,7 @@ namespace
 				return false;
 			}
 
-			const int32 ConnectionDegree = GetAnchorConnectionDegree(CandidateKey);
+			const int32 ConnectionDegree = GetCachedConnectionDegree(CandidateIndex);
 			if (not PassesMissionConnectionRules(ConnectionDegree, EffectiveRules, SelectionSettings))
 			{
 				return false;
@@ -2932,11 +2884,10 @@ namespace
 		                                const FMissionSelectionSettings& SelectionSettings,
 		                                int32& OutHopDistanceFromHQ) const
 		{
-			const FGuid CandidateKey = GetAnchorKey(CandidateIndex);
 			OutHopDistanceFromHQ = INDEX_NONE;
 			if (SelectionSettings.bOverridePlacementWithArray)
 			{
-				OutHopDistanceFromHQ = GetCachedHopDistance(DerivedData.PlayerHQHopDistancesByAnchorKey, CandidateKey);
+				OutHopDistanceFromHQ = GetHopDistanceFromPlayerHQ(CandidateIndex);
 				return OutHopDistanceFromHQ != INDEX_NONE
 					&& OutHopDistanceFromHQ >= SelectionSettings.MinHopsFromPlayerHQ
 					&& OutHopDistanceFromHQ <= SelectionSettings.MaxHopsFromPlayerHQ
@@ -2945,7 +2896,7 @@ namespace
 
 			if (EffectiveRules.bUseHopsDistanceFromHQ)
 			{
-				OutHopDistanceFromHQ = GetCachedHopDistance(DerivedData.PlayerHQHopDistancesByAnchorKey, CandidateKey);
+				OutHopDistanceFromHQ = GetHopDistanceFromPlayerHQ(CandidateIndex);
 				const int32 MaxHopsFromHQClamped = FMath::Max(EffectiveRules.MinHopsFromHQ,
 				                                              EffectiveRules.MaxHopsFromHQ);
 				if (OutHopDistanceFromHQ == INDEX_NONE
@@ -2992,22 +2943,19 @@ namespace
 		                                const float NearestMissionXYDistance,
 		                                const int32 ConnectionDegree) const
 		{
-			const FGuid CandidateKey = GetAnchorKey(CandidateIndex);
 			if (SelectionSettings.bOverridePlacementWithArray)
 			{
 				return GetOverrideMissionPreferenceScore(
 					SelectionSettings.ConnectionPreference,
 					SelectionSettings.HopsPreference,
 					ConnectionDegree,
-					GetCachedHopDistance(DerivedData.PlayerHQHopDistancesByAnchorKey, CandidateKey));
+					GetHopDistanceFromPlayerHQ(CandidateIndex));
 			}
 
 			float PreferenceScore = 0.f;
 			if (EffectiveRules.bUseHopsDistanceFromHQ)
 			{
-				const int32 HopDistanceFromHQ = GetCachedHopDistance(
-					DerivedData.PlayerHQHopDistancesByAnchorKey,
-					CandidateKey);
+				const int32 HopDistanceFromHQ = GetHopDistanceFromPlayerHQ(CandidateIndex);
 				PreferenceScore += GetTopologyPreferenceScore(EffectiveRules.HopsDistancePreference,
 				                                              static_cast<float>(HopDistanceFromHQ));
 			}
@@ -3278,7 +3226,7 @@ namespace
 			{
 				const int32 NearbyIndex = AnchorIndicesInSnapshotOrder[SourceIndex];
 				const FGuid NearbyKey = GetAnchorKey(NearbyIndex);
-				if (IsAnchorOccupied(NearbyKey))
+				if (IsAnchorOccupied(NearbyIndex))
 				{
 					continue;
 				}
@@ -3289,15 +3237,13 @@ namespace
 					continue;
 				}
 
-				if (not PassesNeutralDistanceRules(EffectiveRules, NearbyKey)
+				if (not PassesNeutralDistanceRules(EffectiveRules, NearbyIndex)
 					|| not PassesNeutralSpacingRules(EffectiveRules, NearbyIndex))
 				{
 					continue;
 				}
 
-				const int32 HopDistanceFromHQ = GetCachedHopDistance(
-					DerivedData.PlayerHQHopDistancesByAnchorKey,
-					NearbyKey);
+				const int32 HopDistanceFromHQ = GetHopDistanceFromPlayerHQ(NearbyIndex);
 				FWorldCampaignKeyPlacementCandidate Candidate;
 				Candidate.AnchorKey = NearbyKey;
 				Candidate.AnchorIndex = NearbyIndex;
@@ -3328,7 +3274,7 @@ namespace
 
 			const EMapNeutralObjectType CompanionType =
 				static_cast<EMapNeutralObjectType>(SelectedCandidate.CompanionRawSubtype);
-			State.NeutralItemsByAnchorKey.Add(SelectedCandidate.CompanionAnchorKey, CompanionType);
+			AddNeutralItem(SelectedCandidate.CompanionAnchorKey, CompanionType);
 			IncrementNeutralPlacedCount(CompanionType);
 		}
 
@@ -3554,7 +3500,7 @@ namespace
 			for (const int32 AnchorIndex : SortedAnchorIndices)
 			{
 				const FGuid AnchorKey = GetAnchorKey(AnchorIndex);
-				if (IsAnchorOccupied(AnchorKey))
+				if (IsAnchorOccupied(AnchorIndex))
 				{
 					continue;
 				}
@@ -3751,7 +3697,7 @@ namespace
 		{
 			if (Item.Kind == EFailSafeItemKind::Enemy)
 			{
-				State.EnemyItemsByAnchorKey.Add(AnchorKey, Item.EnemyType);
+				AddEnemyItem(AnchorKey, Item.EnemyType);
 				IncrementEnemyPlacedCount(Item.EnemyType);
 				InOutTotals.EnemyPlaced++;
 				return;
@@ -3759,13 +3705,13 @@ namespace
 
 			if (Item.Kind == EFailSafeItemKind::Neutral)
 			{
-				State.NeutralItemsByAnchorKey.Add(AnchorKey, Item.NeutralType);
+				AddNeutralItem(AnchorKey, Item.NeutralType);
 				IncrementNeutralPlacedCount(Item.NeutralType);
 				InOutTotals.NeutralPlaced++;
 				return;
 			}
 
-			State.MissionsByAnchorKey.Add(AnchorKey, Item.MissionType);
+			AddMission(AnchorKey, Item.MissionType);
 			IncrementMissionPlacedCount(Item.MissionType);
 			InOutTotals.MissionPlaced++;
 		}
@@ -4042,4 +3988,79 @@ FPlacementResult SolvePlacement(
 	FWorldCampaignPlacementBacktrackingSolver Solver;
 	return Solver.Solve(Snapshot, Progress);
 }
+
+FPlacementResult SolvePlacementPortfolio(
+	const FPlacementSnapshot& Snapshot,
+	const int32 PortfolioSize,
+	const TSharedPtr<FPlacementProgress, ESPMode::ThreadSafe>& Progress)
+{
+	if (PortfolioSize <= 1)
+	{
+		return SolvePlacement(Snapshot, Progress);
+	}
+
+	if (Progress.IsValid())
+	{
+		FScopeLock ProgressLock(&Progress->CriticalSection);
+		Progress->PortfolioSize = PortfolioSize;
+		Progress->PortfolioFinishedCount = 0;
+		Progress->PortfolioAcceptedInstance = INDEX_NONE;
+		Progress->PortfolioAcceptedAttemptCount = 0;
+	}
+
+	FPortfolioAcceptanceState AcceptanceState;
+	TArray<FPlacementResult> InstanceResults;
+	InstanceResults.SetNum(PortfolioSize);
+	// Every instance is one long task; unbalanced gives each its own worker instead of batching them on one thread.
+	ParallelFor(PortfolioSize, [&Snapshot, &Progress, &AcceptanceState, &InstanceResults](const int32 InstanceIndex)
+	{
+		// Only instance 0 reports detailed progress so the watchdog log follows one consistent search.
+		const TSharedPtr<FPlacementProgress, ESPMode::ThreadSafe> InstanceProgress =
+			InstanceIndex == 0 ? Progress : nullptr;
+		FWorldCampaignPlacementBacktrackingSolver Solver;
+		FPlacementResult& InstanceResult = InstanceResults[InstanceIndex];
+		InstanceResult = Solver.Solve(Snapshot, InstanceProgress, InstanceIndex, &AcceptanceState);
+		if (InstanceResult.bSucceeded)
+		{
+			AcceptanceState.AcceptSuccess(
+				MakePortfolioAcceptanceKey(InstanceResult.WorkerTotalAttemptCount, InstanceIndex));
+		}
+
+		if (Progress.IsValid())
+		{
+			FScopeLock ProgressLock(&Progress->CriticalSection);
+			Progress->PortfolioFinishedCount++;
+			if (InstanceResult.bSucceeded)
+			{
+				const int64 BestKey = AcceptanceState.BestAcceptedKey.load(std::memory_order_relaxed);
+				Progress->PortfolioAcceptedInstance = static_cast<int32>(static_cast<uint32>(BestKey));
+				Progress->PortfolioAcceptedAttemptCount = static_cast<int32>(BestKey >> PortfolioInstanceKeyBits);
+			}
+		}
+	}, EParallelForFlags::Unbalanced);
+
+	int32 WinningInstanceIndex = INDEX_NONE;
+	int64 WinningKey = TNumericLimits<int64>::Max();
+	for (int32 InstanceIndex = 0; InstanceIndex < InstanceResults.Num(); ++InstanceIndex)
+	{
+		const FPlacementResult& InstanceResult = InstanceResults[InstanceIndex];
+		if (not InstanceResult.bSucceeded)
+		{
+			continue;
+		}
+
+		const int64 InstanceKey = MakePortfolioAcceptanceKey(InstanceResult.WorkerTotalAttemptCount, InstanceIndex);
+		if (InstanceKey < WinningKey)
+		{
+			WinningKey = InstanceKey;
+			WinningInstanceIndex = InstanceIndex;
+		}
+	}
+
+	/*
+	 * Without any success no instance was ever outranked, so instance 0 ran its full search and its failure or
+	 * game-thread backtrack request is exactly what a single solver would have returned.
+	 */
+	return MoveTemp(InstanceResults[WinningInstanceIndex == INDEX_NONE ? 0 : WinningInstanceIndex]);
+}
 }
@@ -63,6 +63,17 @@ struct FWorldCampaignDerivedData
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "World Campaign|Generation")
 	TMap<FGuid, float> ChokepointScoresByAnchorKey;
 
+	/**
+	 * @note Used in: EnemyHQPlaced, EnemyWallPlaced, EnemyObjectsPlaced.
+	 * @note Why: Candidate loops read degrees and chokepoint scores per anchor; an array avoids an FGuid hash each.
+	 * @note Technical: Indexed by the anchor index of the side that fills them: the position in CachedAnchors on the
+	 * generator, the snapshot anchor index in the async solver. Each side rebuilds them from the maps above when it
+	 * takes over derived data from the other.
+	 * @note Notes: Not reflected; the maps stay the inspectable and saved form.
+	 */
+	TArray<int32> AnchorConnectionDegreesByAnchorIndex;
+	TArray<float> ChokepointScoresByAnchorIndex;
+
 	/**
 	 * @note Used in: EnemyObjectsPlaced.
 	 * @note Why: Tracks how many enemy items of each type have been placed.
@@ -90,6 +101,20 @@ struct FWorldCampaignDerivedData
 	 */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "World Campaign|Generation")
 	TMap<EMapMission, int32> MissionPlacedCounts;
+
+	/** @return The cached degree of the anchor, INDEX_NONE if the dense cache does not cover the index. */
+	int32 GetConnectionDegreeAt(const int32 AnchorIndex) const
+	{
+		return AnchorConnectionDegreesByAnchorIndex.IsValidIndex(AnchorIndex)
+			       ? AnchorConnectionDegreesByAnchorIndex[AnchorIndex]
+			       : INDEX_NONE;
+	}
+
+	/** @return The cached chokepoint score of the anchor, 0 if the dense cache does not cover the index. */
+	float GetChokepointScoreAt(const int32 AnchorIndex) const
+	{
+		return ChokepointScoresByAnchorIndex.IsValidIndex(AnchorIndex) ? ChokepointScoresByAnchorIndex[AnchorIndex] : 0.f;
+	}
 };
 
 /**
@@ -243,6 +268,10 @@ namespace WorldCampaignAsyncPlacement
 		int32 WorkerMacroBacktrackCount = 0;
 		int32 WorkerSetupBacktrackRequestCount = 0;
 		int32 WorkerTotalAttemptCount = 0;
+		// Portfolio instance that produced this result and the placement seed it ran with; 0 and the snapshot seed
+		// when solved by a single instance.
+		int32 PortfolioInstanceIndex = 0;
+		int32 PlacementSeedUsed = 0;
 		TMap<ECampaignGenerationStep, int32> StepAttemptIndicesAtEnd;
 		FGuid PlayerHQAnchorKey;
 		FGuid EnemyHQAnchorKey;
@@ -281,6 +310,11 @@ namespace WorldCampaignAsyncPlacement
 		int32 NeutralRejectedNoHopCount = 0;
 		int32 NeutralRejectedHopBandCount = 0;
 		int32 NeutralRejectedSpacingCount = 0;
+		// Portfolio bookkeeping; the detailed counters above are reported by instance 0 only.
+		int32 PortfolioSize = 1;
+		int32 PortfolioFinishedCount = 0;
+		int32 PortfolioAcceptedInstance = INDEX_NONE;
+		int32 PortfolioAcceptedAttemptCount = 0;
 	};
 
 	/**
@@ -292,4 +326,22 @@ namespace WorldCampaignAsyncPlacement
 	FPlacementResult SolvePlacement(
 		const FPlacementSnapshot& Snapshot,
 		const TSharedPtr<FPlacementProgress, ESPMode::ThreadSafe>& Progress = nullptr);
+
+	/**
+	 * @brief Runs PortfolioSize independent solvers over the same snapshot on the thread pool, each with its own
+	 * placement seed (instance 0 keeps the snapshot seed).
+	 *
+	 * Of the instances that succeed, the one with the fewest worker attempts wins, ties go to the lowest instance
+	 * index. Instances that can no longer beat the best accepted result stop cooperatively. The winner only depends on
+	 * the snapshot and PortfolioSize, never on thread timing or core count; more cores only lower the latency.
+	 * If no instance succeeds the result of instance 0 is returned, identical to SolvePlacement.
+	 * @param Snapshot Complete plain-data graph and rule snapshot captured on the game thread.
+	 * @param PortfolioSize Amount of solver instances; 1 or less solves on the calling thread like SolvePlacement.
+	 * @param Progress Optional thread-safe progress state for watchdog logging while solving.
+	 * @return Pure placement result that the game thread can apply or discard.
+	 */
+	FPlacementResult SolvePlacementPortfolio(
+		const FPlacementSnapshot& Snapshot,
+		const int32 PortfolioSize,
+		const TSharedPtr<FPlacementProgress, ESPMode::ThreadSafe>& Progress = nullptr);
 }
@@ -97,5 +97,21 @@ public:
 		meta=(ClampMin="1"))
 	int32 WorldDivisionPathRepairMaxAttempts = 8;
 
+	/**
+	 * Divisions standing this close to an anchor and ordered to a point this close to another anchor follow the cached
+	 * route along the connection graph instead of querying the navmesh. 0 disables anchor routes.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category="World Campaign|World Divisions|Pathfinding",
+		meta=(ClampMin="0"))
+	float WorldDivisionAnchorRouteSnapRadius = 2000.f;
+
+	/**
+	 * Placement solvers that run side by side on the thread pool, each with its own seed. The accepted placement
+	 * depends on this value but not on the core count; any value above 1 changes which campaign a seed generates.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category="World Campaign|Generation",
+		meta=(ClampMin="1"))
+	int32 PlacementPortfolioSize = 1;
+
 	static const UWorldCampaignSettings* Get();
 };
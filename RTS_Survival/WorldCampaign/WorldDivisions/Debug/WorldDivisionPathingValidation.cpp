@@ -700,7 +700,7 @@ namespace
 		}
 
 		SpawnedDivisions.Add(WorldDivision);
-		if (not WorldDivision->IssueMoveOrderToPoint(TargetAnchor->GetActorLocation()))
+		if (not WorldDivision->IssueMoveOrderToPointImmediately(TargetAnchor->GetActorLocation()))
 		{
 			UE_LOG(LogTemp, Error, TEXT("World division pathing validation failed: division %d rejected move order."),
 			       DivisionIndex);
@@ -767,7 +767,7 @@ namespace
 		}
 
 		SpawnedDivisions.Add(WorldDivision);
-		if (not WorldDivision->IssueMoveOrderToPoint(RegressionCase.TargetLocation))
+		if (not WorldDivision->IssueMoveOrderToPointImmediately(RegressionCase.TargetLocation))
 		{
 			UE_LOG(
 				LogTemp,
@@ -1108,7 +1108,8 @@ namespace
 			const AAnchorPoint* TargetAnchor =
 				AnchorsWithClearance[GetBenchmarkTargetAnchorIndex(PreviewIndex, AnchorsWithClearance.Num())];
 			const double PathStartSeconds = FPlatformTime::Seconds();
-			const bool bIssuedMoveOrder = WorldDivision.IssueMoveOrderToPoint(TargetAnchor->GetActorLocation());
+			const bool bIssuedMoveOrder =
+				WorldDivision.IssueMoveOrderToPointImmediately(TargetAnchor->GetActorLocation());
 			const double PathSeconds = FPlatformTime::Seconds() - PathStartSeconds;
 			const FWorldDivisionSaveData DivisionSaveData = WorldDivision.BuildWorldDivisionSaveData();
 			RecordBenchmarkSample(
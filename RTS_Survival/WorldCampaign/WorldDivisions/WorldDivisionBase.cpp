@@ -4,10 +4,12 @@
 
 #include "DrawDebugHelpers.h"
 #include "Kismet/GameplayStatics.h"
+#include "NavFilters/NavigationQueryFilter.h"
 #include "NavigationPath.h"
 #include "NavigationSystem.h"
 #include "RTS_Survival/DeveloperSettings.h"
 #include "RTS_Survival/Utils/HFunctionLibary.h"
+#include "RTS_Survival/WorldCampaign/CampaignGeneration/GenerationHelpers/WorldCampaignAnchorGraph.h"
 #include "RTS_Survival/WorldCampaign/CampaignGeneration/GeneratorWorldCampaign/GeneratorWorldCampaign.h"
 #include "RTS_Survival/WorldCampaign/DeveloperSettings/WorldCampaignSettings.h"
 #include "RTS_Survival/WorldCampaign/WorldDivisions/WorldDivisionInfluenceComponent.h"
@@ -95,9 +97,29 @@ namespace
 		TArray<TWeakObjectPtr<AAnchorPoint>> AnchorPoints;
 		TWeakObjectPtr<AWorldSplineBoundary> Boundary;
 		TArray<FVector2D> BoundaryPolygon;
+		// Connection graph over AnchorPoints indices, used to chain anchor routes.
+		FWorldCampaignAnchorGraph AnchorGraph;
+		// Repaired routes between anchor pairs (from, to); an empty route caches that no route exists.
+		TMap<FIntPoint, TArray<FVector>> RoutesByAnchorPair;
 		bool bHasCachedData = false;
 	};
 
+	struct FWorldDivisionPathSettings
+	{
+		float AvoidanceRadius = 0.f;
+		float BoundaryPadding = 0.f;
+		int32 MaxRepairAttempts = 1;
+		float AnchorRouteSnapRadius = 0.f;
+	};
+
+	struct FWorldDivisionPathEndpoints
+	{
+		FVector StartLocation = FVector::ZeroVector;
+		FVector TargetLocation = FVector::ZeroVector;
+		int32 StartAnchorIndex = INDEX_NONE;
+		int32 TargetAnchorIndex = INDEX_NONE;
+	};
+
 	FVector2D GetXY(const FVector& Location)
 	{
 		return FVector2D(Location.X, Location.Y);
@@ -789,14 +811,47 @@ namespace
 		PathContextCache.AnchorPoints.Reset();
 		PathContextCache.Boundary = nullptr;
 		PathContextCache.BoundaryPolygon.Reset();
+		PathContextCache.AnchorGraph.Reset();
+		PathContextCache.RoutesByAnchorPair.Reset();
 
 		const TArray<AAnchorPoint*> CurrentAnchorPoints = FindAnchorPoints(WorldContextObject);
 		PathContextCache.AnchorPoints.Reserve(CurrentAnchorPoints.Num());
+		TMap<const AAnchorPoint*, int32> AnchorIndexByPointer;
 		for (AAnchorPoint* AnchorPoint : CurrentAnchorPoints)
 		{
+			AnchorIndexByPointer.Add(AnchorPoint, PathContextCache.AnchorPoints.Num());
 			PathContextCache.AnchorPoints.Add(AnchorPoint);
 		}
 
+		TArray<TArray<int32>> NeighborIndicesByAnchor;
+		NeighborIndicesByAnchor.SetNum(CurrentAnchorPoints.Num());
+		for (int32 AnchorIndex = 0; AnchorIndex < CurrentAnchorPoints.Num(); AnchorIndex++)
+		{
+			if (not IsValid(CurrentAnchorPoints[AnchorIndex]))
+			{
+				continue;
+			}
+
+			for (const TObjectPtr<AAnchorPoint>& NeighborAnchor : CurrentAnchorPoints[AnchorIndex]->GetNeighborAnchors())
+			{
+				if (const int32* NeighborIndex = AnchorIndexByPointer.Find(NeighborAnchor.Get()))
+				{
+					NeighborIndicesByAnchor[AnchorIndex].Add(*NeighborIndex);
+				}
+			}
+		}
+
+		PathContextCache.AnchorGraph.Build(
+			CurrentAnchorPoints.Num(),
+			[&CurrentAnchorPoints](const int32 AnchorIndex)
+			{
+				return IsValid(CurrentAnchorPoints[AnchorIndex]);
+			},
+			[&NeighborIndicesByAnchor](const int32 AnchorIndex) -> const TArray<int32>&
+			{
+				return NeighborIndicesByAnchor[AnchorIndex];
+			});
+
 		TArray<AActor*> BoundaryActors;
 		UGameplayStatics::GetAllActorsOfClass(
 			WorldContextObject,
@@ -832,17 +887,20 @@ namespace
 			return PathContext;
 		}
 
+		/*
+		 * The cache is refreshed once per campaign generation (see AWorldDivisionBase::ResetCampaignPathCache) or when
+		 * an anchor it holds was destroyed, so path requests do not iterate world actors. Cached anchor indices are
+		 * what the anchor route cache is keyed on.
+		 */
 		FWorldDivisionPathContextCache& PathContextCache =
 			FindOrAddWorldPathContextCache(*WorldContextObject->GetWorld());
 		if (TryReadWorldPathContextCache(PathContextCache, PathContext))
 		{
-			PathContext.AnchorPoints = FindAnchorPoints(WorldContextObject);
 			return PathContext;
 		}
 
 		RefreshWorldPathContextCache(WorldContextObject, PathContextCache);
 		(void)TryReadWorldPathContextCache(PathContextCache, PathContext);
-		PathContext.AnchorPoints = FindAnchorPoints(WorldContextObject);
 		return PathContext;
 	}
 
@@ -2415,6 +2473,272 @@ namespace
 			(void)TrySimplifyPathPoints(PathPoints, BoundaryPolygon, AnchorPoints, AvoidanceRadius);
 		}
 	}
+
+	FWorldDivisionPathSettings GetWorldDivisionPathSettings()
+	{
+		FWorldDivisionPathSettings PathSettings;
+		if (const UWorldCampaignSettings* Settings = UWorldCampaignSettings::Get())
+		{
+			PathSettings.AvoidanceRadius = Settings->WorldDivisionAnchorAvoidanceRadius;
+			PathSettings.BoundaryPadding = Settings->WorldDivisionBoundaryProjectionPadding;
+			PathSettings.MaxRepairAttempts = Settings->WorldDivisionPathRepairMaxAttempts;
+			PathSettings.AnchorRouteSnapRadius = Settings->WorldDivisionAnchorRouteSnapRadius;
+		}
+
+		return PathSettings;
+	}
+
+	int32 FindClosestAnchorIndexWithinRadius(const FVector& Point,
+	                                         const TArray<AAnchorPoint*>& AnchorPoints,
+	                                         const float Radius)
+	{
+		int32 ClosestAnchorIndex = INDEX_NONE;
+		float ClosestDistanceSquared = FMath::Square(Radius);
+		for (int32 AnchorIndex = 0; AnchorIndex < AnchorPoints.Num(); AnchorIndex++)
+		{
+			const AAnchorPoint* AnchorPoint = AnchorPoints[AnchorIndex];
+			if (not IsValid(AnchorPoint))
+			{
+				continue;
+			}
+
+			const float DistanceSquared = FVector2D::DistSquared(GetXY(Point), GetXY(AnchorPoint->GetActorLocation()));
+			if (DistanceSquared <= ClosestDistanceSquared)
+			{
+				ClosestDistanceSquared = DistanceSquared;
+				ClosestAnchorIndex = AnchorIndex;
+			}
+		}
+
+		return ClosestAnchorIndex;
+	}
+
+	FWorldDivisionPathEndpoints BuildPathEndpoints(const FVector& CurrentLocation,
+	                                               const FVector& TargetWorldPoint,
+	                                               const FWorldDivisionPathContext& PathContext,
+	                                               const FWorldDivisionPathSettings& PathSettings)
+	{
+		FWorldDivisionPathEndpoints Endpoints;
+		Endpoints.StartLocation = ProjectToValidMovePoint(
+			CurrentLocation,
+			PathContext.BoundaryPolygon,
+			PathContext.AnchorPoints,
+			PathSettings.AvoidanceRadius,
+			PathSettings.BoundaryPadding);
+		Endpoints.TargetLocation = ProjectToValidMovePoint(
+			TargetWorldPoint,
+			PathContext.BoundaryPolygon,
+			PathContext.AnchorPoints,
+			PathSettings.AvoidanceRadius,
+			PathSettings.BoundaryPadding);
+		if (PathSettings.AnchorRouteSnapRadius > 0.f)
+		{
+			Endpoints.StartAnchorIndex = FindClosestAnchorIndexWithinRadius(
+				CurrentLocation,
+				PathContext.AnchorPoints,
+				PathSettings.AnchorRouteSnapRadius);
+			Endpoints.TargetAnchorIndex = FindClosestAnchorIndexWithinRadius(
+				TargetWorldPoint,
+				PathContext.AnchorPoints,
+				PathSettings.AnchorRouteSnapRadius);
+		}
+
+		return Endpoints;
+	}
+
+	const TArray<FVector>& FindOrBuildAnchorRoute(FWorldDivisionPathContextCache& PathContextCache,
+	                                              const FWorldDivisionPathContext& PathContext,
+	                                              const FWorldDivisionPathSettings& PathSettings,
+	                                              const int32 StartAnchorIndex,
+	                                              const int32 TargetAnchorIndex)
+	{
+		const FIntPoint AnchorPair(StartAnchorIndex, TargetAnchorIndex);
+		if (const TArray<FVector>* CachedRoute = PathContextCache.RoutesByAnchorPair.Find(AnchorPair))
+		{
+			return *CachedRoute;
+		}
+
+		TArray<FVector>& Route = PathContextCache.RoutesByAnchorPair.Add(AnchorPair);
+		TArray<int32> AnchorChain;
+		if (not PathContextCache.AnchorGraph.BuildShortestPath(StartAnchorIndex, TargetAnchorIndex, AnchorChain))
+		{
+			return Route;
+		}
+
+		// Waypoints are the valid move points next to each anchor on the chain; repair routes between them.
+		Route.Reserve(AnchorChain.Num());
+		for (const int32 AnchorIndex : AnchorChain)
+		{
+			FVector AnchorLocation = PathContext.AnchorPoints[AnchorIndex]->GetActorLocation();
+			AnchorLocation.Z = 0.f;
+			Route.Add(ProjectToValidMovePoint(
+				AnchorLocation,
+				PathContext.BoundaryPolygon,
+				PathContext.AnchorPoints,
+				PathSettings.AvoidanceRadius,
+				PathSettings.BoundaryPadding));
+		}
+
+		RemoveDuplicatePathPoints(Route);
+		RepairPath(
+			Route,
+			PathContext.BoundaryPolygon,
+			PathContext.AnchorPoints,
+			PathSettings.AvoidanceRadius,
+			PathSettings.BoundaryPadding,
+			FMath::Max(FMath::Max(MinimumPathRepairAttemptCount, PathSettings.MaxRepairAttempts),
+			           PathContext.AnchorPoints.Num()));
+		if (Route.Num() < 2)
+		{
+			Route.Reset();
+		}
+
+		return Route;
+	}
+
+	void PrecomputeAnchorRoutes(FWorldDivisionPathContextCache& PathContextCache,
+	                            const FWorldDivisionPathContext& PathContext,
+	                            const FWorldDivisionPathSettings& PathSettings)
+	{
+		if (PathContext.AnchorPoints.Num() != PathContextCache.AnchorGraph.GetNumAnchors())
+		{
+			return;
+		}
+
+		for (int32 StartAnchorIndex = 0; StartAnchorIndex < PathContext.AnchorPoints.Num(); StartAnchorIndex++)
+		{
+			const TConstArrayView<int32> HopDistanceRow =
+				PathContextCache.AnchorGraph.GetHopDistanceRow(StartAnchorIndex);
+			for (int32 TargetAnchorIndex = 0; TargetAnchorIndex < HopDistanceRow.Num(); TargetAnchorIndex++)
+			{
+				// Unreachable pairs and the start itself never get a route, so they are not cached either.
+				if (HopDistanceRow[TargetAnchorIndex] > 0)
+				{
+					(void)FindOrBuildAnchorRoute(
+						PathContextCache,
+						PathContext,
+						PathSettings,
+						StartAnchorIndex,
+						TargetAnchorIndex);
+				}
+			}
+		}
+	}
+
+	bool GetDoesRouteConnectorRespectConstraints(const FVector& SegmentStart,
+	                                             const FVector& SegmentEnd,
+	                                             const FWorldDivisionPathContext& PathContext,
+	                                             const float AvoidanceRadius)
+	{
+		return GetDoesSegmentStayInsideBoundary(SegmentStart, SegmentEnd, PathContext.BoundaryPolygon)
+			&& GetDoesSegmentRespectAllAnchorAvoidance(SegmentStart, SegmentEnd, PathContext.AnchorPoints,
+			                                           AvoidanceRadius);
+	}
+
+	/**
+	 * Reuses the cached route between the anchors at both ends of the order. Only the short connectors from the
+	 * division to the route and from the route to the target are checked per order; when they would break campaign
+	 * constraints the caller falls back to a navigation path.
+	 */
+	bool TryBuildAnchorRoutePath(const UObject* WorldContextObject,
+	                             const FWorldDivisionPathEndpoints& Endpoints,
+	                             const FWorldDivisionPathContext& PathContext,
+	                             const FWorldDivisionPathSettings& PathSettings,
+	                             TArray<FVector>& OutPathPoints)
+	{
+		OutPathPoints.Reset();
+		if (Endpoints.StartAnchorIndex == INDEX_NONE || Endpoints.TargetAnchorIndex == INDEX_NONE
+			|| Endpoints.StartAnchorIndex == Endpoints.TargetAnchorIndex
+			|| not IsValid(WorldContextObject) || not IsValid(WorldContextObject->GetWorld()))
+		{
+			return false;
+		}
+
+		FWorldDivisionPathContextCache& PathContextCache =
+			FindOrAddWorldPathContextCache(*WorldContextObject->GetWorld());
+		const TArray<FVector>& Route = FindOrBuildAnchorRoute(
+			PathContextCache,
+			PathContext,
+			PathSettings,
+			Endpoints.StartAnchorIndex,
+			Endpoints.TargetAnchorIndex);
+		if (Route.Num() < 2)
+		{
+			return false;
+		}
+
+		OutPathPoints.Reserve(Route.Num() + 2);
+		OutPathPoints.Add(Endpoints.StartLocation);
+		OutPathPoints.Append(Route);
+		OutPathPoints.Add(Endpoints.TargetLocation);
+		for (FVector& PathPoint : OutPathPoints)
+		{
+			PathPoint.Z = Endpoints.StartLocation.Z;
+		}
+
+		RemoveDuplicatePathPoints(OutPathPoints);
+		if (OutPathPoints.Num() < 2
+			|| not GetDoesRouteConnectorRespectConstraints(OutPathPoints[0], OutPathPoints[1], PathContext,
+			                                               PathSettings.AvoidanceRadius)
+			|| not GetDoesRouteConnectorRespectConstraints(OutPathPoints[OutPathPoints.Num() - 2],
+			                                               OutPathPoints.Last(), PathContext,
+			                                               PathSettings.AvoidanceRadius))
+		{
+			OutPathPoints.Reset();
+			return false;
+		}
+
+		(void)TrySimplifyPathPoints(
+			OutPathPoints,
+			PathContext.BoundaryPolygon,
+			PathContext.AnchorPoints,
+			PathSettings.AvoidanceRadius);
+		return true;
+	}
+
+	TArray<FVector> BuildRepairedNavigationPath(const UWorld* World,
+	                                            const FWorldDivisionPathEndpoints& Endpoints,
+	                                            const FWorldDivisionPathContext& PathContext,
+	                                            const FWorldDivisionPathSettings& PathSettings,
+	                                            const TArray<FVector>& NavigationPathPoints)
+	{
+		TArray<FVector> PathPoints;
+		if (NavigationPathPoints.Num() >= 2)
+		{
+			PathPoints = NavigationPathPoints;
+			if constexpr (DeveloperSettings::Debugging::GWorldCampaign_DivisionPathing_Compile_DebugSymbols)
+			{
+				DebugDrawUnrealDivisionPath(World, PathPoints);
+			}
+		}
+		else
+		{
+			PathPoints.Add(Endpoints.StartLocation);
+			PathPoints.Add(Endpoints.TargetLocation);
+		}
+
+		for (FVector& PathPoint : PathPoints)
+		{
+			PathPoint.Z = Endpoints.StartLocation.Z;
+		}
+
+		PathPoints[0] = Endpoints.StartLocation;
+		PathPoints[PathPoints.Num() - 1] = Endpoints.TargetLocation;
+		RepairPath(
+			PathPoints,
+			PathContext.BoundaryPolygon,
+			PathContext.AnchorPoints,
+			PathSettings.AvoidanceRadius,
+			PathSettings.BoundaryPadding,
+			FMath::Max(FMath::Max(MinimumPathRepairAttemptCount, PathSettings.MaxRepairAttempts),
+			           PathContext.AnchorPoints.Num()));
+		if constexpr (DeveloperSettings::Debugging::GWorldCampaign_DivisionPathing_Compile_DebugSymbols)
+		{
+			DebugDrawAdjustedDivisionPath(World, PathPoints);
+		}
+
+		return PathPoints;
+	}
 }
 
 AWorldDivisionBase::AWorldDivisionBase()
@@ -2457,6 +2781,8 @@ void AWorldDivisionBase::RestoreWorldDivisionSaveData(const FWorldDivisionSaveDa
 	M_CurrentPathPointIndex = DivisionSaveData.CurrentPathPointIndex;
 	bM_HasPendingMoveOrder = DivisionSaveData.bHasPendingMoveOrder
 		&& M_PathPoints.IsValidIndex(M_CurrentPathPointIndex);
+	// Orders saved before their turn-end path batch ran have a target but no path.
+	bM_IsAwaitingPath = DivisionSaveData.bHasPendingMoveOrder && M_PathPoints.IsEmpty();
 	SetActorLocation(DivisionSaveData.Location);
 	RestoreSubtypeSaveData(DivisionSaveData);
 }
@@ -2472,14 +2798,112 @@ FWorldDivisionSaveData AWorldDivisionBase::BuildWorldDivisionSaveData() const
 	DivisionSaveData.TargetLocation = M_PendingTargetLocation;
 	DivisionSaveData.PathPoints = M_PathPoints;
 	DivisionSaveData.CurrentPathPointIndex = M_CurrentPathPointIndex;
-	DivisionSaveData.bHasPendingMoveOrder = bM_HasPendingMoveOrder;
+	DivisionSaveData.bHasPendingMoveOrder = bM_HasPendingMoveOrder || bM_IsAwaitingPath;
 	FillSubtypeSaveData(DivisionSaveData);
 	return DivisionSaveData;
 }
 
 bool AWorldDivisionBase::IssueMoveOrderToPoint(const FVector& TargetWorldPoint)
 {
-	const TArray<FVector> PathPoints = BuildPathToTargetPoint(TargetWorldPoint);
+	SetAwaitingPathTarget(TargetWorldPoint);
+	(void)TryResolveAwaitingPathFromAnchorRoute();
+	return true;
+}
+
+bool AWorldDivisionBase::IssueMoveOrderToPointImmediately(const FVector& TargetWorldPoint)
+{
+	const TArray<FVector> PathPoints = BuildPathToTargetPointSynchronously(TargetWorldPoint);
+	if (PathPoints.Num() < 2)
+	{
+		return false;
+	}
+
+	CachePendingMoveOrder(PathPoints.Last(), PathPoints);
+	return true;
+}
+
+bool AWorldDivisionBase::TryResolveAwaitingPathFromAnchorRoute()
+{
+	if (not bM_IsAwaitingPath)
+	{
+		return false;
+	}
+
+	const FWorldDivisionPathSettings PathSettings = GetWorldDivisionPathSettings();
+	const FWorldDivisionPathContext PathContext = BuildWorldDivisionPathContext(this);
+	const FWorldDivisionPathEndpoints Endpoints = BuildPathEndpoints(
+		GetActorLocation(),
+		M_PendingTargetLocation,
+		PathContext,
+		PathSettings);
+
+	TArray<FVector> PathPoints;
+	if (not TryBuildAnchorRoutePath(this, Endpoints, PathContext, PathSettings, PathPoints)
+		|| PathPoints.Num() < 2)
+	{
+		return false;
+	}
+
+	CachePendingMoveOrder(PathPoints.Last(), PathPoints);
+	return true;
+}
+
+uint32 AWorldDivisionBase::RequestNavigationPathAsync(const FNavPathQueryDelegate& OnPathFound) const
+{
+	UWorld* World = GetWorld();
+	UNavigationSystemV1* NavigationSystem = IsValid(World) ? UNavigationSystemV1::GetCurrent(World) : nullptr;
+	const ANavigationData* NavigationData = IsValid(NavigationSystem)
+		                                        ? NavigationSystem->GetDefaultNavDataInstance(
+			                                        FNavigationSystem::DontCreate)
+		                                        : nullptr;
+	if (not bM_IsAwaitingPath || not IsValid(NavigationData))
+	{
+		return INVALID_NAVQUERYID;
+	}
+
+	const FWorldDivisionPathEndpoints Endpoints = BuildPathEndpoints(
+		GetActorLocation(),
+		M_PendingTargetLocation,
+		BuildWorldDivisionPathContext(this),
+		GetWorldDivisionPathSettings());
+	const FPathFindingQuery PathQuery(
+		this,
+		*NavigationData,
+		Endpoints.StartLocation,
+		Endpoints.TargetLocation,
+		UNavigationQueryFilter::GetQueryFilter(*NavigationData, this, nullptr));
+	return NavigationSystem->FindPathAsync(
+		FNavAgentProperties::DefaultProperties,
+		PathQuery,
+		OnPathFound,
+		EPathFindingMode::Regular);
+}
+
+bool AWorldDivisionBase::ResolveAwaitingPath(const TArray<FVector>& NavigationPathPoints)
+{
+	if (not bM_IsAwaitingPath)
+	{
+		return false;
+	}
+
+	/*
+	 * The endpoints are projected again instead of reusing the ones sent with the query, so the cached order always
+	 * starts at the current location.
+	 */
+	bM_IsAwaitingPath = false;
+	const FWorldDivisionPathSettings PathSettings = GetWorldDivisionPathSettings();
+	const FWorldDivisionPathContext PathContext = BuildWorldDivisionPathContext(this);
+	const FWorldDivisionPathEndpoints Endpoints = BuildPathEndpoints(
+		GetActorLocation(),
+		M_PendingTargetLocation,
+		PathContext,
+		PathSettings);
+	const TArray<FVector> PathPoints = BuildRepairedNavigationPath(
+		GetWorld(),
+		Endpoints,
+		PathContext,
+		PathSettings,
+		NavigationPathPoints);
 	if (PathPoints.Num() < 2)
 	{
 		return false;
@@ -2489,6 +2913,30 @@ bool AWorldDivisionBase::IssueMoveOrderToPoint(const FVector& TargetWorldPoint)
 	return true;
 }
 
+void AWorldDivisionBase::ResetCampaignPathCache(const UWorld* World)
+{
+	GetWorldDivisionPathContextCaches().RemoveAll([World](const FWorldDivisionPathContextCache& PathContextCache)
+	{
+		return not PathContextCache.World.IsValid() || PathContextCache.World.Get() == World;
+	});
+
+	const FWorldDivisionPathSettings PathSettings = GetWorldDivisionPathSettings();
+	if (not IsValid(World) || PathSettings.AnchorRouteSnapRadius <= 0.f)
+	{
+		return;
+	}
+
+	/*
+	 * Routes between all connected anchors are built here, once per campaign generation or load, so turn orders
+	 * between anchors only read the cache.
+	 */
+	const FWorldDivisionPathContext PathContext = BuildWorldDivisionPathContext(World);
+	PrecomputeAnchorRoutes(
+		FindOrAddWorldPathContextCache(*const_cast<UWorld*>(World)),
+		PathContext,
+		PathSettings);
+}
+
 void AWorldDivisionBase::AdvanceTurn()
 {
 	/*
@@ -2510,7 +2958,7 @@ void AWorldDivisionBase::AdvanceTurn()
 		|| FVector2D::DistSquared(GetXY(M_PendingTargetLocation), GetXY(AdvanceTurnTargetLocation))
 		> AdvanceTurnTargetReachedDistanceSquared)
 	{
-		if (not IssueMoveOrderToPoint(AdvanceTurnTargetLocation))
+		if (not IssueMoveOrderToPointImmediately(AdvanceTurnTargetLocation))
 		{
 			return;
 		}
@@ -2535,7 +2983,7 @@ void AWorldDivisionBase::DebugPath()
 	 */
 	if (not AdvanceTurnTargetLocation.IsNearlyZero(AdvanceTurnTargetNearlyZeroTolerance))
 	{
-		PathPoints = BuildPathToTargetPoint(AdvanceTurnTargetLocation);
+		PathPoints = BuildPathToTargetPointSynchronously(AdvanceTurnTargetLocation);
 	}
 	else if (bM_HasPendingMoveOrder && M_PathPoints.IsValidIndex(M_CurrentPathPointIndex))
 	{
@@ -2742,79 +3190,41 @@ bool AWorldDivisionBase::GetIsAdvanceTurnTargetReached() const
 		<= AdvanceTurnTargetReachedDistanceSquared;
 }
 
-TArray<FVector> AWorldDivisionBase::BuildPathToTargetPoint(const FVector& TargetWorldPoint) const
+TArray<FVector> AWorldDivisionBase::BuildPathToTargetPointSynchronously(const FVector& TargetWorldPoint) const
 {
 	/*
-	 * The division asks Unreal navigation first, but the campaign map has extra rules that normal nav data may not know
-	 * about: anchor standoff circles and AWorldSplineBoundary containment. Those are applied after the nav query.
+	 * Orders between two anchors reuse the cached route along the connection graph. Other orders ask Unreal
+	 * navigation first, but the campaign map has extra rules that normal nav data may not know about: anchor standoff
+	 * circles and AWorldSplineBoundary containment. Those are applied after the nav query.
 	 */
-	const UWorldCampaignSettings* Settings = UWorldCampaignSettings::Get();
-	const float AvoidanceRadius = IsValid(Settings) ? Settings->WorldDivisionAnchorAvoidanceRadius : 0.f;
-	const float BoundaryPadding = IsValid(Settings) ? Settings->WorldDivisionBoundaryProjectionPadding : 0.f;
-	const int32 MaxRepairAttempts = IsValid(Settings) ? Settings->WorldDivisionPathRepairMaxAttempts : 1;
-
+	const FWorldDivisionPathSettings PathSettings = GetWorldDivisionPathSettings();
 	const FWorldDivisionPathContext PathContext = BuildWorldDivisionPathContext(this);
-	const TArray<AAnchorPoint*>& AnchorPoints = PathContext.AnchorPoints;
-	const TArray<FVector2D>& BoundaryPolygon = PathContext.BoundaryPolygon;
-	const FVector StartLocation = ProjectToValidMovePoint(
+	const FWorldDivisionPathEndpoints Endpoints = BuildPathEndpoints(
 		GetActorLocation(),
-		BoundaryPolygon,
-		AnchorPoints,
-		AvoidanceRadius,
-		BoundaryPadding);
-	const FVector TargetLocation = ProjectToValidMovePoint(
 		TargetWorldPoint,
-		BoundaryPolygon,
-		AnchorPoints,
-		AvoidanceRadius,
-		BoundaryPadding);
+		PathContext,
+		PathSettings);
 
 	TArray<FVector> PathPoints;
-	if (UWorld* World = GetWorld())
-	{
-		UNavigationSystemV1* NavigationSystem = UNavigationSystemV1::GetCurrent(World);
-		UNavigationPath* NavigationPath = IsValid(NavigationSystem)
-			                                  ? UNavigationSystemV1::FindPathToLocationSynchronously(
-				                                  const_cast<AWorldDivisionBase*>(this),
-				                                  StartLocation,
-				                                  TargetLocation)
-			                                  : nullptr;
-		if (IsValid(NavigationPath) && NavigationPath->PathPoints.Num() >= 2)
-		{
-			PathPoints = NavigationPath->PathPoints;
-			if constexpr (DeveloperSettings::Debugging::GWorldCampaign_DivisionPathing_Compile_DebugSymbols)
-			{
-				DebugDrawUnrealDivisionPath(World, PathPoints);
-			}
-		}
-	}
-
-	if (PathPoints.Num() < 2)
-	{
-		PathPoints.Add(StartLocation);
-		PathPoints.Add(TargetLocation);
-	}
-
-	for (FVector& PathPoint : PathPoints)
+	if (TryBuildAnchorRoutePath(this, Endpoints, PathContext, PathSettings, PathPoints))
 	{
-		PathPoint.Z = StartLocation.Z;
+		return PathPoints;
 	}
 
-	PathPoints[0] = StartLocation;
-	PathPoints[PathPoints.Num() - 1] = TargetLocation;
-	RepairPath(
-		PathPoints,
-		BoundaryPolygon,
-		AnchorPoints,
-		AvoidanceRadius,
-		BoundaryPadding,
-		FMath::Max(FMath::Max(MinimumPathRepairAttemptCount, MaxRepairAttempts), AnchorPoints.Num()));
-	if constexpr (DeveloperSettings::Debugging::GWorldCampaign_DivisionPathing_Compile_DebugSymbols)
+	UWorld* World = GetWorld();
+	UNavigationSystemV1* NavigationSystem = IsValid(World) ? UNavigationSystemV1::GetCurrent(World) : nullptr;
+	UNavigationPath* NavigationPath = IsValid(NavigationSystem)
+		                                  ? UNavigationSystemV1::FindPathToLocationSynchronously(
+			                                  const_cast<AWorldDivisionBase*>(this),
+			                                  Endpoints.StartLocation,
+			                                  Endpoints.TargetLocation)
+		                                  : nullptr;
+	if (IsValid(NavigationPath))
 	{
-		DebugDrawAdjustedDivisionPath(GetWorld(), PathPoints);
+		PathPoints = NavigationPath->PathPoints;
 	}
 
-	return PathPoints;
+	return BuildRepairedNavigationPath(World, Endpoints, PathContext, PathSettings, PathPoints);
 }
 
 void AWorldDivisionBase::DrawDebugPathPoints(const TArray<FVector>& PathPoints) const
@@ -2822,9 +3232,19 @@ void AWorldDivisionBase::DrawDebugPathPoints(const TArray<FVector>& PathPoints)
 	DrawDebugPathPointsWithOffset(GetWorld(), PathPoints, FColor::Cyan, DebugPathLineThickness);
 }
 
+void AWorldDivisionBase::SetAwaitingPathTarget(const FVector& TargetWorldPoint)
+{
+	M_PendingTargetLocation = TargetWorldPoint;
+	M_PathPoints.Reset();
+	M_CurrentPathPointIndex = 0;
+	bM_HasPendingMoveOrder = false;
+	bM_IsAwaitingPath = true;
+}
+
 void AWorldDivisionBase::CachePendingMoveOrder(const FVector& TargetWorldPoint,
                                                const TArray<FVector>& PathPoints)
 {
+	bM_IsAwaitingPath = false;
 	M_PendingTargetLocation = TargetWorldPoint;
 	M_PathPoints = PathPoints;
 	M_CurrentPathPointIndex = M_PathPoints.Num() >= 2 ? 1 : 0;
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "NavigationData.h"
 #include "RTS_Survival/Subsystems/RadiusSubsystem/ERTSRadiusType.h"
 #include "RTS_Survival/WorldCampaign/SaveAndState/SaveData/FWorldCampaignState.h"
 #include "RTS_Survival/WorldCampaign/StrengthTypes/WorldStrengthTypes.h"
@@ -62,13 +63,51 @@ public:
 	FWorldDivisionSaveData BuildWorldDivisionSaveData() const;
 
 	/**
-	 * @brief Builds and stores a point-targeted path that can be consumed over future turns.
+	 * @brief Stores a point-targeted order that can be consumed over future turns without blocking on the navmesh.
+	 * Orders between anchors take the cached anchor route right away; other orders wait for the owner's turn-end
+	 * path batch in UWorldDivisionManager.
 	 * @param TargetWorldPoint Arbitrary world-space point, not an anchor.
-	 * @return true when a usable path with at least one segment was cached.
+	 * @return true when the order was cached or is waiting on the path batch.
 	 */
 	UFUNCTION(BlueprintCallable, Category="World Campaign|World Divisions")
 	bool IssueMoveOrderToPoint(const FVector& TargetWorldPoint);
 
+	/**
+	 * @brief Builds and stores a point-targeted path right away, querying the navmesh synchronously if needed.
+	 * @param TargetWorldPoint Arbitrary world-space point, not an anchor.
+	 * @return true when a usable path with at least one segment was cached.
+	 * @note For debug commands and pathing validation that inspect the path immediately; turn orders use
+	 * IssueMoveOrderToPoint.
+	 */
+	bool IssueMoveOrderToPointImmediately(const FVector& TargetWorldPoint);
+
+	/**
+	 * @brief Caches the pending order along the cached anchor route when the division and target are near anchors.
+	 * @return false when no anchor route applies; the order keeps waiting for a navigation path.
+	 */
+	bool TryResolveAwaitingPathFromAnchorRoute();
+
+	/**
+	 * @brief Starts an async navmesh query from the projected division location to the pending order target.
+	 * @param OnPathFound Called on the game thread once the query finished.
+	 * @return Query id, or INVALID_NAVQUERYID when no navigation data is available.
+	 */
+	uint32 RequestNavigationPathAsync(const FNavPathQueryDelegate& OnPathFound) const;
+
+	/**
+	 * @brief Repairs a navigation path against campaign constraints and caches it for the pending order.
+	 * @param NavigationPathPoints Raw navmesh points; fewer than two falls back to a straight line to the target.
+	 * @return true when a usable path with at least one segment was cached; the order stops waiting either way.
+	 */
+	bool ResolveAwaitingPath(const TArray<FVector>& NavigationPathPoints);
+
+	/**
+	 * @brief Rebuilds the cached anchors and boundary of the world and precomputes the routes between all
+	 * connected anchor pairs.
+	 * @note Call after campaign generation or load spawned a new set of anchors.
+	 */
+	static void ResetCampaignPathCache(const UWorld* World);
+
 	/**
 	 * @brief Editor/debug command that consumes one turn of movement toward AdvanceTurnTargetLocation.
 	 * @note Applies movement immediately so it works from CallInEditor without relying on ticking.
@@ -116,6 +155,7 @@ public:
 	EWorldFieldDivisions GetDivisionType() const { return M_DivisionType; }
 	int32 GetOwningPlayer() const { return M_OwningPlayer; }
 	bool GetHasPendingMoveOrder() const { return bM_HasPendingMoveOrder; }
+	bool GetIsAwaitingPath() const { return bM_IsAwaitingPath; }
 
 	/**
 	 * @brief Checks whether this division is currently playing turn movement interpolation.
@@ -227,6 +267,11 @@ private:
 		meta=(AllowPrivateAccess="true"))
 	bool bM_HasPendingMoveOrder = false;
 
+	// The pending order has a target but no path yet; it is resolved in the owner's turn-end path batch.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="World Campaign|World Divisions",
+		meta=(AllowPrivateAccess="true"))
+	bool bM_IsAwaitingPath = false;
+
 	FWorldDivisionStrengthChangedDelegate M_OnDivisionStrengthChanged;
 
 	/**
@@ -251,10 +296,17 @@ private:
 
 	/**
 	 * @brief Builds a world-space Unreal path to a point, then repairs it against campaign constraints.
-	 * @param TargetWorldPoint Arbitrary world point requested by code, Blueprint, or editor testing.
+	 * @param TargetWorldPoint Arbitrary world point requested by debug commands or pathing validation.
 	 * @return Path points clamped inside the boundary and routed around anchors where possible.
+	 * @note Blocks on the navmesh for off-graph targets; never use it for turn orders.
+	 */
+	TArray<FVector> BuildPathToTargetPointSynchronously(const FVector& TargetWorldPoint) const;
+
+	/**
+	 * @brief Records a target whose path is resolved later and drops the previous path.
+	 * @param TargetWorldPoint Arbitrary world-space point, not an anchor.
 	 */
-	TArray<FVector> BuildPathToTargetPoint(const FVector& TargetWorldPoint) const;
+	void SetAwaitingPathTarget(const FVector& TargetWorldPoint);
 
 	/**
 	 * @brief Renders world-space path segments with fixed editor debug styling.
@@ -152,6 +152,7 @@ void UWorldDivisionManager::InitializeNewCampaignDivisions(AWorldPlayerControlle
 	}
 
 	DestroyRegisteredDivisions();
+	AWorldDivisionBase::ResetCampaignPathCache(GetWorld());
 	SpawnInitialDivisions(GameDifficulty);
 	RefreshDivisionInfluence(GameDifficulty);
 	CacheDivisionSaveState();
@@ -168,6 +169,7 @@ void UWorldDivisionManager::RestoreSavedCampaignDivisions(AWorldPlayerController
 	}
 
 	DestroyRegisteredDivisions();
+	AWorldDivisionBase::ResetCampaignPathCache(GetWorld());
 	SpawnSavedDivisions(GameDifficulty, DivisionSaveData);
 	RefreshDivisionInfluence(GameDifficulty);
 	CacheDivisionSaveState();
@@ -283,12 +285,14 @@ bool UWorldDivisionManager::IssueMoveOrderToDivision(AWorldDivisionBase* WorldDi
 		return false;
 	}
 
+	DiscardPendingPathQueries(WorldDivision);
 	const bool bIssuedMoveOrder = WorldDivision->IssueMoveOrderToPoint(TargetLocation);
 	if (bIssuedMoveOrder)
 	{
 		CacheDivisionSaveState();
 	}
 
+	StartTurnMovementIfPathsResolved();
 	return bIssuedMoveOrder;
 }
 
@@ -335,6 +339,8 @@ void UWorldDivisionManager::DestroyRegisteredDivisions()
 	}
 
 	M_WorldDivisions.Reset();
+	DiscardPendingPathQueries(nullptr);
+	bM_IsResolvingTurnPaths = false;
 }
 
 void UWorldDivisionManager::SpawnInitialDivisions(const ERTSGameDifficulty GameDifficulty)
@@ -501,7 +507,55 @@ void UWorldDivisionManager::MoveDivisionsForOwner(const int32 OwningPlayer,
 	M_ActiveMovingTurn = TurnType;
 	M_ActiveMovementDifficulty = GameDifficulty;
 	M_ActiveTurnMovementCount = 0;
+	M_ActiveMovingOwner = OwningPlayer;
 
+	bM_IsResolvingTurnPaths = ResolveAwaitingPathsForOwner(OwningPlayer);
+	if (bM_IsResolvingTurnPaths)
+	{
+		return;
+	}
+
+	StartActiveTurnMovement();
+}
+
+bool UWorldDivisionManager::ResolveAwaitingPathsForOwner(const int32 OwningPlayer)
+{
+	/*
+	 * Off-graph orders are resolved here instead of when they are issued, so a turn with many orders costs one batch
+	 * of async navmesh queries rather than a blocking query per order.
+	 */
+	DiscardPendingPathQueries(nullptr);
+	for (const TObjectPtr<AWorldDivisionBase>& WorldDivision : M_WorldDivisions)
+	{
+		if (not IsValid(WorldDivision)
+			|| WorldDivision->GetOwningPlayer() != OwningPlayer
+			|| not WorldDivision->GetIsAwaitingPath())
+		{
+			continue;
+		}
+
+		if (WorldDivision->TryResolveAwaitingPathFromAnchorRoute())
+		{
+			continue;
+		}
+
+		const uint32 QueryId = WorldDivision->RequestNavigationPathAsync(
+			FNavPathQueryDelegate::CreateUObject(this, &UWorldDivisionManager::OnDivisionNavigationPathFound));
+		if (QueryId != INVALID_NAVQUERYID)
+		{
+			M_PendingPathQueries.Add(QueryId, WorldDivision.Get());
+			continue;
+		}
+
+		// Without navigation data the order still gets a campaign-repaired straight line.
+		(void)WorldDivision->ResolveAwaitingPath(TArray<FVector>());
+	}
+
+	return not M_PendingPathQueries.IsEmpty();
+}
+
+void UWorldDivisionManager::StartActiveTurnMovement()
+{
 	/*
 	 * Movement is allowed only for the active owner, but completion is asynchronous because the movement component
 	 * interpolates visually. The manager counts started movements and performs save/influence work after all callbacks.
@@ -509,7 +563,7 @@ void UWorldDivisionManager::MoveDivisionsForOwner(const int32 OwningPlayer,
 	for (const TObjectPtr<AWorldDivisionBase>& WorldDivision : M_WorldDivisions)
 	{
 		if (not IsValid(WorldDivision)
-			|| WorldDivision->GetOwningPlayer() != OwningPlayer
+			|| WorldDivision->GetOwningPlayer() != M_ActiveMovingOwner
 			|| not WorldDivision->GetHasPendingMoveOrder())
 		{
 			continue;
@@ -558,6 +612,57 @@ void UWorldDivisionManager::OnDivisionMovementFinished(AWorldDivisionBase* World
 	FinishActiveTurnMovement();
 }
 
+void UWorldDivisionManager::OnDivisionNavigationPathFound(const uint32 QueryId,
+                                                          const ENavigationQueryResult::Type QueryResult,
+                                                          FNavPathSharedPtr NavigationPath)
+{
+	TWeakObjectPtr<AWorldDivisionBase> WorldDivision;
+	if (not M_PendingPathQueries.RemoveAndCopyValue(QueryId, WorldDivision))
+	{
+		return;
+	}
+
+	if (WorldDivision.IsValid())
+	{
+		TArray<FVector> NavigationPathPoints;
+		if (QueryResult == ENavigationQueryResult::Success && NavigationPath.IsValid())
+		{
+			const TArray<FNavPathPoint>& PathPoints = NavigationPath->GetPathPoints();
+			NavigationPathPoints.Reserve(PathPoints.Num());
+			for (const FNavPathPoint& PathPoint : PathPoints)
+			{
+				NavigationPathPoints.Add(PathPoint.Location);
+			}
+		}
+
+		(void)WorldDivision->ResolveAwaitingPath(NavigationPathPoints);
+	}
+
+	StartTurnMovementIfPathsResolved();
+}
+
+void UWorldDivisionManager::DiscardPendingPathQueries(const AWorldDivisionBase* WorldDivision)
+{
+	for (auto It = M_PendingPathQueries.CreateIterator(); It; ++It)
+	{
+		if (WorldDivision == nullptr || It.Value().Get() == WorldDivision)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void UWorldDivisionManager::StartTurnMovementIfPathsResolved()
+{
+	if (not bM_IsResolvingTurnPaths || not M_PendingPathQueries.IsEmpty())
+	{
+		return;
+	}
+
+	bM_IsResolvingTurnPaths = false;
+	StartActiveTurnMovement();
+}
+
 void UWorldDivisionManager::OnDivisionStrengthChanged(AWorldDivisionBase* WorldDivision)
 {
 	if (not IsValid(WorldDivision))
@@ -600,6 +705,7 @@ void UWorldDivisionManager::FinishActiveTurnMovement()
 
 	M_ActiveMovingTurn = EWorldTurnType::None;
 	M_ActiveTurnMovementCount = 0;
+	M_ActiveMovingOwner = INDEX_NONE;
 }
 
 bool UWorldDivisionManager::GetIsValidWorldPlayerController() const
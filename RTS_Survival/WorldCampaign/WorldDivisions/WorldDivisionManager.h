@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "NavigationData.h"
 #include "RTS_Survival/Game/Difficulty/GameDifficulty.h"
 #include "RTS_Survival/WorldCampaign/CampaignGeneration/Enums/Turn/WorldTurnType.h"
 #include "RTS_Survival/WorldCampaign/SaveAndState/SaveData/FWorldCampaignState.h"
@@ -74,7 +75,7 @@ public:
 	 * @brief Issues a point-targeted move order to one registered or externally selected division.
 	 * @param WorldDivision Division actor that should receive the move order.
 	 * @param TargetLocation Arbitrary world-space point, not an anchor.
-	 * @return true when the division accepted and cached a path.
+	 * @return true when the division cached a path or queued the order for its turn-end path batch.
 	 */
 	UFUNCTION(BlueprintCallable, Category="World Campaign|World Divisions")
 	bool IssueMoveOrderToDivision(AWorldDivisionBase* WorldDivision, const FVector& TargetLocation);
@@ -103,6 +104,13 @@ private:
 	ERTSGameDifficulty M_CurrentGameDifficulty = ERTSGameDifficulty::Normal;
 	ERTSGameDifficulty M_ActiveMovementDifficulty = ERTSGameDifficulty::Normal;
 	int32 M_ActiveTurnMovementCount = 0;
+	int32 M_ActiveMovingOwner = INDEX_NONE;
+
+	// Async navigation queries of the active turn's path batch by query id.
+	TMap<uint32, TWeakObjectPtr<AWorldDivisionBase>> M_PendingPathQueries;
+
+	// The active turn waits for M_PendingPathQueries before its divisions start moving.
+	bool bM_IsResolvingTurnPaths = false;
 
 	/**
 	 * @brief Caches required runtime references before spawning, restoring, or moving divisions.
@@ -169,12 +177,43 @@ private:
 
 	/**
 	 * @brief Starts one side's turn-end movement for all matching divisions with pending orders.
+	 * Orders still waiting for a path are resolved first; movement starts once their navigation queries completed.
 	 * @param OwningPlayer Owner id to move this turn.
 	 * @param TurnType Turn type stored while waiting for movement callbacks.
 	 * @param GameDifficulty Difficulty used after movement to refresh influence.
 	 */
 	void MoveDivisionsForOwner(int32 OwningPlayer, EWorldTurnType TurnType, ERTSGameDifficulty GameDifficulty);
 
+	/**
+	 * @brief Resolves the orders of the owner's divisions that still wait for a path as one batch.
+	 * Cached anchor routes are read right away; off-graph targets start async navigation queries.
+	 * @param OwningPlayer Owner id whose divisions are resolved.
+	 * @return true when navigation queries are pending and turn movement has to wait for them.
+	 */
+	bool ResolveAwaitingPathsForOwner(int32 OwningPlayer);
+
+	/**
+	 * @brief Starts interpolated movement for the active owner's divisions with pending orders.
+	 */
+	void StartActiveTurnMovement();
+
+	/**
+	 * @brief Caches the repaired navigation path of a batched order and starts the waiting turn movement once no
+	 * queries are pending.
+	 */
+	void OnDivisionNavigationPathFound(uint32 QueryId,
+	                                   ENavigationQueryResult::Type QueryResult,
+	                                   FNavPathSharedPtr NavigationPath);
+
+	/**
+	 * @brief Forgets pending path queries of a division so a newer order is not overwritten by a late result.
+	 * @param WorldDivision Division that received a new order; nullptr forgets every pending query.
+	 */
+	void DiscardPendingPathQueries(const AWorldDivisionBase* WorldDivision);
+
+	/** @brief Starts the turn movement that waits on the path batch once no queries are pending. */
+	void StartTurnMovementIfPathsResolved();
+
 	/**
 	 * @brief Receives movement-component completion callbacks and finishes the turn pass when all are done.
 	 * @param WorldDivision Division whose visual movement just finished.
@@ -2,6 +2,7 @@
 
 #include "WorldFowManager.h"
 
+#include "Async/ParallelFor.h"
 #include "Containers/Queue.h"
 #include "Components/MeshComponent.h"
 #include "DrawDebugHelpers.h"
@@ -10,6 +11,7 @@
 #include "Materials/MaterialInstanceDynamic.h"
 #include "RTS_Survival/DeveloperSettings.h"
 #include "RTS_Survival/Utils/HFunctionLibary.h"
+#include "RTS_Survival/Utils/TextureRegionUpload/FRTSTextureRegionUpload.h"
 #include "RTS_Survival/WorldCampaign/CampaignGeneration/GeneratorWorldCampaign/GeneratorWorldCampaign.h"
 #include "RTS_Survival/WorldCampaign/WorldFow/WorldFowCloud.h"
 #include "RTS_Survival/WorldCampaign/WorldFow/WorldMapFowComponent.h"
@@ -40,6 +42,9 @@ namespace WorldFowMaskConstants
 	constexpr int32 MaximumLineRasterizationSamples = 128;
 	constexpr int32 MinimumMaskResolution = 8;
 	constexpr float HalfUVOffset = 0.5f;
+	// Dirty rectangles smaller than this are rasterized on the game thread; larger ones in parallel row bands.
+	constexpr int32 MinimumPixelsForParallelRasterization = 64 * 64;
+	constexpr int32 RasterizationRowsPerBand = 16;
 }
 
 AWorldFowManager::AWorldFowManager()
@@ -65,6 +70,8 @@ void AWorldFowManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
 	M_WorldFowCloud.Reset();
 	M_MaskTexture = nullptr;
 	M_MaskPixels.Empty();
+	M_MaskStamps.Empty();
+	M_DirtyMaskRects.Empty();
 	M_AnchorStates.Empty();
 
 	Super::EndPlay(EndPlayReason);
@@ -619,14 +626,34 @@ void AWorldFowManager::RebuildMaskTexture()
 {
 	M_MaskResolution = FMath::Max(M_MaskResolution, WorldFowMaskConstants::MinimumMaskResolution);
 	const int32 PixelCount = M_MaskResolution * M_MaskResolution;
-	M_MaskPixels.Init(FColor::Black, PixelCount);
 
-	StampAnchorsToMask();
-	StampConnectionsToMask();
-	StampWorldObjectsToMask();
+	TMap<FObjectKey, FWorldFowMaskStamp> NewStamps;
+	CollectAnchorMaskStamps(NewStamps);
+	CollectConnectionMaskStamps(NewStamps);
+	CollectWorldObjectMaskStamps(NewStamps);
+
+	if (M_MaskPixels.Num() != PixelCount)
+	{
+		// Resolution changed or first build: every stamp has to be rasterized into a fresh mask.
+		M_MaskPixels.Init(FColor::Black, PixelCount);
+		M_MaskStamps.Reset();
+		M_DirtyMaskRects.Reset();
+		M_DirtyMaskRects.Add(FIntRect(0, 0, M_MaskResolution, M_MaskResolution));
+	}
+	else
+	{
+		MarkChangedMaskStampsDirty(NewStamps);
+	}
+
+	M_MaskStamps = MoveTemp(NewStamps);
+	MergeDirtyMaskRects();
+	for (const FIntRect& DirtyRect : M_DirtyMaskRects)
+	{
+		RasterizeDirtyMaskRect(DirtyRect);
+	}
 }
 
-void AWorldFowManager::StampAnchorsToMask()
+void AWorldFowManager::CollectAnchorMaskStamps(TMap<FObjectKey, FWorldFowMaskStamp>& OutStamps) const
 {
 	const FWorldCampaignPlacementState& PlacementState = M_WorldGenerator->GetPlacementState();
 	for (const TObjectPtr<AAnchorPoint>& AnchorPoint : PlacementState.CachedAnchors)
@@ -643,16 +670,19 @@ void AWorldFowManager::StampAnchorsToMask()
 			continue;
 		}
 
-		StampCircle(
+		FWorldFowMaskStamp Stamp;
+		Stamp.ChannelIndex = ChannelIndex;
+		AddCircleToStamp(
 			AnchorPoint->GetActorLocation(),
 			FowComponent->GetRevealRadiusForCurrentState(),
 			FowComponent->GetRevealFalloffForCurrentState(),
-			ChannelIndex
+			Stamp
 		);
+		OutStamps.Add(FObjectKey(AnchorPoint.Get()), MoveTemp(Stamp));
 	}
 }
 
-void AWorldFowManager::StampConnectionsToMask()
+void AWorldFowManager::CollectConnectionMaskStamps(TMap<FObjectKey, FWorldFowMaskStamp>& OutStamps) const
 {
 	const FWorldCampaignPlacementState& PlacementState = M_WorldGenerator->GetPlacementState();
 	for (const TObjectPtr<AConnection>& Connection : PlacementState.CachedConnections)
@@ -662,18 +692,31 @@ void AWorldFowManager::StampConnectionsToMask()
 			continue;
 		}
 
+		const int32 ChannelIndex = GetMaskChannelForComponent(Connection->GetFowComponent());
+		if (ChannelIndex == WorldFowMaskConstants::NoMaskChannelIndex)
+		{
+			continue;
+		}
+
+		FWorldFowMaskStamp Stamp;
+		Stamp.ChannelIndex = ChannelIndex;
 		const TArray<TObjectPtr<AAnchorPoint>>& ConnectedAnchors = Connection->GetConnectedAnchors();
-		StampConnectionSegment(Connection, ConnectedAnchors.IsValidIndex(0) ? ConnectedAnchors[0].Get() : nullptr,
-			ConnectedAnchors.IsValidIndex(1) ? ConnectedAnchors[1].Get() : nullptr);
+		AddConnectionSegmentToStamp(Connection, ConnectedAnchors.IsValidIndex(0) ? ConnectedAnchors[0].Get() : nullptr,
+			ConnectedAnchors.IsValidIndex(1) ? ConnectedAnchors[1].Get() : nullptr, Stamp);
 
 		if (ConnectedAnchors.IsValidIndex(2))
 		{
-			StampConnectionSegment(Connection, ConnectedAnchors[2].Get(), nullptr);
+			AddConnectionSegmentToStamp(Connection, ConnectedAnchors[2].Get(), nullptr, Stamp);
+		}
+
+		if (not Stamp.Circles.IsEmpty())
+		{
+			OutStamps.Add(FObjectKey(Connection.Get()), MoveTemp(Stamp));
 		}
 	}
 }
 
-void AWorldFowManager::StampWorldObjectsToMask()
+void AWorldFowManager::CollectWorldObjectMaskStamps(TMap<FObjectKey, FWorldFowMaskStamp>& OutStamps) const
 {
 	const FWorldCampaignPlacementState& PlacementState = M_WorldGenerator->GetPlacementState();
 	for (const TObjectPtr<AAnchorPoint>& AnchorPoint : PlacementState.CachedAnchors)
@@ -695,12 +738,150 @@ void AWorldFowManager::StampWorldObjectsToMask()
 			continue;
 		}
 
-		StampCircle(
+		FWorldFowMaskStamp Stamp;
+		Stamp.ChannelIndex = WorldFowMaskConstants::POIChannelIndex;
+		AddCircleToStamp(
 			FowComponent->GetPOIRevealOrigin(),
 			FowComponent->GetPOIRevealRadius(),
 			FowComponent->GetPOIRevealFalloff(),
-			WorldFowMaskConstants::POIChannelIndex
+			Stamp
 		);
+		OutStamps.Add(FObjectKey(PromotedWorldObject), MoveTemp(Stamp));
+	}
+}
+
+void AWorldFowManager::MarkChangedMaskStampsDirty(const TMap<FObjectKey, FWorldFowMaskStamp>& NewStamps)
+{
+	// Both the old and the new footprint of a changed stamp are dirty: the old one may have to fade back to black.
+	for (const TPair<FObjectKey, FWorldFowMaskStamp>& OldStamp : M_MaskStamps)
+	{
+		const FWorldFowMaskStamp* NewStamp = NewStamps.Find(OldStamp.Key);
+		if (NewStamp == nullptr || not (*NewStamp == OldStamp.Value))
+		{
+			M_DirtyMaskRects.Add(OldStamp.Value.PixelBounds);
+		}
+	}
+
+	for (const TPair<FObjectKey, FWorldFowMaskStamp>& NewStamp : NewStamps)
+	{
+		const FWorldFowMaskStamp* OldStamp = M_MaskStamps.Find(NewStamp.Key);
+		if (OldStamp == nullptr || not (*OldStamp == NewStamp.Value))
+		{
+			M_DirtyMaskRects.Add(NewStamp.Value.PixelBounds);
+		}
+	}
+}
+
+void AWorldFowManager::MergeDirtyMaskRects()
+{
+	M_DirtyMaskRects.RemoveAll([](const FIntRect& DirtyRect)
+	{
+		return DirtyRect.Area() <= 0;
+	});
+
+	// Overlapping rectangles are merged so no pixel is rasterized or uploaded twice.
+	bool bMergedAny = true;
+	while (bMergedAny)
+	{
+		bMergedAny = false;
+		for (int32 RectIndex = 0; RectIndex < M_DirtyMaskRects.Num(); ++RectIndex)
+		{
+			for (int32 OtherIndex = M_DirtyMaskRects.Num() - 1; OtherIndex > RectIndex; --OtherIndex)
+			{
+				if (not M_DirtyMaskRects[RectIndex].Intersect(M_DirtyMaskRects[OtherIndex]))
+				{
+					continue;
+				}
+
+				M_DirtyMaskRects[RectIndex].Union(M_DirtyMaskRects[OtherIndex]);
+				M_DirtyMaskRects.RemoveAtSwap(OtherIndex);
+				bMergedAny = true;
+			}
+		}
+	}
+}
+
+void AWorldFowManager::RasterizeDirtyMaskRect(const FIntRect& DirtyRect)
+{
+	TArray<const FWorldFowMaskStamp*> OverlappingStamps;
+	for (const TPair<FObjectKey, FWorldFowMaskStamp>& Stamp : M_MaskStamps)
+	{
+		if (Stamp.Value.PixelBounds.Intersect(DirtyRect))
+		{
+			OverlappingStamps.Add(&Stamp.Value);
+		}
+	}
+
+	// Row bands never share pixels, so they can write the mask in parallel; the channel max makes the stamp order
+	// irrelevant and the result equal to rasterizing the whole mask.
+	const int32 NumBands = FMath::DivideAndRoundUp(DirtyRect.Height(), WorldFowMaskConstants::RasterizationRowsPerBand);
+	const EParallelForFlags ParallelForFlags =
+		DirtyRect.Area() >= WorldFowMaskConstants::MinimumPixelsForParallelRasterization
+			? EParallelForFlags::Unbalanced
+			: EParallelForFlags::ForceSingleThread;
+	ParallelFor(NumBands, [this, &DirtyRect, &OverlappingStamps](const int32 BandIndex)
+	{
+		const int32 BandMinY = DirtyRect.Min.Y + BandIndex * WorldFowMaskConstants::RasterizationRowsPerBand;
+		const FIntRect BandRect(
+			DirtyRect.Min.X,
+			BandMinY,
+			DirtyRect.Max.X,
+			FMath::Min(DirtyRect.Max.Y, BandMinY + WorldFowMaskConstants::RasterizationRowsPerBand)
+		);
+		for (int32 PixelY = BandRect.Min.Y; PixelY < BandRect.Max.Y; ++PixelY)
+		{
+			for (int32 PixelX = BandRect.Min.X; PixelX < BandRect.Max.X; ++PixelX)
+			{
+				M_MaskPixels[PixelY * M_MaskResolution + PixelX] = FColor::Black;
+			}
+		}
+
+		for (const FWorldFowMaskStamp* Stamp : OverlappingStamps)
+		{
+			if (Stamp->PixelBounds.Intersect(BandRect))
+			{
+				RasterizeStampInRect(*Stamp, BandRect);
+			}
+		}
+	}, ParallelForFlags);
+}
+
+void AWorldFowManager::RasterizeStampInRect(const FWorldFowMaskStamp& Stamp, const FIntRect& ClipRect)
+{
+	for (const FWorldFowMaskCircle& Circle : Stamp.Circles)
+	{
+		const int32 PixelRadius = Circle.PixelRadius;
+		const int32 HardPixelRadius = Circle.HardPixelRadius;
+		const int32 MinimumPixelX = FMath::Max(ClipRect.Min.X, Circle.CenterPixel.X - PixelRadius);
+		const int32 MaximumPixelX = FMath::Min(ClipRect.Max.X - 1, Circle.CenterPixel.X + PixelRadius);
+		const int32 MinimumPixelY = FMath::Max(ClipRect.Min.Y, Circle.CenterPixel.Y - PixelRadius);
+		const int32 MaximumPixelY = FMath::Min(ClipRect.Max.Y - 1, Circle.CenterPixel.Y + PixelRadius);
+
+		for (int32 PixelY = MinimumPixelY; PixelY <= MaximumPixelY; ++PixelY)
+		{
+			for (int32 PixelX = MinimumPixelX; PixelX <= MaximumPixelX; ++PixelX)
+			{
+				const float Distance = FVector2D::Distance(FVector2D(PixelX, PixelY), FVector2D(Circle.CenterPixel));
+				if (Distance > PixelRadius)
+				{
+					continue;
+				}
+
+				float FalloffAlpha = 1.f;
+				if (PixelRadius > HardPixelRadius)
+				{
+					FalloffAlpha = FMath::GetMappedRangeValueClamped(
+						FVector2D(HardPixelRadius, PixelRadius),
+						FVector2D(1.f, 0.f),
+						Distance
+					);
+				}
+
+				const uint8 PixelValue = static_cast<uint8>(FMath::RoundToInt(FalloffAlpha * 255.f));
+				FColor& Pixel = M_MaskPixels[PixelY * M_MaskResolution + PixelX];
+				WriteMaskPixelChannel(Pixel, Stamp.ChannelIndex, PixelValue);
+			}
+		}
 	}
 }
 
@@ -716,11 +897,15 @@ void AWorldFowManager::PushMaskToCloudMaterial()
 		return;
 	}
 
-	if (not IsValid(M_MaskTexture))
+	const bool bNeedsNewTexture = not IsValid(M_MaskTexture) || M_MaskTexture->GetSizeX() != M_MaskResolution
+		|| M_MaskTexture->GetSizeY() != M_MaskResolution;
+	if (not bNeedsNewTexture)
 	{
-		M_MaskTexture = UTexture2D::CreateTransient(M_MaskResolution, M_MaskResolution, PF_B8G8R8A8);
+		UploadDirtyMaskRects();
+		return;
 	}
 
+	M_MaskTexture = UTexture2D::CreateTransient(M_MaskResolution, M_MaskResolution, PF_B8G8R8A8);
 	if (not IsValid(M_MaskTexture))
 	{
 		return;
@@ -730,6 +915,7 @@ void AWorldFowManager::PushMaskToCloudMaterial()
 	FMemory::Memcpy(TextureData, M_MaskPixels.GetData(), M_MaskPixels.Num() * sizeof(FColor));
 	M_MaskTexture->GetPlatformData()->Mips[0].BulkData.Unlock();
 	M_MaskTexture->UpdateResource();
+	M_DirtyMaskRects.Reset();
 
 	UMeshComponent* CloudMeshComponent = M_WorldFowCloud->GetCloudMeshComponent();
 	if (not IsValid(CloudMeshComponent))
@@ -748,6 +934,18 @@ void AWorldFowManager::PushMaskToCloudMaterial()
 	DynamicMaterial->SetTextureParameterValue(M_WorldFowMaskParameterName, M_MaskTexture);
 }
 
+void AWorldFowManager::UploadDirtyMaskRects()
+{
+	if (M_DirtyMaskRects.IsEmpty())
+	{
+		return;
+	}
+
+	// The render thread owns the packed copy of the rects, so the mask may be rasterized again before the upload ran.
+	FRTSTextureRegionUpload::UploadPixelRects(*M_MaskTexture, 0, M_MaskPixels, M_MaskResolution, M_DirtyMaskRects);
+	M_DirtyMaskRects.Reset();
+}
+
 void AWorldFowManager::SetAnchorState(AAnchorPoint* AnchorPoint, const EWorldMapFowState NewState)
 {
 	if (not IsValid(AnchorPoint))
@@ -803,10 +1001,11 @@ void AWorldFowManager::SetConnectionState(AConnection* Connection, const EWorldM
 	FowComponent->SetCurrentFowState(NewState);
 }
 
-void AWorldFowManager::StampConnectionSegment(
+void AWorldFowManager::AddConnectionSegmentToStamp(
 	const AConnection* Connection,
 	const AAnchorPoint* StartAnchor,
-	const AAnchorPoint* EndAnchor)
+	const AAnchorPoint* EndAnchor,
+	FWorldFowMaskStamp& Stamp) const
 {
 	if (not IsValid(Connection) || not IsValid(StartAnchor))
 	{
@@ -814,75 +1013,61 @@ void AWorldFowManager::StampConnectionSegment(
 	}
 
 	const UWorldMapFowComponent* FowComponent = Connection->GetFowComponent();
-	const int32 ChannelIndex = GetMaskChannelForComponent(FowComponent);
-	if (ChannelIndex == WorldFowMaskConstants::NoMaskChannelIndex)
+	if (not IsValid(FowComponent))
 	{
 		return;
 	}
 
 	const FVector SegmentEnd = IsValid(EndAnchor) ? EndAnchor->GetActorLocation() : Connection->GetJunctionLocation();
-	StampLine(
+	AddLineToStamp(
 		StartAnchor->GetActorLocation(),
 		SegmentEnd,
 		FowComponent->GetConnectionCorridorWidthForCurrentState(),
 		FowComponent->GetRevealFalloffForCurrentState(),
-		ChannelIndex
+		Stamp
 	);
 }
 
-void AWorldFowManager::StampCircle(
+void AWorldFowManager::AddCircleToStamp(
 	const FVector& WorldLocation,
 	const float Radius,
 	const float Falloff,
-	const int32 ChannelIndex)
+	FWorldFowMaskStamp& Stamp) const
 {
-	const FIntPoint CenterPixel = WorldToPixel(WorldLocation);
-	const int32 PixelRadius = GetPixelRadius(Radius + Falloff);
-	const int32 HardPixelRadius = GetPixelRadius(Radius);
-	const int32 MinimumPixelX = FMath::Max(0, CenterPixel.X - PixelRadius);
-	const int32 MaximumPixelX = FMath::Min(M_MaskResolution - 1, CenterPixel.X + PixelRadius);
-	const int32 MinimumPixelY = FMath::Max(0, CenterPixel.Y - PixelRadius);
-	const int32 MaximumPixelY = FMath::Min(M_MaskResolution - 1, CenterPixel.Y + PixelRadius);
-
-	for (int32 PixelY = MinimumPixelY; PixelY <= MaximumPixelY; ++PixelY)
+	FWorldFowMaskCircle Circle;
+	Circle.CenterPixel = WorldToPixel(WorldLocation);
+	Circle.PixelRadius = GetPixelRadius(Radius + Falloff);
+	Circle.HardPixelRadius = GetPixelRadius(Radius);
+
+	const FIntRect CircleBounds(
+		FMath::Max(0, Circle.CenterPixel.X - Circle.PixelRadius),
+		FMath::Max(0, Circle.CenterPixel.Y - Circle.PixelRadius),
+		FMath::Min(M_MaskResolution, Circle.CenterPixel.X + Circle.PixelRadius + 1),
+		FMath::Min(M_MaskResolution, Circle.CenterPixel.Y + Circle.PixelRadius + 1)
+	);
+	if (Stamp.Circles.IsEmpty())
 	{
-		for (int32 PixelX = MinimumPixelX; PixelX <= MaximumPixelX; ++PixelX)
-		{
-			const float Distance = FVector2D::Distance(FVector2D(PixelX, PixelY), FVector2D(CenterPixel));
-			if (Distance > PixelRadius)
-			{
-				continue;
-			}
-
-			float FalloffAlpha = 1.f;
-			if (PixelRadius > HardPixelRadius)
-			{
-				FalloffAlpha = FMath::GetMappedRangeValueClamped(
-					FVector2D(HardPixelRadius, PixelRadius),
-					FVector2D(1.f, 0.f),
-					Distance
-				);
-			}
-
-			const uint8 PixelValue = static_cast<uint8>(FMath::RoundToInt(FalloffAlpha * 255.f));
-			FColor& Pixel = M_MaskPixels[PixelY * M_MaskResolution + PixelX];
-			WriteMaskPixelChannel(Pixel, ChannelIndex, PixelValue);
-		}
+		Stamp.PixelBounds = CircleBounds;
+	}
+	else
+	{
+		Stamp.PixelBounds.Union(CircleBounds);
 	}
+	Stamp.Circles.Add(Circle);
 }
 
-void AWorldFowManager::StampLine(
+void AWorldFowManager::AddLineToStamp(
 	const FVector& Start,
 	const FVector& End,
 	const float Width,
 	const float Falloff,
-	const int32 ChannelIndex)
+	FWorldFowMaskStamp& Stamp) const
 {
 	const int32 LineRasterizationSampleCount = GetLineRasterizationSampleCount(Start, End);
 	for (int32 StepIndex = 0; StepIndex <= LineRasterizationSampleCount; ++StepIndex)
 	{
 		const float Alpha = static_cast<float>(StepIndex) / LineRasterizationSampleCount;
-		StampCircle(FMath::Lerp(Start, End, Alpha), Width, Falloff, ChannelIndex);
+		AddCircleToStamp(FMath::Lerp(Start, End, Alpha), Width, Falloff, Stamp);
 	}
 }
 
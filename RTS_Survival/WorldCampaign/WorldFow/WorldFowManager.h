@@ -17,6 +17,37 @@ class AWorldPlayerController;
 class UTexture2D;
 class UWorldMapFowComponent;
 
+/** @brief One rasterized disc of a mask stamp in mask pixel space. */
+struct FWorldFowMaskCircle
+{
+	FIntPoint CenterPixel = FIntPoint::ZeroValue;
+	int32 PixelRadius = 0;
+	int32 HardPixelRadius = 0;
+
+	bool operator==(const FWorldFowMaskCircle& Other) const
+	{
+		return CenterPixel == Other.CenterPixel && PixelRadius == Other.PixelRadius
+			&& HardPixelRadius == Other.HardPixelRadius;
+	}
+};
+
+/**
+ * @brief Everything one anchor, connection or world object writes into the mask; lines are stored as their sampled
+ * discs. Compared between updates so only elements whose stamp changed dirty the mask.
+ */
+struct FWorldFowMaskStamp
+{
+	int32 ChannelIndex = INDEX_NONE;
+	TArray<FWorldFowMaskCircle> Circles;
+	// Max is exclusive; clamped to the mask.
+	FIntRect PixelBounds = FIntRect(0, 0, 0, 0);
+
+	bool operator==(const FWorldFowMaskStamp& Other) const
+	{
+		return ChannelIndex == Other.ChannelIndex && Circles == Other.Circles;
+	}
+};
+
 /**
  * @brief Spawned by the world player controller after campaign generation to calculate actor FOW states and the cloud mask.
  */
@@ -96,17 +127,29 @@ private:
 	void ApplyRevealRulesFromVisibleAnchors();
 	void ApplyWorldObjectStates();
 	void ApplyConnectionStates();
+	/**
+	 * @brief Collects the stamps of the current states and re-rasterizes only the mask rectangles touched by stamps
+	 * that were added, removed or changed since the last rebuild.
+	 */
 	void RebuildMaskTexture();
-	void StampAnchorsToMask();
-	void StampConnectionsToMask();
-	void StampWorldObjectsToMask();
+	void CollectAnchorMaskStamps(TMap<FObjectKey, FWorldFowMaskStamp>& OutStamps) const;
+	void CollectConnectionMaskStamps(TMap<FObjectKey, FWorldFowMaskStamp>& OutStamps) const;
+	void CollectWorldObjectMaskStamps(TMap<FObjectKey, FWorldFowMaskStamp>& OutStamps) const;
+	void MarkChangedMaskStampsDirty(const TMap<FObjectKey, FWorldFowMaskStamp>& NewStamps);
+	void MergeDirtyMaskRects();
+	void RasterizeDirtyMaskRect(const FIntRect& DirtyRect);
+	void RasterizeStampInRect(const FWorldFowMaskStamp& Stamp, const FIntRect& ClipRect);
+	/** @brief Uploads the dirty rectangles, or the whole mask when the texture is (re)created. */
 	void PushMaskToCloudMaterial();
+	void UploadDirtyMaskRects();
 	void SetAnchorState(AAnchorPoint* AnchorPoint, EWorldMapFowState NewState);
 	void SetObjectState(AWorldMapObject* WorldMapObject, EWorldMapFowState NewState);
 	void SetConnectionState(AConnection* Connection, EWorldMapFowState NewState);
-	void StampConnectionSegment(const AConnection* Connection, const AAnchorPoint* StartAnchor, const AAnchorPoint* EndAnchor);
-	void StampCircle(const FVector& WorldLocation, float Radius, float Falloff, int32 ChannelIndex);
-	void StampLine(const FVector& Start, const FVector& End, float Width, float Falloff, int32 ChannelIndex);
+	void AddConnectionSegmentToStamp(const AConnection* Connection, const AAnchorPoint* StartAnchor,
+	                                 const AAnchorPoint* EndAnchor, FWorldFowMaskStamp& Stamp) const;
+	void AddCircleToStamp(const FVector& WorldLocation, float Radius, float Falloff, FWorldFowMaskStamp& Stamp) const;
+	void AddLineToStamp(const FVector& Start, const FVector& End, float Width, float Falloff,
+	                    FWorldFowMaskStamp& Stamp) const;
 	int32 GetLineRasterizationSampleCount(const FVector& Start, const FVector& End) const;
 	void WriteMaskPixelChannel(FColor& Pixel, int32 ChannelIndex, uint8 Value) const;
 	int32 GetMaskChannelForComponent(const UWorldMapFowComponent* FowComponent) const;
@@ -129,6 +172,10 @@ private:
 	TObjectPtr<UTexture2D> M_MaskTexture = nullptr;
 
 	TArray<FColor> M_MaskPixels;
+	// Stamps the mask pixels were last rasterized from, keyed by the stamping actor.
+	TMap<FObjectKey, FWorldFowMaskStamp> M_MaskStamps;
+	// Mask rectangles rasterized since the last upload.
+	TArray<FIntRect> M_DirtyMaskRects;
 	TMap<TObjectKey<const AAnchorPoint>, EWorldMapFowState> M_AnchorStates;
 
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "World Campaign|FOW", meta = (AllowPrivateAccess = "true"))
@@ -0,0 +1,31 @@
+// Copyright (C) Bas Blokzijl - All rights reserved.
+
+using UnrealBuildTool;
+using System.Collections.Generic;
+
+/**
+ * Separate shipping target that measures game performance with scripted mass battles.
+ *
+ * Benchmark-only code is compiled behind RTS_WITH_PERF_BENCHMARK_SHIPPING_TESTS. The definition is absent from
+ * every regular game, editor, and shipping target, so the harness and its latency hooks are removed by the
+ * preprocessor outside this target. Runs headless under -nullrhi, including on Linux.
+ */
+public class RTS_SurvivalShippingPerfBenchmarksTarget : TargetRules
+{
+	public RTS_SurvivalShippingPerfBenchmarksTarget(TargetInfo Target) : base(Target)
+	{
+		Type = TargetType.Game;
+		DefaultBuildSettings = BuildSettingsVersion.V4;
+		IncludeOrderVersion = EngineIncludeOrderVersion.Latest;
+		ExtraModuleNames.AddRange(new string[] { "RTS_Survival" });
+
+		GlobalDefinitions.Add("RTS_WITH_PERF_BENCHMARK_SHIPPING_TESTS=1");
+		BuildEnvironment = TargetBuildEnvironment.Unique;
+
+		if (Configuration == UnrealTargetConfiguration.Shipping)
+		{
+			bUseChecksInShipping = false;
+			bUseLoggingInShipping = true;
+		}
+	}
+}